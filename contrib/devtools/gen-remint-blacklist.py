@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+'''
+Script to generate the Zerocoin to Sigma remint blacklist table.
+
+The input is a JSON array of blacklisted public coin values as hex strings
+(src/test/data/remint_blacklist.json). Each value is reduced to the double
+SHA256 of its big endian magnitude (the bytes returned by CBigNum::ToBytes())
+and the digests are written sorted, so that the node can look a value up with
+a binary search instead of parsing every entry into a CBigNum.
+
+Usage:
+
+    contrib/devtools/gen-remint-blacklist.py src/test/data/remint_blacklist.json > src/sigma/remint-blacklist.cpp
+'''
+
+from hashlib import sha256
+import json
+import sys
+
+def hash256(data):
+    return sha256(sha256(data).digest()).digest()
+
+def value_digest(hex_value):
+    value = int(hex_value, 16)
+    return hash256(value.to_bytes((value.bit_length() + 7) // 8, 'big'))
+
+def main():
+    if len(sys.argv) != 2:
+        print(('Usage: %s <remint_blacklist.json>' % sys.argv[0]), file=sys.stderr)
+        sys.exit(1)
+
+    with open(sys.argv[1], 'r') as f:
+        values = json.load(f)
+
+    digests = sorted(set(value_digest(v) for v in values))
+    if len(digests) != len(values):
+        print('Duplicate entries in %s' % sys.argv[1], file=sys.stderr)
+        sys.exit(1)
+
+    g = sys.stdout
+    g.write('/**\n')
+    g.write(' * Blacklisted public coin values for Zerocoin to Sigma remint\n')
+    g.write(' * AUTOGENERATED by contrib/devtools/gen-remint-blacklist.py\n')
+    g.write(' *\n')
+    g.write(' * Each line contains the double SHA256 of a value\'s big endian magnitude.\n')
+    g.write(' * Lines are sorted so the table can be binary searched.\n')
+    g.write(' */\n')
+    g.write('#include <cstddef>\n')
+    g.write('\n')
+    g.write('extern const unsigned char sigmaRemintBlacklist[][32];\n')
+    g.write('extern const size_t sigmaRemintBlacklistSize;\n')
+    g.write('\n')
+    g.write('const unsigned char sigmaRemintBlacklist[][32] = {\n')
+    for digest in digests:
+        g.write('    {%s},\n' % ','.join('0x%02x' % b for b in digest))
+    g.write('};\n')
+    g.write('\n')
+    g.write('const size_t sigmaRemintBlacklistSize = sizeof(sigmaRemintBlacklist) / sizeof(sigmaRemintBlacklist[0]);\n')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,81 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "policy/fees.h"
+#include "script/script.h"
+#include "txmempool.h"
+
+#include <vector>
+
+namespace {
+
+struct ReplayBlock
+{
+    //! Transactions entering the mempool at this height
+    std::vector<CTxMemPoolEntry> entered;
+    //! Transactions confirmed by the block at this height
+    std::vector<CTxMemPoolEntry> confirmed;
+};
+
+// A thousand blocks of twenty transactions each, a quarter of them Sigma spends. Transactions
+// paying more are confirmed sooner, the cheapest wait up to six blocks.
+std::vector<ReplayBlock> MakeHistory()
+{
+    static const unsigned int BLOCKS = 1000;
+    static const int TXS_PER_BLOCK = 20;
+
+    std::vector<ReplayBlock> history(BLOCKS + 7);
+    uint32_t nRand = 1;
+    for (unsigned int nHeight = 1; nHeight <= BLOCKS; nHeight++) {
+        for (int i = 0; i < TXS_PER_BLOCK; i++) {
+            nRand = nRand * 1103515245 + 12345;
+            bool fSigma = i % 4 == 0;
+
+            CMutableTransaction tx;
+            tx.vin.resize(1);
+            tx.vin[0].prevout = COutPoint(fSigma ? uint256() : uint256S(std::to_string(nRand)), 1 + i);
+            if (fSigma)
+                tx.vin[0].scriptSig = CScript() << OP_SIGMASPEND << std::vector<unsigned char>(1500, 0);
+            tx.vout.resize(1);
+            tx.vout[0].nValue = nHeight;
+
+            int nDelay = 1 + (nRand >> 16) % 6;
+            CAmount nFee = (fSigma ? 20000 : 2000) * (7 - nDelay);
+            CTxMemPoolEntry entry(tx, nFee, 0, 0, nHeight, true, 0, false, 4, LockPoints());
+            history[nHeight].entered.push_back(entry);
+            history[nHeight + nDelay].confirmed.push_back(entry);
+        }
+    }
+    return history;
+}
+
+} // namespace
+
+// Replay of a block history through the fee estimator, followed by per class estimates
+static void FeeEstimatorReplay(benchmark::State& state)
+{
+    static const std::vector<ReplayBlock> history = MakeHistory();
+    CTxMemPool pool(CFeeRate(1000));
+
+    while (state.KeepRunning()) {
+        CBlockPolicyEstimator estimator(CFeeRate(1000));
+        for (unsigned int nHeight = 1; nHeight < history.size(); nHeight++) {
+            std::vector<CTxMemPoolEntry> confirmed = history[nHeight].confirmed;
+            for (const CTxMemPoolEntry& entry : confirmed)
+                estimator.removeTx(entry.GetTx().GetHash());
+            estimator.processBlock(nHeight, confirmed, true);
+            for (const CTxMemPoolEntry& entry : history[nHeight].entered)
+                estimator.processTransaction(entry, true);
+        }
+        int answerFound;
+        for (int nTarget = 1; nTarget <= 10; nTarget++) {
+            estimator.estimateSmartFee(nTarget, &answerFound, pool);
+            estimator.estimateSmartFee(nTarget, &answerFound, pool, FeeEstimateClass::SIGMA);
+        }
+    }
+}
+
+BENCHMARK(FeeEstimatorReplay);
@@ -0,0 +1,59 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "hash.h"
+#include "primitives/block.h"
+#include "utilstrencodings.h"
+
+#include <vector>
+
+/* One header per possible first X16Rv2 stage, since only that stage benefits from the midstate */
+static std::vector<CBlockHeader> PowHeaders()
+{
+    std::vector<CBlockHeader> headers(16);
+    uint32_t n = 0;
+    for (int sel = 0; sel < 16; sel++) {
+        CBlockHeader& header = headers[sel];
+        do {
+            n++;
+            header.hashPrevBlock = Hash(BEGIN(n), END(n));
+        } while (header.hashPrevBlock.GetNibble(48) != sel);
+        header.hashMerkleRoot = Hash(BEGIN(sel), END(sel));
+        header.nTime = 1500000000;
+        header.nBits = 0x1e0ffff0;
+    }
+    return headers;
+}
+
+static void X16RV2_Header(benchmark::State& state)
+{
+    std::vector<CBlockHeader> headers = PowHeaders();
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < headers.size(); i++) {
+            for (int j = 0; j < 64; j++) {
+                headers[i].nNonce++;
+                headers[i].GetPoWHash();
+            }
+        }
+    }
+}
+
+static void X16RV2_Midstate(benchmark::State& state)
+{
+    std::vector<CBlockHeader> headers = PowHeaders();
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < headers.size(); i++) {
+            CBlockHeaderPoWHasher hasher(headers[i]);
+            for (int j = 0; j < 64; j++) {
+                headers[i].nNonce++;
+                hasher.GetPoWHash(headers[i].nNonce);
+            }
+        }
+    }
+}
+
+BENCHMARK(X16RV2_Header);
+BENCHMARK(X16RV2_Midstate);
@@ -0,0 +1,64 @@
+#include "bench.h"
+
+#include "hash.h"
+#include "rpc/server.h"
+#include "util.h"
+#include "utilstrencodings.h"
+#include "utiltime.h"
+
+#include <univalue.h>
+
+// Stands in for an index lookup such as getrawtransaction or getaddressdeltas,
+// which mostly waits for a disk read and then does a bit of work on the result
+static UniValue benchlookup(const UniValue& params, bool fHelp)
+{
+    MilliSleep(1);
+    uint256 hash;
+    for (int i = 0; i < 100; i++)
+        hash = Hash(hash.begin(), hash.end());
+    return hash.GetHex();
+}
+
+static const CRPCCommand benchLookupCommand = { "hidden", "benchlookup", &benchlookup, true };
+
+static void RPCBatch(benchmark::State& state, int nConcurrency)
+{
+    static bool fRegistered = false;
+    if (!fRegistered) {
+        tableRPC.appendCommand(benchLookupCommand.name, &benchLookupCommand);
+        tableRPC.setReadOnly(benchLookupCommand.name);
+        SetRPCWarmupFinished();
+        fRegistered = true;
+    }
+    mapArgs["-rpcbatchconcurrency"] = itostr(nConcurrency);
+    StartRPC();
+
+    UniValue batch(UniValue::VARR);
+    for (int i = 0; i < 200; i++) {
+        UniValue req(UniValue::VOBJ);
+        req.push_back(Pair("method", "benchlookup"));
+        req.push_back(Pair("params", UniValue(UniValue::VARR)));
+        req.push_back(Pair("id", i));
+        batch.push_back(req);
+    }
+
+    while (state.KeepRunning())
+        JSONRPCExecBatch(batch);
+
+    InterruptRPC();
+    StopRPC();
+    mapArgs.erase("-rpcbatchconcurrency");
+}
+
+static void RPCBatch_Serial(benchmark::State& state)
+{
+    RPCBatch(state, 1);
+}
+
+static void RPCBatch_Parallel(benchmark::State& state)
+{
+    RPCBatch(state, DEFAULT_RPC_BATCH_CONCURRENCY);
+}
+
+BENCHMARK(RPCBatch_Serial);
+BENCHMARK(RPCBatch_Parallel);
@@ -0,0 +1,37 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "wallet/wallet.h"
+
+#include <cassert>
+#include <list>
+#include <vector>
+
+// Coin selection for a large spend from a wallet with thousands of coins of every denomination
+static void SigmaSelectSpendCoins(benchmark::State& state)
+{
+    std::vector<sigma::CoinDenomination> denominations;
+    sigma::GetAllDenoms(denominations);
+
+    std::list<CSigmaEntry> coins;
+    for (auto denomination : denominations) {
+        for (int i = 0; i < 1000; i++) {
+            CSigmaEntry coin;
+            coin.set_denomination(denomination);
+            coin.nHeight = i;
+            coins.push_back(coin);
+        }
+    }
+
+    while (state.KeepRunning()) {
+        std::vector<CSigmaEntry> coinsToSpend;
+        std::vector<sigma::CoinDenomination> coinsToMint;
+        CWallet::SelectSpendCoinsAndChange(987 * COIN + 35 * CENT, coins, SIZE_MAX, MAX_MONEY, coinsToSpend, coinsToMint);
+        assert(!coinsToSpend.empty());
+    }
+}
+
+BENCHMARK(SigmaSelectSpendCoins);
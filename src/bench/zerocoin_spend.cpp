@@ -0,0 +1,66 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "taskpool.h"
+#include "zerocoin.h"
+#include "libzerocoin/Zerocoin.h"
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+
+namespace {
+
+struct SpendFixture {
+    libzerocoin::Accumulator accumulator;
+    libzerocoin::SpendMetaData metaData;
+    std::unique_ptr<libzerocoin::CoinSpend> spend;
+
+    SpendFixture() : accumulator(ZCParamsV2), metaData(0, uint256())
+    {
+        for (int i = 0; i < 5; i++)
+            accumulator += libzerocoin::PrivateCoin(ZCParamsV2, libzerocoin::ZQ_LOVELACE, ZEROCOIN_TX_VERSION_2).getPublicCoin();
+        libzerocoin::PrivateCoin coin(ZCParamsV2, libzerocoin::ZQ_LOVELACE, ZEROCOIN_TX_VERSION_2);
+        libzerocoin::AccumulatorWitness witness(ZCParamsV2, accumulator, coin.getPublicCoin());
+        accumulator += coin.getPublicCoin();
+        spend.reset(new libzerocoin::CoinSpend(ZCParamsV2, coin, accumulator, witness, metaData));
+        assert(spend->Verify(accumulator, metaData));
+    }
+};
+
+const SpendFixture& GetSpend()
+{
+    // Creating the spend takes far longer than verifying it, do it once
+    static SpendFixture fixture;
+    return fixture;
+}
+
+}
+
+// Proofs inside a spend are checked in parallel on the shared pool
+static void ZerocoinSpendVerify(benchmark::State& state)
+{
+    const SpendFixture& fixture = GetSpend();
+    while (state.KeepRunning())
+        assert(fixture.spend->Verify(fixture.accumulator, fixture.metaData));
+}
+
+// Several spends of one block verified concurrently, sharing the pool with their own inner loops
+static void ZerocoinSpendVerifyBlock(benchmark::State& state)
+{
+    const SpendFixture& fixture = GetSpend();
+    while (state.KeepRunning()) {
+        std::atomic<int> nValid(0);
+        ParallelFor(0, 4, [&](size_t) {
+            if (fixture.spend->Verify(fixture.accumulator, fixture.metaData))
+                nValid++;
+        });
+        assert(nValid == 4);
+    }
+}
+
+BENCHMARK(ZerocoinSpendVerify);
+BENCHMARK(ZerocoinSpendVerifyBlock);
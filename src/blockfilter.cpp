@@ -0,0 +1,311 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockfilter.h"
+
+#include "hash.h"
+#include "primitives/block.h"
+#include "script/script.h"
+#include "streams.h"
+#include "undo.h"
+#include "version.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+/// Parameters of the basic filter type (BIP 158)
+static const uint8_t BASIC_FILTER_P = 19;
+static const uint32_t BASIC_FILTER_M = 784931;
+
+namespace {
+
+/** Writes bits most significant first, as Golomb-Rice codes are laid out. */
+class BitWriter
+{
+private:
+    std::vector<unsigned char>& vch;
+    unsigned char nBuffer;
+    int nBits; //!< Number of bits in nBuffer
+
+public:
+    explicit BitWriter(std::vector<unsigned char>& vchIn) : vch(vchIn), nBuffer(0), nBits(0) {}
+
+    void Write(uint64_t nData, int nCount)
+    {
+        while (nCount > 0) {
+            int nTake = std::min(8 - nBits, nCount);
+            nBuffer |= ((nData >> (nCount - nTake)) & ((1u << nTake) - 1)) << (8 - nBits - nTake);
+            nBits += nTake;
+            nCount -= nTake;
+            if (nBits == 8)
+                Flush();
+        }
+    }
+
+    //! Write out a partial byte, padded with zero bits
+    void Flush()
+    {
+        if (nBits == 0)
+            return;
+        vch.push_back(nBuffer);
+        nBuffer = 0;
+        nBits = 0;
+    }
+};
+
+class BitReader
+{
+private:
+    const std::vector<unsigned char>& vch;
+    size_t nPos;
+    unsigned char nBuffer;
+    int nBits; //!< Number of unread bits in nBuffer
+
+public:
+    BitReader(const std::vector<unsigned char>& vchIn, size_t nPosIn) : vch(vchIn), nPos(nPosIn), nBuffer(0), nBits(0) {}
+
+    //! Number of bytes consumed so far, a partially read one included
+    size_t GetPos() const { return nPos; }
+
+    uint64_t Read(int nCount)
+    {
+        uint64_t nData = 0;
+        while (nCount > 0) {
+            if (nBits == 0) {
+                if (nPos >= vch.size())
+                    throw std::ios_base::failure("BitReader::Read(): end of data");
+                nBuffer = vch[nPos++];
+                nBits = 8;
+            }
+            int nTake = std::min(nBits, nCount);
+            nData = (nData << nTake) | ((nBuffer >> (nBits - nTake)) & ((1u << nTake) - 1));
+            nBits -= nTake;
+            nCount -= nTake;
+        }
+        return nData;
+    }
+};
+
+void GolombRiceEncode(BitWriter& writer, uint8_t nP, uint64_t nValue)
+{
+    // Quotient in unary, a run of ones closed by a zero
+    uint64_t nQuotient = nValue >> nP;
+    while (nQuotient > 0) {
+        int nCount = std::min<uint64_t>(nQuotient, 64);
+        writer.Write(~0ULL, nCount);
+        nQuotient -= nCount;
+    }
+    writer.Write(0, 1);
+    writer.Write(nValue, nP);
+}
+
+uint64_t GolombRiceDecode(BitReader& reader, uint8_t nP)
+{
+    uint64_t nQuotient = 0;
+    while (reader.Read(1) == 1)
+        nQuotient++;
+    return (nQuotient << nP) + reader.Read(nP);
+}
+
+/** Map a uniform 64 bit hash to [0, n) without a division, as (x * n) >> 64. */
+uint64_t MapIntoRange(uint64_t x, uint64_t n)
+{
+#ifdef __SIZEOF_INT128__
+    return (static_cast<unsigned __int128>(x) * static_cast<unsigned __int128>(n)) >> 64;
+#else
+    uint64_t nXHi = x >> 32, nXLo = x & 0xFFFFFFFF;
+    uint64_t nNHi = n >> 32, nNLo = n & 0xFFFFFFFF;
+    uint64_t nHiHi = nXHi * nNHi;
+    uint64_t nHiLo = nXHi * nNLo;
+    uint64_t nLoHi = nXLo * nNHi;
+    uint64_t nLoLo = nXLo * nNLo;
+    uint64_t nMid = (nLoLo >> 32) + (nHiLo & 0xFFFFFFFF) + (nLoHi & 0xFFFFFFFF);
+    return nHiHi + (nHiLo >> 32) + (nLoHi >> 32) + (nMid >> 32);
+#endif
+}
+
+} // anon namespace
+
+GCSFilter::GCSFilter(const Params& paramsIn) : params(paramsIn), nElements(0), nRange(0)
+{
+    vEncoded.push_back(0); // CompactSize of zero elements
+}
+
+GCSFilter::GCSFilter(const Params& paramsIn, std::vector<unsigned char> vEncodedIn)
+    : params(paramsIn), vEncoded(std::move(vEncodedIn))
+{
+    CDataStream stream(vEncoded, SER_NETWORK, PROTOCOL_VERSION);
+    uint64_t n = ReadCompactSize(stream);
+    nElements = n;
+    if (nElements != n)
+        throw std::ios_base::failure("N must be less than 2^32");
+    nRange = uint64_t(nElements) * params.nM;
+
+    // Decode every delta once, so truncated or padded encodings are refused here rather than while matching
+    BitReader reader(vEncoded, vEncoded.size() - stream.size());
+    for (uint32_t i = 0; i < nElements; i++)
+        GolombRiceDecode(reader, params.nP);
+    if (reader.GetPos() != vEncoded.size())
+        throw std::ios_base::failure("GCSFilter(): encoded filter contains excess data");
+}
+
+GCSFilter::GCSFilter(const Params& paramsIn, const ElementSet& elements) : params(paramsIn)
+{
+    if (elements.size() > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("N must be less than 2^32");
+    nElements = elements.size();
+    nRange = uint64_t(nElements) * params.nM;
+
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    WriteCompactSize(stream, nElements);
+    vEncoded.assign(stream.begin(), stream.end());
+
+    BitWriter writer(vEncoded);
+    uint64_t nLast = 0;
+    for (uint64_t nValue : BuildHashedSet(elements)) {
+        GolombRiceEncode(writer, params.nP, nValue - nLast);
+        nLast = nValue;
+    }
+    writer.Flush();
+}
+
+uint64_t GCSFilter::HashToRange(const Element& element) const
+{
+    uint64_t nHash = CSipHasher(params.nSipHashK0, params.nSipHashK1)
+        .Write(element.data(), element.size())
+        .Finalize();
+    return MapIntoRange(nHash, nRange);
+}
+
+std::vector<uint64_t> GCSFilter::BuildHashedSet(const ElementSet& elements) const
+{
+    std::vector<uint64_t> vHashed;
+    vHashed.reserve(elements.size());
+    for (const Element& element : elements)
+        vHashed.push_back(HashToRange(element));
+    std::sort(vHashed.begin(), vHashed.end());
+    return vHashed;
+}
+
+bool GCSFilter::MatchInternal(const uint64_t* pQuery, size_t nQuery) const
+{
+    CDataStream stream(vEncoded, SER_NETWORK, PROTOCOL_VERSION);
+    ReadCompactSize(stream);
+    BitReader reader(vEncoded, vEncoded.size() - stream.size());
+
+    // Both sides are sorted, so walk them together
+    uint64_t nValue = 0;
+    size_t nQueryPos = 0;
+    for (uint32_t i = 0; i < nElements; i++) {
+        nValue += GolombRiceDecode(reader, params.nP);
+        while (true) {
+            if (nQueryPos == nQuery)
+                return false;
+            if (pQuery[nQueryPos] == nValue)
+                return true;
+            if (pQuery[nQueryPos] > nValue)
+                break;
+            nQueryPos++;
+        }
+    }
+    return false;
+}
+
+bool GCSFilter::Match(const Element& element) const
+{
+    uint64_t nQuery = HashToRange(element);
+    return MatchInternal(&nQuery, 1);
+}
+
+bool GCSFilter::MatchAny(const ElementSet& elements) const
+{
+    const std::vector<uint64_t> vQuery = BuildHashedSet(elements);
+    return MatchInternal(vQuery.data(), vQuery.size());
+}
+
+const std::string& BlockFilterTypeName(BlockFilterType filterType)
+{
+    static const std::string strBasic = "basic";
+    static const std::string strUnknown;
+    return filterType == BLOCK_FILTER_BASIC ? strBasic : strUnknown;
+}
+
+bool BlockFilterTypeByName(const std::string& strName, BlockFilterType& filterType)
+{
+    if (strName == BlockFilterTypeName(BLOCK_FILTER_BASIC)) {
+        filterType = BLOCK_FILTER_BASIC;
+        return true;
+    }
+    return false;
+}
+
+GCSFilter::ElementSet BasicFilterElements(const CBlock& block, const CBlockUndo& blockUndo)
+{
+    GCSFilter::ElementSet elements;
+
+    for (const CTransactionRef& ptx : block.vtx) {
+        for (const CTxOut& txout : ptx->vout) {
+            const CScript& script = txout.scriptPubKey;
+            if (script.empty() || script[0] == OP_RETURN)
+                continue;
+            elements.emplace(script.begin(), script.end());
+        }
+    }
+
+    for (const CTxUndo& txUndo : blockUndo.vtxundo) {
+        for (const CTxInUndo& txInUndo : txUndo.vprevout) {
+            const CScript& script = txInUndo.txout.scriptPubKey;
+            if (script.empty())
+                continue;
+            elements.emplace(script.begin(), script.end());
+        }
+    }
+
+    return elements;
+}
+
+BlockFilter::BlockFilter(BlockFilterType filterTypeIn, const uint256& blockHashIn, std::vector<unsigned char> vFilter)
+    : filterType(filterTypeIn), blockHash(blockHashIn)
+{
+    GCSFilter::Params params;
+    if (!BuildParams(params))
+        throw std::invalid_argument("unknown filter type");
+    filter = GCSFilter(params, std::move(vFilter));
+}
+
+BlockFilter::BlockFilter(BlockFilterType filterTypeIn, const CBlock& block, const CBlockUndo& blockUndo)
+    : filterType(filterTypeIn), blockHash(block.GetHash())
+{
+    GCSFilter::Params params;
+    if (!BuildParams(params))
+        throw std::invalid_argument("unknown filter type");
+    filter = GCSFilter(params, BasicFilterElements(block, blockUndo));
+}
+
+bool BlockFilter::BuildParams(GCSFilter::Params& params) const
+{
+    switch (filterType) {
+    case BLOCK_FILTER_BASIC:
+        params.nSipHashK0 = blockHash.GetUint64(0);
+        params.nSipHashK1 = blockHash.GetUint64(1);
+        params.nP = BASIC_FILTER_P;
+        params.nM = BASIC_FILTER_M;
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint256 BlockFilter::GetHash() const
+{
+    const std::vector<unsigned char>& vData = GetEncodedFilter();
+    return Hash(vData.begin(), vData.end());
+}
+
+uint256 BlockFilter::ComputeHeader(const uint256& prevHeader) const
+{
+    const uint256 filterHash = GetHash();
+    return Hash(filterHash.begin(), filterHash.end(), prevHeader.begin(), prevHeader.end());
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_BLOCKFILTER_H
+#define BITCOIN_BLOCKFILTER_H
+
+#include "serialize.h"
+#include "uint256.h"
+
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+class CBlock;
+class CBlockUndo;
+
+/**
+ * Golomb-coded set (BIP 158): a compact probabilistic set of byte strings
+ * with a false positive rate of 1/M. Elements are hashed with SipHash to a
+ * number in [0, N * M), the sorted numbers are delta encoded and the deltas
+ * written with Golomb-Rice coding of parameter P.
+ */
+class GCSFilter
+{
+public:
+    typedef std::vector<unsigned char> Element;
+    typedef std::set<Element> ElementSet;
+
+    struct Params
+    {
+        uint64_t nSipHashK0;
+        uint64_t nSipHashK1;
+        uint8_t nP; //!< Golomb-Rice coding parameter
+        uint32_t nM; //!< Inverse false positive rate
+
+        Params(uint64_t nSipHashK0In = 0, uint64_t nSipHashK1In = 0, uint8_t nPIn = 0, uint32_t nMIn = 1)
+            : nSipHashK0(nSipHashK0In), nSipHashK1(nSipHashK1In), nP(nPIn), nM(nMIn) {}
+    };
+
+private:
+    Params params;
+    uint32_t nElements;
+    uint64_t nRange; //!< nElements * nM
+    std::vector<unsigned char> vEncoded;
+
+    uint64_t HashToRange(const Element& element) const;
+    std::vector<uint64_t> BuildHashedSet(const ElementSet& elements) const;
+
+    /** Whether any of the sorted hashed query elements is in the set. */
+    bool MatchInternal(const uint64_t* pQuery, size_t nQuery) const;
+
+public:
+    explicit GCSFilter(const Params& paramsIn = Params());
+
+    /** Reconstruct a filter from its encoding; throws std::ios_base::failure if it is malformed. */
+    GCSFilter(const Params& paramsIn, std::vector<unsigned char> vEncodedIn);
+
+    GCSFilter(const Params& paramsIn, const ElementSet& elements);
+
+    uint32_t GetN() const { return nElements; }
+    const Params& GetParams() const { return params; }
+    const std::vector<unsigned char>& GetEncoded() const { return vEncoded; }
+
+    /** Whether the element may be in the set. False positives happen at a rate of 1/M. */
+    bool Match(const Element& element) const;
+
+    /** Whether any of the elements may be in the set, in one pass over the filter. */
+    bool MatchAny(const ElementSet& elements) const;
+};
+
+enum BlockFilterType : uint8_t
+{
+    BLOCK_FILTER_BASIC = 0,
+    BLOCK_FILTER_INVALID = 255,
+};
+
+/** Name of a filter type as used by RPC, or an empty string if it is unknown. */
+const std::string& BlockFilterTypeName(BlockFilterType filterType);
+
+/** Look up a filter type by its name; returns false if there is none. */
+bool BlockFilterTypeByName(const std::string& strName, BlockFilterType& filterType);
+
+/**
+ * Elements of the basic filter of a block: every output script, Sigma mint
+ * scripts included, except empty and OP_RETURN ones, and every script spent
+ * by an input. Sigma and Zerocoin spends have no spent script, their coins are
+ * found through the mint scripts.
+ */
+GCSFilter::ElementSet BasicFilterElements(const CBlock& block, const CBlockUndo& blockUndo);
+
+/**
+ * Compact filter of a block (BIP 157) along with the hash of the block it
+ * belongs to, which also keys the filter's SipHash.
+ */
+class BlockFilter
+{
+private:
+    BlockFilterType filterType;
+    uint256 blockHash;
+    GCSFilter filter;
+
+    bool BuildParams(GCSFilter::Params& params) const;
+
+public:
+    BlockFilter() : filterType(BLOCK_FILTER_INVALID) {}
+
+    //! Reconstruct a filter from its encoding; throws std::invalid_argument on an unknown type
+    BlockFilter(BlockFilterType filterTypeIn, const uint256& blockHashIn, std::vector<unsigned char> vFilter);
+
+    BlockFilter(BlockFilterType filterTypeIn, const CBlock& block, const CBlockUndo& blockUndo);
+
+    BlockFilterType GetFilterType() const { return filterType; }
+    const uint256& GetBlockHash() const { return blockHash; }
+    const GCSFilter& GetFilter() const { return filter; }
+    const std::vector<unsigned char>& GetEncodedFilter() const { return filter.GetEncoded(); }
+
+    uint256 GetHash() const;
+
+    /** Filter header: the hash of this filter chained to the previous block's filter header. */
+    uint256 ComputeHeader(const uint256& prevHeader) const;
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion) {
+        uint8_t nFilterType = filterType;
+        std::vector<unsigned char> vFilter;
+        if (!ser_action.ForRead())
+            vFilter = filter.GetEncoded();
+        READWRITE(nFilterType);
+        READWRITE(blockHash);
+        READWRITE(vFilter);
+        if (ser_action.ForRead())
+            *this = BlockFilter(BlockFilterType(nFilterType), blockHash, std::move(vFilter));
+    }
+};
+
+#endif // BITCOIN_BLOCKFILTER_H
@@ -0,0 +1,236 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockfilterindex.h"
+
+#include "chain.h"
+#include "chainparams.h"
+#include "main.h"
+#include "undo.h"
+#include "util.h"
+
+#include <boost/thread/thread.hpp>
+
+static const char DB_FILTER = 'f';
+static const char DB_BEST_BLOCK = 'B';
+
+CBlockFilterIndex* pblockfilterindex = NULL;
+
+namespace {
+
+struct CFilterEntry
+{
+    uint256 hash;
+    uint256 header;
+    std::vector<unsigned char> vFilter;
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion) {
+        READWRITE(hash);
+        READWRITE(header);
+        READWRITE(vFilter);
+    }
+};
+
+} // anon namespace
+
+CBlockFilterIndex::CBlockFilterIndex(BlockFilterType filterTypeIn, size_t nCacheSize, bool fMemory, bool fWipe)
+    : filterType(filterTypeIn),
+      db(GetDataDir() / "blocks" / "filter" / BlockFilterTypeName(filterTypeIn), nCacheSize, fMemory, fWipe),
+      pindexBest(NULL),
+      fTipChanged(false),
+      fSynced(false)
+{
+}
+
+bool CBlockFilterIndex::Init()
+{
+    uint256 hashBest;
+    if (!db.Read(DB_BEST_BLOCK, hashBest))
+        return true;
+
+    LOCK(cs_main);
+    BlockMap::const_iterator it = mapBlockIndex.find(hashBest);
+    if (it == mapBlockIndex.end())
+        return error("%s: best block %s of the %s filter index is unknown", __func__, hashBest.ToString(), BlockFilterTypeName(filterType));
+
+    boost::unique_lock<boost::mutex> lock(mutex);
+    pindexBest = it->second;
+    return true;
+}
+
+const CBlockIndex* CBlockFilterIndex::BestBlock() const
+{
+    boost::unique_lock<boost::mutex> lock(mutex);
+    return pindexBest;
+}
+
+const CBlockIndex* CBlockFilterIndex::NextSyncBlock(const CBlockIndex* pindexPrev) const
+{
+    AssertLockHeld(cs_main);
+
+    if (!pindexPrev)
+        return chainActive.Genesis();
+    if (chainActive.Contains(pindexPrev))
+        return chainActive.Next(pindexPrev);
+
+    // A reorganization left us on a stale branch; the filters up to the fork stay good
+    const CBlockIndex* pindexFork = chainActive.FindFork(pindexPrev);
+    return pindexFork ? chainActive.Next(pindexFork) : chainActive.Genesis();
+}
+
+void CBlockFilterIndex::UpdatedBlockTip(const CBlockIndex* pindex)
+{
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        fTipChanged = true;
+    }
+    condTip.notify_all();
+}
+
+CBlockFilterIndex::SyncResult CBlockFilterIndex::SyncNext()
+{
+    const CBlockIndex* pindex;
+    {
+        LOCK(cs_main);
+        pindex = NextSyncBlock(BestBlock());
+    }
+    if (!pindex)
+        return SYNC_CAUGHT_UP;
+
+    CBlock block;
+    if (!ReadBlockFromDisk(block, pindex, Params().GetConsensus())) {
+        error("%s: failed to read block %s from disk", __func__, pindex->GetBlockHash().ToString());
+        return SYNC_FAILED;
+    }
+
+    // The genesis block spends nothing and has no undo data
+    CBlockUndo blockUndo;
+    uint256 prevHeader;
+    if (pindex->pprev) {
+        if (!ReadBlockUndoFromDisk(blockUndo, pindex)) {
+            error("%s: failed to read undo data of block %s", __func__, pindex->GetBlockHash().ToString());
+            return SYNC_FAILED;
+        }
+        if (!LookupFilterHeader(pindex->pprev, prevHeader)) {
+            error("%s: no filter header for block %s", __func__, pindex->pprev->GetBlockHash().ToString());
+            return SYNC_FAILED;
+        }
+    }
+
+    BlockFilter filter(filterType, block, blockUndo);
+
+    CFilterEntry entry;
+    entry.hash = filter.GetHash();
+    entry.header = filter.ComputeHeader(prevHeader);
+    entry.vFilter = filter.GetEncodedFilter();
+
+    CDBBatch batch(db);
+    batch.Write(std::make_pair(DB_FILTER, pindex->GetBlockHash()), entry);
+    batch.Write(DB_BEST_BLOCK, pindex->GetBlockHash());
+    if (!db.WriteBatch(batch)) {
+        error("%s: failed to write the filter of block %s", __func__, pindex->GetBlockHash().ToString());
+        return SYNC_FAILED;
+    }
+
+    boost::unique_lock<boost::mutex> lock(mutex);
+    pindexBest = pindex;
+    return SYNC_BLOCK;
+}
+
+void CBlockFilterIndex::ThreadSync()
+{
+    int64_t nLastLog = GetTime();
+
+    while (true) {
+        boost::this_thread::interruption_point();
+
+        SyncResult result = SyncNext();
+        if (result == SYNC_BLOCK) {
+            if (!fSynced && GetTime() - nLastLog >= 30) {
+                LogPrintf("Syncing %s block filter index with the block chain, at height %d\n",
+                    BlockFilterTypeName(filterType), BestBlock()->nHeight);
+                nLastLog = GetTime();
+            }
+            continue;
+        }
+
+        // Retrying would fail on the same block after every new tip; lookups keep serving the blocks indexed so far
+        if (result == SYNC_FAILED) {
+            std::string strWarning = strprintf(_("Warning: the %s block filter index stopped syncing, see debug.log for details"),
+                BlockFilterTypeName(filterType));
+            LogPrintf("*** %s\n", strWarning);
+            // Set under cs_main like the warnings of block validation, GetWarnings is read by RPC and the GUI
+            LOCK(cs_main);
+            strMiscWarning = strWarning;
+            return;
+        }
+
+        boost::unique_lock<boost::mutex> lock(mutex);
+        if (!fSynced && pindexBest) {
+            LogPrintf("%s block filter index is synced at height %d\n", BlockFilterTypeName(filterType), pindexBest->nHeight);
+            fSynced = true;
+        }
+        // Sleep until the next block is connected; waiting is an interruption point
+        while (!fTipChanged)
+            condTip.wait(lock);
+        fTipChanged = false;
+    }
+}
+
+bool CBlockFilterIndex::LookupFilter(const CBlockIndex* pindex, BlockFilter& filter) const
+{
+    CFilterEntry entry;
+    if (!db.Read(std::make_pair(DB_FILTER, pindex->GetBlockHash()), entry))
+        return false;
+
+    try {
+        filter = BlockFilter(filterType, pindex->GetBlockHash(), std::move(entry.vFilter));
+    } catch (const std::exception& e) {
+        return error("%s: malformed filter of block %s: %s", __func__, pindex->GetBlockHash().ToString(), e.what());
+    }
+    return true;
+}
+
+bool CBlockFilterIndex::LookupFilterHeader(const CBlockIndex* pindex, uint256& header) const
+{
+    CFilterEntry entry;
+    if (!db.Read(std::make_pair(DB_FILTER, pindex->GetBlockHash()), entry))
+        return false;
+
+    header = entry.header;
+    return true;
+}
+
+bool CBlockFilterIndex::LookupFilterRange(int nStartHeight, const CBlockIndex* pindexStop, std::vector<BlockFilter>& filters) const
+{
+    if (nStartHeight < 0 || nStartHeight > pindexStop->nHeight)
+        return false;
+
+    filters.resize(pindexStop->nHeight - nStartHeight + 1);
+    const CBlockIndex* pindex = pindexStop;
+    for (size_t i = filters.size(); i-- > 0; pindex = pindex->pprev) {
+        if (!LookupFilter(pindex, filters[i]))
+            return false;
+    }
+    return true;
+}
+
+bool CBlockFilterIndex::LookupFilterHashRange(int nStartHeight, const CBlockIndex* pindexStop, std::vector<uint256>& hashes) const
+{
+    if (nStartHeight < 0 || nStartHeight > pindexStop->nHeight)
+        return false;
+
+    hashes.resize(pindexStop->nHeight - nStartHeight + 1);
+    const CBlockIndex* pindex = pindexStop;
+    for (size_t i = hashes.size(); i-- > 0; pindex = pindex->pprev) {
+        CFilterEntry entry;
+        if (!db.Read(std::make_pair(DB_FILTER, pindex->GetBlockHash()), entry))
+            return false;
+        hashes[i] = entry.hash;
+    }
+    return true;
+}
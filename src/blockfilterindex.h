@@ -0,0 +1,99 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_BLOCKFILTERINDEX_H
+#define BITCOIN_BLOCKFILTERINDEX_H
+
+#include "blockfilter.h"
+#include "dbwrapper.h"
+#include "validationinterface.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+
+class CBlockIndex;
+
+//! -blockfilterindex default
+static const bool DEFAULT_BLOCKFILTERINDEX = false;
+//! -peerblockfilters default
+static const bool DEFAULT_PEERBLOCKFILTERS = false;
+//! Max memory allocated to the block filter index cache (MiB)
+static const int64_t nMaxFilterIndexCache = 1024;
+
+/** Maximum number of filters served for one getcfilters request (BIP 157) */
+static const int MAX_GETCFILTERS_SIZE = 1000;
+/** Maximum number of filter hashes served for one getcfheaders request (BIP 157) */
+static const int MAX_GETCFHEADERS_SIZE = 2000;
+/** Distance between the filter headers of a cfcheckpt message (BIP 157) */
+static const int CFCHECKPT_INTERVAL = 1000;
+
+/**
+ * Filters and filter headers of the blocks of the active chain, kept in
+ * blocks/filter/<type>/. Filters need the undo data of their block, so the
+ * index is built by a thread of its own from the blocks on disk: it catches
+ * up with the chain after it is enabled and follows the tip from then on,
+ * and lookups see the blocks up to BestBlock(). Entries are keyed by block
+ * hash and stay valid when their block leaves the active chain.
+ */
+class CBlockFilterIndex final : public CValidationInterface
+{
+private:
+    const BlockFilterType filterType;
+    CDBWrapper db;
+
+    mutable boost::mutex mutex;
+    boost::condition_variable condTip;
+    //! Last block whose filter was written, on the active chain when it was written
+    const CBlockIndex* pindexBest;
+    bool fTipChanged;
+    bool fSynced;
+
+    /** Next block of the active chain to index after pindexPrev, which may have been reorganized away. */
+    const CBlockIndex* NextSyncBlock(const CBlockIndex* pindexPrev) const;
+
+protected:
+    void UpdatedBlockTip(const CBlockIndex* pindex) override;
+
+public:
+    CBlockFilterIndex(BlockFilterType filterTypeIn, size_t nCacheSize, bool fMemory = false, bool fWipe = false);
+
+    CBlockFilterIndex(const CBlockFilterIndex&) = delete;
+    CBlockFilterIndex& operator=(const CBlockFilterIndex&) = delete;
+
+    /** Pick up where the index stopped last time. The block index must be loaded. */
+    bool Init();
+
+    enum SyncResult
+    {
+        SYNC_BLOCK,     //!< The next block was indexed
+        SYNC_CAUGHT_UP, //!< The index is at the tip of the active chain
+        SYNC_FAILED,    //!< A block could not be read or its filter written
+    };
+
+    /** Index the next block of the active chain. */
+    SyncResult SyncNext();
+
+    /** Body of the "blockfilter" thread: index blocks as the chain grows, until interrupted or an error stops it. */
+    void ThreadSync();
+
+    BlockFilterType GetFilterType() const { return filterType; }
+    const CBlockIndex* BestBlock() const;
+
+    bool LookupFilter(const CBlockIndex* pindex, BlockFilter& filter) const;
+    bool LookupFilterHeader(const CBlockIndex* pindex, uint256& header) const;
+
+    /** Filters of pindexStop and its ancestors down to height nStartHeight, lowest first. */
+    bool LookupFilterRange(int nStartHeight, const CBlockIndex* pindexStop, std::vector<BlockFilter>& filters) const;
+
+    /** Filter hashes of pindexStop and its ancestors down to height nStartHeight, lowest first. */
+    bool LookupFilterHashRange(int nStartHeight, const CBlockIndex* pindexStop, std::vector<uint256>& hashes) const;
+};
+
+/** Basic block filter index, set if -blockfilterindex is on */
+extern CBlockFilterIndex* pblockfilterindex;
+
+#endif // BITCOIN_BLOCKFILTERINDEX_H
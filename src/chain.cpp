@@ -112,10 +112,20 @@ void CBlockIndex::BuildSkip()
         pskip = pprev->GetAncestor(GetSkipHeight(nHeight));
 }
 
+void CBlockIndex::BuildProofLinks()
+{
+    if (pprev)
+        pprevOtherProof = const_cast<CBlockIndex*>(GetLastBlockIndex(pprev, !IsProofOfStake()));
+}
+
 const CBlockIndex* GetLastBlockIndex(const CBlockIndex* pindex, bool fProofOfStake)
 {
-    while (pindex && pindex->pprev && (pindex->IsProofOfStake() != fProofOfStake))
+    while (pindex && pindex->pprev && (pindex->IsProofOfStake() != fProofOfStake)) {
+        // Jump over the whole run of blocks of the other type at once where the link is built
+        if (pindex->pprevOtherProof)
+            return pindex->pprevOtherProof;
         pindex = pindex->pprev;
+    }
     return pindex;
 }
 
@@ -180,6 +180,10 @@ public:
     //! pointer to the index of some further predecessor of this block
     CBlockIndex* pskip;
 
+    //! (memory only) pointer to the closest predecessor of the other proof type (PoW for a PoS block
+    //! and vice versa), or the genesis block if there is none. NULL until BuildProofLinks is called.
+    CBlockIndex* pprevOtherProof;
+
     //! height of the entry in the chain. The genesis block has height 0
     int nHeight;
 
@@ -250,6 +254,7 @@ public:
         phashBlock = NULL;
         pprev = NULL;
         pskip = NULL;
+        pprevOtherProof = NULL;
         nHeight = 0;
         nFile = 0;
         nDataPos = 0;
@@ -460,6 +465,9 @@ public:
     //! Build the skiplist pointer for this entry.
     void BuildSkip();
 
+    //! Build the pointer to the closest predecessor of the other proof type. Requires pprev.
+    void BuildProofLinks();
+
     //! Efficiently find an ancestor of this block.
     CBlockIndex* GetAncestor(int height);
     const CBlockIndex* GetAncestor(int height) const;
@@ -611,6 +619,7 @@ public:
     /** Find the last common block between this chain and a block index entry. */
     const CBlockIndex *FindFork(const CBlockIndex *pindex) const;
 };
+/** Return the last block of the given proof type up to and including pindex, or the genesis block if there is none */
 const CBlockIndex* GetLastBlockIndex(const CBlockIndex* pindex, bool fProofOfStake);
 
 #endif // BITCOIN_CHAIN_H
@@ -351,8 +351,11 @@ UniValue sendprivate(Type type, const UniValue& data, const UniValue& auth, bool
 
             BOOST_FOREACH(CSigmaEntry coin, coins){
                 COutPoint outpoint;
-                if(!sigma::GetOutPoint(outpoint, coin.value))
-                    throw runtime_error("Mint tx not found!");
+                {
+                    LOCK(cs_main);
+                    if(!sigma::GetOutPoint(outpoint, coin.value))
+                        throw runtime_error("Mint tx not found!");
+                }
                 txid = outpoint.hash.ToString();
                 index = outpoint.n;
                 string key = txid + to_string(index);
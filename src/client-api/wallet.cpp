@@ -455,8 +455,8 @@ UniValue StateBlock(UniValue& ret, std::string blockhash){
     }
 
     UniValue transactions(UniValue::VOBJ);
-    BOOST_FOREACH(const CTransaction&tx, block.vtx)
-    {
+    for (const CTransactionRef& ptx : block.vtx) {
+        const CTransaction& tx = *ptx;
         const CWalletTx *wtx = pwalletMain->GetWalletTx(tx.GetHash());
         if(wtx){
             ListAPITransactions(*(wtx), transactions, filter);
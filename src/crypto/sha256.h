@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string>
 
 /** A hasher class for SHA-256. */
 class CSHA256
@@ -25,4 +26,29 @@ public:
     CSHA256& Reset();
 };
 
+/** Instruction set extensions that SHA256AutoDetect may pick an implementation from. */
+enum SHA256Implementation
+{
+    SHA256_STANDARD = 0,
+    SHA256_SSE41 = (1 << 0),  //!< 4-way SHA256D64 using SSE4.1
+    SHA256_AVX2 = (1 << 1),   //!< 8-way SHA256D64 using AVX2
+    SHA256_SHANI = (1 << 2),  //!< SHA256 transform using the Intel SHA extensions
+    SHA256_ALL = SHA256_SSE41 | SHA256_AVX2 | SHA256_SHANI
+};
+
+/** Autodetect the best available SHA256 implementation, restricted to the
+ *  extensions in nAllowed. Returns the name of the implementation in use.
+ *  Until this is called the portable C implementation is used.
+ */
+std::string SHA256AutoDetect(int nAllowed = SHA256_ALL);
+
+/** Compute multiple double-SHA256's of 64-byte blobs.
+ *  output:  pointer to a blocks*32 byte output buffer
+ *  input:   pointer to a blocks*64 byte input buffer
+ *  blocks:  the number of hashes to compute.
+ *  output may point to the start of input; each hash is written after its
+ *  input has been consumed.
+ */
+void SHA256D64(unsigned char* output, const unsigned char* input, size_t blocks);
+
 #endif // BITCOIN_CRYPTO_SHA256_H
@@ -50,12 +50,11 @@ inline int GetHashSelection(const uint256 PrevBlockHash, int index) {
     return(hashSelection);
 }
 
-template<typename T1>
-inline uint256 HashX16RV2(const T1 pbegin, const T1 pend, const uint256 PrevBlockHash)
+/** Run the X16Rv2 stage selected by hashSelection over toHash into out.
+ *  out must be zero on entry, as the tiger based stages only fill its first
+ *  24 bytes before hashing all 64 of them again. */
+inline void HashX16RV2Stage(int hashSelection, const void* toHash, int lenToHash, uint512& out)
 {
-//      static std::chrono::duration<double>[16];
-    int hashSelection;
-
     sph_blake512_context     ctx_blake;      //0
     sph_bmw512_context       ctx_bmw;        //1
     sph_groestl512_context   ctx_groestl;    //2
@@ -75,8 +74,105 @@ inline uint256 HashX16RV2(const T1 pbegin, const T1 pend, const uint256 PrevBloc
     sph_sha512_context        ctx_sha512;
     sph_tiger_context         ctx_tiger;
 
+    switch(hashSelection) {
+        case 0:
+            sph_blake512_init(&ctx_blake);
+            sph_blake512 (&ctx_blake, toHash, lenToHash);
+            sph_blake512_close(&ctx_blake, static_cast<void*>(&out));
+            break;
+        case 1:
+            sph_bmw512_init(&ctx_bmw);
+            sph_bmw512 (&ctx_bmw, toHash, lenToHash);
+            sph_bmw512_close(&ctx_bmw, static_cast<void*>(&out));
+            break;
+        case 2:
+            sph_groestl512_init(&ctx_groestl);
+            sph_groestl512 (&ctx_groestl, toHash, lenToHash);
+            sph_groestl512_close(&ctx_groestl, static_cast<void*>(&out));
+            break;
+        case 3:
+            sph_jh512_init(&ctx_jh);
+            sph_jh512 (&ctx_jh, toHash, lenToHash);
+            sph_jh512_close(&ctx_jh, static_cast<void*>(&out));
+            break;
+        case 4:
+            sph_tiger_init(&ctx_tiger);
+            sph_tiger (&ctx_tiger, toHash, lenToHash);
+            sph_tiger_close(&ctx_tiger, static_cast<void*>(&out));
 
+            sph_keccak512_init(&ctx_keccak);
+            sph_keccak512 (&ctx_keccak, static_cast<const void*>(&out), 64);
+            sph_keccak512_close(&ctx_keccak, static_cast<void*>(&out));
+            break;
+        case 5:
+            sph_skein512_init(&ctx_skein);
+            sph_skein512 (&ctx_skein, toHash, lenToHash);
+            sph_skein512_close(&ctx_skein, static_cast<void*>(&out));
+            break;
+        case 6:
+            sph_tiger_init(&ctx_tiger);
+            sph_tiger (&ctx_tiger, toHash, lenToHash);
+            sph_tiger_close(&ctx_tiger, static_cast<void*>(&out));
+
+            sph_luffa512_init(&ctx_luffa);
+            sph_luffa512 (&ctx_luffa, static_cast<const void*>(&out), 64);
+            sph_luffa512_close(&ctx_luffa, static_cast<void*>(&out));
+            break;
+        case 7:
+            sph_cubehash512_init(&ctx_cubehash);
+            sph_cubehash512 (&ctx_cubehash, toHash, lenToHash);
+            sph_cubehash512_close(&ctx_cubehash, static_cast<void*>(&out));
+            break;
+        case 8:
+            sph_shavite512_init(&ctx_shavite);
+            sph_shavite512(&ctx_shavite, toHash, lenToHash);
+            sph_shavite512_close(&ctx_shavite, static_cast<void*>(&out));
+            break;
+        case 9:
+            sph_simd512_init(&ctx_simd);
+            sph_simd512 (&ctx_simd, toHash, lenToHash);
+            sph_simd512_close(&ctx_simd, static_cast<void*>(&out));
+            break;
+        case 10:
+            sph_echo512_init(&ctx_echo);
+            sph_echo512 (&ctx_echo, toHash, lenToHash);
+            sph_echo512_close(&ctx_echo, static_cast<void*>(&out));
+            break;
+        case 11:
+            sph_hamsi512_init(&ctx_hamsi);
+            sph_hamsi512 (&ctx_hamsi, toHash, lenToHash);
+            sph_hamsi512_close(&ctx_hamsi, static_cast<void*>(&out));
+            break;
+        case 12:
+            sph_fugue512_init(&ctx_fugue);
+            sph_fugue512 (&ctx_fugue, toHash, lenToHash);
+            sph_fugue512_close(&ctx_fugue, static_cast<void*>(&out));
+            break;
+        case 13:
+            sph_shabal512_init(&ctx_shabal);
+            sph_shabal512 (&ctx_shabal, toHash, lenToHash);
+            sph_shabal512_close(&ctx_shabal, static_cast<void*>(&out));
+            break;
+        case 14:
+            sph_whirlpool_init(&ctx_whirlpool);
+            sph_whirlpool(&ctx_whirlpool, toHash, lenToHash);
+            sph_whirlpool_close(&ctx_whirlpool, static_cast<void*>(&out));
+            break;
+        case 15:
+            sph_tiger_init(&ctx_tiger);
+            sph_tiger (&ctx_tiger, toHash, lenToHash);
+            sph_tiger_close(&ctx_tiger, static_cast<void*>(&out));
+
+            sph_sha512_init(&ctx_sha512);
+            sph_sha512 (&ctx_sha512, static_cast<const void*>(&out), 64);
+            sph_sha512_close(&ctx_sha512, static_cast<void*>(&out));
+            break;
+    }
+}
 
+template<typename T1>
+inline uint256 HashX16RV2(const T1 pbegin, const T1 pend, const uint256 PrevBlockHash)
+{
     static unsigned char pblank[1];
 
     uint512 hash[16];
@@ -93,104 +189,121 @@ inline uint256 HashX16RV2(const T1 pbegin, const T1 pend, const uint256 PrevBloc
             lenToHash = 64;
         }
 
-        hashSelection = GetHashSelection(PrevBlockHash, i);
+        HashX16RV2Stage(GetHashSelection(PrevBlockHash, i), toHash, lenToHash, hash[i]);
+    }
 
-        switch(hashSelection) {
-            case 0:
-                sph_blake512_init(&ctx_blake);
-                sph_blake512 (&ctx_blake, toHash, lenToHash);
-                sph_blake512_close(&ctx_blake, static_cast<void*>(&hash[i]));
-                break;
-            case 1:
-                sph_bmw512_init(&ctx_bmw);
-                sph_bmw512 (&ctx_bmw, toHash, lenToHash);
-                sph_bmw512_close(&ctx_bmw, static_cast<void*>(&hash[i]));
-                break;
-            case 2:
-                sph_groestl512_init(&ctx_groestl);
-                sph_groestl512 (&ctx_groestl, toHash, lenToHash);
-                sph_groestl512_close(&ctx_groestl, static_cast<void*>(&hash[i]));
-                break;
-            case 3:
-                sph_jh512_init(&ctx_jh);
-                sph_jh512 (&ctx_jh, toHash, lenToHash);
-                sph_jh512_close(&ctx_jh, static_cast<void*>(&hash[i]));
-                break;
-            case 4:
-                sph_tiger_init(&ctx_tiger);
-                sph_tiger (&ctx_tiger, toHash, lenToHash);
-                sph_tiger_close(&ctx_tiger, static_cast<void*>(&hash[i]));
+    return hash[15].trim256();
+}
 
-                sph_keccak512_init(&ctx_keccak);
-                sph_keccak512 (&ctx_keccak, static_cast<const void*>(&hash[i]), 64);
-                sph_keccak512_close(&ctx_keccak, static_cast<void*>(&hash[i]));
-                break;
-            case 5:
-                sph_skein512_init(&ctx_skein);
-                sph_skein512 (&ctx_skein, toHash, lenToHash);
-                sph_skein512_close(&ctx_skein, static_cast<void*>(&hash[i]));
-                break;
-            case 6:
-                sph_tiger_init(&ctx_tiger);
-                sph_tiger (&ctx_tiger, toHash, lenToHash);
-                sph_tiger_close(&ctx_tiger, static_cast<void*>(&hash[i]));
+/** X16Rv2 with a fixed message prefix already absorbed by the first stage.
+ *
+ *  While mining one block template only the trailing nonce changes, and the
+ *  stage order depends on hashPrevBlock alone. The prefix is absorbed once
+ *  here, and each Finalize() resumes the first stage from a copy of the saved
+ *  context before running the other 15 stages.
+ */
+class CX16RV2Midstate
+{
+private:
+    int hashSelection[16];
 
-                sph_luffa512_init(&ctx_luffa);
-                sph_luffa512 (&ctx_luffa, static_cast<const void*>(&hash[i]), 64);
-                sph_luffa512_close(&ctx_luffa, static_cast<void*>(&hash[i]));
-                break;
-            case 7:
-                sph_cubehash512_init(&ctx_cubehash);
-                sph_cubehash512 (&ctx_cubehash, toHash, lenToHash);
-                sph_cubehash512_close(&ctx_cubehash, static_cast<void*>(&hash[i]));
-                break;
-            case 8:
-                sph_shavite512_init(&ctx_shavite);
-                sph_shavite512(&ctx_shavite, toHash, lenToHash);
-                sph_shavite512_close(&ctx_shavite, static_cast<void*>(&hash[i]));
-                break;
-            case 9:
-                sph_simd512_init(&ctx_simd);
-                sph_simd512 (&ctx_simd, toHash, lenToHash);
-                sph_simd512_close(&ctx_simd, static_cast<void*>(&hash[i]));
-                break;
-            case 10:
-                sph_echo512_init(&ctx_echo);
-                sph_echo512 (&ctx_echo, toHash, lenToHash);
-                sph_echo512_close(&ctx_echo, static_cast<void*>(&hash[i]));
-                break;
-            case 11:
-                sph_hamsi512_init(&ctx_hamsi);
-                sph_hamsi512 (&ctx_hamsi, toHash, lenToHash);
-                sph_hamsi512_close(&ctx_hamsi, static_cast<void*>(&hash[i]));
-                break;
-            case 12:
-                sph_fugue512_init(&ctx_fugue);
-                sph_fugue512 (&ctx_fugue, toHash, lenToHash);
-                sph_fugue512_close(&ctx_fugue, static_cast<void*>(&hash[i]));
-                break;
-            case 13:
-                sph_shabal512_init(&ctx_shabal);
-                sph_shabal512 (&ctx_shabal, toHash, lenToHash);
-                sph_shabal512_close(&ctx_shabal, static_cast<void*>(&hash[i]));
-                break;
-            case 14:
-                sph_whirlpool_init(&ctx_whirlpool);
-                sph_whirlpool(&ctx_whirlpool, toHash, lenToHash);
-                sph_whirlpool_close(&ctx_whirlpool, static_cast<void*>(&hash[i]));
-                break;
-            case 15:
-                sph_tiger_init(&ctx_tiger);
-                sph_tiger (&ctx_tiger, toHash, lenToHash);
-                sph_tiger_close(&ctx_tiger, static_cast<void*>(&hash[i]));
+    /** Context of the first stage; the tiger based stages start with tiger. */
+    union {
+        sph_blake512_context     blake;
+        sph_bmw512_context       bmw;
+        sph_groestl512_context   groestl;
+        sph_jh512_context        jh;
+        sph_skein512_context     skein;
+        sph_cubehash512_context  cubehash;
+        sph_shavite512_context   shavite;
+        sph_simd512_context      simd;
+        sph_echo512_context      echo;
+        sph_hamsi512_context     hamsi;
+        sph_fugue512_context     fugue;
+        sph_shabal512_context    shabal;
+        sph_whirlpool_context    whirlpool;
+        sph_tiger_context        tiger;
+    } ctx;
+
+public:
+    CX16RV2Midstate(const void* prefix, size_t len, const uint256& PrevBlockHash)
+    {
+        for (int i = 0; i < 16; i++)
+            hashSelection[i] = GetHashSelection(PrevBlockHash, i);
 
-                sph_sha512_init(&ctx_sha512);
-                sph_sha512 (&ctx_sha512, static_cast<const void*>(&hash[i]), 64);
-                sph_sha512_close(&ctx_sha512, static_cast<void*>(&hash[i]));
+        switch (hashSelection[0]) {
+            case 0: sph_blake512_init(&ctx.blake); sph_blake512(&ctx.blake, prefix, len); break;
+            case 1: sph_bmw512_init(&ctx.bmw); sph_bmw512(&ctx.bmw, prefix, len); break;
+            case 2: sph_groestl512_init(&ctx.groestl); sph_groestl512(&ctx.groestl, prefix, len); break;
+            case 3: sph_jh512_init(&ctx.jh); sph_jh512(&ctx.jh, prefix, len); break;
+            case 5: sph_skein512_init(&ctx.skein); sph_skein512(&ctx.skein, prefix, len); break;
+            case 7: sph_cubehash512_init(&ctx.cubehash); sph_cubehash512(&ctx.cubehash, prefix, len); break;
+            case 8: sph_shavite512_init(&ctx.shavite); sph_shavite512(&ctx.shavite, prefix, len); break;
+            case 9: sph_simd512_init(&ctx.simd); sph_simd512(&ctx.simd, prefix, len); break;
+            case 10: sph_echo512_init(&ctx.echo); sph_echo512(&ctx.echo, prefix, len); break;
+            case 11: sph_hamsi512_init(&ctx.hamsi); sph_hamsi512(&ctx.hamsi, prefix, len); break;
+            case 12: sph_fugue512_init(&ctx.fugue); sph_fugue512(&ctx.fugue, prefix, len); break;
+            case 13: sph_shabal512_init(&ctx.shabal); sph_shabal512(&ctx.shabal, prefix, len); break;
+            case 14: sph_whirlpool_init(&ctx.whirlpool); sph_whirlpool(&ctx.whirlpool, prefix, len); break;
+            case 4:
+            case 6:
+            case 15:
+                sph_tiger_init(&ctx.tiger);
+                sph_tiger(&ctx.tiger, prefix, len);
                 break;
         }
     }
 
-    return hash[15].trim256();
-}
+    /** Hash the prefix followed by tail. */
+    uint256 Finalize(const void* tail, size_t len) const
+    {
+        uint512 hash[16];
+        sph_keccak512_context ctx_keccak;
+        sph_luffa512_context ctx_luffa;
+        sph_sha512_context ctx_sha512;
+
+        void* out = static_cast<void*>(&hash[0]);
+        switch (hashSelection[0]) {
+            case 0: { sph_blake512_context c = ctx.blake; sph_blake512(&c, tail, len); sph_blake512_close(&c, out); break; }
+            case 1: { sph_bmw512_context c = ctx.bmw; sph_bmw512(&c, tail, len); sph_bmw512_close(&c, out); break; }
+            case 2: { sph_groestl512_context c = ctx.groestl; sph_groestl512(&c, tail, len); sph_groestl512_close(&c, out); break; }
+            case 3: { sph_jh512_context c = ctx.jh; sph_jh512(&c, tail, len); sph_jh512_close(&c, out); break; }
+            case 5: { sph_skein512_context c = ctx.skein; sph_skein512(&c, tail, len); sph_skein512_close(&c, out); break; }
+            case 7: { sph_cubehash512_context c = ctx.cubehash; sph_cubehash512(&c, tail, len); sph_cubehash512_close(&c, out); break; }
+            case 8: { sph_shavite512_context c = ctx.shavite; sph_shavite512(&c, tail, len); sph_shavite512_close(&c, out); break; }
+            case 9: { sph_simd512_context c = ctx.simd; sph_simd512(&c, tail, len); sph_simd512_close(&c, out); break; }
+            case 10: { sph_echo512_context c = ctx.echo; sph_echo512(&c, tail, len); sph_echo512_close(&c, out); break; }
+            case 11: { sph_hamsi512_context c = ctx.hamsi; sph_hamsi512(&c, tail, len); sph_hamsi512_close(&c, out); break; }
+            case 12: { sph_fugue512_context c = ctx.fugue; sph_fugue512(&c, tail, len); sph_fugue512_close(&c, out); break; }
+            case 13: { sph_shabal512_context c = ctx.shabal; sph_shabal512(&c, tail, len); sph_shabal512_close(&c, out); break; }
+            case 14: { sph_whirlpool_context c = ctx.whirlpool; sph_whirlpool(&c, tail, len); sph_whirlpool_close(&c, out); break; }
+            case 4:
+            case 6:
+            case 15: {
+                sph_tiger_context c = ctx.tiger;
+                sph_tiger(&c, tail, len);
+                sph_tiger_close(&c, out);
+                if (hashSelection[0] == 4) {
+                    sph_keccak512_init(&ctx_keccak);
+                    sph_keccak512(&ctx_keccak, out, 64);
+                    sph_keccak512_close(&ctx_keccak, out);
+                } else if (hashSelection[0] == 6) {
+                    sph_luffa512_init(&ctx_luffa);
+                    sph_luffa512(&ctx_luffa, out, 64);
+                    sph_luffa512_close(&ctx_luffa, out);
+                } else {
+                    sph_sha512_init(&ctx_sha512);
+                    sph_sha512(&ctx_sha512, out, 64);
+                    sph_sha512_close(&ctx_sha512, out);
+                }
+                break;
+            }
+        }
+
+        for (int i = 1; i < 16; i++)
+            HashX16RV2Stage(hashSelection[i], static_cast<const void*>(&hash[i-1]), 64, hash[i]);
+
+        return hash[15].trim256();
+    }
+};
 #endif // HASHALGOS_H
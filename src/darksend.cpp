@@ -5,6 +5,8 @@
 #include "activeindexnode.h"
 #include "coincontrol.h"
 #include "consensus/validation.h"
+#include "crypto/common.h"
+#include "crypto/sha256.h"
 #include "darksend.h"
 //#include "governance.h"
 #include "init.h"
@@ -12,6 +14,8 @@
 #include "indexnode-payments.h"
 #include "indexnode-sync.h"
 #include "indexnodeman.h"
+#include "random.h"
+#include "scheduler.h"
 #include "script/sign.h"
 #include "txmempool.h"
 #include "util.h"
@@ -2336,20 +2340,86 @@ bool CDarkSendSigner::SignMessage(std::string strMessage, std::vector<unsigned c
     return key.SignCompact(ss.GetHash(), vchSigRet);
 }
 
+CRecoveredKeyCache::CRecoveredKeyCache(size_t nEntries) {
+    size_t nSize = 1;
+    while (nSize * 2 <= nEntries)
+        nSize *= 2;
+    vTable.resize(nSize);
+    GetRandBytes(nonce.begin(), 32);
+}
+
+size_t CRecoveredKeyCache::Slot(const uint256 &hash, int nAlternative) const {
+    // Entries are salted SHA256 outputs, any of their bits are good slot indexes
+    return ReadLE64(hash.begin() + 8 * nAlternative) & (vTable.size() - 1);
+}
+
+uint256 CRecoveredKeyCache::ComputeEntry(const uint256 &hashMessage, const std::vector<unsigned char> &vchSig) const {
+    uint256 entry;
+    CSHA256().Write(nonce.begin(), 32).Write(hashMessage.begin(), 32).Write(vchSig.data(), vchSig.size()).Finalize(entry.begin());
+    return entry;
+}
+
+bool CRecoveredKeyCache::Get(const uint256 &hash, CKeyID &keyIDRet) const {
+    LOCK(cs);
+    for (int i = 0; i < 2; i++) {
+        const Entry &entry = vTable[Slot(hash, i)];
+        if (entry.hash == hash) {
+            keyIDRet = entry.keyID;
+            return true;
+        }
+    }
+    return false;
+}
+
+void CRecoveredKeyCache::Insert(const uint256 &hash, const CKeyID &keyID) {
+    LOCK(cs);
+    for (int i = 0; i < 2; i++) {
+        Entry &entry = vTable[Slot(hash, i)];
+        if (entry.hash.IsNull() || entry.hash == hash) {
+            entry.hash = hash;
+            entry.keyID = keyID;
+            return;
+        }
+    }
+
+    Entry entry;
+    entry.hash = hash;
+    entry.keyID = keyID;
+    size_t nSlot = Slot(hash, 0);
+    for (int i = 0; i < MAX_DISPLACEMENTS; i++) {
+        std::swap(entry, vTable[nSlot]);
+        if (entry.hash.IsNull())
+            return;
+        // Move the displaced entry to its other slot
+        size_t nFirst = Slot(entry.hash, 0);
+        nSlot = nSlot == nFirst ? Slot(entry.hash, 1) : nFirst;
+    }
+    // The neighbourhood is crowded, the entry displaced last is forgotten
+}
+
 bool CDarkSendSigner::VerifyMessage(CPubKey pubkey, const std::vector<unsigned char> &vchSig, std::string strMessage, std::string &strErrorRet) {
+    static CRecoveredKeyCache recoveredKeys;
+
     CHashWriter ss(SER_GETHASH, 0);
     ss << strMessageMagic;
     ss << strMessage;
-
-    CPubKey pubkeyFromSig;
-    if (!pubkeyFromSig.RecoverCompact(ss.GetHash(), vchSig)) {
-        strErrorRet = "Error recovering public key.";
-        return false;
+    uint256 hashMessage = ss.GetHash();
+
+    uint256 entry = recoveredKeys.ComputeEntry(hashMessage, vchSig);
+    CKeyID keyIDFromSig;
+    if (!recoveredKeys.Get(entry, keyIDFromSig)) {
+        CPubKey pubkeyFromSig;
+        if (!pubkeyFromSig.RecoverCompact(hashMessage, vchSig)) {
+            strErrorRet = "Error recovering public key.";
+            return false;
+        }
+        keyIDFromSig = pubkeyFromSig.GetID();
+        recoveredKeys.Insert(entry, keyIDFromSig);
     }
 
-    if (pubkeyFromSig.GetID() != pubkey.GetID()) {
+    if (keyIDFromSig != pubkey.GetID()) {
         strErrorRet = strprintf("Keys don't match: pubkey=%s, pubkeyFromSig=%s, strMessage=%s, vchSig=%s",
-                                pubkey.GetID().ToString(), pubkeyFromSig.GetID().ToString(), strMessage,
+                                pubkey.GetID().ToString(), keyIDFromSig.ToString(), strMessage,
                                 EncodeBase64(&vchSig[0], vchSig.size()));
         return false;
     }
@@ -2489,60 +2559,62 @@ void CDarksendPool::UpdatedBlockTip(const CBlockIndex *pindex) {
     }
 }
 
+static void ScheduleAutomaticDenominating(CScheduler& scheduler)
+{
+    int64_t nDelay = PRIVATESEND_AUTO_TIMEOUT_MIN + GetRandInt(PRIVATESEND_AUTO_TIMEOUT_MAX - PRIVATESEND_AUTO_TIMEOUT_MIN);
+    scheduler.scheduleFromNow([&scheduler]() {
+        if (indexnodeSync.GetBlockchainSynced() && !ShutdownRequested())
+            darkSendPool.DoAutomaticDenominating();
+        ScheduleAutomaticDenominating(scheduler);
+    }, nDelay, "privatesendauto", "indexnode");
+}
+
 //TODO: Rename/move to core
-void ThreadCheckDarkSendPool() {
+void ScheduleDarkSendMaintenance(CScheduler& scheduler) {
     if (fLiteMode) return; // disable all Index specific functionality
 
-    static bool fOneThread;
-    if (fOneThread) return;
-    fOneThread = true;
-
-    // Make this thread recognisable as the PrivateSend thread
-    RenameThread("dash-privatesend");
-
-    unsigned int nTick = 0;
-    unsigned int nDoAutoNextRun = nTick + PRIVATESEND_AUTO_TIMEOUT_MIN;
+    // All of this used to run on a single thread, so it shares one lane. The jobs
+    // which depend on the blockchain being synced skip their run until it is.
 
-    while (true) {
-        MilliSleep(1000);
-
-        // try to sync from all available nodes, one step at a time
-        indexnodeSync.ProcessTick();
-
-        if (indexnodeSync.GetBlockchainSynced() && !ShutdownRequested()) {
+    // try to sync from all available nodes, one step at a time
+    scheduler.scheduleEvery([]() { indexnodeSync.ProcessTick(); }, 1, "indexnodesync", "indexnode");
 
-            nTick++;
-
-            // make sure to check all indexnodes first
-            mnodeman.Check();
-
-            // check if we should activate or ping every few minutes,
-            // slightly postpone first run to give net thread a chance to connect to some peers
-            if (nTick % INDEXNODE_MIN_MNP_SECONDS == 15)
+    scheduler.scheduleEvery([]() {
+        if (!indexnodeSync.GetBlockchainSynced() || ShutdownRequested())
+            return;
+        // make sure to check all indexnodes first
+        mnodeman.Check();
+        darkSendPool.CheckTimeout();
+        darkSendPool.CheckForCompleteQueue();
+    }, 1, "indexnodecheck", "indexnode");
+
+    // check if we should activate or ping every few minutes,
+    // slightly postpone first run to give net thread a chance to connect to some peers
+    scheduler.scheduleFromNow([&scheduler]() {
+        scheduler.scheduleEvery([]() {
+            if (indexnodeSync.GetBlockchainSynced() && !ShutdownRequested())
                 activeIndexnode.ManageState();
+        }, INDEXNODE_MIN_MNP_SECONDS, "indexnodestate", "indexnode");
+        if (indexnodeSync.GetBlockchainSynced() && !ShutdownRequested())
+            activeIndexnode.ManageState();
+    }, 15, "indexnodestate", "indexnode");
 
-            if (nTick % 60 == 0) {
-                mnodeman.ProcessIndexnodeConnections();
-                mnodeman.CheckAndRemove();
-                mnpayments.CheckAndRemove();
-                instantsend.CheckAndRemove();
-                GetMainSignals().NotifyIndexnodeList();
-            }
-            if (fIndexNode && (nTick % (60 * 5) == 0)) {
-                mnodeman.DoFullVerificationStep();
-            }
-
-//            if(nTick % (60 * 5) == 0) {
-//                governance.DoMaintenance();
-//            }
-
-            darkSendPool.CheckTimeout();
-            darkSendPool.CheckForCompleteQueue();
+    scheduler.scheduleEvery([]() {
+        if (!indexnodeSync.GetBlockchainSynced() || ShutdownRequested())
+            return;
+        mnodeman.ProcessIndexnodeConnections();
+        mnodeman.CheckAndRemove();
+        mnpayments.CheckAndRemove();
+        instantsend.CheckAndRemove();
+        GetMainSignals().NotifyIndexnodeList();
+    }, 60, "indexnodecleanup", "indexnode");
 
-            if (nDoAutoNextRun == nTick) {
-                darkSendPool.DoAutomaticDenominating();
-                nDoAutoNextRun = nTick + PRIVATESEND_AUTO_TIMEOUT_MIN + GetRandInt(PRIVATESEND_AUTO_TIMEOUT_MAX - PRIVATESEND_AUTO_TIMEOUT_MIN);
-            }
-        }
+    if (fIndexNode) {
+        scheduler.scheduleEvery([]() {
+            if (indexnodeSync.GetBlockchainSynced() && !ShutdownRequested())
+                mnodeman.DoFullVerificationStep();
+        }, 60 * 5, "indexnodeverify", "indexnode");
     }
+
+    ScheduleAutomaticDenominating(scheduler);
 }
@@ -234,6 +234,44 @@ public:
     bool CheckSignature(const CPubKey& pubKeyIndexnode);
 };
 
+//! Number of recovered keys kept for indexnode message signatures (about 1MB)
+static const unsigned int RECOVERED_KEY_CACHE_ENTRIES = 1 << 14;
+
+/**
+ * Key IDs recovered from compact message signatures, keyed by (message hash, signature).
+ *
+ * Indexnode announcements, pings and lock votes arrive from every peer that
+ * relays them; this lets each of them go through public key recovery once.
+ * Fixed-size cuckoo table: an entry lives in one of two slots, and an insert
+ * into two full slots pushes the occupants on to their alternate slots for a
+ * bounded number of steps, dropping whatever is displaced last.
+ */
+class CRecoveredKeyCache
+{
+private:
+    struct Entry {
+        //! SHA256(nonce || message hash || signature), null for a free slot
+        uint256 hash;
+        CKeyID keyID;
+    };
+
+    static const int MAX_DISPLACEMENTS = 8;
+
+    mutable CCriticalSection cs;
+    std::vector<Entry> vTable;
+    uint256 nonce;
+
+    size_t Slot(const uint256& hash, int nAlternative) const;
+
+public:
+    //! nEntries is rounded down to a power of two
+    explicit CRecoveredKeyCache(size_t nEntries = RECOVERED_KEY_CACHE_ENTRIES);
+
+    uint256 ComputeEntry(const uint256& hashMessage, const std::vector<unsigned char>& vchSig) const;
+    bool Get(const uint256& hash, CKeyID& keyIDRet) const;
+    void Insert(const uint256& hash, const CKeyID& keyID);
+};
+
 /** Helper object for signing and checking signatures
  */
 class CDarkSendSigner
@@ -478,6 +516,9 @@ public:
     void UpdatedBlockTip(const CBlockIndex *pindex);
 };
 
-void ThreadCheckDarkSendPool();
+class CScheduler;
+
+/** Schedule the periodic indexnode, payment, InstantSend and PrivateSend maintenance */
+void ScheduleDarkSendMaintenance(CScheduler& scheduler);
 
 #endif
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "dex.h"
 #include "errors.h"
 #include "fees.h"
+#include "inputcache.h"
 #include "log.h"
 #include "mdex.h"
 #include "notifications.h"
@@ -14,6 +15,7 @@
 #include "persistence.h"
 #include "rules.h"
 #include "script.h"
+#include "sigma.h"
 #include "sigmadb.h"
 #include "sp.h"
 #include "tally.h"
@@ -43,6 +45,7 @@
 #include "../tinyformat.h"
 #include "../uint256.h"
 #include "../ui_interface.h"
+#include "../undo.h"
 #include "../util.h"
 #include "../utilstrencodings.h"
 #include "../utiltime.h"
@@ -63,6 +66,7 @@
 #include <openssl/sha.h>
 
 #include "leveldb/db.h"
+#include "leveldb/write_batch.h"
 
 #include <assert.h>
 #include <stdint.h>
@@ -70,6 +74,7 @@
 
 #include <fstream>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -480,13 +485,15 @@ bool elysium::update_tally_map(const std::string& who, uint32_t propertyId, int6
     before = getMPbalance(who, propertyId, ttype);
 
     std::unordered_map<std::string, CMPTally>::iterator my_it = mp_tally_map.find(who);
-    if (my_it == mp_tally_map.end()) {
+    bool created = (my_it == mp_tally_map.end());
+    if (created) {
         // insert an empty element
         my_it = (mp_tally_map.insert(std::make_pair(who, CMPTally()))).first;
     }
 
     CMPTally& tally = my_it->second;
     bRet = tally.updateMoney(propertyId, amount, ttype);
+    WalletCacheNotifyTally(who, created);
 
     after = getMPbalance(who, propertyId, ttype);
     if (!bRet) {
@@ -596,11 +603,13 @@ void CheckWalletUpdate(bool forceUpdate)
     global_balance_reserved.clear();
 
     // populate global balance totals and wallet property list - note global balances do not include additional balances from watch-only addresses
-    for (std::unordered_map<std::string, CMPTally>::iterator my_it = mp_tally_map.begin(); my_it != mp_tally_map.end(); ++my_it) {
-        // check if the address is a wallet address (including watched addresses)
-        std::string address = my_it->first;
-        int addressIsMine = IsMyAddress(address);
-        if (!addressIsMine) continue;
+    const std::map<std::string, int>& walletAddresses = WalletCacheAddresses();
+    for (std::map<std::string, int>::const_iterator it = walletAddresses.begin(); it != walletAddresses.end(); ++it) {
+        // only wallet addresses (including watched addresses) are cached
+        const std::string& address = it->first;
+        int addressIsMine = it->second;
+        std::unordered_map<std::string, CMPTally>::iterator my_it = mp_tally_map.find(address);
+        if (my_it == mp_tally_map.end()) continue;
         // iterate only those properties in the TokenMap for this address
         my_it->second.init();
         uint32_t propertyId;
@@ -621,49 +630,85 @@ void CheckWalletUpdate(bool forceUpdate)
 #endif
 }
 
-// TODO: move
-CCoinsView elysium::viewDummy;
-CCoinsViewCache elysium::view(&viewDummy);
+InputCache elysium::inputCache;
 
-//! Guards coins view cache
+//! Guards the input cache
 CCriticalSection elysium::cs_tx_cache;
 
-static unsigned int nCacheHits = 0;
-static unsigned int nCacheMiss = 0;
+//! Undo data of the last block whose transactions were parsed (guarded by cs_main)
+static CBlockUndo blockUndoParsed;
+static uint256 hashBlockUndoParsed;
 
 /**
- * Fetches transaction inputs and adds them to the coins view cache.
+ * Returns the undo data of a transaction of a connected block, which lists the
+ * outputs spent by its inputs, or nullptr if it is not available. The undo data
+ * is read once per block, when its first Elysium transaction is parsed.
+ *
+ * Note: cs_main should be locked!
+ */
+static const CTxUndo* GetBlockTxUndo(const CBlockIndex* pBlockIndex, unsigned int idx)
+{
+    AssertLockHeld(cs_main);
+
+    // The coinbase has no undo data
+    if (!pBlockIndex || idx == 0) {
+        return nullptr;
+    }
+
+    if (hashBlockUndoParsed != pBlockIndex->GetBlockHash()) {
+        blockUndoParsed.vtxundo.clear();
+        hashBlockUndoParsed = pBlockIndex->GetBlockHash();
+        if ((pBlockIndex->nStatus & BLOCK_HAVE_UNDO) && !ReadBlockUndoFromDisk(blockUndoParsed, pBlockIndex)) {
+            PrintToLog("%s(): failed to read undo data of block %s\n", __func__, hashBlockUndoParsed.GetHex());
+            blockUndoParsed.vtxundo.clear();
+        }
+    }
+
+    if (idx > blockUndoParsed.vtxundo.size()) {
+        return nullptr;
+    }
+    return &blockUndoParsed.vtxundo[idx - 1];
+}
+
+//! Elysium transactions of the block being connected, parsed by elysium_handler_block_parse() (guarded by cs_main)
+static std::map<unsigned int, std::unique_ptr<CMPTransaction>> blockTxsParsed;
+static uint256 hashBlockTxsParsed;
+
+/**
+ * Resolves the outputs spent by the inputs of a transaction. They are taken from
+ * the undo data if given, and otherwise from the input cache or the transaction index.
+ * Sigma spend inputs are left null.
  *
  * Note: cs_tx_cache should be locked, when adding and accessing inputs!
  *
- * @param tx[in]  The transaction to fetch inputs for
- * @return True, if all inputs were successfully added to the cache
+ * @param tx[in]        The transaction to fetch inputs for
+ * @param txUndo[in]    The undo data of the transaction, if it is part of a connected block
+ * @param prevOuts[out] The spent outputs, one per input
+ * @return True, if all inputs were resolved
  */
-static bool FillTxInputCache(const CTransaction& tx)
+static bool FillTxInputs(const CTransaction& tx, const CTxUndo* txUndo, std::vector<CTxOut>& prevOuts)
 {
-    static unsigned int nCacheSize = GetArg("-elysiumtxcache", 500000);
+    prevOuts.assign(tx.vin.size(), CTxOut());
 
-    if (view.GetCacheSize() > nCacheSize) {
-        PrintToLog("%s(): clearing cache before insertion [size=%d, hit=%d, miss=%d]\n",
-                __func__, view.GetCacheSize(), nCacheHits, nCacheMiss);
-        view.Flush();
+    // Undo data lists the spent outputs in the order of the inputs
+    if (txUndo && txUndo->vprevout.size() != tx.vin.size()) {
+        txUndo = nullptr;
     }
 
-    for (std::vector<CTxIn>::const_iterator it = tx.vin.begin(); it != tx.vin.end(); ++it) {
-        const CTxIn& txIn = *it;
+    for (unsigned int i = 0; i < tx.vin.size(); ++i) {
+        const CTxIn& txIn = tx.vin[i];
 
-        if (it->scriptSig.IsSigmaSpend()) {
+        if (txIn.scriptSig.IsSigmaSpend()) {
             continue;
         }
 
-        unsigned int nOut = txIn.prevout.n;
-        CCoinsModifier coins = view.ModifyCoins(txIn.prevout.hash);
+        if (txUndo) {
+            prevOuts[i] = txUndo->vprevout[i].txout;
+            continue;
+        }
 
-        if (coins->IsAvailable(nOut)) {
-            ++nCacheHits;
+        if (inputCache.Get(txIn.prevout, prevOuts[i])) {
             continue;
-        } else {
-            ++nCacheMiss;
         }
 
         CTransaction txPrev;
@@ -671,12 +716,12 @@ static bool FillTxInputCache(const CTransaction& tx)
         if (!GetTransaction(txIn.prevout.hash, txPrev, Params().GetConsensus(), hashBlock, true)) {
             return false;
         }
-
-        if (nOut >= coins->vout.size()) {
-            coins->vout.resize(nOut+1);
+        if (txIn.prevout.n >= txPrev.vout.size()) {
+            return false;
         }
-        coins->vout[nOut].scriptPubKey = txPrev.vout[nOut].scriptPubKey;
-        coins->vout[nOut].nValue = txPrev.vout[nOut].nValue;
+
+        prevOuts[i] = txPrev.vout[txIn.prevout.n];
+        inputCache.Add(txIn.prevout, prevOuts[i]);
     }
 
     return true;
@@ -688,7 +733,8 @@ static bool FillTxInputCache(const CTransaction& tx)
 // RETURNS: 0 if parsed a MP TX
 // RETURNS: < 0 if a non-MP-TX or invalid
 // RETURNS: >0 if 1 or more payments have been made
-static int parseTransaction(bool bRPConly, const CTransaction& wtx, int nBlock, unsigned int idx, CMPTransaction& mp_tx, unsigned int nTime)
+static int parseTransaction(bool bRPConly, const CTransaction& wtx, int nBlock, unsigned int idx, CMPTransaction& mp_tx, unsigned int nTime,
+        const CBlockIndex* pBlockIndex = nullptr)
 {
     InputMode inputMode = InputMode::NORMAL;
     if (wtx.IsSigmaSpend()) {
@@ -714,16 +760,17 @@ static int parseTransaction(bool bRPConly, const CTransaction& wtx, int nBlock,
     boost::optional<CBitcoinAddress> sender;
     int64_t inAll = 0;
 
-    { // needed to ensure the cache isn't cleared in the meantime when doing parallel queries
-    LOCK(cs_tx_cache);
+    // Outputs spent by the inputs; transactions of a connected block take them from its undo data
+    std::vector<CTxOut> prevOuts;
+    const CTxUndo* txUndo = pBlockIndex ? GetBlockTxUndo(pBlockIndex, idx) : nullptr;
 
-    // Add previous transaction inputs to the cache
-    if (!FillTxInputCache(wtx)) {
+    {
+    LOCK(cs_tx_cache);
+    if (!FillTxInputs(wtx, txUndo, prevOuts)) {
         PrintToLog("%s() ERROR: failed to get inputs for %s\n", __func__, wtx.GetHash().GetHex());
         return -101;
     }
-
-    assert(view.HaveInputs(wtx));
+    }
 
     if (*elysiumClass != PacketClass::C) {
         if (inputMode != InputMode::NORMAL) {
@@ -737,8 +784,7 @@ static int parseTransaction(bool bRPConly, const CTransaction& wtx, int nBlock,
         for (unsigned int i = 0; i < wtx.vin.size(); ++i) {
             if (elysium_debug_vin) PrintToLog("vin=%d:%s\n", i, ScriptToAsmStr(wtx.vin[i].scriptSig));
 
-            const CTxIn& txIn = wtx.vin[i];
-            const CTxOut& txOut = view.GetOutputFor(txIn);
+            const CTxOut& txOut = prevOuts[i];
 
             assert(!txOut.IsNull());
 
@@ -782,8 +828,7 @@ static int parseTransaction(bool bRPConly, const CTransaction& wtx, int nBlock,
         unsigned int vin_n = 0; // the first input
         if (elysium_debug_vin) PrintToLog("vin=%d:%s\n", vin_n, ScriptToAsmStr(wtx.vin[vin_n].scriptSig));
 
-        const CTxIn& txIn = wtx.vin[vin_n];
-        const CTxOut& txOut = view.GetOutputFor(txIn);
+        const CTxOut& txOut = prevOuts[vin_n];
 
         assert(!txOut.IsNull());
 
@@ -807,12 +852,12 @@ static int parseTransaction(bool bRPConly, const CTransaction& wtx, int nBlock,
         break;
     case InputMode::NORMAL:
     default:
-        inAll = view.GetValueIn(wtx);
+        for (const CTxOut& txOut : prevOuts) {
+            inAll += txOut.nValue;
+        }
         break;
     }
 
-    } // end of LOCK(cs_tx_cache)
-
     int64_t outAll = wtx.GetValueOut();
 
     // ### DATA POPULATION ### - save output addresses, values and scripts
@@ -1050,9 +1095,10 @@ static int parseTransaction(bool bRPConly, const CTransaction& wtx, int nBlock,
 /**
  * Provides access to parseTransaction in read-only mode.
  */
-int ParseTransaction(const CTransaction& tx, int nBlock, unsigned int idx, CMPTransaction& mptx, unsigned int nTime)
+int ParseTransaction(const CTransaction& tx, int nBlock, unsigned int idx, CMPTransaction& mptx, unsigned int nTime,
+        const CBlockIndex* pBlockIndex)
 {
-    return parseTransaction(true, tx, nBlock, idx, mptx, nTime);
+    return parseTransaction(true, tx, nBlock, idx, mptx, nTime, pBlockIndex);
 }
 
 /**
@@ -1194,9 +1240,10 @@ static int elysium_initial_scan(int nFirstBlock)
         unsigned parsed = 0;
 
         elysium_handler_block_begin(nBlock, pblockindex);
+        elysium_handler_block_parse(block, nBlock, pblockindex);
 
         for (unsigned i = 0; i < block.vtx.size(); i++) {
-            if (elysium_handler_tx(block.vtx[i], nBlock, i, pblockindex)) {
+            if (elysium_handler_tx(*block.vtx[i], nBlock, i, pblockindex)) {
                 parsed++;
             }
         }
@@ -1973,6 +2020,11 @@ int elysium_init()
     InitDebugLogLevels();
     ShrinkDebugLog();
 
+    {
+        LOCK(cs_tx_cache);
+        inputCache.SetMaxSize(GetArg("-elysiumtxcache", DEFAULT_INPUT_CACHE_SIZE));
+    }
+
     // check for --autocommit option and set transaction commit flag accordingly
     if (!GetBoolArg("-autocommit", true)) {
         PrintToLog("Process was started with --autocommit set to false. "
@@ -2029,6 +2081,8 @@ int elysium_init()
         if (!pwalletMain->IsLocked()) {
             wallet->ReloadMasterKey();
         }
+
+        WalletCacheConnect();
     } else {
         wallet = nullptr;
     }
@@ -2120,6 +2174,7 @@ int elysium_shutdown()
     LOCK(cs_main);
 
 #ifdef ENABLE_WALLET
+    WalletCacheDisconnect();
     delete wallet; wallet = nullptr;
 #endif
     delete txProcessor; txProcessor = nullptr;
@@ -2163,14 +2218,27 @@ bool elysium_handler_tx(const CTransaction& tx, int nBlock, unsigned int idx, co
     if (nBlock < nWaterlineBlock) return false;
     int64_t nBlockTime = pBlockIndex->GetBlockTime();
 
-    CMPTransaction mp_obj;
-    mp_obj.unlockLogic();
+    std::unique_ptr<CMPTransaction> mp_obj;
+    int pop_ret = -1;
+
+    if (pBlockIndex->GetBlockHash() == hashBlockTxsParsed) {
+        // The block was parsed ahead, transactions missing from it are no valid Elysium transactions
+        auto it = blockTxsParsed.find(idx);
+        if (it != blockTxsParsed.end()) {
+            mp_obj = std::move(it->second);
+            blockTxsParsed.erase(it);
+            pop_ret = 0;
+        }
+    } else {
+        mp_obj.reset(new CMPTransaction());
+        mp_obj->unlockLogic();
+        pop_ret = parseTransaction(false, tx, nBlock, idx, *mp_obj, nBlockTime, pBlockIndex);
+    }
 
     bool fFoundTx = false;
-    int pop_ret = parseTransaction(false, tx, nBlock, idx, mp_obj, nBlockTime);
 
     if (0 == pop_ret) {
-        int interp_ret = txProcessor->ProcessTx(mp_obj);
+        int interp_ret = txProcessor->ProcessTx(*mp_obj);
         if (interp_ret) {
             PrintToLog("!!! interpretPacket() returned %d !!!\n", interp_ret);
         }
@@ -2179,7 +2247,7 @@ bool elysium_handler_tx(const CTransaction& tx, int nBlock, unsigned int idx, co
         // PKT_ERROR - 2 = interpret_Transaction failed, structurally invalid payload
         if (interp_ret != PKT_ERROR - 2) {
             bool bValid = (0 <= interp_ret);
-            p_txlistdb->recordTX(tx.GetHash(), bValid, nBlock, mp_obj.getType(), mp_obj.getNewAmount());
+            p_txlistdb->recordTX(tx.GetHash(), bValid, nBlock, mp_obj->getType(), mp_obj->getNewAmount());
             p_ElysiumTXDB->RecordTransaction(tx.GetHash(), idx, interp_ret);
         }
         fFoundTx |= (interp_ret == 0);
@@ -3338,6 +3406,98 @@ int CMPSTOList::deleteAboveBlock(int blockNum)
 }
 
 // MPTradeList here
+
+/*
+ * Besides the trades (key txid) and matches (key txid1+txid2) the trade database holds
+ * two indexes for the history lookups, written together with the records they point to:
+ *
+ *   addr:<address>:<block>:<index>:<txid>             = <propertyIdForSale>:<propertyIdDesired>
+ *   pair:<lower id>:<higher id>:<block>:<txid1+txid2> = (empty)
+ *
+ * Numbers are zero padded, so an address or a pair is one key range, ordered by block.
+ */
+namespace {
+
+const std::string TRADE_INDEX_ADDRESS = "addr:";
+const std::string TRADE_INDEX_PAIR = "pair:";
+const std::string TRADE_INDEX_VERSION_KEY = "index:version";
+const std::string TRADE_INDEX_VERSION = "1";
+
+std::string TradeAddressPrefix(const std::string& address)
+{
+    return TRADE_INDEX_ADDRESS + address + ":";
+}
+
+std::string TradeAddressKey(const std::string& address, int blockNum, int blockIndex, const std::string& txid)
+{
+    return TradeAddressPrefix(address) + strprintf("%010d:%010d:%s", blockNum, blockIndex, txid);
+}
+
+std::string TradePairPrefix(uint32_t propertyIdA, uint32_t propertyIdB)
+{
+    return TRADE_INDEX_PAIR + strprintf("%010u:%010u:", std::min(propertyIdA, propertyIdB), std::max(propertyIdA, propertyIdB));
+}
+
+std::string TradePairKey(uint32_t propertyIdA, uint32_t propertyIdB, int blockNum, const std::string& matchKey)
+{
+    return TradePairPrefix(propertyIdA, propertyIdB) + strprintf("%010d:%s", blockNum, matchKey);
+}
+
+bool IsTradeIndexKey(const std::string& key)
+{
+    return key.compare(0, TRADE_INDEX_ADDRESS.size(), TRADE_INDEX_ADDRESS) == 0 ||
+           key.compare(0, TRADE_INDEX_PAIR.size(), TRADE_INDEX_PAIR) == 0 ||
+           key == TRADE_INDEX_VERSION_KEY;
+}
+
+/** Derives the index entry of a trade or match record, and the block of the record. */
+bool GetTradeIndexEntry(const std::string& key, const std::string& value, std::string& indexKey, std::string& indexValue, int& blockNum)
+{
+    std::vector<std::string> vstr;
+    boost::split(vstr, value, boost::is_any_of(":"), token_compress_on);
+    if (key.size() == 64 && vstr.size() == 5) {
+        blockNum = atoi(vstr[3]);
+        indexKey = TradeAddressKey(vstr[0], blockNum, atoi(vstr[4]), key);
+        indexValue = vstr[1] + ":" + vstr[2];
+        return true;
+    }
+    // matches recorded before trading fees have 7 tokens
+    if (key.size() == 129 && (vstr.size() == 7 || vstr.size() == 8)) {
+        blockNum = atoi(vstr[6]);
+        indexKey = TradePairKey(boost::lexical_cast<uint32_t>(vstr[2]), boost::lexical_cast<uint32_t>(vstr[3]), blockNum, key);
+        indexValue = "";
+        return true;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
+void CMPTradeList::ensureIndexes()
+{
+  if (!pdb) return;
+  std::string strVersion;
+  if (pdb->Get(readoptions, TRADE_INDEX_VERSION_KEY, &strVersion).ok() && strVersion == TRADE_INDEX_VERSION) return;
+
+  leveldb::WriteBatch batch;
+  unsigned int n_indexed = 0;
+  leveldb::Iterator* it = NewIterator();
+  for(it->SeekToFirst(); it->Valid(); it->Next()) {
+      std::string strKey = it->key().ToString();
+      std::string indexKey, indexValue;
+      int blockNum;
+      if (IsTradeIndexKey(strKey)) continue;
+      if (!GetTradeIndexEntry(strKey, it->value().ToString(), indexKey, indexValue, blockNum)) continue;
+      batch.Put(indexKey, indexValue);
+      ++n_indexed;
+  }
+  delete it;
+
+  batch.Put(TRADE_INDEX_VERSION_KEY, TRADE_INDEX_VERSION);
+  Status status = pdb->Write(syncoptions, &batch);
+  PrintToLog("%s(): indexed %d trade records: %s\n", __FUNCTION__, n_indexed, status.ToString());
+}
+
 bool CMPTradeList::getMatchingTrades(const uint256& txid, uint32_t propertyId, UniValue& tradeArray, int64_t& totalSold, int64_t& totalReceived)
 {
   if (!pdb) return false;
@@ -3354,6 +3514,7 @@ bool CMPTradeList::getMatchingTrades(const uint256& txid, uint32_t propertyId, U
       std::string strKey = it->key().ToString();
       std::string strValue = it->value().ToString();
       std::string matchTxid;
+      if (IsTradeIndexKey(strKey)) continue;
       size_t txidMatch = strKey.find(txidStr);
       if (txidMatch == std::string::npos) continue; // no match
 
@@ -3413,28 +3574,65 @@ bool CMPTradeList::getMatchingTrades(const uint256& txid, uint32_t propertyId, U
   if (count) { return true; } else { return false; }
 }
 
-bool CompareTradePair(const std::pair<int64_t, UniValue>& firstJSONObj, const std::pair<int64_t, UniValue>& secondJSONObj)
+bool CompareTradePair(const std::pair<int64_t, std::string>& firstMatch, const std::pair<int64_t, std::string>& secondMatch)
 {
-    return firstJSONObj.first > secondJSONObj.first;
+    return firstMatch.first > secondMatch.first;
 }
 
 // obtains an array of matching trades with pricing and volume details for a pair sorted by blocknumber
 void CMPTradeList::getTradesForPair(uint32_t propertyIdSideA, uint32_t propertyIdSideB, UniValue& responseArray, uint64_t count)
 {
   if (!pdb) return;
+  // at least one trade is returned, also for a count of zero
+  uint64_t wanted = std::max<uint64_t>(count, 1);
+
+  // walk the pair's index backwards from the most recent match, taking whole blocks until there are enough
+  // matches recorded before trading fees can't be reported and don't count towards the requested number
+  const std::string prefix = TradePairPrefix(propertyIdSideA, propertyIdSideB);
+  std::vector<std::pair<int64_t, std::string> > vecMatches;
+  std::map<std::string, std::string> mapValues;
   leveldb::Iterator* it = NewIterator();
-  std::vector<std::pair<int64_t, UniValue> > vecResponse;
+  it->Seek(prefix + "~");
+  if (it->Valid()) {
+      it->Prev();
+  } else {
+      it->SeekToLast();
+  }
+  for (; it->Valid() && it->key().starts_with(prefix); it->Prev()) {
+      std::string strKey = it->key().ToString().substr(prefix.size());
+      size_t separator = strKey.find(':');
+      if (separator == std::string::npos) continue;
+      int64_t blockNum = atoi(strKey.substr(0, separator));
+      if (vecMatches.size() >= wanted && blockNum != vecMatches.back().first) break;
+      std::string strMatchKey = strKey.substr(separator + 1);
+      std::string strValue;
+      if (!pdb->Get(readoptions, strMatchKey, &strValue).ok()) {
+          PrintToLog("TRADEDB error - indexed match not found (%s)\n", strMatchKey);
+          continue;
+      }
+      ++nRead;
+      if (std::count(strValue.begin(), strValue.end(), ':') != 7) continue;
+      vecMatches.push_back(std::make_pair(blockNum, strMatchKey));
+      mapValues[strMatchKey] = strValue;
+  }
+  delete it;
+
+  // most recent first, matches of one block in key order, then keep the requested number oldest first
+  std::reverse(vecMatches.begin(), vecMatches.end());
+  std::stable_sort(vecMatches.begin(), vecMatches.end(), CompareTradePair);
+  if (vecMatches.size() > wanted) vecMatches.resize(wanted);
+  std::reverse(vecMatches.begin(), vecMatches.end());
+
   bool propertyIdSideAIsDivisible = isPropertyDivisible(propertyIdSideA);
   bool propertyIdSideBIsDivisible = isPropertyDivisible(propertyIdSideB);
-  for(it->SeekToFirst(); it->Valid(); it->Next()) {
-      std::string strKey = it->key().ToString();
-      std::string strValue = it->value().ToString();
+  for (std::vector<std::pair<int64_t, std::string> >::iterator itMatch = vecMatches.begin(); itMatch != vecMatches.end(); ++itMatch) {
+      const std::string& strKey = itMatch->second;
+      const std::string& strValue = mapValues[strKey];
       std::vector<std::string> vecKeys;
       std::vector<std::string> vecValues;
       uint256 sellerTxid, matchingTxid;
       std::string sellerAddress, matchingAddress;
       int64_t amountReceived = 0, amountSold = 0;
-      if (strKey.size() != 129) continue; // only interested in matches
       boost::split(vecKeys, strKey, boost::is_any_of("+"), boost::token_compress_on);
       boost::split(vecValues, strValue, boost::is_any_of(":"), boost::token_compress_on);
       if (vecKeys.size() != 2 || vecValues.size() != 8) {
@@ -3488,26 +3686,8 @@ void CMPTradeList::getTradesForPair(uint32_t propertyIdSideA, uint32_t propertyI
       }
       trade.push_back(Pair("matchingtxid", matchingTxid.GetHex()));
       trade.push_back(Pair("matchingaddress", matchingAddress));
-      vecResponse.push_back(make_pair(blockNum, trade));
+      responseArray.push_back(trade);
   }
-
-  // sort the response most recent first before adding to the array
-  std::sort(vecResponse.begin(), vecResponse.end(), CompareTradePair);
-  uint64_t processed = 0;
-  for (std::vector<std::pair<int64_t, UniValue> >::iterator it = vecResponse.begin(); it != vecResponse.end(); ++it) {
-      responseArray.push_back(it->second);
-      processed++;
-      if (processed >= count) break;
-  }
-
-  std::vector<UniValue> responseArrayValues = responseArray.getValues();
-  std::reverse(responseArrayValues.begin(), responseArrayValues.end());
-  responseArray.clear();
-  for (std::vector<UniValue>::iterator it = responseArrayValues.begin(); it != responseArrayValues.end(); ++it) {
-      responseArray.push_back(*it);
-  }
-
-  delete it;
 }
 
 // obtains a vector of txids where the supplied address participated in a trade (needed for gettradehistory_MP)
@@ -3516,40 +3696,35 @@ void CMPTradeList::getTradesForPair(uint32_t propertyIdSideA, uint32_t propertyI
 void CMPTradeList::getTradesForAddress(std::string address, std::vector<uint256>& vecTransactions, uint32_t propertyIdFilter)
 {
   if (!pdb) return;
-  std::map<std::string,uint256> mapTrades;
+  const std::string prefix = TradeAddressPrefix(address);
   leveldb::Iterator* it = NewIterator();
-  for(it->SeekToFirst(); it->Valid(); it->Next()) {
-      std::string strKey = it->key().ToString();
+  for(it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+      std::string strKey = it->key().ToString().substr(prefix.size());
       std::string strValue = it->value().ToString();
+      std::vector<std::string> vecKeys;
       std::vector<std::string> vecValues;
-      if (strKey.size() != 64) continue; // only interested in trades
-      uint256 txid = uint256S(strKey);
-      size_t addressMatch = strValue.find(address);
-      if (addressMatch == std::string::npos) continue;
+      boost::split(vecKeys, strKey, boost::is_any_of(":"), token_compress_on);
       boost::split(vecValues, strValue, boost::is_any_of(":"), token_compress_on);
-      if (vecValues.size() != 5) {
-          PrintToLog("TRADEDB error - unexpected number of tokens in value (%s)\n", strValue);
+      if (vecKeys.size() != 3 || vecValues.size() != 2) {
+          PrintToLog("TRADEDB error - unexpected number of tokens in index entry (%s:%s)\n", strKey, strValue);
           continue;
       }
-      uint32_t propertyIdForSale = boost::lexical_cast<uint32_t>(vecValues[1]);
-      uint32_t propertyIdDesired = boost::lexical_cast<uint32_t>(vecValues[2]);
-      int64_t blockNum = boost::lexical_cast<uint32_t>(vecValues[3]);
-      int64_t txIndex = boost::lexical_cast<uint32_t>(vecValues[4]);
+      uint32_t propertyIdForSale = boost::lexical_cast<uint32_t>(vecValues[0]);
+      uint32_t propertyIdDesired = boost::lexical_cast<uint32_t>(vecValues[1]);
       if (propertyIdFilter != 0 && propertyIdFilter != propertyIdForSale && propertyIdFilter != propertyIdDesired) continue;
-      std::string sortKey = strprintf("%06d%010d", blockNum, txIndex);
-      mapTrades.insert(std::make_pair(sortKey, txid));
+      vecTransactions.push_back(uint256S(vecKeys[2]));
   }
   delete it;
-  for (std::map<std::string,uint256>::iterator it = mapTrades.begin(); it != mapTrades.end(); it++) {
-      vecTransactions.push_back(it->second);
-  }
 }
 
 void CMPTradeList::recordNewTrade(const uint256& txid, const std::string& address, uint32_t propertyIdForSale, uint32_t propertyIdDesired, int blockNum, int blockIndex)
 {
   if (!pdb) return;
   std::string strValue = strprintf("%s:%d:%d:%d:%d", address, propertyIdForSale, propertyIdDesired, blockNum, blockIndex);
-  Status status = pdb->Put(writeoptions, txid.ToString(), strValue);
+  leveldb::WriteBatch batch;
+  batch.Put(txid.ToString(), strValue);
+  batch.Put(TradeAddressKey(address, blockNum, blockIndex, txid.ToString()), strprintf("%d:%d", propertyIdForSale, propertyIdDesired));
+  Status status = pdb->Write(writeoptions, &batch);
   ++nWritten;
   if (elysium_debug_tradedb) PrintToLog("%s(): %s\n", __FUNCTION__, status.ToString());
 }
@@ -3559,13 +3734,12 @@ void CMPTradeList::recordMatchedTrade(const uint256 txid1, const uint256 txid2,
   if (!pdb) return;
   const string key = txid1.ToString() + "+" + txid2.ToString();
   const string value = strprintf("%s:%s:%u:%u:%lu:%lu:%d:%d", address1, address2, prop1, prop2, amount1, amount2, blockNum, fee);
-  Status status;
-  if (pdb)
-  {
-    status = pdb->Put(writeoptions, key, value);
-    ++nWritten;
-    if (elysium_debug_tradedb) PrintToLog("%s(): %s\n", __FUNCTION__, status.ToString());
-  }
+  leveldb::WriteBatch batch;
+  batch.Put(key, value);
+  batch.Put(TradePairKey(prop1, prop2, blockNum, key), "");
+  Status status = pdb->Write(writeoptions, &batch);
+  ++nWritten;
+  if (elysium_debug_tradedb) PrintToLog("%s(): %s\n", __FUNCTION__, status.ToString());
 }
 
 /**
@@ -3577,8 +3751,6 @@ int CMPTradeList::deleteAboveBlock(int blockNum)
 {
   leveldb::Slice skey, svalue;
   unsigned int count = 0;
-  std::vector<std::string> vstr;
-  int block = 0;
   unsigned int n_found = 0;
   leveldb::Iterator* it = NewIterator();
   for(it->SeekToFirst(); it->Valid(); it->Next())
@@ -3586,14 +3758,20 @@ int CMPTradeList::deleteAboveBlock(int blockNum)
     skey = it->key();
     svalue = it->value();
     ++count;
-    string strvalue = it->value().ToString();
-    boost::split(vstr, strvalue, boost::is_any_of(":"), token_compress_on);
-    if (7 == vstr.size()) block = atoi(vstr[6]); // trade matches have 7 tokens, key is txid+txid, only care about block
-    if (5 == vstr.size()) block = atoi(vstr[3]); // trades have 5 tokens, key is txid, only care about block
+    string strkey = skey.ToString();
+    string strvalue = svalue.ToString();
+    std::string indexKey, indexValue;
+    int block = 0;
+    if (IsTradeIndexKey(strkey)) continue; // removed together with their records
+    // trades have 5 tokens and txid keys, matches have 8 tokens and txid+txid keys, only care about block
+    if (!GetTradeIndexEntry(strkey, strvalue, indexKey, indexValue, block)) continue;
     if (block >= blockNum) {
         ++n_found;
-        PrintToLog("%s() DELETING FROM TRADEDB: %s=%s\n", __FUNCTION__, skey.ToString(), svalue.ToString());
-        pdb->Delete(writeoptions, skey);
+        PrintToLog("%s() DELETING FROM TRADEDB: %s=%s\n", __FUNCTION__, strkey, strvalue);
+        leveldb::WriteBatch batch;
+        batch.Delete(skey);
+        batch.Delete(indexKey);
+        pdb->Write(writeoptions, &batch);
     }
   }
 
@@ -3616,6 +3794,7 @@ int CMPTradeList::getMPTradeCountTotal()
     Iterator* it = NewIterator();
     for(it->SeekToFirst(); it->Valid(); it->Next())
     {
+        if (IsTradeIndexKey(it->key().ToString())) continue;
         ++count;
     }
     delete it;
@@ -3753,6 +3932,59 @@ int elysium_handler_block_begin(int nBlockPrev, CBlockIndex const * pBlockIndex)
     return 0;
 }
 
+/**
+ * Parses the Elysium transactions of a block before they are processed one by one, and
+ * verifies the proofs of all Sigma spends among them at once. Proofs do not depend on the
+ * tally, so they are checked concurrently; elysium_handler_tx() then only applies the
+ * transactions. Must be called after elysium_handler_block_begin().
+ */
+void elysium_handler_block_parse(const CBlock& block, int nBlock, const CBlockIndex* pBlockIndex)
+{
+    LOCK(cs_main);
+
+    if (!elysiumInitialized) {
+        elysium_init();
+    }
+
+    blockTxsParsed.clear();
+    hashBlockTxsParsed = pBlockIndex->GetBlockHash();
+
+    // we do not care about parsing blocks prior to our waterline (empty blockchain defense)
+    if (nBlock < nWaterlineBlock) return;
+    int64_t nBlockTime = pBlockIndex->GetBlockTime();
+    bool const fPadding = nBlock >= ::Params().GetConsensus().nSigmaPaddingBlock;
+
+    std::vector<SigmaSpendCheck> spends;
+
+    for (unsigned int idx = 0; idx < block.vtx.size(); idx++) {
+        std::unique_ptr<CMPTransaction> mp_obj(new CMPTransaction());
+        mp_obj->unlockLogic();
+
+        if (parseTransaction(false, *block.vtx[idx], nBlock, idx, *mp_obj, nBlockTime, pBlockIndex) != 0) {
+            continue;
+        }
+
+        // Processing interprets the payload again, the spend is only decoded here to check its proof
+        if (mp_obj->interpret_Transaction() && mp_obj->getType() == ELYSIUM_TYPE_SIMPLE_SPEND) {
+            spends.push_back(SigmaSpendCheck{
+                mp_obj->getHash(),
+                mp_obj->getProperty(),
+                mp_obj->getDenomination(),
+                mp_obj->getGroup(),
+                mp_obj->getGroupSize(),
+                mp_obj->getSpend(),
+                mp_obj->getSerial(),
+                fPadding});
+        }
+
+        blockTxsParsed[idx] = std::move(mp_obj);
+    }
+
+    // The proof and serial pointers are only valid for the duration of this call: processing a
+    // transaction interprets its payload again, which replaces them
+    txProcessor->SetVerifiedSpends(VerifySigmaSpends(spends));
+}
+
 // called once per block, after the block has been processed
 // TODO: consolidate into *handler_block_begin() << need to adjust Accept expiry check.............
 // it performs cleanup and other functions
@@ -3765,6 +3997,11 @@ int elysium_handler_block_end(int nBlockNow, CBlockIndex const * pBlockIndex,
         elysium_init();
     }
 
+    // drop whatever was parsed ahead but not processed
+    blockTxsParsed.clear();
+    hashBlockTxsParsed.SetNull();
+    txProcessor->SetVerifiedSpends({});
+
     // for every new received block must do:
     // 1) remove expired entries from the accept list (per spec accept entries are
     //    valid until their blocklimit expiration; because the customer can keep
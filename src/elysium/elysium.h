@@ -1,11 +1,11 @@
 #ifndef ZCOIN_ELYSIUM_ELYSIUM_H
 #define ZCOIN_ELYSIUM_ELYSIUM_H
 
+class CBlock;
 class CBlockIndex;
-class CCoinsView;
-class CCoinsViewCache;
 class CTransaction;
 
+#include "inputcache.h"
 #include "log.h"
 #include "persistence.h"
 #include "tally.h"
@@ -164,6 +164,7 @@ public:
     {
         leveldb::Status status = Open(path, fWipe);
         PrintToLog("Loading trades database: %s\n", status.ToString());
+        if (status.ok()) ensureIndexes();
     }
 
     virtual ~CMPTradeList()
@@ -174,6 +175,8 @@ public:
     void recordMatchedTrade(const uint256 txid1, const uint256 txid2, string address1, string address2, unsigned int prop1, unsigned int prop2, uint64_t amount1, uint64_t amount2, int blockNum, int64_t fee);
     void recordNewTrade(const uint256& txid, const std::string& address, uint32_t propertyIdForSale, uint32_t propertyIdDesired, int blockNum, int blockIndex);
     int deleteAboveBlock(int blockNum);
+    /** Builds the address and pair index entries for trades recorded before they were introduced. */
+    void ensureIndexes();
     bool exists(const uint256 &txid);
     void printStats();
     void printAll();
@@ -262,6 +265,7 @@ void NotifyTotalTokensChanged(uint32_t propertyId, int block);
 int elysium_handler_disc_begin(int nBlockNow, CBlockIndex const * pBlockIndex);
 int elysium_handler_disc_end(int nBlockNow, CBlockIndex const * pBlockIndex);
 int elysium_handler_block_begin(int nBlockNow, CBlockIndex const * pBlockIndex);
+void elysium_handler_block_parse(const CBlock& block, int nBlock, const CBlockIndex* pBlockIndex);
 int elysium_handler_block_end(int nBlockNow, CBlockIndex const * pBlockIndex, unsigned int);
 bool elysium_handler_tx(const CTransaction& tx, int nBlock, unsigned int idx, const CBlockIndex* pBlockIndex);
 int elysium_save_state( CBlockIndex const *pBlockIndex );
@@ -274,10 +278,9 @@ extern CMPTradeList *t_tradelistdb;
 extern CMPSTOList *s_stolistdb;
 extern CElysiumTransactionDB *p_ElysiumTXDB;
 
-// TODO: move, rename
-extern CCoinsView viewDummy;
-extern CCoinsViewCache view;
-//! Guards coins view cache
+//! Outputs spent by inputs of transactions parsed outside of block processing
+extern InputCache inputCache;
+//! Guards the input cache
 extern CCriticalSection cs_tx_cache;
 
 std::string strMPProperty(uint32_t propertyId);
@@ -0,0 +1,59 @@
+#include "inputcache.h"
+
+#include <algorithm>
+
+namespace elysium {
+
+InputCache::InputCache(size_t maxSize) : maxSize(std::max<size_t>(maxSize, 1)), hits(0), misses(0)
+{
+}
+
+bool InputCache::Get(const COutPoint& outpoint, CTxOut& txOut)
+{
+    auto it = index.find(outpoint);
+    if (it == index.end()) {
+        misses++;
+        return false;
+    }
+
+    entries.splice(entries.begin(), entries, it->second);
+    txOut = it->second->second;
+    hits++;
+    return true;
+}
+
+void InputCache::Add(const COutPoint& outpoint, const CTxOut& txOut)
+{
+    auto it = index.find(outpoint);
+    if (it != index.end()) {
+        it->second->second = txOut;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    entries.emplace_front(outpoint, txOut);
+    index.emplace(outpoint, entries.begin());
+    Trim();
+}
+
+void InputCache::Clear()
+{
+    entries.clear();
+    index.clear();
+}
+
+void InputCache::SetMaxSize(size_t size)
+{
+    maxSize = std::max<size_t>(size, 1);
+    Trim();
+}
+
+void InputCache::Trim()
+{
+    while (entries.size() > maxSize) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+} // namespace elysium
@@ -0,0 +1,59 @@
+#ifndef ELYSIUM_INPUTCACHE_H
+#define ELYSIUM_INPUTCACHE_H
+
+#include "../primitives/transaction.h"
+
+#include <list>
+#include <map>
+#include <utility>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace elysium
+{
+/** Default number of outputs kept by the input cache (see -elysiumtxcache) */
+static const size_t DEFAULT_INPUT_CACHE_SIZE = 500000;
+
+/**
+ * Least recently used cache of the outputs spent by transaction inputs.
+ *
+ * Used to resolve senders and input amounts of transactions which are not
+ * parsed as part of a connected block, such as those looked up via RPC.
+ * Blocks provide the spent outputs through their undo data instead.
+ */
+class InputCache
+{
+public:
+    explicit InputCache(size_t maxSize = DEFAULT_INPUT_CACHE_SIZE);
+
+    /** Looks up the output spent by an input and marks it as most recently used */
+    bool Get(const COutPoint& outpoint, CTxOut& txOut);
+
+    /** Adds an output, evicting the least recently used one when the cache is full */
+    void Add(const COutPoint& outpoint, const CTxOut& txOut);
+
+    void Clear();
+
+    size_t Size() const { return entries.size(); }
+    size_t MaxSize() const { return maxSize; }
+    void SetMaxSize(size_t size);
+
+    uint64_t Hits() const { return hits; }
+    uint64_t Misses() const { return misses; }
+
+private:
+    typedef std::list<std::pair<COutPoint, CTxOut>> Entries;
+
+    //! Entries ordered from most to least recently used
+    Entries entries;
+    std::map<COutPoint, Entries::iterator> index;
+    size_t maxSize;
+    uint64_t hits;
+    uint64_t misses;
+
+    void Trim();
+};
+}
+
+#endif // ELYSIUM_INPUTCACHE_H
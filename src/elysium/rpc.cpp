@@ -1739,7 +1739,8 @@ UniValue elysium_listblocktransactions(const UniValue& params, bool fHelp)
 
     LOCK(cs_main);
 
-    BOOST_FOREACH(const CTransaction&tx, block.vtx) {
+    for (const CTransactionRef& ptx : block.vtx) {
+        const CTransaction& tx = *ptx;
         if (p_txlistdb->exists(tx.GetHash())) {
             // later we can add a verbose flag to decode here, but for now callers can send returned txids into gettransaction_MP
             // add the txid into the response as it's an MP transaction
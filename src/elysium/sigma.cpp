@@ -5,8 +5,11 @@
 
 #include "../main.h"
 #include "../sync.h"
+#include "../taskpool.h"
 
+#include <algorithm>
 #include <iterator>
+#include <tuple>
 #include <vector>
 
 namespace elysium {
@@ -35,4 +38,52 @@ bool VerifySigmaSpend(
     return proof.Verify(serial, anonimitySet.begin(), anonimitySet.end(), fPadding);
 }
 
+std::map<uint256, bool> VerifySigmaSpends(const std::vector<SigmaSpendCheck>& spends)
+{
+    typedef std::tuple<PropertyId, SigmaDenomination, SigmaMintGroup> GroupKey;
+
+    // Mints are only ever appended to a group, so the first groupSize of the largest set any
+    // spend asks for is exactly the set VerifySigmaSpend() would read for that spend.
+    std::map<GroupKey, std::vector<SigmaPublicKey>> anonimitySets;
+    {
+        std::map<GroupKey, size_t> groupSizes;
+        for (auto& spend : spends) {
+            auto& size = groupSizes[GroupKey(spend.property, spend.denomination, spend.group)];
+            size = std::max(size, spend.groupSize);
+        }
+
+        LOCK(cs_main);
+        for (auto& size : groupSizes) {
+            auto& anonimitySet = anonimitySets[size.first];
+            sigmaDb->GetAnonimityGroup(
+                std::get<0>(size.first), std::get<1>(size.first), std::get<2>(size.first), size.second,
+                std::back_inserter(anonimitySet));
+        }
+    }
+
+    // -1 for spends which cannot be decided yet
+    std::vector<int> results(spends.size(), -1);
+
+    ParallelFor(0, spends.size(), [&](size_t i) {
+        auto& spend = spends[i];
+        auto& anonimitySet = anonimitySets.at(GroupKey(spend.property, spend.denomination, spend.group));
+
+        if (anonimitySet.size() < spend.groupSize) {
+            return;
+        }
+
+        results[i] = spend.proof->Verify(
+            *spend.serial, anonimitySet.begin(), anonimitySet.begin() + spend.groupSize, spend.fPadding);
+    });
+
+    std::map<uint256, bool> verified;
+    for (size_t i = 0; i < spends.size(); i++) {
+        if (results[i] >= 0) {
+            verified[spends[i].tx] = results[i] != 0;
+        }
+    }
+
+    return verified;
+}
+
 } // namespace elysium
@@ -4,6 +4,11 @@
 #include "property.h"
 #include "sigmaprimitives.h"
 
+#include "../uint256.h"
+
+#include <map>
+#include <vector>
+
 #include <stddef.h>
 
 namespace elysium {
@@ -17,6 +22,27 @@ bool VerifySigmaSpend(
     const secp_primitives::Scalar& serial,
     bool fPadding);
 
+/** A spend to check with VerifySigmaSpends(). Proof and serial are borrowed for the duration of the call. */
+struct SigmaSpendCheck
+{
+    uint256 tx;
+    PropertyId property;
+    SigmaDenomination denomination;
+    SigmaMintGroup group;
+    size_t groupSize;
+    const SigmaProof *proof;
+    const secp_primitives::Scalar *serial;
+    bool fPadding;
+};
+
+/**
+ * Verify the proofs of many spends concurrently, reading every (property, denomination, group)
+ * anonymity set from the database only once. Returns the outcome keyed by transaction, which is
+ * what VerifySigmaSpend() would return for it. Spends whose group does not hold groupSize mints
+ * yet are left out, because mints recorded before the spend is processed may still complete it.
+ */
+std::map<uint256, bool> VerifySigmaSpends(const std::vector<SigmaSpendCheck>& spends);
+
 } // namespace elysium
 
 #endif // ZCOIN_ELYSIUM_SIGMA_H
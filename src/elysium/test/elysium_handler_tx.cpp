@@ -88,12 +88,83 @@ BOOST_AUTO_TEST_CASE(elysium_parse_normal_tx)
     auto block = getHeighestBlock();
     BOOST_CHECK_EQUAL(2, block.vtx.size());
 
-    CTransaction elysiumTx = block.vtx[1];
+    CTransaction elysiumTx = *block.vtx[1];
     CMPTransaction mp_obj;
 
     BOOST_CHECK_EQUAL(0, ParseTransaction(elysiumTx, chainActive.Height(), 1, mp_obj, block.GetBlockTime()));
 }
 
+BOOST_AUTO_TEST_CASE(elysium_parse_tx_inputs_from_undo)
+{
+    pwalletMain->SetBroadcastTransactions(true);
+    std::string fromAddress = CBitcoinAddress(pubkey.GetID()).ToString();
+
+    std::vector<unsigned char> payload = CreatePayload_IssuanceFixed(
+        2, 1, 0, "Companies", "", "undo", "", "", CAmount(1)
+    );
+
+    uint256 txid;
+    std::string rawHex;
+    BOOST_CHECK_EQUAL(
+        0, // No error
+        elysium::WalletTxBuilder(fromAddress, "", "", 0, payload, txid, rawHex, true)
+    );
+
+    CreateAndProcessBlock({}, scriptPubKey);
+    auto block = getHeighestBlock();
+    BOOST_REQUIRE_EQUAL(2, block.vtx.size());
+
+    CTransaction elysiumTx = *block.vtx[1];
+
+    // The outputs spent by the transaction, as the wallet knows them
+    CAmount inAll = 0;
+    {
+        LOCK(pwalletMain->cs_wallet);
+        for (const CTxIn& txIn : elysiumTx.vin) {
+            auto it = pwalletMain->mapWallet.find(txIn.prevout.hash);
+            BOOST_REQUIRE(it != pwalletMain->mapWallet.end());
+            inAll += it->second.vout[txIn.prevout.n].nValue;
+        }
+    }
+
+    uint64_t misses;
+    {
+        LOCK(elysium::cs_tx_cache);
+        elysium::inputCache.Clear();
+        misses = elysium::inputCache.Misses();
+    }
+
+    // As part of its block, the sender and input amount come from the undo data alone
+    CMPTransaction mp_obj;
+    int ret;
+    bool fTxIndexOld = fTxIndex;
+    fTxIndex = false;
+    {
+        LOCK(cs_main);
+        ret = ParseTransaction(elysiumTx, chainActive.Height(), 1, mp_obj, block.GetBlockTime(), chainActive.Tip());
+    }
+    fTxIndex = fTxIndexOld;
+
+    BOOST_CHECK_EQUAL(0, ret);
+    BOOST_CHECK_EQUAL(fromAddress, mp_obj.getSender());
+    BOOST_CHECK_EQUAL(static_cast<uint64_t>(inAll - elysiumTx.GetValueOut()), mp_obj.getFeePaid());
+    {
+        LOCK(elysium::cs_tx_cache);
+        BOOST_CHECK_EQUAL(0, elysium::inputCache.Size());
+        BOOST_CHECK_EQUAL(misses, elysium::inputCache.Misses());
+    }
+
+    // Without the block the inputs are looked up, and end up in the cache
+    CMPTransaction mp_rpc;
+    BOOST_CHECK_EQUAL(0, ParseTransaction(elysiumTx, chainActive.Height(), 1, mp_rpc, block.GetBlockTime()));
+    BOOST_CHECK_EQUAL(mp_obj.getSender(), mp_rpc.getSender());
+    BOOST_CHECK_EQUAL(mp_obj.getFeePaid(), mp_rpc.getFeePaid());
+    {
+        LOCK(elysium::cs_tx_cache);
+        BOOST_CHECK_EQUAL(elysiumTx.vin.size(), elysium::inputCache.Size());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(elysium_parse_normal_tx_with_spend)
 {
     pwalletMain->SetBroadcastTransactions(true);
@@ -118,7 +189,7 @@ BOOST_AUTO_TEST_CASE(elysium_parse_normal_tx_with_spend)
     auto block = getHeighestBlock();
     BOOST_CHECK_EQUAL(2, block.vtx.size());
 
-    CTransaction elysiumTx = block.vtx[1];
+    CTransaction elysiumTx = *block.vtx[1];
     CMPTransaction mp_obj;
 
     BOOST_CHECK_EQUAL(0, ParseTransaction(elysiumTx, chainActive.Height(), 1, mp_obj, block.GetBlockTime()));
@@ -157,7 +228,7 @@ BOOST_AUTO_TEST_CASE(elysium_parse_sigma_tx_with_non_spend)
     auto block = getHeighestBlock();
     BOOST_CHECK_EQUAL(2, block.vtx.size());
 
-    CTransaction sigmaTx = block.vtx[1];
+    CTransaction sigmaTx = *block.vtx[1];
     CMPTransaction mp_obj;
 
     BOOST_CHECK_EQUAL(0, ParseTransaction(sigmaTx, chainActive.Height(), 1, mp_obj, block.GetBlockTime()));
@@ -189,7 +260,7 @@ BOOST_AUTO_TEST_CASE(elysium_parse_sigma_tx_with_spend)
     auto block = getHeighestBlock();
     BOOST_CHECK_EQUAL(2, block.vtx.size());
 
-    CTransaction sigmaTx = block.vtx[1];
+    CTransaction sigmaTx = *block.vtx[1];
     CMPTransaction mp_obj;
 
     BOOST_CHECK_EQUAL(0, ParseTransaction(sigmaTx, chainActive.Height(), 1, mp_obj, block.GetBlockTime()));
@@ -0,0 +1,85 @@
+#include "elysium/inputcache.h"
+
+#include "primitives/transaction.h"
+#include "uint256.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace elysium;
+
+namespace {
+
+COutPoint OutPoint(uint32_t n)
+{
+    return COutPoint(uint256S("6bb7bd70ff6fb8c4a6a4e2a96da86c1c3fde5d3e7c3a3dcd0e4fb28e3a4a8b1a"), n);
+}
+
+CTxOut TxOut(CAmount value)
+{
+    return CTxOut(value, CScript() << OP_TRUE);
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(elysium_inputcache_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(inputcache_get)
+{
+    InputCache cache(10);
+    CTxOut txOut;
+
+    BOOST_CHECK(!cache.Get(OutPoint(0), txOut));
+
+    cache.Add(OutPoint(0), TxOut(100));
+    cache.Add(OutPoint(1), TxOut(200));
+
+    BOOST_CHECK(cache.Get(OutPoint(1), txOut));
+    BOOST_CHECK(txOut == TxOut(200));
+    BOOST_CHECK(cache.Get(OutPoint(0), txOut));
+    BOOST_CHECK(txOut == TxOut(100));
+    BOOST_CHECK(!cache.Get(OutPoint(2), txOut));
+
+    BOOST_CHECK_EQUAL(cache.Size(), 2);
+    BOOST_CHECK_EQUAL(cache.Hits(), 2);
+    BOOST_CHECK_EQUAL(cache.Misses(), 2);
+
+    // Adding again replaces the output
+    cache.Add(OutPoint(0), TxOut(300));
+    BOOST_CHECK(cache.Get(OutPoint(0), txOut));
+    BOOST_CHECK(txOut == TxOut(300));
+    BOOST_CHECK_EQUAL(cache.Size(), 2);
+
+    cache.Clear();
+    BOOST_CHECK_EQUAL(cache.Size(), 0);
+    BOOST_CHECK(!cache.Get(OutPoint(0), txOut));
+}
+
+BOOST_AUTO_TEST_CASE(inputcache_evicts_least_recently_used)
+{
+    InputCache cache(3);
+    CTxOut txOut;
+
+    cache.Add(OutPoint(0), TxOut(100));
+    cache.Add(OutPoint(1), TxOut(101));
+    cache.Add(OutPoint(2), TxOut(102));
+
+    // Using the oldest entry keeps it in the cache
+    BOOST_CHECK(cache.Get(OutPoint(0), txOut));
+
+    cache.Add(OutPoint(3), TxOut(103));
+    BOOST_CHECK_EQUAL(cache.Size(), 3);
+    BOOST_CHECK(!cache.Get(OutPoint(1), txOut));
+    BOOST_CHECK(cache.Get(OutPoint(0), txOut));
+    BOOST_CHECK(cache.Get(OutPoint(2), txOut));
+    BOOST_CHECK(cache.Get(OutPoint(3), txOut));
+
+    // Shrinking drops the least recently used entries
+    cache.SetMaxSize(1);
+    BOOST_CHECK_EQUAL(cache.Size(), 1);
+    BOOST_CHECK(cache.Get(OutPoint(3), txOut));
+    BOOST_CHECK(txOut == TxOut(103));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
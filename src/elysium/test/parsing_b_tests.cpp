@@ -43,14 +43,11 @@ static CTransaction TxClassB(const std::vector<CTxOut>& txInputs, const std::vec
         inputTx.vout.push_back(txOut);
         CTransaction tx(inputTx);
 
-        // Populate transaction cache:
-        CCoinsModifier coins = view.ModifyCoins(tx.GetHash());
-
-        if (nOut >= coins->vout.size()) {
-            coins->vout.resize(nOut+1);
+        // Populate input cache:
+        {
+            LOCK(cs_tx_cache);
+            inputCache.Add(COutPoint(tx.GetHash(), nOut), txOut);
         }
-        coins->vout[nOut].scriptPubKey = txOut.scriptPubKey;
-        coins->vout[nOut].nValue = txOut.nValue;
 
         // Add input:
         CTxIn txIn(tx.GetHash(), nOut);
@@ -42,14 +42,11 @@ static CTransaction TxClassC(const std::vector<CTxOut>& txInputs)
         inputTx.vout.push_back(txOut);
         CTransaction tx(inputTx);
 
-        // Populate transaction cache:
-        CCoinsModifier coins = view.ModifyCoins(tx.GetHash());
-
-        if (nOut >= coins->vout.size()) {
-            coins->vout.resize(nOut+1);
+        // Populate input cache:
+        {
+            LOCK(cs_tx_cache);
+            inputCache.Add(COutPoint(tx.GetHash(), nOut), txOut);
         }
-        coins->vout[nOut].scriptPubKey = txOut.scriptPubKey;
-        coins->vout[nOut].nValue = txOut.nValue;
 
         // Add input:
         CTxIn txIn(tx.GetHash(), nOut);
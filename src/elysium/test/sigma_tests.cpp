@@ -100,6 +100,62 @@ BOOST_FIXTURE_TEST_CASE(verify_spend, SigmaDatabaseFixture)
     BOOST_CHECK_EQUAL(VerifySigmaSpend(3, 0, 1, sigmaDb->groupSize, proof, key.serial, false), false);
 }
 
+BOOST_FIXTURE_TEST_CASE(verify_spends, SigmaDatabaseFixture)
+{
+    auto& params = DefaultSigmaParams;
+    SigmaPrivateKey key1, key2;
+    std::vector<SigmaPublicKey> anonimitySet;
+
+    key1.Generate();
+    key2.Generate();
+
+    anonimitySet.push_back(SigmaPublicKey(key1, params));
+    anonimitySet.push_back(SigmaPublicKey(key2, params));
+
+    for (auto& mint : CreateMints(3)) {
+        anonimitySet.push_back(mint);
+    }
+
+    for (auto& mint : anonimitySet) {
+        sigmaDb->RecordMint(3, 0, mint, 100);
+        sigmaDb->RecordMint(4, 0, CreateMint(), 100);
+    }
+
+    // key1 spends with the whole set and key2 with a prefix of it, from the same group.
+    SigmaProof proof1(params, key1, anonimitySet.begin(), anonimitySet.end(), false);
+    SigmaProof proof2(params, key2, anonimitySet.begin(), anonimitySet.begin() + 3, false);
+
+    std::vector<SigmaSpendCheck> spends = {
+        {uint256S("01"), 3, 0, 0, anonimitySet.size(), &proof1, &key1.serial, false},
+        {uint256S("02"), 3, 0, 0, 3, &proof2, &key2.serial, false},
+        {uint256S("03"), 3, 0, 0, anonimitySet.size(), &proof1, &key2.serial, false},
+        {uint256S("04"), 4, 0, 0, anonimitySet.size(), &proof1, &key1.serial, false},
+        {uint256S("05"), 3, 0, 0, anonimitySet.size() + 1, &proof1, &key1.serial, false}
+    };
+
+    auto verified = VerifySigmaSpends(spends);
+
+    // Spends against a group which is not complete yet are left out.
+    BOOST_CHECK_EQUAL(verified.size(), 4);
+    BOOST_CHECK_EQUAL(verified.count(uint256S("05")), 0);
+
+    for (auto& spend : spends) {
+        auto it = verified.find(spend.tx);
+        if (it == verified.end()) {
+            continue;
+        }
+        BOOST_CHECK_EQUAL(it->second, VerifySigmaSpend(
+            spend.property, spend.denomination, spend.group, spend.groupSize, *spend.proof, *spend.serial, spend.fPadding));
+    }
+
+    BOOST_CHECK_EQUAL(verified[uint256S("01")], true);
+    BOOST_CHECK_EQUAL(verified[uint256S("02")], true);
+    BOOST_CHECK_EQUAL(verified[uint256S("03")], false);
+    BOOST_CHECK_EQUAL(verified[uint256S("04")], false);
+
+    BOOST_CHECK(VerifySigmaSpends({}).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace elysium
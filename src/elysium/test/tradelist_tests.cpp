@@ -0,0 +1,274 @@
+#include "../elysium.h"
+#include "../mdex.h"
+#include "../sp.h"
+
+#include "random.h"
+#include "test/test_bitcoin.h"
+#include "tinyformat.h"
+#include "utilstrencodings.h"
+
+#include <univalue.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace elysium {
+namespace {
+
+/** Trade database with the full scan lookups it used before the indexes, as a reference. */
+class TestTradeList : public CMPTradeList
+{
+public:
+    TestTradeList(const boost::filesystem::path& path, bool fWipe) : CMPTradeList(path, fWipe)
+    {
+    }
+
+    void ScanTradesForAddress(const std::string& address, std::vector<uint256>& vecTransactions, uint32_t propertyIdFilter)
+    {
+        std::map<std::string, uint256> mapTrades;
+        leveldb::Iterator* it = NewIterator();
+        for (it->SeekToFirst(); it->Valid(); it->Next()) {
+            std::string strKey = it->key().ToString();
+            std::string strValue = it->value().ToString();
+            std::vector<std::string> vecValues;
+            if (strKey.size() != 64) continue;
+            uint256 txid = uint256S(strKey);
+            if (strValue.find(address) == std::string::npos) continue;
+            boost::split(vecValues, strValue, boost::is_any_of(":"), boost::token_compress_on);
+            if (vecValues.size() != 5) continue;
+            uint32_t propertyIdForSale = boost::lexical_cast<uint32_t>(vecValues[1]);
+            uint32_t propertyIdDesired = boost::lexical_cast<uint32_t>(vecValues[2]);
+            int64_t blockNum = boost::lexical_cast<uint32_t>(vecValues[3]);
+            int64_t txIndex = boost::lexical_cast<uint32_t>(vecValues[4]);
+            if (propertyIdFilter != 0 && propertyIdFilter != propertyIdForSale && propertyIdFilter != propertyIdDesired) continue;
+            mapTrades.insert(std::make_pair(strprintf("%06d%010d", blockNum, txIndex), txid));
+        }
+        delete it;
+        for (const auto& trade : mapTrades) {
+            vecTransactions.push_back(trade.second);
+        }
+    }
+
+    // The scan sorted with std::sort, which leaves the order of a block's matches unspecified;
+    // the reference keeps them in key order, as the index does
+    void ScanTradesForPair(uint32_t propertyIdSideA, uint32_t propertyIdSideB, UniValue& responseArray, uint64_t count)
+    {
+        std::vector<std::pair<int64_t, UniValue> > vecResponse;
+        leveldb::Iterator* it = NewIterator();
+        for (it->SeekToFirst(); it->Valid(); it->Next()) {
+            std::string strKey = it->key().ToString();
+            std::string strValue = it->value().ToString();
+            std::vector<std::string> vecKeys;
+            std::vector<std::string> vecValues;
+            uint256 sellerTxid, matchingTxid;
+            std::string sellerAddress, matchingAddress;
+            int64_t amountReceived = 0, amountSold = 0;
+            if (strKey.size() != 129) continue;
+            boost::split(vecKeys, strKey, boost::is_any_of("+"), boost::token_compress_on);
+            boost::split(vecValues, strValue, boost::is_any_of(":"), boost::token_compress_on);
+            if (vecKeys.size() != 2 || vecValues.size() != 8) continue;
+            uint32_t tradePropertyIdSideA = boost::lexical_cast<uint32_t>(vecValues[2]);
+            uint32_t tradePropertyIdSideB = boost::lexical_cast<uint32_t>(vecValues[3]);
+            if (tradePropertyIdSideA == propertyIdSideA && tradePropertyIdSideB == propertyIdSideB) {
+                sellerTxid.SetHex(vecKeys[1]);
+                sellerAddress = vecValues[1];
+                amountSold = boost::lexical_cast<int64_t>(vecValues[4]);
+                matchingTxid.SetHex(vecKeys[0]);
+                matchingAddress = vecValues[0];
+                amountReceived = boost::lexical_cast<int64_t>(vecValues[5]);
+            } else if (tradePropertyIdSideB == propertyIdSideA && tradePropertyIdSideA == propertyIdSideB) {
+                sellerTxid.SetHex(vecKeys[0]);
+                sellerAddress = vecValues[0];
+                amountSold = boost::lexical_cast<int64_t>(vecValues[5]);
+                matchingTxid.SetHex(vecKeys[1]);
+                matchingAddress = vecValues[1];
+                amountReceived = boost::lexical_cast<int64_t>(vecValues[4]);
+            } else {
+                continue;
+            }
+
+            rational_t unitPrice(amountReceived, amountSold);
+            rational_t inversePrice(amountSold, amountReceived);
+            int64_t blockNum = boost::lexical_cast<int64_t>(vecValues[6]);
+
+            UniValue trade(UniValue::VOBJ);
+            trade.push_back(Pair("block", blockNum));
+            trade.push_back(Pair("unitprice", xToString(unitPrice)));
+            trade.push_back(Pair("inverseprice", xToString(inversePrice)));
+            trade.push_back(Pair("sellertxid", sellerTxid.GetHex()));
+            trade.push_back(Pair("selleraddress", sellerAddress));
+            trade.push_back(Pair("amountsold", FormatDivisibleMP(amountSold)));
+            trade.push_back(Pair("amountreceived", FormatDivisibleMP(amountReceived)));
+            trade.push_back(Pair("matchingtxid", matchingTxid.GetHex()));
+            trade.push_back(Pair("matchingaddress", matchingAddress));
+            vecResponse.push_back(std::make_pair(blockNum, trade));
+        }
+        delete it;
+
+        std::stable_sort(vecResponse.begin(), vecResponse.end(), [](const std::pair<int64_t, UniValue>& a, const std::pair<int64_t, UniValue>& b) {
+            return a.first > b.first;
+        });
+        uint64_t processed = 0;
+        std::vector<UniValue> values;
+        for (const auto& response : vecResponse) {
+            values.push_back(response.second);
+            if (++processed >= count) break;
+        }
+        std::reverse(values.begin(), values.end());
+        for (const UniValue& value : values) {
+            responseArray.push_back(value);
+        }
+    }
+
+    //! Drops the indexes, leaving the database as written by earlier versions
+    void DropIndexes()
+    {
+        leveldb::Iterator* it = NewIterator();
+        for (it->SeekToFirst(); it->Valid(); it->Next()) {
+            std::string strKey = it->key().ToString();
+            if (strKey.size() != 64 && strKey.size() != 129) {
+                pdb->Delete(writeoptions, it->key());
+            }
+        }
+        delete it;
+    }
+};
+
+const std::vector<uint32_t> PROPERTIES = {1, 2, 3, 2147483651};
+
+std::string RandomAddress()
+{
+    // letters only, so an address never occurs inside another value
+    std::string address = "a";
+    while (address.size() < 34) {
+        address += "abcdefghijkmnopqrstuvwxyzABCDEFGHJKLMNPQRSTUVWXYZ"[GetRandInt(49)];
+    }
+    return address;
+}
+
+struct TradeListTestingSetup : TestingSetup
+{
+    std::vector<std::string> addresses;
+
+    TradeListTestingSetup() : TestingSetup(CBaseChainParams::REGTEST)
+    {
+        _my_sps = new CMPSPInfo(pathTemp / "MP_spinfo_test", true);
+        for (int i = 0; i < 5; i++) {
+            addresses.push_back(RandomAddress());
+        }
+    }
+
+    ~TradeListTestingSetup()
+    {
+        delete _my_sps;
+        _my_sps = nullptr;
+    }
+
+    void Fill(CMPTradeList& db)
+    {
+        std::set<std::pair<int, int>> positions;
+        for (int i = 0; i < 200; i++) {
+            int block = 100 + GetRandInt(40), index = GetRandInt(1000);
+            if (!positions.insert(std::make_pair(block, index)).second) continue;
+            uint32_t forSale = PROPERTIES[GetRandInt(PROPERTIES.size())];
+            uint32_t desired = PROPERTIES[GetRandInt(PROPERTIES.size())];
+            db.recordNewTrade(GetRandHash(), addresses[GetRandInt(addresses.size())], forSale, desired, block, index);
+        }
+        for (int i = 0; i < 300; i++) {
+            uint32_t prop1 = PROPERTIES[GetRandInt(PROPERTIES.size())];
+            uint32_t prop2 = PROPERTIES[GetRandInt(PROPERTIES.size())];
+            if (prop1 == prop2) continue;
+            db.recordMatchedTrade(GetRandHash(), GetRandHash(), addresses[GetRandInt(addresses.size())], addresses[GetRandInt(addresses.size())],
+                prop1, prop2, 1 + GetRand(10000000000), 1 + GetRand(10000000000), 100 + GetRandInt(40), GetRand(1000));
+        }
+    }
+
+    void CheckAgainstScan(TestTradeList& db)
+    {
+        for (const std::string& address : addresses) {
+            for (uint32_t filter : {0u, 1u, 2u, 3u, 2147483651u, 99u}) {
+                std::vector<uint256> indexed, scanned;
+                db.getTradesForAddress(address, indexed, filter);
+                db.ScanTradesForAddress(address, scanned, filter);
+                BOOST_CHECK(indexed == scanned);
+            }
+        }
+        for (uint32_t sideA : PROPERTIES) {
+            for (uint32_t sideB : PROPERTIES) {
+                for (uint64_t count : {0, 1, 2, 5, 17, 1000}) {
+                    UniValue indexed(UniValue::VARR), scanned(UniValue::VARR);
+                    db.getTradesForPair(sideA, sideB, indexed, count);
+                    db.ScanTradesForPair(sideA, sideB, scanned, count);
+                    BOOST_CHECK_EQUAL(indexed.write(), scanned.write());
+                }
+            }
+        }
+    }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(elysium_tradelist_tests, TradeListTestingSetup)
+
+BOOST_AUTO_TEST_CASE(indexed_lookups_match_scan)
+{
+    TestTradeList db(pathTemp / "MP_tradelist_test", true);
+    Fill(db);
+    CheckAgainstScan(db);
+
+    UniValue trades(UniValue::VARR);
+    db.getTradesForPair(1, 2, trades, 1000);
+    BOOST_CHECK(trades.size() > 0);
+}
+
+BOOST_AUTO_TEST_CASE(indexes_follow_reorgs)
+{
+    TestTradeList db(pathTemp / "MP_tradelist_test", true);
+    Fill(db);
+    int total = db.getMPTradeCountTotal();
+
+    BOOST_CHECK(db.deleteAboveBlock(130) > 0);
+    BOOST_CHECK(db.getMPTradeCountTotal() < total);
+    CheckAgainstScan(db);
+
+    // Everything from block 130 on is gone, including matches
+    for (uint32_t sideA : PROPERTIES) {
+        for (uint32_t sideB : PROPERTIES) {
+            UniValue trades(UniValue::VARR);
+            db.getTradesForPair(sideA, sideB, trades, 1000);
+            for (size_t i = 0; i < trades.size(); i++) {
+                BOOST_CHECK(find_value(trades[i], "block").get_int64() < 130);
+            }
+        }
+    }
+
+    Fill(db);
+    CheckAgainstScan(db);
+}
+
+BOOST_AUTO_TEST_CASE(indexes_built_for_existing_database)
+{
+    {
+        TestTradeList db(pathTemp / "MP_tradelist_test", true);
+        Fill(db);
+        db.DropIndexes();
+        std::vector<uint256> trades;
+        db.getTradesForAddress(addresses[0], trades);
+        BOOST_CHECK(trades.empty());
+    }
+
+    TestTradeList db(pathTemp / "MP_tradelist_test", false);
+    CheckAgainstScan(db);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace elysium
@@ -0,0 +1,129 @@
+#include "../elysium.h"
+#include "../tally.h"
+#include "../walletcache.h"
+
+#include "base58.h"
+#include "key.h"
+#include "main.h"
+#include "random.h"
+#include "sync.h"
+#include "wallet/wallet.h"
+#include "wallet/test/wallet_test_fixture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <string>
+
+extern CWallet* pwalletMain;
+
+namespace elysium {
+namespace {
+
+struct WalletCacheTestingSetup : WalletTestingSetup
+{
+    WalletCacheTestingSetup()
+    {
+        WalletCacheConnect();
+        WalletCacheUpdate();
+    }
+
+    ~WalletCacheTestingSetup()
+    {
+        WalletCacheDisconnect();
+        LOCK(cs_main);
+        mp_tally_map.clear();
+    }
+
+    std::string NewWalletAddress()
+    {
+        LOCK(pwalletMain->cs_wallet);
+        return CBitcoinAddress(pwalletMain->GenerateNewKey().GetID()).ToString();
+    }
+};
+
+bool IsCached(const std::string& address)
+{
+    LOCK(cs_main);
+    return WalletCacheAddresses().count(address) > 0;
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(elysium_walletcache_tests, WalletCacheTestingSetup)
+
+BOOST_AUTO_TEST_CASE(foreign_addresses_are_ignored)
+{
+    CKey key;
+    key.MakeNewKey(true);
+    std::string address = CBitcoinAddress(key.GetPubKey().GetID()).ToString();
+
+    BOOST_CHECK(update_tally_map(address, 3, 100, BALANCE));
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 0);
+    BOOST_CHECK(!IsCached(address));
+
+    BOOST_CHECK(update_tally_map(address, 3, -50, BALANCE));
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(wallet_balance_changes)
+{
+    std::string address = NewWalletAddress();
+
+    BOOST_CHECK(update_tally_map(address, 3, 100, BALANCE));
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 1);
+    BOOST_CHECK(IsCached(address));
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 0);
+
+    BOOST_CHECK(update_tally_map(address, 3, -40, BALANCE));
+    BOOST_CHECK(update_tally_map(address, 3, 40, SELLOFFER_RESERVE));
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 1);
+
+    // an update which leaves the balances unchanged is not reported
+    BOOST_CHECK(update_tally_map(address, 3, 10, BALANCE));
+    BOOST_CHECK(update_tally_map(address, 3, -10, BALANCE));
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 0);
+
+    {
+        LOCK(cs_main);
+        std::map<std::string, int>::const_iterator it = WalletCacheAddresses().find(address);
+        BOOST_CHECK(it != WalletCacheAddresses().end());
+        BOOST_CHECK_EQUAL(it->second, static_cast<int>(ISMINE_SPENDABLE));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(added_keys_are_picked_up)
+{
+    CKey key;
+    key.MakeNewKey(true);
+    CPubKey pubKey = key.GetPubKey();
+    std::string address = CBitcoinAddress(pubKey.GetID()).ToString();
+
+    BOOST_CHECK(update_tally_map(address, 3, 100, BALANCE));
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 0);
+    BOOST_CHECK(!IsCached(address));
+
+    {
+        LOCK(pwalletMain->cs_wallet);
+        BOOST_CHECK(pwalletMain->AddKeyPubKey(key, pubKey));
+    }
+
+    BOOST_CHECK_EQUAL(WalletCacheUpdate(), 1);
+    BOOST_CHECK(IsCached(address));
+}
+
+BOOST_AUTO_TEST_CASE(txid_cache_rejects_duplicates)
+{
+    size_t size = walletTXIDCache.size();
+    uint256 hash = GetRandHash();
+
+    WalletTXIDCacheAdd(hash);
+    WalletTXIDCacheAdd(hash);
+
+    BOOST_CHECK_EQUAL(walletTXIDCache.size(), size + 1);
+    BOOST_CHECK(walletTXIDCache.back() == hash);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace elysium
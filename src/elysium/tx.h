@@ -2,6 +2,7 @@
 #define ZCOIN_ELYSIUM_TX_H
 
 class CMPMetaDEx;
+class CBlockIndex;
 class CMPOffer;
 class CTransaction;
 
@@ -378,7 +379,12 @@ private:
     std::vector<unsigned char> raw;
 };
 
-/** Parses a transaction and populates the CMPTransaction object. */
-int ParseTransaction(const CTransaction& tx, int nBlock, unsigned int idx, CMPTransaction& mptx, unsigned int nTime=0);
+/**
+ * Parses a transaction and populates the CMPTransaction object. Given the block
+ * index of a connected block, the spent outputs come from its undo data, and
+ * cs_main must be locked.
+ */
+int ParseTransaction(const CTransaction& tx, int nBlock, unsigned int idx, CMPTransaction& mptx, unsigned int nTime=0,
+        const CBlockIndex* pBlockIndex=nullptr);
 
 #endif // ZCOIN_ELYSIUM_TX_H
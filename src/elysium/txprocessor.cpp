@@ -40,6 +40,12 @@ int TxProcessor::ProcessTx(CMPTransaction& tx)
     return 0;
 }
 
+void TxProcessor::SetVerifiedSpends(std::map<uint256, bool> verified)
+{
+    LOCK(cs_main);
+    verifiedSpends = std::move(verified);
+}
+
 int TxProcessor::ProcessSimpleMint(const CMPTransaction& tx)
 {
     auto block = tx.getBlock();
@@ -194,10 +200,13 @@ int TxProcessor::ProcessSimpleSpend(const CMPTransaction& tx)
         }
     }
 
-    // check serial in database
+    // check serial in database, then the proof unless it was checked along with the rest of the block
     uint256 spendTx;
+    auto verified = verifiedSpends.find(tx.getHash());
     if (sigmaDb->HasSpendSerial(property, denomination, *serial, spendTx)
-        || !VerifySigmaSpend(property, denomination, group, groupSize, *spend, *serial, fPadding)) {
+        || !(verified != verifiedSpends.end()
+            ? verified->second
+            : VerifySigmaSpend(property, denomination, group, groupSize, *spend, *serial, fPadding))) {
         PrintToLog("%s(): rejected: spend is invalid\n", __func__);
         return PKT_ERROR_SIGMA - 907;
     }
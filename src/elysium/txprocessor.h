@@ -5,8 +5,12 @@
 #include "sigmaprimitives.h"
 #include "tx.h"
 
+#include "../uint256.h"
+
 #include <boost/signals2/signal.hpp>
 
+#include <map>
+
 namespace elysium {
 
 class TxProcessor
@@ -14,6 +18,9 @@ class TxProcessor
 public:
     int ProcessTx(CMPTransaction& tx);
 
+    //! Use spend proof outcomes found ahead of processing, see VerifySigmaSpends(); replaces earlier ones
+    void SetVerifiedSpends(std::map<uint256, bool> verified);
+
 public:
     boost::signals2::signal<void(PropertyId, SigmaDenomination, SigmaMintGroup, SigmaMintIndex, const SigmaPublicKey&)> SimpleMintProcessed;
     boost::signals2::signal<void(const CMPTransaction&)> TransactionProcessed;
@@ -21,6 +28,9 @@ public:
 private:
     int ProcessSimpleMint(const CMPTransaction& tx);
     int ProcessSimpleSpend(const CMPTransaction& tx);
+
+private:
+    std::map<uint256, bool> verifiedSpends;
 };
 
 extern TxProcessor *txProcessor;
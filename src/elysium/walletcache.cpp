@@ -4,6 +4,7 @@
 #include "tally.h"
 #include "wallettxs.h"
 
+#include "../base58.h"
 #include "../init.h"
 #include "../main.h"
 #include "../sync.h"
@@ -12,7 +13,8 @@
 #include "../wallet/wallet.h"
 #endif
 
-#include <algorithm>
+#include <boost/signals2/connection.hpp>
+
 #include <list>
 #include <map>
 #include <set>
@@ -27,16 +29,36 @@ namespace elysium {
 //! Global vector of Elysium transactions in the wallet
 std::vector<uint256> walletTXIDCache;
 
+//! Transactions in walletTXIDCache, for duplicate detection
+static std::set<uint256> walletTXIDs;
+
 //! Map of wallet balances
 static std::map<std::string, CMPTally> walletBalancesCache;
 
+//! Wallet addresses with a tally, mapped to their IsMine type (guarded by cs_main)
+static std::map<std::string, int> walletAddresses;
+
+//! Wallet addresses whose tally changed since the last update (guarded by cs_main)
+static std::set<std::string> changedAddresses;
+
+//! Addresses new to the tally map, which are not known to be in the wallet or not (guarded by cs_main)
+static std::set<std::string> unknownAddresses;
+
+//! Guards addedAddresses, which is filled by the wallet with cs_wallet held
+static CCriticalSection cs_addedAddresses;
+
+//! Addresses added to the wallet since the last update
+static std::set<std::string> addedAddresses;
+
+static boost::signals2::connection keyAddedConnection;
+
 /**
  * Adds a txid to the wallet txid cache, performing duplicate detection.
  */
 void WalletTXIDCacheAdd(const uint256& hash)
 {
     if (elysium_debug_walletcache) PrintToLog("WALLETTXIDCACHE: Adding tx to txid cache : %s\n", hash.GetHex());
-    if (std::find(walletTXIDCache.begin(), walletTXIDCache.end(), hash) != walletTXIDCache.end()) {
+    if (!walletTXIDs.insert(hash).second) {
         PrintToLog("ERROR: Wallet TXID Cache blocked duplicate insertion for %s\n", hash.GetHex());
     } else {
         walletTXIDCache.push_back(hash);
@@ -61,7 +83,7 @@ void WalletTXIDCacheInit()
         if (pwtx != NULL) {
             // get the hash of the transaction and check leveldb to see if this is an Elysium tx, if so add to cache
             const uint256& hash = pwtx->GetHash();
-            if (p_txlistdb->exists(hash)) {
+            if (p_txlistdb->exists(hash) && walletTXIDs.insert(hash).second) {
                 walletTXIDCache.push_back(hash);
                 if (elysium_debug_walletcache) PrintToLog("WALLETTXIDCACHE: Adding tx to txid cache : %s\n", hash.GetHex());
             }
@@ -73,25 +95,42 @@ void WalletTXIDCacheInit()
 /**
  * Updates the cache with the latest state, returning true if changes were made to wallet addresses (including watch only).
  *
- * Also prepares a list of addresses that were changed (for future usage).
+ * Only addresses reported through WalletCacheNotifyTally() and WalletCacheNotifyAddress() since the previous update are
+ * looked at, so the cost depends on the activity of the wallet rather than on the number of Elysium addresses.
  */
 int WalletCacheUpdate()
 {
     if (elysium_debug_walletcache) PrintToLog("WALLETCACHE: Update requested\n");
     int numChanges = 0;
-    std::set<std::string> changedAddresses;
 
     LOCK(cs_main);
 
-    for (std::unordered_map<string, CMPTally>::iterator my_it = mp_tally_map.begin(); my_it != mp_tally_map.end(); ++my_it) {
-        const std::string& address = my_it->first;
+    std::set<std::string> added;
+    {
+        LOCK(cs_addedAddresses);
+        added.swap(addedAddresses);
+    }
+    for (const std::string& address : added) {
+        if (mp_tally_map.count(address)) unknownAddresses.insert(address);
+    }
 
-        // determine if this address is in the wallet
+    // determine which of the new addresses are in the wallet
+    for (const std::string& address : unknownAddresses) {
+        if (!mp_tally_map.count(address)) continue; // tally was cleared meanwhile
         int addressIsMine = IsMyAddress(address);
         if (!addressIsMine) {
             if (elysium_debug_walletcache) PrintToLog("WALLETCACHE: Ignoring non-wallet address %s\n", address);
+            walletAddresses.erase(address);
             continue; // ignore this address, not in wallet
         }
+        walletAddresses[address] = addressIsMine;
+        changedAddresses.insert(address);
+    }
+    unknownAddresses.clear();
+
+    for (const std::string& address : changedAddresses) {
+        std::unordered_map<std::string, CMPTally>::iterator my_it = mp_tally_map.find(address);
+        if (my_it == mp_tally_map.end()) continue;
 
         // obtain & init the tally
         CMPTally& tally = my_it->second;
@@ -101,13 +140,12 @@ int WalletCacheUpdate()
         std::map<std::string, CMPTally>::iterator search_it = walletBalancesCache.find(address);
         if (search_it == walletBalancesCache.end()) { // cache miss, new address
             ++numChanges;
-            changedAddresses.insert(address);
             walletBalancesCache.insert(std::make_pair(address,tally));
             if (elysium_debug_walletcache) PrintToLog("WALLETCACHE: *CACHE MISS* - %s not in cache\n", address);
             continue;
         }
 
-        // check cache for miss on balance - TODO TRY AND OPTIMIZE THIS
+        // check cache for miss on balance
         CMPTally &cacheTally = search_it->second;
         uint32_t propertyId;
         while (0 != (propertyId = (tally.next()))) {
@@ -117,17 +155,71 @@ int WalletCacheUpdate()
                     tally.getMoney(propertyId, ACCEPT_RESERVE) != cacheTally.getMoney(propertyId, ACCEPT_RESERVE) ||
                     tally.getMoney(propertyId, METADEX_RESERVE) != cacheTally.getMoney(propertyId, METADEX_RESERVE)) { // cache miss, balance
                 ++numChanges;
-                changedAddresses.insert(address);
-                walletBalancesCache.erase(search_it);
-                walletBalancesCache.insert(std::make_pair(address,tally));
+                search_it->second = tally;
                 if (elysium_debug_walletcache) PrintToLog("WALLETCACHE: *CACHE MISS* - %s balance for property %d differs\n", address, propertyId);
                 break;
             }
         }
     }
+    changedAddresses.clear();
+
     if (elysium_debug_walletcache) PrintToLog("WALLETCACHE: Update finished - there were %d changes\n", numChanges);
     return numChanges;
 }
 
+/**
+ * Records a change of the tally of an address.
+ *
+ * Called by update_tally_map() with cs_main held. Changes of addresses, which are known not to be in the wallet, are
+ * dropped right away.
+ */
+void WalletCacheNotifyTally(const std::string& address, bool created)
+{
+    AssertLockHeld(cs_main);
+
+    if (created) {
+        unknownAddresses.insert(address);
+    } else if (walletAddresses.count(address)) {
+        changedAddresses.insert(address);
+    }
+}
+
+/**
+ * Records an address, which was added to the wallet.
+ *
+ * May be called with cs_wallet held, so cs_main must not be acquired here.
+ */
+void WalletCacheNotifyAddress(const std::string& address)
+{
+    LOCK(cs_addedAddresses);
+    addedAddresses.insert(address);
+}
+
+const std::map<std::string, int>& WalletCacheAddresses()
+{
+    AssertLockHeld(cs_main);
+    return walletAddresses;
+}
+
+#ifdef ENABLE_WALLET
+static void NotifyKeyAdded(CWallet *wallet, const CTxDestination& address)
+{
+    WalletCacheNotifyAddress(CBitcoinAddress(address).ToString());
+}
+#endif
+
+void WalletCacheConnect()
+{
+#ifdef ENABLE_WALLET
+    if (pwalletMain && !keyAddedConnection.connected()) {
+        keyAddedConnection = pwalletMain->NotifyKeyAdded.connect(&NotifyKeyAdded);
+    }
+#endif
+}
+
+void WalletCacheDisconnect()
+{
+    keyAddedConnection.disconnect();
+}
 
 } // namespace elysium
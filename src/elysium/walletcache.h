@@ -3,6 +3,8 @@
 
 class uint256;
 
+#include <map>
+#include <string>
 #include <vector>
 
 namespace elysium
@@ -18,6 +20,21 @@ void WalletTXIDCacheInit();
 
 /** Updates the cache and returns whether any wallet addresses were changed */
 int WalletCacheUpdate();
+
+/** Records a change of the tally of an address, created indicates the address is new to the tally map */
+void WalletCacheNotifyTally(const std::string& address, bool created);
+
+/** Records an address which was added to the wallet and has to be checked for a tally */
+void WalletCacheNotifyAddress(const std::string& address);
+
+/** Returns the wallet addresses (including watch only) with a tally, mapped to their IsMine type */
+const std::map<std::string, int>& WalletCacheAddresses();
+
+/** Subscribes to key additions of the wallet */
+void WalletCacheConnect();
+
+/** Unsubscribes from key additions of the wallet */
+void WalletCacheDisconnect();
 }
 
 #endif // ELYSIUM_WALLETCACHE_H
@@ -271,6 +271,22 @@ bool CHDMintTracker::UpdateState(const CMintMeta& meta)
     return true;
 }
 
+/**
+ * Remember the outpoint of a mint in memory.
+ *
+ * The outpoint names the mint transaction, so it does not change when the mint is reorganized into another block.
+ *
+ * @param hashSerial mint serial hash
+ * @param outPoint mint output
+ * @return void
+ */
+void CHDMintTracker::SetMintOutPoint(const uint256& hashSerial, const COutPoint& outPoint)
+{
+    auto it = mapSerialHashes.find(hashSerial);
+    if (it != mapSerialHashes.end())
+        it->second.outPoint = outPoint;
+}
+
 /**
  * Add a mint object to memory.
  * 
@@ -423,6 +439,8 @@ bool CHDMintTracker::UpdateMetaStatus(const std::set<uint256>& setMempool, CMint
     bool isMintInChain = GetOutPoint(outPoint, pubCoin);
     LogPrintf("UpdateMetaStatus : isMintInChain: %d\n", isMintInChain);
     const uint256& txidMint = outPoint.hash;
+    if (isMintInChain)
+        mint.outPoint = outPoint;
 
     //See if there is internal record of spending this mint (note this is memory only, would reset on restart - next function checks this)
     bool isPendingSpend = static_cast<bool>(mapPendingSpends.count(mint.hashSerial));
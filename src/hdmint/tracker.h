@@ -46,6 +46,7 @@ public:
     void SetPubcoinNotUsed(const uint256& hashPubcoin);
     bool UnArchive(const uint256& hashPubcoin, bool isDeterministic);
     bool UpdateState(const CMintMeta& meta);
+    void SetMintOutPoint(const uint256& hashSerial, const COutPoint& outPoint);
     void Clear();
 };
 
@@ -26,7 +26,9 @@
  * @param strWalletFile wallet file string
  * @return CHDMintWallet object
  */
-CHDMintWallet::CHDMintWallet(const std::string& strWalletFile, bool resetCount) : tracker(strWalletFile)
+CHDMintWallet::CHDMintWallet(const std::string& strWalletFile, bool resetCount) :
+    nCountNextUse(COUNT_DEFAULT), nCountNextGenerate(COUNT_DEFAULT), tracker(strWalletFile),
+    nCountSynced(COUNT_DEFAULT), fCatchUpRunning(false), fCatchUpPending(false)
 {
     this->strWalletFile = strWalletFile;
     CWalletDB walletdb(strWalletFile);
@@ -47,6 +49,17 @@ CHDMintWallet::CHDMintWallet(const std::string& strWalletFile, bool resetCount)
     }
 }
 
+/**
+ * Destructor for CHDMintWallet object.
+ *
+ * Waits for a running catch-up, which stops early once shutdown was requested.
+ */
+CHDMintWallet::~CHDMintWallet()
+{
+    if (threadCatchUp.joinable())
+        threadCatchUp.join();
+}
+
 /**
  * Constructor helper function.
  *
@@ -141,7 +154,6 @@ std::pair<uint256,uint256> CHDMintWallet::RegenerateMintPoolEntry(const uint160&
  */
 void CHDMintWallet::GenerateMintPool(int32_t nIndex)
 {
-    CWalletDB walletdb(strWalletFile);
     //Is locked
     if (pwalletMain->IsLocked())
         return;
@@ -151,6 +163,11 @@ void CHDMintWallet::GenerateMintPool(int32_t nIndex)
         return;
     }
 
+    // Write the new entries in a single transaction
+    LOCK(pwalletMain->cs_wallet);
+    CDBWriteBatch batch(strWalletFile);
+    CWalletDB walletdb(strWalletFile);
+
     int32_t nLastCount = nCountNextGenerate;
     int32_t nStop = nLastCount + 20;
     if(nIndex > 0 && nIndex >= nLastCount)
@@ -174,8 +191,8 @@ void CHDMintWallet::GenerateMintPool(int32_t nIndex)
 
         MintPoolEntry mintPoolEntry(hashSeedMaster, seedId, nLastCount);
         mintPool.Add(make_pair(hashPubcoin, mintPoolEntry));
-        CWalletDB(strWalletFile).WritePubcoin(primitives::GetSerialHash(coin.getSerialNumber()), commitmentValue);
-        CWalletDB(strWalletFile).WriteMintPoolPair(hashPubcoin, mintPoolEntry);
+        walletdb.WritePubcoin(primitives::GetSerialHash(coin.getSerialNumber()), commitmentValue);
+        walletdb.WriteMintPoolPair(hashPubcoin, mintPoolEntry);
         LogPrintf("%s : hashSeedMaster=%s hashPubcoin=%s seedId=%d count=%d\n", __func__, hashSeedMaster.GetHex(), hashPubcoin.GetHex(), seedId.GetHex(), nLastCount);
     }
 
@@ -226,12 +243,32 @@ bool CHDMintWallet::GetSerialForPubcoin(const std::vector<std::pair<uint256, Gro
     return fFound;
 }
 
+namespace {
+
+//! Mints found on chain which SyncWithChain records in one wallet database transaction
+const size_t SYNC_MINTS_PER_BATCH = 100;
+
+//! A mint of the wallet found on chain, looked up before the wallet is locked to record it
+struct CFoundMint
+{
+    std::pair<uint256, MintPoolEntry> mintPoolPair;
+    CWalletTx wtx;
+    CHDMint dMint;
+    boost::optional<CWalletTx> wtxSpend;
+};
+
+} // anon namespace
+
 /**
  * Catch the mint counter up with the chain.
  *
  * Mints are created deterministically so we can completely regenerate all mints and transaction data for them from chain data.
  * Rather than a single pass of listMints, we wrap each pass in an outer while loop, that continues until no updates are found.
  * The reason for this is to allow the mint counter in the wallet to update and regenerate more of the mint pool should it need to.
+ *
+ * The chain is searched one mint at a time, taking cs_main around each chain lookup and cs_wallet around each
+ * tracker check. The mints found are recorded a batch at a time under cs_wallet in a single database transaction,
+ * so restoring a large wallet neither flushes after every record nor holds up block validation until it is done.
  * 
  * @param fGenerateMintPool whether or not to call GenerateMintPool. defaults to true
  * @param listMints An optional value. If passed, only sync the mints in this list. Else get all mints in the mintpool
@@ -239,17 +276,53 @@ bool CHDMintWallet::GetSerialForPubcoin(const std::vector<std::pair<uint256, Gro
 void CHDMintWallet::SyncWithChain(bool fGenerateMintPool, boost::optional<std::list<std::pair<uint256, MintPoolEntry>>> listMints)
 {
     bool found = true;
-    CWalletDB walletdb(strWalletFile);
+    bool fFullSync = (listMints == boost::none);
 
     set<uint256> setAddedTx;
     std::set<uint256> setChecked;
+    std::vector<CFoundMint> vFound;
+
+    // Record the mints found so far, committing before cs_wallet is released
+    auto recordFound = [&]() {
+        if (vFound.empty())
+            return;
+        LOCK(pwalletMain->cs_wallet);
+        CDBWriteBatch batch(strWalletFile);
+        CWalletDB walletdb(strWalletFile);
+        for (CFoundMint& mint : vFound) {
+            const uint256& txHash = mint.wtx.GetHash();
+            if (!setAddedTx.count(txHash)) {
+                pwalletMain->AddToWallet(mint.wtx, false, &walletdb);
+                setAddedTx.insert(txHash);
+            }
+            if (mint.wtxSpend)
+                pwalletMain->AddToWallet(mint.wtxSpend.get(), false, &walletdb);
+
+            LogPrintf("%s: Adding mint to tracker.. \n", __func__);
+            // Add to tracker which also adds to database
+            tracker.Add(mint.dMint, true);
+
+            // Only update if the current hashSeedMaster matches the mints'
+            int32_t& mintCount = get<2>(mint.mintPoolPair.second);
+            if(hashSeedMaster == get<0>(mint.mintPoolPair.second) && mintCount >= GetCount()){
+                SetCount(++mintCount);
+                UpdateCountDB();
+                LogPrint("zero", "%s: updated count to %d\n", __func__, nCountNextUse);
+            }
+            batch.CommitIfFull();
+        }
+        vFound.clear();
+    };
+
     while (found) {
         found = false;
+        int32_t nCountPass = nCountNextGenerate;
         if (fGenerateMintPool)
             GenerateMintPool();
         LogPrintf("%s: Mintpool size=%d\n", __func__, mintPool.size());
 
         if(listMints==boost::none){
+            LOCK(pwalletMain->cs_wallet);
             listMints = list<pair<uint256, MintPoolEntry>>();
             mintPool.List(listMints.get());
         }
@@ -258,21 +331,28 @@ void CHDMintWallet::SyncWithChain(bool fGenerateMintPool, boost::optional<std::l
                 continue;
             setChecked.insert(pMint.first);
 
-            if (ShutdownRequested())
+            if (ShutdownRequested()) {
+                recordFound();
                 return;
-
-            uint160& mintHashSeedMaster = get<0>(pMint.second);
-            int32_t& mintCount = get<2>(pMint.second);
+            }
 
             // halt processing if mint already in tracker
-            if (tracker.HasPubcoinHash(pMint.first))
-                continue;
+            {
+                LOCK(pwalletMain->cs_wallet);
+                if (tracker.HasPubcoinHash(pMint.first))
+                    continue;
+            }
 
             COutPoint outPoint;
-            if (sigma::GetOutPoint(outPoint, pMint.first)) {
+            bool fMintInChain;
+            {
+                LOCK(cs_main);
+                fMintInChain = sigma::GetOutPoint(outPoint, pMint.first);
+            }
+            if (fMintInChain) {
                 const uint256& txHash = outPoint.hash;
                 //this mint has already occurred on the chain, increment counter's state to reflect this
-                LogPrintf("%s : Found wallet coin mint=%s count=%d tx=%s\n", __func__, pMint.first.GetHex(), mintCount, txHash.GetHex());
+                LogPrintf("%s : Found wallet coin mint=%s count=%d tx=%s\n", __func__, pMint.first.GetHex(), get<2>(pMint.second), txHash.GetHex());
                 found = true;
 
                 uint256 hashBlock;
@@ -315,53 +395,194 @@ void CHDMintWallet::SyncWithChain(bool fGenerateMintPool, boost::optional<std::l
                 }
 
                 CBlockIndex* pindex = nullptr;
-                if (mapBlockIndex.count(hashBlock))
-                    pindex = mapBlockIndex.at(hashBlock);
+                {
+                    LOCK(cs_main);
+                    if (mapBlockIndex.count(hashBlock))
+                        pindex = mapBlockIndex.at(hashBlock);
+                }
+                if (!pindex) {
+                    LogPrintf("%s : unknown block %s of mint %s!\n", __func__, hashBlock.GetHex(), pMint.first.GetHex());
+                    continue;
+                }
 
+                CFoundMint mint;
+                mint.mintPoolPair = pMint;
+                //Fill out wtx so that a transaction record can be created
+                mint.wtx = CWalletTx(pwalletMain, tx);
+                mint.wtx.nTimeReceived = pindex->GetBlockTime();
                 if (!setAddedTx.count(txHash)) {
                     CBlock block;
-                    CWalletTx wtx(pwalletMain, tx);
-                    if (pindex && ReadBlockFromDisk(block, pindex, Params().GetConsensus())) {
+                    if (ReadBlockFromDisk(block, pindex, Params().GetConsensus())) {
                         LOCK(cs_main);
-                        wtx.SetMerkleBranch(block);
+                        mint.wtx.SetMerkleBranch(block);
                     }
-
-                    //Fill out wtx so that a transaction record can be created
-                    wtx.nTimeReceived = pindex->GetBlockTime();
-                    pwalletMain->AddToWallet(wtx, false, &walletdb);
-                    setAddedTx.insert(txHash);
                 }
 
-                if(!SetMintSeedSeen(pMint, pindex->nHeight, txHash, denomination.get()))
+                if(!LookupSeenMint(pMint, pindex->nHeight, denomination.get(), mint.dMint, mint.wtxSpend))
                     continue;
 
-                // Only update if the current hashSeedMaster matches the mints'
-                if(hashSeedMaster == mintHashSeedMaster && mintCount >= GetCount()){
-                    SetCount(++mintCount);
-                    UpdateCountDB();
-                    LogPrint("zero", "%s: updated count to %d\n", __func__, nCountNextUse);
+                vFound.push_back(std::move(mint));
+                if (vFound.size() >= SYNC_MINTS_PER_BATCH)
+                    recordFound();
+            }
+        }
+        // The counts must be up to date before the next pass generates more of the mint pool
+        recordFound();
+
+        // Clear listMints to allow it to be repopulated by the mintPool on the next iteration.
+        // A partial sync only needs the entries generated since this pass began.
+        if(found) {
+            if (fFullSync) {
+                listMints = boost::none;
+            } else {
+                LOCK(pwalletMain->cs_wallet);
+                listMints = list<pair<uint256, MintPoolEntry>>();
+                ListMintPool(nCountPass, listMints.get());
+            }
+        }
+    }
+
+    LOCK(pwalletMain->cs_wallet);
+    if (fFullSync && !pwalletMain->IsLocked() && !ShutdownRequested())
+        SetSynced();
+}
+
+/**
+ * Catch up with the chain after the wallet was unlocked.
+ *
+ * Does all the work of a full SyncWithChain when the master seed changed or was never synced.
+ * Otherwise only new mint pool entries are checked: blocks connected while the wallet was locked
+ * were already matched against the mint pool by the tracker, but the pool could not grow, so
+ * mints beyond the high-water mark of the last sync may have been missed.
+ *
+ * @return void
+ */
+void CHDMintWallet::CatchUp()
+{
+    // SyncWithChain takes the locks for one lookup or one batch of updates at a time
+    bool fFullSync;
+    {
+        LOCK(pwalletMain->cs_wallet);
+        if (pwalletMain->IsLocked() || ShutdownRequested())
+            return;
+        fFullSync = (hashSeedMasterSynced != hashSeedMaster);
+    }
+
+    if (fFullSync) {
+        SyncWithChain();
+        return;
+    }
+
+    GenerateMintPool();
+    list<pair<uint256, MintPoolEntry>> listMints;
+    int32_t nCountFrom;
+    {
+        LOCK(pwalletMain->cs_wallet);
+        nCountFrom = nCountSynced;
+        if (nCountNextGenerate > nCountSynced)
+            ListMintPool(nCountSynced, listMints);
+    }
+    if (!listMints.empty()) {
+        LogPrintf("%s: syncing %d new mint pool entries from count %d\n", __func__, listMints.size(), nCountFrom);
+        SyncWithChain(false, listMints);
+    }
+
+    LOCK(pwalletMain->cs_wallet);
+    if (!pwalletMain->IsLocked() && !ShutdownRequested())
+        SetSynced();
+}
+
+/**
+ * Bring the mint wallet up to date after the wallet was unlocked.
+ *
+ * Sets the wallet up again if the master seed changed. If anything changed since the last sync
+ * (a new master seed, or a mint pool that was exhausted or grew past the synced high-water mark)
+ * the catch-up is run on a background thread, so unlocking does not wait for it. Wallet
+ * operations which need the mint counts wait for it on cs_wallet.
+ *
+ * @param hashSeedMasterIn current hash master seed
+ * @return void
+ */
+void CHDMintWallet::SyncAfterUnlock(const uint160& hashSeedMasterIn)
+{
+    {
+        LOCK(pwalletMain->cs_wallet);
+        if (hashSeedMasterIn != hashSeedMaster) {
+            if (!SetupWallet(hashSeedMasterIn, false))
+                return;
+        } else if (hashSeedMasterSynced == hashSeedMaster && nCountNextGenerate > nCountNextUse && nCountSynced == nCountNextGenerate) {
+            return;
+        }
+    }
+
+    fCatchUpPending = true;
+    if (fCatchUpRunning.exchange(true))
+        return;
+
+    // The previous thread has cleared fCatchUpRunning and is about to exit
+    if (threadCatchUp.joinable())
+        threadCatchUp.join();
+
+    threadCatchUp = boost::thread([this]() {
+        RenameThread("index-mintsync");
+        while (true) {
+            while (fCatchUpPending.exchange(false)) {
+                try {
+                    CatchUp();
+                } catch (const std::exception& e) {
+                    LogPrintf("%s: %s\n", __func__, e.what());
                 }
             }
+            fCatchUpRunning = false;
+            // Don't lose a request that arrived after the last check
+            if (!fCatchUpPending || fCatchUpRunning.exchange(true))
+                break;
         }
-        // Clear listMints to allow it to be repopulated by the mintPool on the next iteration
-        if(found)
-            listMints = boost::none;
+    });
+}
+
+/**
+ * Record the state of the current master seed as synced with the chain.
+ *
+ * @return void
+ */
+void CHDMintWallet::SetSynced()
+{
+    hashSeedMasterSynced = hashSeedMaster;
+    nCountSynced = nCountNextGenerate;
+}
+
+/**
+ * List the mint pool entries of the current master seed from the given count onwards.
+ *
+ * @param nCountFrom first count to list
+ * @param listMints list the entries are appended to
+ * @return void
+ */
+void CHDMintWallet::ListMintPool(int32_t nCountFrom, std::list<std::pair<uint256, MintPoolEntry>>& listMints)
+{
+    for (const auto& mintPoolPair : mintPool) {
+        if (get<0>(mintPoolPair.second) == hashSeedMaster && get<2>(mintPoolPair.second) >= nCountFrom)
+            listMints.push_back(mintPoolPair);
     }
 }
 
 /**
- * Add the mint from the chain to the mint tracker.
+ * Regenerate a mint of the wallet found on the chain and look up whether it is spent.
  *
- * Gets the mint from known values and creates a CHDMint object. Stores it in the tracker.
+ * Gets the mint from known values and creates a CHDMint object. Nothing is written: SyncWithChain
+ * adds the mint to the tracker, and the spend transaction if any to the wallet.
  * If the wallet is not locked, the mint is regenerated from the known values. If regeneration fails, return false.
  * If the wallet is locked, we use unencrypted db values to regenerate the object.
  *
  * @param mintPoolEntryPair pair of pubcoin hash to MintPoolEntry object
  * @param nHeight mint txid height
- * @param txid mint txid height
  * @param denom mint denomination
+ * @param dMint the regenerated mint. Is set in this function
+ * @param wtxSpend the transaction spending the mint, if it is spent. Is set in this function
+ * @return success
  */
-bool CHDMintWallet::SetMintSeedSeen(std::pair<uint256,MintPoolEntry> mintPoolEntryPair, const int& nHeight, const uint256& txid, const sigma::CoinDenomination& denom)
+bool CHDMintWallet::LookupSeenMint(const std::pair<uint256,MintPoolEntry>& mintPoolEntryPair, int nHeight, const sigma::CoinDenomination& denom, CHDMint& dMint, boost::optional<CWalletTx>& wtxSpend)
 {
     // Regenerate the mint
     uint256 hashPubcoin = mintPoolEntryPair.first;
@@ -370,7 +591,6 @@ bool CHDMintWallet::SetMintSeedSeen(std::pair<uint256,MintPoolEntry> mintPoolEnt
 
     GroupElement bnValue;
     uint256 hashSerial;
-    bool serialInBlockchain = false;
     // Can regenerate if unlocked (cheaper)
     if(!pwalletMain->IsLocked()){
         LogPrintf("%s: Wallet not locked, creating mind seed..\n", __func__);
@@ -405,21 +625,29 @@ bool CHDMintWallet::SetMintSeedSeen(std::pair<uint256,MintPoolEntry> mintPoolEnt
 
     LogPrintf("%s: Creating mint object.. \n", __func__);
     // Create mint object
-    CHDMint dMint(mintCount, seedId, hashSerial, bnValue);
+    dMint = CHDMint(mintCount, seedId, hashSerial, bnValue);
     dMint.SetDenomination(denom);
     dMint.SetHeight(nHeight);
 
     // Check if this is also already spent
-    CWalletDB walletdb(strWalletFile);
     int nHeightTx;
     uint256 txidSpend;
     CTransaction txSpend;
-    if (IsSerialInBlockchain(hashSerial, nHeightTx, txidSpend, txSpend)) {
-        //Find transaction details and make a wallettx and add to wallet
+    wtxSpend = boost::none;
+    bool fSpent;
+    CBlockIndex* pindex = nullptr;
+    {
+        // The spend is looked up in the sigma state and the chain, its mint in the tracker
+        LOCK2(cs_main, pwalletMain->cs_wallet);
+        fSpent = IsSerialInBlockchain(hashSerial, nHeightTx, txidSpend, txSpend);
+        if (fSpent)
+            pindex = chainActive[nHeightTx];
+    }
+    if (fSpent) {
+        //Find transaction details and make a wallettx to add to the wallet
         LogPrintf("%s: Mint object is spent. Setting used..\n", __func__);
         dMint.SetUsed(true);
         CWalletTx wtx(pwalletMain, txSpend);
-        CBlockIndex* pindex = chainActive[nHeightTx];
         CBlock block;
         if (ReadBlockFromDisk(block, pindex, Params().GetConsensus())) {
             LOCK(cs_main);
@@ -427,13 +655,9 @@ bool CHDMintWallet::SetMintSeedSeen(std::pair<uint256,MintPoolEntry> mintPoolEnt
         }
 
         wtx.nTimeReceived = pindex->nTime;
-        pwalletMain->AddToWallet(wtx, false, &walletdb);
+        wtxSpend = wtx;
     }
 
-    LogPrintf("%s: Adding mint to tracker.. \n", __func__);
-    // Add to tracker which also adds to database
-    tracker.Add(dMint, true);
-
     return true;
 }
 
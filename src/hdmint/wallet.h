@@ -5,7 +5,9 @@
 #ifndef ZCOIN_HDMINTWALLET_H
 #define ZCOIN_HDMINTWALLET_H
 
+#include <atomic>
 #include <map>
+#include <boost/thread/thread.hpp>
 #include "libzerocoin/Zerocoin.h"
 #include "hdmint/mintpool.h"
 #include "uint256.h"
@@ -25,13 +27,28 @@ private:
     CHDMintTracker tracker;
     uint160 hashSeedMaster;
 
+    // Master seed and mint pool high-water mark of the last completed sync with the chain
+    uint160 hashSeedMasterSynced;
+    int32_t nCountSynced;
+
+    // Background catch-up started by SyncAfterUnlock
+    boost::thread threadCatchUp;
+    std::atomic<bool> fCatchUpRunning;
+    std::atomic<bool> fCatchUpPending;
+
+    void CatchUp();
+    void SetSynced();
+    void ListMintPool(int32_t nCountFrom, std::list<std::pair<uint256, MintPoolEntry>>& listMints);
+
 public:
     int static const COUNT_DEFAULT = 0;
 
     CHDMintWallet(const std::string& strWalletFile, bool resetCount=false);
+    ~CHDMintWallet();
 
     bool SetupWallet(const uint160& hashSeedMaster, bool fResetCount=false);
     void SyncWithChain(bool fGenerateMintPool = true, boost::optional<std::list<std::pair<uint256, MintPoolEntry>>> listMints = boost::none);
+    void SyncAfterUnlock(const uint160& hashSeedMaster);
     bool GetHDMintFromMintPoolEntry(const sigma::CoinDenomination denom, sigma::PrivateCoin& coin, CHDMint& dMint, MintPoolEntry& mintPoolEntry);
     bool GenerateMint(const sigma::CoinDenomination denom, sigma::PrivateCoin& coin, CHDMint& dMint, boost::optional<MintPoolEntry> mintPoolEntry = boost::none, bool fAllowUnsynced=false);
     bool LoadMintPoolFromDB();
@@ -41,7 +58,7 @@ public:
     bool TxOutToPublicCoin(const CTxOut& txout, sigma::PublicCoin& pubCoin, CValidationState& state);
     std::pair<uint256,uint256> RegenerateMintPoolEntry(const uint160& mintHashSeedMaster, CKeyID& seedId, const int32_t& nCount);
     void GenerateMintPool(int32_t nIndex = 0);
-    bool SetMintSeedSeen(std::pair<uint256,MintPoolEntry> mintPoolEntryPair, const int& nHeight, const uint256& txid, const sigma::CoinDenomination& denom);
+    bool LookupSeenMint(const std::pair<uint256,MintPoolEntry>& mintPoolEntryPair, int nHeight, const sigma::CoinDenomination& denom, CHDMint& dMint, boost::optional<CWalletTx>& wtxSpend);
     bool SeedToMint(const uint512& mintSeed, GroupElement& bnValue, sigma::PrivateCoin& coin);
     // Count updating functions
     int32_t GetCount();
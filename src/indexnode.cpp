@@ -532,7 +532,7 @@ void CIndexnode::UpdateLastPaid(const CBlockIndex *pindex, int nMaxBlocksToScanB
             }
             CAmount nIndexnodePayment = GetIndexnodePayment(params, false,BlockReading->nHeight);
 
-            BOOST_FOREACH(CTxOut txout, block.vtx[0].vout)
+            BOOST_FOREACH(CTxOut txout, block.vtx[0]->vout)
             if (mnpayee == txout.scriptPubKey && nIndexnodePayment == txout.nValue) {
                 SetBlockLastPaid(BlockReading->nHeight);
                 SetTimeLastPaid(BlockReading->nTime);
@@ -12,11 +12,13 @@
 
 #include "addrman.h"
 #include "amount.h"
+#include "blockfilterindex.h"
 #include "chain.h"
 #include "chainparams.h"
 #include "checkpoints.h"
 #include "compat/sanity.h"
 #include "consensus/validation.h"
+#include "crypto/sha256.h"
 #include "fs.h"
 #include "httpserver.h"
 #include "httprpc.h"
@@ -98,6 +100,7 @@ static CZMQReplierInterface* pzmqReplierInterface = NULL;
 
 
 bool fFeeEstimatesInitialized = false;
+CScheduler* pschedulerMain = NULL;
 
 #ifdef WIN32
 // Win32 LevelDB doesn't use filedescriptors, and the ones used for
@@ -288,6 +291,12 @@ void PrepareShutdown(){
         pblocktree = NULL;
     }
 
+    if (pblockfilterindex) {
+        UnregisterValidationInterface(pblockfilterindex);
+        delete pblockfilterindex;
+        pblockfilterindex = NULL;
+    }
+
 #ifdef ENABLE_ELYSIUM
     if (isElysiumEnabled()) {
         elysium_shutdown();
@@ -341,6 +350,7 @@ void Shutdown()
     delete pwalletMain;
     pwalletMain = NULL;
 #endif
+    pschedulerMain = NULL;
     globalVerifyHandle.reset();
     ECC_Stop();
     LogPrintf("%s: done\n", __func__);
@@ -446,6 +456,9 @@ std::string HelpMessage(HelpMessageMode mode) {
     strUsage += HelpMessageOpt("-txindex", strprintf(
             _("Maintain a full transaction index, used by the getrawtransaction rpc call (default: %u)"),
             DEFAULT_TXINDEX));
+    strUsage += HelpMessageOpt("-blockfilterindex", strprintf(
+            _("Maintain an index of compact block filters (BIP 157/158), used by the getblockfilter rpc call (default: %u)"),
+            DEFAULT_BLOCKFILTERINDEX));
     strUsage += HelpMessageOpt("-addressindex", strprintf(_("Maintain a full address index, used to query for the balance, txids and unspent outputs for addresses (default: %u)"), DEFAULT_ADDRESSINDEX));
     strUsage += HelpMessageOpt("-timestampindex", strprintf(_("Maintain a timestamp index for block hashes, used to query blocks hashes by a range of timestamps (default: %u)"), DEFAULT_TIMESTAMPINDEX));
     strUsage += HelpMessageOpt("-spentindex", strprintf(_("Maintain a full spent index, used to query the spending txid and input index for an outpoint (default: %u)"), DEFAULT_SPENTINDEX));
@@ -494,6 +507,9 @@ std::string HelpMessage(HelpMessageMode mode) {
     strUsage += HelpMessageOpt("-peerbloomfilters", strprintf(
             _("Support filtering of blocks and transaction with bloom filters (default: %u)"),
             DEFAULT_PEERBLOOMFILTERS));
+    strUsage += HelpMessageOpt("-peerblockfilters", strprintf(
+            _("Serve compact block filters to peers per BIP 157, requires -blockfilterindex (default: %u)"),
+            DEFAULT_PEERBLOCKFILTERS));
     strUsage += HelpMessageOpt("-port=<port>",
                                strprintf(_("Listen for connections on <port> (default: %u or testnet: %u)"),
                                          Params(CBaseChainParams::MAIN).GetDefaultPort(),
@@ -565,6 +581,9 @@ std::string HelpMessage(HelpMessageMode mode) {
         strUsage += HelpMessageOpt("-checkpoints",
                                    strprintf("Disable expensive verification for known chain history (default: %u)",
                                              DEFAULT_CHECKPOINTS_ENABLED));
+        strUsage += HelpMessageOpt("-assumevalidproofs=<hex>",
+                                   "If this block is in the chain assume that it and its ancestors have valid Zerocoin and Sigma spend proofs, "
+                                   "as is done below the last checkpoint (0 to verify all spend proofs)");
         strUsage += HelpMessageOpt("-disablesafemode",
                                    strprintf("Disable safemode, override a real safe mode event (default: %u)",
                                              DEFAULT_DISABLE_SAFEMODE));
@@ -612,6 +631,9 @@ std::string HelpMessage(HelpMessageMode mode) {
         strUsage += HelpMessageOpt("-logtimemicros",
                                    strprintf("Add microsecond precision to debug timestamps (default: %u)",
                                              DEFAULT_LOGTIMEMICROS));
+        strUsage += HelpMessageOpt("-lockprofile",
+                                   strprintf("Record wait and hold times of locks, see getlockprofile (default: %u)",
+                                             DEFAULT_LOCKPROFILE));
         strUsage += HelpMessageOpt("-mocktime=<n>", "Replace actual time with <n> seconds since epoch (default: 0)");
         strUsage += HelpMessageOpt("-limitfreerelay=<n>", strprintf(
                 "Continuously rate-limit free transactions to <n>*1000 bytes per minute (default: %u)",
@@ -691,6 +713,12 @@ std::string HelpMessage(HelpMessageMode mode) {
     strUsage += HelpMessageOpt("-rpcthreads=<n>",
                                strprintf(_("Set the number of threads to service RPC calls (default: %d)"),
                                          DEFAULT_HTTP_THREADS));
+    strUsage += HelpMessageOpt("-rpcbatchthreads=<n>",
+                               strprintf(_("Set the number of threads executing read-only calls of JSON-RPC batches, 0 to execute batches serially (default: %d)"),
+                                         DEFAULT_RPC_BATCH_THREADS));
+    strUsage += HelpMessageOpt("-rpcbatchconcurrency=<n>",
+                               strprintf(_("Maximum number of read-only calls of one JSON-RPC batch executed at the same time (default: %d)"),
+                                         DEFAULT_RPC_BATCH_CONCURRENCY));
     strUsage += HelpMessageOpt("-blockspamfilter=<n>", strprintf(_("Use block spam filter (default: %u)"), DEFAULT_BLOCK_SPAM_FILTER));
     strUsage += HelpMessageOpt("-blockspamfiltermaxsize=<n>", strprintf(_("Maximum size of the list of indexes in the block spam filter (default: %u)"), DEFAULT_BLOCK_SPAM_FILTER_MAX_SIZE));
     strUsage += HelpMessageOpt("-blockspamfiltermaxavg=<n>", strprintf(_("Maximum average size of an index occurrence in the block spam filter (default: %u)"), DEFAULT_BLOCK_SPAM_FILTER_MAX_AVG));
@@ -709,7 +737,7 @@ std::string HelpMessage(HelpMessageMode mode) {
     strUsage += HelpMessageGroup("Elysium options:");
     strUsage += HelpMessageOpt("-elysium", "Enable Elysium");
     strUsage += HelpMessageOpt("-startclean", "Clear all persistence files on startup; triggers reparsing of Elysium transactions");
-    strUsage += HelpMessageOpt("-elysiumtxcache=<num>", "The maximum number of transactions in the input transaction cache (default: 500000)");
+    strUsage += HelpMessageOpt("-elysiumtxcache=<num>", "The maximum number of spent outputs in the input cache used to resolve senders outside of block processing (default: 500000)");
     strUsage += HelpMessageOpt("-elysiumprogressfrequency=<seconds>", "Time in seconds after which the initial scanning progress is reported (default: 30)");
     strUsage += HelpMessageOpt("-elysiumdebug=<category>", "Enable or disable log categories, can be \"all\" or \"none\"");
     strUsage += HelpMessageOpt("-autocommit=<flag>", "Enable or disable broadcasting of transactions, when creating transactions (default: 1)");
@@ -1218,6 +1246,8 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
     if (GetArg("-prune", 0)) {
         if (GetBoolArg("-txindex", DEFAULT_TXINDEX))
             return InitError(_("Prune mode is incompatible with -txindex."));
+        if (GetBoolArg("-blockfilterindex", DEFAULT_BLOCKFILTERINDEX))
+            return InitError(_("Prune mode is incompatible with -blockfilterindex."));
 #ifdef ENABLE_WALLET
         if (GetBoolArg("-rescan", false)) {
             return InitError(_("Rescans are not possible in pruned mode. You will need to use -reindex which will download the whole blockchain again."));
@@ -1282,6 +1312,15 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
     }
     fCheckBlockIndex = GetBoolArg("-checkblockindex", chainparams.DefaultConsistencyChecks());
     fCheckpointsEnabled = GetBoolArg("-checkpoints", DEFAULT_CHECKPOINTS_ENABLED);
+    if (mapArgs.count("-assumevalidproofs")) {
+        std::string strAssumeValid = GetArg("-assumevalidproofs", "");
+        if (strAssumeValid == "0")
+            fAssumeValidProofs = false;
+        else if (!IsHex(strAssumeValid) || strAssumeValid.size() != 64)
+            return InitError(strprintf(_("Invalid block hash for -assumevalidproofs: '%s'"), strAssumeValid));
+        else
+            hashAssumeValidProofs = uint256S(strAssumeValid);
+    }
 
     // mempool AC_CONFIG_SUBDIRSlimits
     int64_t nMempoolSizeMax = GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000;
@@ -1363,9 +1402,17 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
     // Option to startup with mocktime set (used for regression testing):
     SetMockTime(GetArg("-mocktime", 0)); // SetMockTime(0) is a no-op
 
+    fLockProfile = GetBoolArg("-lockprofile", DEFAULT_LOCKPROFILE);
+
     if (GetBoolArg("-peerbloomfilters", DEFAULT_PEERBLOOMFILTERS))
         nLocalServices = ServiceFlags(nLocalServices | NODE_BLOOM);
 
+    if (GetBoolArg("-peerblockfilters", DEFAULT_PEERBLOCKFILTERS)) {
+        if (!GetBoolArg("-blockfilterindex", DEFAULT_BLOCKFILTERINDEX))
+            return InitError(_("Cannot set -peerblockfilters without -blockfilterindex."));
+        nLocalServices = ServiceFlags(nLocalServices | NODE_COMPACT_FILTERS);
+    }
+
     if (GetArg("-rpcserialversion", DEFAULT_RPC_SERIALIZE_VERSION) < 0)
         return InitError("rpcserialversion must be non-negative.");
 
@@ -1421,6 +1468,9 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
 
     // ********************************************************* Step 4: application initialization: dir lock, daemonize, pidfile, debug log
 
+    std::string sha256_algo = SHA256AutoDetect();
+    LogPrintf("Using the '%s' SHA256 implementation\n", sha256_algo);
+
     // Initialize elliptic curve code
     ECC_Start();
     globalVerifyHandle.reset(new ECCVerifyHandle());
@@ -1471,9 +1521,11 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
             return InitError(_("Unable to sign spork message, wrong key?"));
     }
 
-    // Start the lightweight task scheduler thread
+    // Start the lightweight task scheduler threads; tasks sharing a lane still run one at a time
     CScheduler::Function serviceLoop = boost::bind(&CScheduler::serviceQueue, &scheduler);
-    threadGroup.create_thread(boost::bind(&TraceThread<CScheduler::Function>, "scheduler", serviceLoop));
+    for (int i = 0; i < DEFAULT_SCHEDULER_THREADS; i++)
+        threadGroup.create_thread(boost::bind(&TraceThread<CScheduler::Function>, "scheduler", serviceLoop));
+    pschedulerMain = &scheduler;
 
     /* Start the RPC server already.  It will be started in "warmup" mode
      * and not really process calls already (but it will signify connections
@@ -1763,6 +1815,10 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
     if (nBlockTreeDBCache > (1 << 21) && !GetBoolArg("-txindex", false))
         nBlockTreeDBCache = (1 << 21); // block tree db cache shouldn't be larger than 2 MiB
     nTotalCache -= nBlockTreeDBCache;
+    int64_t nFilterIndexCache = 0;
+    if (GetBoolArg("-blockfilterindex", DEFAULT_BLOCKFILTERINDEX))
+        nFilterIndexCache = std::min(nTotalCache / 8, nMaxFilterIndexCache << 20);
+    nTotalCache -= nFilterIndexCache;
     int64_t nCoinDBCache = std::min(nTotalCache / 2,
                                     (nTotalCache / 4) + (1 << 23)); // use 25%-50% of the remainder for disk cache
     nCoinDBCache = std::min(nCoinDBCache, nMaxCoinsDBCache << 20); // cap total coins db cache
@@ -1771,6 +1827,8 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
     nCoinCacheUsage = nTotalCache / 300;
     LogPrintf("Cache configuration:\n");
     LogPrintf("* Using %.1fMiB for block index database\n", nBlockTreeDBCache * (1.0 / 1024 / 1024));
+    if (nFilterIndexCache > 0)
+        LogPrintf("* Using %.1fMiB for block filter index database\n", nFilterIndexCache * (1.0 / 1024 / 1024));
     LogPrintf("* Using %.1fMiB for chain state database\n", nCoinDBCache * (1.0 / 1024 / 1024));
     LogPrintf("* Using %.1fMiB for in-memory UTXO set\n", nCoinCacheUsage * (1.0 / 1024 / 1024));
 
@@ -1931,6 +1989,16 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
     }
     LogPrintf(" block index %15dms\n", GetTimeMillis() - nStart);
 
+    if (GetBoolArg("-blockfilterindex", DEFAULT_BLOCKFILTERINDEX)) {
+        // Built from the blocks on disk by a thread of its own, so the chain is never held up by it
+        pblockfilterindex = new CBlockFilterIndex(BLOCK_FILTER_BASIC, nFilterIndexCache, false, fReindex);
+        if (!pblockfilterindex->Init())
+            return InitError(_("Error loading the block filter index"));
+        RegisterValidationInterface(pblockfilterindex);
+        threadGroup.create_thread(boost::bind(&TraceThread<boost::function<void()> >, "blockfilter",
+            boost::function<void()>(boost::bind(&CBlockFilterIndex::ThreadSync, pblockfilterindex))));
+    }
+
     fs::path est_path = GetDataDir() / FEE_ESTIMATES_FILENAME;
     CAutoFile est_filein(fsbridge::fopen(est_path, "rb"), SER_DISK, CLIENT_VERSION);
     // Allowed to fail as this file IS missing on first startup.
@@ -2219,9 +2287,9 @@ bool AppInit2(boost::thread_group &threadGroup, CScheduler &scheduler) {
     indexnodeSync.UpdatedBlockTip(chainActive.Tip());
     // governance.UpdatedBlockTip(chainActive.Tip());
 
-    // ********************************************************* Step 11d: start dash-privatesend thread
+    // ********************************************************* Step 11d: schedule dash-privatesend maintenance
 
-    threadGroup.create_thread(boost::bind(&ThreadCheckDarkSendPool));
+    ScheduleDarkSendMaintenance(scheduler);
 
 
 
@@ -22,6 +22,11 @@ static const bool DEFAULT_REST_ENABLE = false;
 static const bool DEFAULT_DISABLE_SAFEMODE = false;
 static const bool DEFAULT_STOPAFTERBLOCKIMPORT = false;
 static const bool DEFAULT_RESETAPICERTS = false;
+//! Number of threads servicing the node's scheduler
+static const int DEFAULT_SCHEDULER_THREADS = 2;
+
+//! The scheduler running the node's periodic maintenance, NULL before AppInit2 and after Shutdown
+extern CScheduler* pschedulerMain;
 
 void StartShutdown();
 bool ShutdownRequested();
@@ -14,23 +14,22 @@
 #define PARALLELTASKS_H
 
 /**
- * Implementation of thread pool for parallelizing spend creation and verification
+ * Groups of parallel tasks for spend creation and verification, run on the
+ * shared work-stealing CTaskPool (see taskpool.h)
  */ 
 
 #include <vector>
 #include <functional>
 
-#define BOOST_THREAD_PROVIDES_FUTURE
-
-
-#include <boost/thread/future.hpp>
 #include <boost/thread.hpp>
 
+#include "../taskpool.h"
+
 namespace libzerocoin {
 
 class ParallelTasks {
 private:
-    vector<boost::future<void>> tasks;
+    CTaskGroup group;
 
 public:
     ParallelTasks(int n=0);
@@ -53,6 +52,17 @@ public:
     };
 };
 
+// run fn(i) for each i in [0, n) in parallel chunks and wait for completion
+template <typename F>
+void ParallelFor(size_t n, F fn) {
+#ifdef ZEROCOIN_THREADING
+    ::ParallelFor(0, n, fn);
+#else
+    for (size_t i = 0; i < n; i++)
+        fn(i);
+#endif
+}
+
 }
 
 #endif // PARALLELTASKS_H
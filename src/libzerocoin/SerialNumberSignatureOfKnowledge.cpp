@@ -45,9 +45,6 @@ SerialNumberSignatureOfKnowledge::SerialNumberSignatureOfKnowledge(const Params*
 
 
 	for(uint32_t i=0; i < params->zkp_iterations; i++) {
-		//FIXME we really ought to use one BN_CTX for all of these
-		// operations for performance reasons, not the one that
-		// is created individually  by the wrapper
 		r[i] = Bignum::randBignum(params->coinCommitmentGroup.groupOrder);
 		v[i] = Bignum::randBignum(params->serialNumberSoKCommitmentGroup.groupOrder);
 	}
@@ -56,15 +53,10 @@ SerialNumberSignatureOfKnowledge::SerialNumberSignatureOfKnowledge(const Params*
 	// instead we generate the random values beforehand and run the calculations
 	// based on those values in parallel.
 
-    ParallelTasks challenges(params->zkp_iterations);
-
-	for(uint32_t i=0; i < params->zkp_iterations; i++) {
-		// compute g^{ {a^x b^r} h^v} mod p2
-        challenges.Add([this, i, &coin, &c, &r, &v] {
-            c[i] = challengeCalculation(coin.getSerialNumber(), r[i], v[i]);
-        });
-	}
-    challenges.Wait();
+	// compute g^{ {a^x b^r} h^v} mod p2
+    ParallelFor(params->zkp_iterations, [this, &coin, &c, &r, &v](size_t i) {
+        c[i] = challengeCalculation(coin.getSerialNumber(), r[i], v[i]);
+    });
 
 	// We can't hash data in parallel either
 	// because OPENMP cannot not guarantee loops
@@ -75,8 +67,7 @@ SerialNumberSignatureOfKnowledge::SerialNumberSignatureOfKnowledge(const Params*
     this->hash = hasher.GetArith256Hash();
 	unsigned char *hashbytes =  (unsigned char*) &hash;
 
-    challenges.Reset();
-	for(uint32_t i = 0; i < params->zkp_iterations; i++) {
+    ParallelFor(params->zkp_iterations, [this, hashbytes, &r, &v, &b, &commitmentToCoin, &coin](size_t i) {
 		int bit = i % 8;
 		int byte = i / 8;
 
@@ -85,14 +76,11 @@ SerialNumberSignatureOfKnowledge::SerialNumberSignatureOfKnowledge(const Params*
 			s_notprime[i]       = r[i];
 			sprime[i]           = v[i];
 		} else {
-            challenges.Add([this, i, &r, &v, &b, &commitmentToCoin, &coin] {
-                s_notprime[i]   = r[i] - coin.getRandomness();
-                sprime[i]       = v[i] - (commitmentToCoin.getRandomness() *
-			                              b.pow_mod(r[i] - coin.getRandomness(), params->serialNumberSoKCommitmentGroup.groupOrder));
-            });
+            s_notprime[i]   = r[i] - coin.getRandomness();
+            sprime[i]       = v[i] - (commitmentToCoin.getRandomness() *
+                                      b.pow_mod(r[i] - coin.getRandomness(), params->serialNumberSoKCommitmentGroup.groupOrder));
 		}
-    }
-    challenges.Wait();
+    });
 }
 
 inline Bignum SerialNumberSignatureOfKnowledge::challengeCalculation(const Bignum& a_exp,const Bignum& b_exp,
@@ -133,24 +121,19 @@ bool SerialNumberSignatureOfKnowledge::Verify(const Bignum& coinSerialNumber, co
 	vector<CBigNum> tprime(params->zkp_iterations);
 	unsigned char *hashbytes = (unsigned char*) &this->hash;
 
-    ParallelTasks challenges(params->zkp_iterations);
-
-	for(uint32_t i = 0; i < params->zkp_iterations; i++) {
-        challenges.Add([this, i, hashbytes, &b, &h, &tprime, &coinSerialNumber, &valueOfCommitmentToCoin] {
-            int bit = i % 8;
-            int byte = i / 8;
-            bool challenge_bit = ((hashbytes[byte] >> bit) & 0x01);
-            if(challenge_bit) {
-                tprime[i] = challengeCalculation(coinSerialNumber, s_notprime[i], sprime[i]);
-            } else {
-                Bignum exp = b.pow_mod(s_notprime[i], params->serialNumberSoKCommitmentGroup.groupOrder);
-                tprime[i] = ((valueOfCommitmentToCoin.pow_mod(exp, params->serialNumberSoKCommitmentGroup.modulus) % params->serialNumberSoKCommitmentGroup.modulus) *
-                             (h.pow_mod(sprime[i], params->serialNumberSoKCommitmentGroup.modulus) % params->serialNumberSoKCommitmentGroup.modulus)) %
-                            params->serialNumberSoKCommitmentGroup.modulus;
-            }
-        });
-	}
-    challenges.Wait();
+    ParallelFor(params->zkp_iterations, [this, hashbytes, &b, &h, &tprime, &coinSerialNumber, &valueOfCommitmentToCoin](size_t i) {
+        int bit = i % 8;
+        int byte = i / 8;
+        bool challenge_bit = ((hashbytes[byte] >> bit) & 0x01);
+        if(challenge_bit) {
+            tprime[i] = challengeCalculation(coinSerialNumber, s_notprime[i], sprime[i]);
+        } else {
+            Bignum exp = b.pow_mod(s_notprime[i], params->serialNumberSoKCommitmentGroup.groupOrder);
+            tprime[i] = ((valueOfCommitmentToCoin.pow_mod(exp, params->serialNumberSoKCommitmentGroup.modulus) % params->serialNumberSoKCommitmentGroup.modulus) *
+                         (h.pow_mod(sprime[i], params->serialNumberSoKCommitmentGroup.modulus) % params->serialNumberSoKCommitmentGroup.modulus)) %
+                        params->serialNumberSoKCommitmentGroup.modulus;
+        }
+    });
 
 	for(uint32_t i = 0; i < params->zkp_iterations; i++) {
 		hasher << tprime[i];
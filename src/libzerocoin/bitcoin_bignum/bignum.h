@@ -13,6 +13,7 @@
 #include "../../arith_uint256.h"
 #include "../../version.h"
 #include "../../clientversion.h"
+#include "bignum_backend.h"
 /** Errors thrown by the bignum class */
 class bignum_error : public std::runtime_error
 {
@@ -20,30 +21,22 @@ public:
     explicit bignum_error(const std::string& str) : std::runtime_error(str) {}
 };
 
-/** RAII encapsulated BN_CTX (OpenSSL bignum context) */
+/** The calling thread's BN_CTX (OpenSSL bignum context), reused across operations instead of allocated for each */
 class CAutoBN_CTX
 {
 protected:
     BN_CTX* pctx;
-    BN_CTX* operator=(BN_CTX* pnew) { return pctx = pnew; }
 
 public:
     CAutoBN_CTX()
     {
-        pctx = BN_CTX_new();
+        pctx = bignum_backend::ThreadContext();
         if (pctx == NULL)
             throw bignum_error("CAutoBN_CTX : BN_CTX_new() returned NULL");
     }
 
-    ~CAutoBN_CTX()
-    {
-        if (pctx != NULL)
-            BN_CTX_free(pctx);
-    }
-
     operator BN_CTX*() { return pctx; }
     BN_CTX& operator*() { return *pctx; }
-    BN_CTX** operator&() { return &pctx; }
     bool operator!() { return (pctx == NULL); }
 };
 
@@ -523,9 +516,8 @@ public:
      * @param m modulus
      */
     CBigNum mul_mod(const CBigNum& b, const CBigNum& m) const {
-        CAutoBN_CTX pctx;
         CBigNum ret;
-        if (!BN_mod_mul(&ret, bn, &b, &m, pctx))
+        if (!bignum_backend::ModMul(&ret, bn, &b, &m))
             throw bignum_error("CBigNum::mul_mod : BN_mod_mul failed");
 
         return ret;
@@ -537,16 +529,15 @@ public:
      * @param m modulus
      */
     CBigNum pow_mod(const CBigNum& e, const CBigNum& m) const {
-        CAutoBN_CTX pctx;
         CBigNum ret;
         if( e < 0){
             // g^-x = (g^-1)^x
             CBigNum inv = this->inverse(m);
             CBigNum posE = e * -1;
-            if (!BN_mod_exp(&ret, &inv, &posE, &m, pctx))
+            if (!bignum_backend::ModExp(&ret, &inv, &posE, &m))
                 throw bignum_error("CBigNum::pow_mod: BN_mod_exp failed on negative exponent");
         }else
-        if (!BN_mod_exp(&ret, bn, &e, &m, pctx))
+        if (!bignum_backend::ModExp(&ret, bn, &e, &m))
             throw bignum_error("CBigNum::pow_mod : BN_mod_exp failed");
 
         return ret;
@@ -559,9 +550,8 @@ public:
      * @return the inverse
      */
     CBigNum inverse(const CBigNum& m) const {
-        CAutoBN_CTX pctx;
         CBigNum ret;
-        if (!BN_mod_inverse(&ret, bn, &m, pctx))
+        if (!bignum_backend::ModInverse(&ret, bn, &m))
             throw bignum_error("CBigNum::inverse*= :BN_mod_inverse");
         return ret;
     }
@@ -0,0 +1,250 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#if defined(HAVE_CONFIG_H)
+#include "config/bitcoin-config.h"
+#endif
+
+#include "bignum_backend.h"
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <boost/thread/tss.hpp>
+
+#ifdef USE_GMP
+#include <gmp.h>
+#endif
+
+namespace bignum_backend {
+
+namespace {
+
+std::atomic<int> nEngine(
+#ifdef USE_GMP
+    ENGINE_GMP
+#else
+    ENGINE_OPENSSL
+#endif
+);
+
+#ifdef USE_GMP
+void ToMpz(mpz_ptr z, const BIGNUM* bn, std::vector<unsigned char>& buf)
+{
+    buf.resize(BN_num_bytes(bn));
+    BN_bn2bin(bn, buf.data());
+    mpz_import(z, buf.size(), 1, 1, 1, 0, buf.data());
+    if (BN_is_negative(bn))
+        mpz_neg(z, z);
+}
+
+bool FromMpz(BIGNUM* bn, mpz_srcptr z, std::vector<unsigned char>& buf)
+{
+    size_t nSize = 0;
+    buf.resize((mpz_sizeinbase(z, 2) + 7) / 8);
+    mpz_export(buf.data(), &nSize, 1, 1, 1, 0, z);
+    if (!BN_bin2bn(buf.data(), nSize, bn))
+        return false;
+    BN_set_negative(bn, mpz_sgn(z) < 0);
+    return true;
+}
+
+/** Per-thread GMP temporaries; their limbs are reused from one operation to the next */
+struct GmpScratch {
+    mpz_t a, b, m, r;
+    std::vector<unsigned char> buf;
+
+    GmpScratch() { mpz_inits(a, b, m, r, NULL); }
+    ~GmpScratch() { mpz_clears(a, b, m, r, NULL); }
+};
+
+GmpScratch& ThreadScratch()
+{
+    static boost::thread_specific_ptr<GmpScratch> scratch;
+    if (!scratch.get())
+        scratch.reset(new GmpScratch());
+    return *scratch;
+}
+#endif
+
+/** A modulus which is exponentiated over and over, with its precomputed forms for both engines */
+class CachedModulus
+{
+public:
+    BIGNUM* n;
+    //! NULL for even moduli, which OpenSSL exponentiates without Montgomery reduction
+    BN_MONT_CTX* mont;
+#ifdef USE_GMP
+    mpz_t z;
+#endif
+
+    CachedModulus() : n(BN_new()), mont(NULL)
+    {
+#ifdef USE_GMP
+        mpz_init(z);
+#endif
+    }
+
+    ~CachedModulus()
+    {
+        BN_free(n);
+        if (mont != NULL)
+            BN_MONT_CTX_free(mont);
+#ifdef USE_GMP
+        mpz_clear(z);
+#endif
+    }
+
+    CachedModulus(const CachedModulus&) = delete;
+    CachedModulus& operator=(const CachedModulus&) = delete;
+
+    bool Set(const BIGNUM* m, BN_CTX* ctx)
+    {
+        if (n == NULL || !BN_copy(n, m))
+            return false;
+        if (BN_is_odd(m)) {
+            mont = BN_MONT_CTX_new();
+            if (mont == NULL || !BN_MONT_CTX_set(mont, m, ctx))
+                return false;
+        }
+#ifdef USE_GMP
+        std::vector<unsigned char> buf;
+        ToMpz(z, m, buf);
+#endif
+        return true;
+    }
+};
+
+//! Zerocoin exponentiates modulo the accumulator modulus and a couple of group moduli
+const size_t MODULUS_CACHE_SIZE = 8;
+
+typedef std::list<std::unique_ptr<CachedModulus>> ModulusList;
+
+/**
+ * Per-thread, like the BN_CTX and GMP temporaries, so verifier threads of the task pool
+ * never wait on each other; each thread precomputes the few moduli it works with once.
+ */
+ModulusList& ThreadModulusCache()
+{
+    static boost::thread_specific_ptr<ModulusList> cache;
+    if (!cache.get())
+        cache.reset(new ModulusList());
+    return *cache;
+}
+
+//! The entry stays valid until the calling thread looks up another modulus
+const CachedModulus* GetModulus(const BIGNUM* m, BN_CTX* ctx)
+{
+    ModulusList& cache = ThreadModulusCache();
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+        if (BN_cmp((*it)->n, m) == 0) {
+            // Keep the most recently used moduli at the front
+            cache.splice(cache.begin(), cache, it);
+            return cache.front().get();
+        }
+    }
+
+    std::unique_ptr<CachedModulus> entry(new CachedModulus());
+    if (!entry->Set(m, ctx))
+        return NULL;
+    cache.push_front(std::move(entry));
+    if (cache.size() > MODULUS_CACHE_SIZE)
+        cache.pop_back();
+    return cache.front().get();
+}
+
+//! Moduli for which the engines are not used: errors and trivial results are left to OpenSSL
+bool IsPlainModulus(const BIGNUM* m)
+{
+    return BN_is_negative(m) || BN_is_zero(m) || BN_is_one(m);
+}
+
+} // namespace
+
+bool HaveGMP()
+{
+#ifdef USE_GMP
+    return true;
+#else
+    return false;
+#endif
+}
+
+Engine GetEngine()
+{
+    return (Engine)nEngine.load();
+}
+
+bool SetEngine(Engine engine)
+{
+    if (engine == ENGINE_GMP && !HaveGMP())
+        return false;
+    nEngine = engine;
+    return true;
+}
+
+BN_CTX* ThreadContext()
+{
+    static boost::thread_specific_ptr<BN_CTX> context(BN_CTX_free);
+    if (!context.get())
+        context.reset(BN_CTX_new());
+    return context.get();
+}
+
+bool ModExp(BIGNUM* r, const BIGNUM* a, const BIGNUM* e, const BIGNUM* m)
+{
+    BN_CTX* ctx = ThreadContext();
+    if (ctx == NULL)
+        return false;
+    if (IsPlainModulus(m) || BN_is_negative(e))
+        return BN_mod_exp(r, a, e, m, ctx);
+
+    const CachedModulus* mod = GetModulus(m, ctx);
+    if (mod == NULL)
+        return false;
+#ifdef USE_GMP
+    if (nEngine == ENGINE_GMP) {
+        GmpScratch& s = ThreadScratch();
+        ToMpz(s.a, a, s.buf);
+        ToMpz(s.b, e, s.buf);
+        mpz_powm(s.r, s.a, s.b, mod->z);
+        return FromMpz(r, s.r, s.buf);
+    }
+#endif
+    if (mod->mont == NULL)
+        return BN_mod_exp(r, a, e, m, ctx);
+    return BN_mod_exp_mont(r, a, e, m, ctx, mod->mont);
+}
+
+bool ModMul(BIGNUM* r, const BIGNUM* a, const BIGNUM* b, const BIGNUM* m)
+{
+    // A single product is about as cheap as converting its operands to GMP and back,
+    // so both engines multiply with OpenSSL and only share the pooled temporaries
+    BN_CTX* ctx = ThreadContext();
+    if (ctx == NULL)
+        return false;
+    return BN_mod_mul(r, a, b, m, ctx);
+}
+
+bool ModInverse(BIGNUM* r, const BIGNUM* a, const BIGNUM* m)
+{
+    BN_CTX* ctx = ThreadContext();
+    if (ctx == NULL)
+        return false;
+#ifdef USE_GMP
+    if (nEngine == ENGINE_GMP && !IsPlainModulus(m)) {
+        GmpScratch& s = ThreadScratch();
+        ToMpz(s.a, a, s.buf);
+        ToMpz(s.m, m, s.buf);
+        if (!mpz_invert(s.r, s.a, s.m))
+            return false;
+        return FromMpz(r, s.r, s.buf);
+    }
+#endif
+    return BN_mod_inverse(r, a, m, ctx) != NULL;
+}
+
+} // namespace bignum_backend
@@ -0,0 +1,53 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_BIGNUM_BACKEND_H
+#define BITCOIN_BIGNUM_BACKEND_H
+
+#include <openssl/bn.h>
+
+/**
+ * Engines behind the modular arithmetic of CBigNum.
+ *
+ * OpenSSL is always built in. GMP is added by configuring --with-gmp and
+ * then becomes the default; recent OpenSSL releases exponentiate faster than a
+ * generic libgmp on x86-64, so it is opt-in. Both engines give the same
+ * results: the canonical residue in [0, |m|).
+ *
+ * Whichever engine is active, each thread keeps a single BN_CTX for its
+ * temporaries, and the Montgomery (OpenSSL) or converted (GMP) forms of the
+ * last few moduli used for exponentiation - the accumulator modulus and the
+ * group moduli in practice - are kept instead of being rebuilt on every call.
+ */
+namespace bignum_backend {
+
+enum Engine {
+    ENGINE_OPENSSL,
+    ENGINE_GMP,
+};
+
+//! Whether this build includes the GMP engine
+bool HaveGMP();
+
+//! Engine currently used by CBigNum
+Engine GetEngine();
+
+//! Switch engines, for differential tests and benchmarks. Returns false if the engine is not built in.
+bool SetEngine(Engine engine);
+
+//! BN_CTX of the calling thread, freed when the thread exits
+BN_CTX* ThreadContext();
+
+//! r = a^e mod m, with e >= 0
+bool ModExp(BIGNUM* r, const BIGNUM* a, const BIGNUM* e, const BIGNUM* m);
+
+//! r = a * b mod m
+bool ModMul(BIGNUM* r, const BIGNUM* a, const BIGNUM* b, const BIGNUM* m);
+
+//! r = a^-1 mod m, fails if a has no inverse
+bool ModInverse(BIGNUM* r, const BIGNUM* a, const BIGNUM* m);
+
+} // namespace bignum_backend
+
+#endif // BITCOIN_BIGNUM_BACKEND_H
@@ -16,6 +16,7 @@
 #include "addrman.h"
 #include "arith_uint256.h"
 #include "blockencodings.h"
+#include "blockfilterindex.h"
 #include "chainparams.h"
 #include "checkpoints.h"
 #include "checkqueue.h"
@@ -108,6 +109,8 @@ bool fIsBareMultisigStd = DEFAULT_PERMIT_BAREMULTISIG;
 bool fRequireStandard = true;
 bool fCheckBlockIndex = false;
 bool fCheckpointsEnabled = DEFAULT_CHECKPOINTS_ENABLED;
+bool fAssumeValidProofs = DEFAULT_ASSUME_VALID_PROOFS;
+uint256 hashAssumeValidProofs;
 size_t nCoinCacheUsage = 5000 * 300;
 uint64_t nPruneTarget = 0;
 int64_t nMaxTipAge = DEFAULT_MAX_TIP_AGE;
@@ -131,7 +134,7 @@ struct IteratorComparator {
 };
 
 struct COrphanTx {
-    CTransaction tx;
+    CTransactionRef tx;
     NodeId fromPeer;
     int64_t nTimeExpire;
 };
@@ -266,7 +269,7 @@ namespace {
     int nPeersWithValidatedDownloads = 0;
 
     /** Relay map, protected by cs_main. */
-    typedef std::map <uint256, std::shared_ptr<const CTransaction>> MapRelay;
+    typedef std::map <uint256, CTransactionRef> MapRelay;
     MapRelay mapRelay;
     std::map<CInv, CDataStream> mapRelayInv;
     /** Expiration-time ordered list of (expire time, relay map entry) pairs, protected by cs_main). */
@@ -757,7 +760,8 @@ CBlockTreeDB *pblocktree = NULL;
 // mapOrphanTransactions
 //
 
-bool AddOrphanTx(const CTransaction &tx, NodeId peer) EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
+bool AddOrphanTx(const CTransactionRef &ptx, NodeId peer) EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
+    const CTransaction &tx = *ptx;
     uint256 hash = tx.GetHash();
     if (mapOrphanTransactions.count(hash))
         return false;
@@ -775,7 +779,7 @@ bool AddOrphanTx(const CTransaction &tx, NodeId peer) EXCLUSIVE_LOCKS_REQUIRED(c
         return false;
     }
 
-    auto ret = mapOrphanTransactions.emplace(hash, COrphanTx{tx, peer, GetTime() + ORPHAN_TX_EXPIRE_TIME});
+    auto ret = mapOrphanTransactions.emplace(hash, COrphanTx{ptx, peer, GetTime() + ORPHAN_TX_EXPIRE_TIME});
     assert(ret.second);
     BOOST_FOREACH(
     const CTxIn &txin, tx.vin) {
@@ -792,7 +796,7 @@ int static EraseOrphanTx(uint256 hash) EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
     if (it == mapOrphanTransactions.end())
         return 0;
     BOOST_FOREACH(
-    const CTxIn &txin, it->second.tx.vin)
+    const CTxIn &txin, it->second.tx->vin)
     {
         auto itPrev = mapOrphanTransactionsByPrev.find(txin.prevout);
         if (itPrev == mapOrphanTransactionsByPrev.end())
@@ -811,7 +815,7 @@ void EraseOrphansFor(NodeId peer) {
     while (iter != mapOrphanTransactions.end()) {
         map<uint256, COrphanTx>::iterator maybeErase = iter++; // increment to avoid iterator becoming invalid
         if (maybeErase->second.fromPeer == peer) {
-            nErased += EraseOrphanTx(maybeErase->second.tx.GetHash());
+            nErased += EraseOrphanTx(maybeErase->second.tx->GetHash());
         }
     }
     if (nErased > 0) LogPrint("mempool", "Erased %d orphan tx from peer %d\n", nErased, peer);
@@ -830,7 +834,7 @@ unsigned int LimitOrphanTxSize(unsigned int nMaxOrphans) EXCLUSIVE_LOCKS_REQUIRE
         while (iter != mapOrphanTransactions.end()) {
             map<uint256, COrphanTx>::iterator maybeErase = iter++;
             if (maybeErase->second.nTimeExpire <= nNow) {
-                nErased += EraseOrphanTx(maybeErase->second.tx.GetHash());
+                nErased += EraseOrphanTx(maybeErase->second.tx->GetHash());
             } else {
                 nMinExpTime = std::min(maybeErase->second.nTimeExpire, nMinExpTime);
             }
@@ -1243,7 +1247,7 @@ std::string FormatStateMessage(const CValidationState &state) {
 bool AcceptToMemoryPoolWorker(
         CTxMemPool &pool,
         CValidationState &state,
-        const CTransaction &tx,
+        const CTransactionRef &ptx,
         bool fCheckInputs,
         bool fLimitFree,
         bool *pfMissingInputs,
@@ -1252,6 +1256,7 @@ bool AcceptToMemoryPoolWorker(
         std::vector <uint256> &vHashTxnToUncache,
         bool isCheckWalletTransaction,
         bool markZcoinSpendTransactionSerial) {
+    const CTransaction &tx = *ptx;
     bool fTestNet = (Params().NetworkIDString() == CBaseChainParams::TESTNET);
     LogPrintf("AcceptToMemoryPoolWorker(),fCheckInputs=%s, tx.IsZerocoinSpend()=%s, fTestNet=%s\n",
               fCheckInputs, tx.IsZerocoinSpend() || tx.IsSigmaSpend(), fTestNet);
@@ -1533,7 +1538,7 @@ bool AcceptToMemoryPoolWorker(
                 }
             }
 
-            CTxMemPoolEntry entry(tx, nFees, GetTime(), dPriority, chainActive.Height(), pool.HasNoInputsOf(tx),
+            CTxMemPoolEntry entry(ptx, nFees, GetTime(), dPriority, chainActive.Height(), pool.HasNoInputsOf(tx),
                                   inChainInputValue, fSpendsCoinbase, nSigOpsCost, lp);
 
             // TODO: Temporarily disable this condition (by setting txMinFee = 0) to accept zero-fee TX (from old 0.8 client)
@@ -1833,7 +1838,7 @@ bool AcceptToMemoryPoolWorker(
             CAmount nFees = 0;
             int64_t nSigOpsCost = GetLegacySigOpCount(tx);
             CTxMemPool::setEntries setAncestors;
-            CTxMemPoolEntry entry(tx, nFees, GetTime(), dPriority, chainActive.Height(), pool.HasNoInputsOf(tx),
+            CTxMemPoolEntry entry(ptx, nFees, GetTime(), dPriority, chainActive.Height(), pool.HasNoInputsOf(tx),
                                   inChainInputValue, fSpendsCoinbase, nSigOpsCost, lp);
             pool.addUnchecked(hash, entry, setAncestors, !IsInitialBlockDownload());
             if (tx.IsZerocoinSpend()) {
@@ -1875,7 +1880,7 @@ bool AcceptToMemoryPoolWorker(
 bool AcceptToMemoryPool(
 	    CTxMemPool &pool,
 	    CValidationState &state,
-	    const CTransaction &tx,
+	    const CTransactionRef &ptx,
 	    bool fCheckInputs,
         bool fLimitFree,
         bool *pfMissingInputs,
@@ -1883,12 +1888,13 @@ bool AcceptToMemoryPool(
 	    const CAmount nAbsurdFee,
         bool isCheckWalletTransaction,
         bool markZcoinSpendTransactionSerial) {
+    const CTransaction &tx = *ptx;
     LogPrintf("AcceptToMemoryPool(), transaction: %s, fCheckInputs=%s\n",
               tx.GetHash().ToString(),
               fCheckInputs);
     std::vector <uint256> vHashTxToUncache;
     bool res = AcceptToMemoryPoolWorker(
-        pool, state, tx, fCheckInputs, fLimitFree, pfMissingInputs,
+        pool, state, ptx, fCheckInputs, fLimitFree, pfMissingInputs,
         fOverrideMempoolLimit, nAbsurdFee,
         vHashTxToUncache, isCheckWalletTransaction,
         markZcoinSpendTransactionSerial);
@@ -1907,6 +1913,31 @@ bool AcceptToMemoryPool(
     return res;
 }
 
+bool AcceptToMemoryPool(
+        CTxMemPool &pool,
+        CValidationState &state,
+        const CTransaction &tx,
+        bool fCheckInputs,
+        bool fLimitFree,
+        bool *pfMissingInputs,
+        bool fOverrideMempoolLimit,
+        const CAmount nAbsurdFee,
+        bool isCheckWalletTransaction,
+        bool markZcoinSpendTransactionSerial) {
+    return AcceptToMemoryPool(pool, state, MakeTransactionRef(tx), fCheckInputs, fLimitFree,
+                              pfMissingInputs, fOverrideMempoolLimit, nAbsurdFee,
+                              isCheckWalletTransaction, markZcoinSpendTransactionSerial);
+}
+
+bool AddToStemPoolFromMempool(const uint256 &hash) {
+    AssertLockHeld(cs_main);
+    if (!stempool.addFromPool(mempool, hash, !IsInitialBlockDownload()))
+        return false;
+    LimitMempoolSize(stempool, GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000,
+                     GetArg("-mempoolexpiry", DEFAULT_MEMPOOL_EXPIRY) * 60 * 60);
+    return stempool.exists(hash);
+}
+
 /** Return transaction in txOut, and if it was found inside a block, its hash is placed in hashBlock */
 bool
 GetTransaction(const uint256 &hash, CTransaction &txOut, const Consensus::Params &consensusParams, uint256 &hashBlock,
@@ -1957,8 +1988,8 @@ GetTransaction(const uint256 &hash, CTransaction &txOut, const Consensus::Params
     if (pindexSlow) {
         CBlock block;
         if (ReadBlockFromDisk(block, pindexSlow, consensusParams)) {
-            BOOST_FOREACH(
-            const CTransaction &tx, block.vtx) {
+            for (const CTransactionRef& ptx : block.vtx) {
+                const CTransaction& tx = *ptx;
                 if (tx.GetHash() == hash) {
                     txOut = tx;
                     hashBlock = pindexSlow->GetBlockHash();
@@ -2586,6 +2617,13 @@ namespace {
 
 } // anon namespace
 
+bool ReadBlockUndoFromDisk(CBlockUndo &blockundo, const CBlockIndex *pindex) {
+    CDiskBlockPos pos = pindex->GetUndoPos();
+    if (pos.IsNull() || !pindex->pprev)
+        return error("%s: no undo data available for block %s", __func__, pindex->GetBlockHash().ToString());
+    return UndoReadFromDisk(blockundo, pos, pindex->pprev->GetBlockHash());
+}
+
 /**
  * Apply the undo operation of a CTxInUndo to the given chain state.
  * @param undo The undo object.
@@ -2644,7 +2682,7 @@ bool DisconnectBlock(const CBlock &block, CValidationState &state, const CBlockI
 
     // undo transactions in reverse order
     for (int i = block.vtx.size() - 1; i >= 0; i--) {
-        const CTransaction &tx = block.vtx[i];
+        const CTransaction &tx = *block.vtx[i];
 
         uint256 hash = tx.GetHash();
 
@@ -2704,7 +2742,7 @@ bool DisconnectBlock(const CBlock &block, CValidationState &state, const CBlockI
                 AbortNode(state, "Failed to write address unspent index");
                 return error("Failed to write address unspent index");
             }
-            if (!pblocktree->AddTotalSupply(-(block.vtx[0].GetValueOut() - nFees))) {
+            if (!pblocktree->AddTotalSupply(-(block.vtx[0]->GetValueOut() - nFees))) {
                 AbortNode(state, "Failed to write total supply");
                 return error("Failed to write total supply");
             }
@@ -2828,11 +2866,11 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
         return true;
     }
 		    // Set proof-of-stake hash modifier
-    pindex->nStakeModifier = ComputeStakeModifier(pindex->pprev, block.IsProofOfStake() ? block.vtx[1].vin[0].prevout.hash : block.GetHash());
+    pindex->nStakeModifier = ComputeStakeModifier(pindex->pprev, block.IsProofOfStake() ? block.vtx[1]->vin[0].prevout.hash : block.GetHash());
 
     // Check proof-of-stake
     if (block.IsProofOfStake()) {
-         const COutPoint &prevout = block.vtx[1].vin[0].prevout;
+         const COutPoint &prevout = block.vtx[1]->vin[0].prevout;
          const CCoins *coins = view.AccessCoins(prevout.hash);
           if (!coins)
               return state.DoS(100, error("ConnectBlock(): kernel input unavailable"),
@@ -2846,7 +2884,7 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
          if(!CheckStakeBlockTimestamp(block.nTime))
               return state.DoS(100, error("ConnectBlock(): proof-of-stake time check failed"),
                                  REJECT_INVALID, "bad-cs-timecheck");
-        if (!CheckProofOfStake(pindex->pprev, block.vtx[1], block.nTime, block.nBits, state,mapBlockIndex[block.hashPrevBlock]))
+        if (!CheckProofOfStake(pindex->pprev, *block.vtx[1], block.nTime, block.nBits, state,mapBlockIndex[block.hashPrevBlock]))
               return state.DoS(100, error("ConnectBlock(): proof-of-stake check failed"),
                                  REJECT_INVALID, "bad-cs-proofhash");
         
@@ -2860,6 +2898,19 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
         }
     }
 
+    // Spend proofs are the most expensive part of historical blocks. Those of assumed-valid
+    // blocks are not verified; the spends are still checked against and applied to the state.
+    bool fProofChecks = true;
+    if (fAssumeValidProofs) {
+        if (!fScriptChecks) {
+            fProofChecks = false;
+        } else if (!hashAssumeValidProofs.IsNull()) {
+            BlockMap::const_iterator it = mapBlockIndex.find(hashAssumeValidProofs);
+            if (it != mapBlockIndex.end() && it->second->GetAncestor(pindex->nHeight) == pindex)
+                fProofChecks = false;
+        }
+    }
+
     int64_t nTime1 = GetTimeMicros();
     nTimeCheck += nTime1 - nTimeStart;
     LogPrint("bench", "    - Sanity checks: %.2fms [%.2fs]\n", 0.001 * (nTime1 - nTimeStart), nTimeCheck * 0.000001);
@@ -2891,8 +2942,8 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
 
     bool fEnforceBIP30 = true;
     if (fEnforceBIP30) {
-        BOOST_FOREACH(
-        const CTransaction &tx, block.vtx) {
+        for (const CTransactionRef& ptx : block.vtx) {
+            const CTransaction& tx = *ptx;
             const CCoins *coins = view.AccessCoins(tx.GetHash());
             if (coins && !coins->IsPruned())
                 return state.DoS(100, error("ConnectBlock(): tried to overwrite transaction"), REJECT_INVALID,
@@ -2965,9 +3016,11 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
 
     block.zerocoinTxInfo = std::make_shared<CZerocoinTxInfo>();
     block.sigmaTxInfo = std::make_shared<sigma::CSigmaTxInfo>();
+    block.zerocoinTxInfo->fSkipProofVerification = !fProofChecks;
+    block.sigmaTxInfo->fSkipProofVerification = !fProofChecks;
 
     for (unsigned int i = 0; i < block.vtx.size(); i++) {
-        const CTransaction &tx = block.vtx[i];
+        const CTransaction &tx = *block.vtx[i];
 
         uint256 txHash = tx.GetHash();
         if (txIds.count(txHash) > 0 && (fTestNet || pindex->nHeight >= HF_INDEXNODE_HEIGHT))
@@ -2995,7 +3048,7 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
                 auto itByPrev = mapOrphanTransactionsByPrev.find(tx.vin[j].prevout);
                 if (itByPrev == mapOrphanTransactionsByPrev.end()) continue;
                 for (auto mi = itByPrev->second.begin(); mi != itByPrev->second.end(); ++mi) {
-                    const CTransaction &orphanTx = (*mi)->second.tx;
+                    const CTransaction &orphanTx = *(*mi)->second.tx;
                     const uint256 &orphanHash = orphanTx.GetHash();
                     vOrphanErase.push_back(orphanHash);
                 }
@@ -3067,9 +3120,9 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
     //btzc: Add time to check
     CAmount blockReward = nFees + GetBlockSubsidy(pindex->nHeight, chainparams.GetConsensus(), pindex->nTime);
 	if (block.IsProofOfWork()) {
-        if (block.vtx[0].GetValueOut() > blockReward)
+        if (block.vtx[0]->GetValueOut() > blockReward)
             return state.DoS(100, error("ConnectBlock(): coinbase pays too much (actual=%d vs limit=%d)",
-                                        block.vtx[0].GetValueOut(), blockReward),
+                                        block.vtx[0]->GetValueOut(), blockReward),
                              REJECT_INVALID, "bad-cb-amount");
     }
 
@@ -3092,7 +3145,7 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
         return state.DoS(0, error("ConnectBlock(): %s", strError), REJECT_INVALID, "bad-cb-amount");
     }
     //get proper vtx to check mn payments for
-    const CTransaction& txNew = (block.nNonce == 0) ? block.vtx[1] : block.vtx[0];
+    const CTransaction& txNew = (block.nNonce == 0) ? *block.vtx[1] : *block.vtx[0];
     if (block.nTime > sporkManager.GetSporkValue(SPORK_8_INDEXNODE_PAYMENT_ENFORCEMENT) && !IsBlockPayeeValid(txNew, pindex->nHeight, blockReward)) {
         mapRejectedBlocks.insert(make_pair(block.GetHash(), GetTime()));
         return state.DoS(0, error("ConnectBlock(): couldn't find indexnode or superblock payments"),
@@ -3143,7 +3196,7 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
         if (!pblocktree->UpdateAddressUnspentIndex(dbIndexHelper.getAddressUnspentIndex()))
             return AbortNode(state, "Failed to write address unspent index");
 
-        if (!pblocktree->AddTotalSupply(block.vtx[0].GetValueOut() - nFees))
+        if (!pblocktree->AddTotalSupply(block.vtx[0]->GetValueOut() - nFees))
             return AbortNode(state, "Failed to write total supply");
     }
 
@@ -3166,7 +3219,7 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
     // Watch for changes to the previous coinbase transaction.
     static uint256 hashPrevBestCoinBase;
     GetMainSignals().UpdatedTransaction(hashPrevBestCoinBase);
-    hashPrevBestCoinBase = block.vtx[0].GetHash();
+    hashPrevBestCoinBase = block.vtx[0]->GetHash();
 
     // Erase orphan transactions include or precluded by this block
     if (vOrphanErase.size()) {
@@ -3181,7 +3234,8 @@ bool ConnectBlock(const CBlock &block, CValidationState &state, CBlockIndex *pin
     // Erase conflicting zerocoin txs from the mempool
     CZerocoinState *zcState = CZerocoinState::GetZerocoinState();
     sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
-    BOOST_FOREACH(const CTransaction &tx, block.vtx) {
+    for (const CTransactionRef& ptx : block.vtx) {
+        const CTransaction& tx = *ptx;
         if (tx.IsZerocoinSpend() || tx.IsZerocoinRemint()) {
             BOOST_FOREACH(
             const CTxIn &txin, tx.vin)
@@ -3454,7 +3508,7 @@ bool static DisconnectTip(CValidationState &state, const CChainParams &chainpara
     // retrieve all mints
     block.sigmaTxInfo = std::make_shared<sigma::CSigmaTxInfo>();
     for (auto const& tx : block.vtx) {
-        CheckTransaction(tx, state, tx.GetHash(), false, pindexDelete->pprev->nHeight,
+        CheckTransaction(*tx, state, tx->GetHash(), false, pindexDelete->pprev->nHeight,
             false, false, nullptr, block.sigmaTxInfo.get());
     }
 
@@ -3479,32 +3533,19 @@ bool static DisconnectTip(CValidationState &state, const CChainParams &chainpara
     if (!fBare) {
         // Resurrect mempool transactions from the disconnected block.
         std::vector <uint256> vHashUpdate;
-        BOOST_FOREACH(const CTransaction &tx, block.vtx) {
+        for (const CTransactionRef& ptx : block.vtx) {
+            const CTransaction& tx = *ptx;
             // ignore validation errors in resurrected transactions
             list <CTransaction> removed;
             CValidationState stateDummy;
-            CValidationState dandelionStateDummy;
-            // Changes to mempool should also be made to Dandelion stempool.
-            if (!tx.IsCoinBase()) {
-                AcceptToMemoryPool(
-                    stempool,
-                    dandelionStateDummy,
-                    tx,
-                    false, /* fCheckInputs */
-                    false, /* fLimitFree */
-                    NULL, /* pfMissingInputs */
-                    false, /* fOverrideMempoolLimit */
-                    0, /* nAbsurdFee */
-                    false, /* isCheckWalletTransaction */
-                    false /* markZcoinSpendTransactionSerial */
-                );
-            }
-            if (tx.IsCoinBase() || tx.IsCoinStake() || !AcceptToMemoryPool(mempool, stateDummy, tx, true, false, NULL)) {
+            if (tx.IsCoinBase() || tx.IsCoinStake() || !AcceptToMemoryPool(mempool, stateDummy, ptx, true, false, NULL)) {
                 mempool.removeRecursive(tx, removed);
 
                 // Changes to mempool should also be made to Dandelion stempool.
                 stempool.removeRecursive(tx, removed);
             } else if (mempool.exists(tx.GetHash())) {
+                // Changes to mempool should also be made to Dandelion stempool.
+                AddToStemPoolFromMempool(tx.GetHash());
                 vHashUpdate.push_back(tx.GetHash());
             }
         }
@@ -3546,7 +3587,8 @@ bool static DisconnectTip(CValidationState &state, const CChainParams &chainpara
 
     // Let wallets know transactions went from 1-confirmed to
     // 0-confirmed or conflicted:
-    BOOST_FOREACH(const CTransaction &tx, block.vtx) {
+    for (const CTransactionRef& ptx : block.vtx) {
+        const CTransaction& tx = *ptx;
         SyncWithWallets(tx, pindexDelete->pprev, NULL);
     }
 
@@ -3628,6 +3670,7 @@ ConnectTip(CValidationState &state, const CChainParams &chainparams, CBlockIndex
     if (fElysium) {
         LogPrint("handler", "Elysium handler: block connect begin [height: %d]\n", GetHeight());
         elysium_handler_block_begin(GetHeight(), pindexNew);
+        elysium_handler_block_parse(*pblock, GetHeight(), pindexNew);
     }
 #endif
 
@@ -3649,8 +3692,8 @@ ConnectTip(CValidationState &state, const CChainParams &chainparams, CBlockIndex
         SyncWithWallets(tx, pindexNew, NULL);
     }
     // ... and about transactions that got confirmed:
-    BOOST_FOREACH(
-    const CTransaction &tx, pblock->vtx) {
+    for (const CTransactionRef& ptx : pblock->vtx) {
+        const CTransaction& tx = *ptx;
         SyncWithWallets(tx, pindexNew, pblock);
 
 #ifdef ENABLE_ELYSIUM
@@ -4231,6 +4274,7 @@ CBlockIndex *AddToBlockIndex(const CBlockHeader &block) {
     }
     if (block.nNonce == 0)
         pindexNew->SetProofOfStake();
+    pindexNew->BuildProofLinks();
     pindexNew->nChainWork = (pindexNew->pprev ? pindexNew->pprev->nChainWork : 0) + GetBlockProof(*pindexNew);
     pindexNew->RaiseValidity(BLOCK_VALID_TREE);
     if (pindexBestHeader == NULL || pindexBestHeader->nChainWork < pindexNew->nChainWork)
@@ -4389,7 +4433,7 @@ bool GetBlockPublicKey(const CBlock& block, std::vector<unsigned char>& vchPubKe
         return false;
 
     vector<vector<unsigned char> > vSolutions;
-    const CTxOut& txout = block.vtx[1].vout[1];
+    const CTxOut& txout = block.vtx[1]->vout[1];
     txnouttype whichType;
     Solver(txout.scriptPubKey,whichType, vSolutions);
 
@@ -4506,27 +4550,27 @@ bool CheckBlock(const CBlock &block, CValidationState &state,
             return state.DoS(100, false, REJECT_INVALID, "bad-blk-length", false, "size limits failed");
         }
         // First transaction must be coinbase, the rest must not be
-        if (block.vtx.empty() || !block.vtx[0].IsCoinBase()) {
+        if (block.vtx.empty() || !block.vtx[0]->IsCoinBase()) {
             LogPrintf("CheckBlock - first tx is not coinbase -> failed!\n");
             return state.DoS(100, false, REJECT_INVALID, "bad-cb-missing", false, "first tx is not coinbase");
         }
         for (unsigned int i = 1; i < block.vtx.size(); i++) {
-            if (block.vtx[i].IsCoinBase()) {
+            if (block.vtx[i]->IsCoinBase()) {
                 LogPrintf("CheckBlock - more than one coinbase -> failed!\n");
                 return state.DoS(100, false, REJECT_INVALID, "bad-cb-multiple", false, "more than one coinbase");
             }
         }
 		if (block.IsProofOfStake()) {
             // Coinbase output must be empty if proof-of-stake block
-            if (block.vtx[0].vout.size() != 1 || !block.vtx[0].vout[0].IsEmpty())
+            if (block.vtx[0]->vout.size() != 1 || !block.vtx[0]->vout[0].IsEmpty())
                 return state.DoS(100, false, REJECT_INVALID, "bad-cb-not-empty", false, "coinbase output not empty for proof-of-stake block");
 
             // Second transaction must be coinstake, the rest must not be
-            if (block.vtx.size() < 2 || !block.vtx[1].IsCoinStake())
+            if (block.vtx.size() < 2 || !block.vtx[1]->IsCoinStake())
                 return state.DoS(100, false, REJECT_INVALID, "bad-cs-missing", false, "second tx is not coinstake");
 
             for (unsigned int i = 2; i < block.vtx.size(); i++)
-                if (block.vtx[i].IsCoinStake())
+                if (block.vtx[i]->IsCoinStake())
                 return state.DoS(100, false, REJECT_INVALID, "bad-cs-multiple", false, "more than one coinstake");
         }
 
@@ -4542,7 +4586,8 @@ bool CheckBlock(const CBlock &block, CValidationState &state,
             // We should never accept block which conflicts with completed transaction lock,
             // that's why this is in CheckBlock unlike coinbase payee/amount.
             // Require other nodes to comply, send them some data in case they are missing it.
-            BOOST_FOREACH(const CTransaction& tx, block.vtx) {
+            for (const CTransactionRef& ptx : block.vtx) {
+                const CTransaction& tx = *ptx;
                 // skip coinbase, it has no inputs
                 if (tx.IsCoinBase()) continue;
                 // LOOK FOR TRANSACTION LOCK IN OUR MAP OF OUTPOINTS
@@ -4569,13 +4614,14 @@ bool CheckBlock(const CBlock &block, CValidationState &state,
         // Check transactions
         if (nHeight == INT_MAX)
             nHeight = ZerocoinGetNHeight(block.GetBlockHeader());
-        const CTransaction& txNew = (block.nNonce == 0) ? block.vtx[1] : block.vtx[0];
+        const CTransaction& txNew = (block.nNonce == 0) ? *block.vtx[1] : *block.vtx[0];
         //We dont really use checkzerocoinfoundersinputs after snapshot payee block,disable with the next update
         if (nHeight > 1 && !CheckZerocoinFoundersInputs(txNew, state, Params().GetConsensus(), nHeight, false)) {
             return state.Invalid(false, state.GetRejectCode(), state.GetRejectReason(), "Founders' reward check failed");
         }
 
-        BOOST_FOREACH(const CTransaction &tx, block.vtx) {
+        for (const CTransactionRef& ptx : block.vtx) {
+            const CTransaction& tx = *ptx;
             // We don't check transactions against zerocoin state here, we'll check it again later in ConnectBlock
             if (!CheckTransaction(tx, state, tx.GetHash(), isVerifyDB, nHeight, false, false, NULL, NULL)) {
                 LogPrintf("block=%s\n", block.ToString());
@@ -4586,9 +4632,8 @@ bool CheckBlock(const CBlock &block, CValidationState &state,
         }
 
         unsigned int nSigOps = 0;
-        BOOST_FOREACH(
-        const CTransaction &tx, block.vtx)
-        {
+        for (const CTransactionRef& ptx : block.vtx) {
+            const CTransaction& tx = *ptx;
             nSigOps += GetLegacySigOpCount(tx);
         }
         if (nSigOps * WITNESS_SCALE_FACTOR > MAX_BLOCK_SIGOPS_COST)
@@ -4635,11 +4680,11 @@ bool IsWitnessEnabled(const CBlockIndex *pindexPrev, const Consensus::Params &pa
 // commitment occurs, or -1 if not found.
 static int GetWitnessCommitmentIndex(const CBlock &block) {
     int commitpos = -1;
-    for (size_t o = 0; o < block.vtx[0].vout.size(); o++) {
-        if (block.vtx[0].vout[o].scriptPubKey.size() >= 38 && block.vtx[0].vout[o].scriptPubKey[0] == OP_RETURN &&
-            block.vtx[0].vout[o].scriptPubKey[1] == 0x24 && block.vtx[0].vout[o].scriptPubKey[2] == 0xaa &&
-            block.vtx[0].vout[o].scriptPubKey[3] == 0x21 && block.vtx[0].vout[o].scriptPubKey[4] == 0xa9 &&
-            block.vtx[0].vout[o].scriptPubKey[5] == 0xed) {
+    for (size_t o = 0; o < block.vtx[0]->vout.size(); o++) {
+        if (block.vtx[0]->vout[o].scriptPubKey.size() >= 38 && block.vtx[0]->vout[o].scriptPubKey[0] == OP_RETURN &&
+            block.vtx[0]->vout[o].scriptPubKey[1] == 0x24 && block.vtx[0]->vout[o].scriptPubKey[2] == 0xaa &&
+            block.vtx[0]->vout[o].scriptPubKey[3] == 0x21 && block.vtx[0]->vout[o].scriptPubKey[4] == 0xa9 &&
+            block.vtx[0]->vout[o].scriptPubKey[5] == 0xed) {
             commitpos = o;
         }
     }
@@ -4650,10 +4695,12 @@ void UpdateUncommittedBlockStructures(CBlock &block, const CBlockIndex *pindexPr
                                       const Consensus::Params &consensusParams) {
     int commitpos = GetWitnessCommitmentIndex(block);
     static const std::vector<unsigned char> nonce(32, 0x00);
-    if (commitpos != -1 && IsWitnessEnabled(pindexPrev, consensusParams) && block.vtx[0].wit.IsEmpty()) {
-        block.vtx[0].wit.vtxinwit.resize(1);
-        block.vtx[0].wit.vtxinwit[0].scriptWitness.stack.resize(1);
-        block.vtx[0].wit.vtxinwit[0].scriptWitness.stack[0] = nonce;
+    if (commitpos != -1 && IsWitnessEnabled(pindexPrev, consensusParams) && block.vtx[0]->wit.IsEmpty()) {
+        CMutableTransaction tx(*block.vtx[0]);
+        tx.wit.vtxinwit.resize(1);
+        tx.wit.vtxinwit[0].scriptWitness.stack.resize(1);
+        tx.wit.vtxinwit[0].scriptWitness.stack[0] = nonce;
+        block.vtx[0] = MakeTransactionRef(std::move(tx));
     }
 }
 
@@ -4678,8 +4725,9 @@ GenerateCoinbaseCommitment(CBlock &block, const CBlockIndex *pindexPrev, const C
             memcpy(&out.scriptPubKey[6], witnessroot.begin(), 32);
             commitment = std::vector < unsigned
             char > (out.scriptPubKey.begin(), out.scriptPubKey.end());
-            const_cast<std::vector <CTxOut> *>(&block.vtx[0].vout)->push_back(out);
-            block.vtx[0].UpdateHash();
+            CMutableTransaction tx(*block.vtx[0]);
+            tx.vout.push_back(out);
+            block.vtx[0] = MakeTransactionRef(std::move(tx));
         }
     }
     UpdateUncommittedBlockStructures(block, pindexPrev, consensusParams);
@@ -4775,8 +4823,8 @@ bool ContextualCheckBlock(const CBlock &block, CValidationState &state, CBlockIn
                               : block.GetBlockTime();
 
     // Check that all transactions are finalized
-    BOOST_FOREACH(
-    const CTransaction &tx, block.vtx) {
+    for (const CTransactionRef& ptx : block.vtx) {
+        const CTransaction& tx = *ptx;
         if (!IsFinalTx(tx, nHeight, nLockTimeCutoff)) {
             return state.DoS(10, false, REJECT_INVALID, "bad-txns-nonfinal", false, "non-final transaction");
         }
@@ -4787,9 +4835,9 @@ bool ContextualCheckBlock(const CBlock &block, CValidationState &state, CBlockIn
     if ((block.nVersion & 0xff) >= 2 &&
         IsSuperMajority(2, pindexPrev, consensusParams.nMajorityEnforceBlockUpgrade, consensusParams)) {
         CScript expect = CScript() << nHeight;
-//        LogPrintf("block.vtx[0].vin[0].scriptSig.begin()=%s\n", block.vtx[0].vin[0].scriptSig.begin());
-        if (block.vtx[0].vin[0].scriptSig.size() < expect.size() ||
-            !std::equal(expect.begin(), expect.end(), block.vtx[0].vin[0].scriptSig.begin())) {
+//        LogPrintf("block.vtx[0]->vin[0].scriptSig.begin()=%s\n", block.vtx[0]->vin[0].scriptSig.begin());
+        if (block.vtx[0]->vin[0].scriptSig.size() < expect.size() ||
+            !std::equal(expect.begin(), expect.end(), block.vtx[0]->vin[0].scriptSig.begin())) {
             return state.DoS(100, false, REJECT_INVALID, "bad-cb-height", false, "block height mismatch in coinbase");
         }
     }
@@ -4811,14 +4859,14 @@ bool ContextualCheckBlock(const CBlock &block, CValidationState &state, CBlockIn
             // The malleation check is ignored; as the transaction tree itself
             // already does not permit it, it is impossible to trigger in the
             // witness tree.
-            if (block.vtx[0].wit.vtxinwit.size() != 1 || block.vtx[0].wit.vtxinwit[0].scriptWitness.stack.size() != 1 ||
-                block.vtx[0].wit.vtxinwit[0].scriptWitness.stack[0].size() != 32) {
+            if (block.vtx[0]->wit.vtxinwit.size() != 1 || block.vtx[0]->wit.vtxinwit[0].scriptWitness.stack.size() != 1 ||
+                block.vtx[0]->wit.vtxinwit[0].scriptWitness.stack[0].size() != 32) {
                 return state.DoS(100, error("%s : invalid witness nonce size", __func__), REJECT_INVALID,
                                  "bad-witness-nonce-size", true);
             }
-            CHash256().Write(hashWitness.begin(), 32).Write(&block.vtx[0].wit.vtxinwit[0].scriptWitness.stack[0][0],
+            CHash256().Write(hashWitness.begin(), 32).Write(&block.vtx[0]->wit.vtxinwit[0].scriptWitness.stack[0][0],
                                                             32).Finalize(hashWitness.begin());
-            if (memcmp(hashWitness.begin(), &block.vtx[0].vout[commitpos].scriptPubKey[6], 32)) {
+            if (memcmp(hashWitness.begin(), &block.vtx[0]->vout[commitpos].scriptPubKey[6], 32)) {
                 return state.DoS(100, error("%s : witness merkle commitment mismatch", __func__), REJECT_INVALID,
                                  "bad-witness-merkle-match", true);
             }
@@ -4829,7 +4877,7 @@ bool ContextualCheckBlock(const CBlock &block, CValidationState &state, CBlockIn
     // No witness data is allowed in blocks that don't commit to witness data, as this would otherwise leave room for spam
     if (!fHaveWitness) {
         for (size_t i = 0; i < block.vtx.size(); i++) {
-            if (!block.vtx[i].wit.IsNull()) {
+            if (!block.vtx[i]->wit.IsNull()) {
                 return state.DoS(100, error("%s : unexpected witness data found", __func__), REJECT_INVALID,
                                  "unexpected-witness", true);
             }
@@ -4861,12 +4909,12 @@ bool CheckStake(CBlock* pblock, CWallet& wallet, const CChainParams& chainparams
 
     CValidationState state;
     // verify hash target and signature of coinstake tx
-    if (!CheckProofOfStake(mapBlockIndex[pblock->hashPrevBlock], pblock->vtx[1], pblock->nTime, pblock->nBits, state,mapBlockIndex[pblock->hashPrevBlock]))
+    if (!CheckProofOfStake(mapBlockIndex[pblock->hashPrevBlock], *pblock->vtx[1], pblock->nTime, pblock->nBits, state,mapBlockIndex[pblock->hashPrevBlock]))
         return error("CheckStake() : proof-of-stake checking failed");
 
     //// debug print
     LogPrintf("%s\n", pblock->ToString());
-    LogPrintf("out %s\n", FormatMoney(pblock->vtx[1].GetValueOut()));
+    LogPrintf("out %s\n", FormatMoney(pblock->vtx[1]->GetValueOut()));
 
     // Found a solution
     {
@@ -4892,7 +4940,7 @@ bool SignBlock(CBlock& block, CWallet& wallet, int64_t& nFees, CBlockTemplate *p
 {
     // if we are trying to sign
     // something except proof-of-stake block template
-    if (!block.vtx[0].vout[0].IsEmpty()){
+    if (!block.vtx[0]->vout[0].IsEmpty()){
         LogPrintf("something except proof-of-stake block\n");
         return false;
     }
@@ -4907,7 +4955,7 @@ bool SignBlock(CBlock& block, CWallet& wallet, int64_t& nFees, CBlockTemplate *p
     static int64_t nLastCoinStakeSearchTime = GetAdjustedTime(); // startup timestamp
 
     CKey key;
-    CMutableTransaction txCoinBase(block.vtx[0]);
+    CMutableTransaction txCoinBase(*block.vtx[0]);
     CMutableTransaction txCoinStake;
 
     int64_t nStakeTime = GetAdjustedTime();
@@ -4922,9 +4970,9 @@ bool SignBlock(CBlock& block, CWallet& wallet, int64_t& nFees, CBlockTemplate *p
                 // make sure coinstake would meet timestamp protocol
                 // as it would be the same as the block timestamp
                 block.nTime = nSearchTime;
-                block.vtx[0] = txCoinBase;
+                block.vtx[0] = MakeTransactionRef(txCoinBase);
 
-                block.vtx.insert(block.vtx.begin() + 1, txCoinStake);
+                block.vtx.insert(block.vtx.begin() + 1, MakeTransactionRef(txCoinStake));
 
                 block.hashMerkleRoot = BlockMerkleRoot(block);
                 // append a signature to our block
@@ -5364,8 +5412,10 @@ bool static LoadBlockIndexDB() {
         if (pindex->nStatus & BLOCK_FAILED_MASK &&
             (!pindexBestInvalid || pindex->nChainWork > pindexBestInvalid->nChainWork))
             pindexBestInvalid = pindex;
-        if (pindex->pprev)
+        if (pindex->pprev) {
             pindex->BuildSkip();
+            pindex->BuildProofLinks();
+        }
         if (pindex->IsValid(BLOCK_VALID_TREE) &&
             (pindexBestHeader == NULL || CBlockIndexWorkComparator()(pindexBestHeader, pindex)))
             pindexBestHeader = pindex;
@@ -6312,7 +6362,7 @@ void static ProcessGetData(CNode *pfrom, const Consensus::Params &consensusParam
                             typedef std::pair<unsigned int, uint256> PairType;
                             BOOST_FOREACH(PairType & pair, merkleBlock.vMatchedTxn)
                                 pfrom->PushMessageWithFlag(SERIALIZE_TRANSACTION_NO_WITNESS, NetMsgType::TX,
-                                        block.vtx[pair.first]);
+                                        *block.vtx[pair.first]);
                         }
                         // else
                         // no response
@@ -6564,6 +6614,42 @@ uint32_t GetFetchFlags(CNode *pfrom, CBlockIndex *pprev, const Consensus::Params
     return nFetchFlags;
 }
 
+/**
+ * Check a BIP 157 request and look up its stop block. Peers asking for filters
+ * we do not serve or for a malformed range are disconnected. Returns false if
+ * the request is to be dropped.
+ */
+static bool PrepareBlockFilterRequest(CNode *pfrom, uint8_t nFilterType, uint32_t nStartHeight,
+                                      const uint256 &stopHash, uint32_t nMaxCount, const CBlockIndex *&pindexStop) {
+    if (!(nLocalServices & NODE_COMPACT_FILTERS) || !pblockfilterindex ||
+        nFilterType != pblockfilterindex->GetFilterType()) {
+        LogPrint("net", "peer %d requested unsupported block filter type: %d\n", pfrom->id, nFilterType);
+        pfrom->fDisconnect = true;
+        return false;
+    }
+
+    {
+        LOCK(cs_main);
+        BlockMap::iterator it = mapBlockIndex.find(stopHash);
+        if (it == mapBlockIndex.end() || !(it->second->nStatus & BLOCK_HAVE_DATA) ||
+            !it->second->IsValid(BLOCK_VALID_SCRIPTS)) {
+            LogPrint("net", "peer %d requested filters for unknown block %s\n", pfrom->id, stopHash.ToString());
+            pfrom->fDisconnect = true;
+            return false;
+        }
+        pindexStop = it->second;
+    }
+
+    uint32_t nStopHeight = pindexStop->nHeight;
+    if (nStartHeight > nStopHeight || nStopHeight - nStartHeight >= nMaxCount) {
+        LogPrint("net", "peer %d sent invalid block filter range: start %d, stop %d\n", pfrom->id, nStartHeight, nStopHeight);
+        pfrom->fDisconnect = true;
+        return false;
+    }
+
+    return true;
+}
+
 bool static ProcessMessage(CNode *pfrom, string strCommand,
                            CDataStream &vRecv, int64_t nTimeReceived,
                            const CChainParams &chainparams) {
@@ -6588,11 +6674,6 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
         }
     }
 
-    {
-        LOCK(cs_main);
-        CNode::CheckDandelionEmbargoes();
-    }
-
     if (strCommand == NetMsgType::VERSION) {
         // Feeler connections exist only to verify if address is online.
         if (pfrom->fFeeler) {
@@ -7071,6 +7152,70 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
         }
         pfrom->PushMessageWithFlag(State(pfrom->GetId())->fWantsCmpctWitness ? 0 : SERIALIZE_TRANSACTION_NO_WITNESS,
                                    NetMsgType::BLOCKTXN, resp);
+    } else if (strCommand == NetMsgType::GETCFILTERS) {
+        uint8_t nFilterType;
+        uint32_t nStartHeight;
+        uint256 stopHash;
+        vRecv >> nFilterType >> nStartHeight >> stopHash;
+
+        const CBlockIndex *pindexStop;
+        if (!PrepareBlockFilterRequest(pfrom, nFilterType, nStartHeight, stopHash, MAX_GETCFILTERS_SIZE, pindexStop))
+            return true;
+
+        // Filters come precomputed from the index, blocks it has not reached yet are not served
+        std::vector<BlockFilter> filters;
+        if (!pblockfilterindex->LookupFilterRange(nStartHeight, pindexStop, filters)) {
+            LogPrint("net", "Failed to find block filters in range %d to %s for peer=%d\n", nStartHeight, stopHash.ToString(), pfrom->id);
+            return true;
+        }
+
+        BOOST_FOREACH(const BlockFilter &filter, filters)
+            pfrom->PushMessage(NetMsgType::CFILTER, filter);
+    } else if (strCommand == NetMsgType::GETCFHEADERS) {
+        uint8_t nFilterType;
+        uint32_t nStartHeight;
+        uint256 stopHash;
+        vRecv >> nFilterType >> nStartHeight >> stopHash;
+
+        const CBlockIndex *pindexStop;
+        if (!PrepareBlockFilterRequest(pfrom, nFilterType, nStartHeight, stopHash, MAX_GETCFHEADERS_SIZE, pindexStop))
+            return true;
+
+        uint256 prevHeader;
+        if (nStartHeight > 0) {
+            const CBlockIndex *pindexPrev = pindexStop->GetAncestor(nStartHeight - 1);
+            if (!pblockfilterindex->LookupFilterHeader(pindexPrev, prevHeader)) {
+                LogPrint("net", "Failed to find block filter header for %s for peer=%d\n", pindexPrev->GetBlockHash().ToString(), pfrom->id);
+                return true;
+            }
+        }
+
+        std::vector<uint256> filterHashes;
+        if (!pblockfilterindex->LookupFilterHashRange(nStartHeight, pindexStop, filterHashes)) {
+            LogPrint("net", "Failed to find block filter hashes in range %d to %s for peer=%d\n", nStartHeight, stopHash.ToString(), pfrom->id);
+            return true;
+        }
+
+        pfrom->PushMessage(NetMsgType::CFHEADERS, nFilterType, stopHash, prevHeader, filterHashes);
+    } else if (strCommand == NetMsgType::GETCFCHECKPT) {
+        uint8_t nFilterType;
+        uint256 stopHash;
+        vRecv >> nFilterType >> stopHash;
+
+        const CBlockIndex *pindexStop;
+        if (!PrepareBlockFilterRequest(pfrom, nFilterType, 0, stopHash, std::numeric_limits<uint32_t>::max(), pindexStop))
+            return true;
+
+        std::vector<uint256> headers(pindexStop->nHeight / CFCHECKPT_INTERVAL);
+        for (size_t i = 0; i < headers.size(); i++) {
+            const CBlockIndex *pindex = pindexStop->GetAncestor((i + 1) * CFCHECKPT_INTERVAL);
+            if (!pblockfilterindex->LookupFilterHeader(pindex, headers[i])) {
+                LogPrint("net", "Failed to find block filter header for %s for peer=%d\n", pindex->GetBlockHash().ToString(), pfrom->id);
+                return true;
+            }
+        }
+
+        pfrom->PushMessage(NetMsgType::CFCHECKPT, nFilterType, stopHash, headers);
     } else if (strCommand == NetMsgType::GETHEADERS) {
         CBlockLocator locator;
         uint256 hashStop;
@@ -7127,22 +7272,23 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
         CTxLockRequest txLockRequest;
         CDarksendBroadcastTx dstx;
         int nInvType = MSG_TX;
-        CTransaction tx;
-//        vRecv >> tx;
+        CTransactionRef ptx;
         // LogPrintf("ProcessMessage() txHash=%s\n", tx.GetHash().ToString());
 
-        // Read data and assign inv type
+        // Read data and assign inv type. The transaction is allocated once here and
+        // the same reference is then shared by the mempool, stempool and orphan map.
         if (strCommand == NetMsgType::TX) {
-            vRecv >> tx;
+            vRecv >> ptx;
         } else if (strCommand == NetMsgType::TXLOCKREQUEST) {
             vRecv >> txLockRequest;
-            tx = txLockRequest;
+            ptx = MakeTransactionRef(txLockRequest);
             nInvType = MSG_TXLOCK_REQUEST;
         } else if (strCommand == NetMsgType::DSTX) {
             vRecv >> dstx;
-            tx = dstx.tx;
+            ptx = MakeTransactionRef(dstx.tx);
             nInvType = MSG_DSTX;
         }
+        const CTransaction &tx = *ptx;
 
         CInv inv(nInvType, tx.GetHash());
         pfrom->AddInventoryKnown(inv);
@@ -7194,28 +7340,17 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
         bool fMissingInputs = false;
         bool fMissingInputsZerocoin = false;
         CValidationState state;
-        CValidationState dummyState; // Dummy state for Dandelion stempool
 
         pfrom->setAskFor.erase(inv.hash);
         mapAlreadyAskedFor.erase(inv.hash);
         if (!AlreadyHave(inv) && !tx.IsZerocoinSpend() &&
-            AcceptToMemoryPool(mempool, state, tx, true, true, &fMissingInputs, false, 0, true)) {
+            AcceptToMemoryPool(mempool, state, ptx, true, true, &fMissingInputs, false, 0, true)) {
             LogPrintf("Transaction %s received and added to the mempool.\n",
                       tx.GetHash().ToString());
 
             // Changes to mempool should also be made to Dandelion stempool.
-            AcceptToMemoryPool(
-                stempool,
-                dummyState,
-                tx,
-                true, /* fCheckInputs */
-                true, /* fLimitFree */
-                &fMissingInputs, /* pfMissingInputs */
-                false, /* fOverrideMempoolLimit */
-                0, /* nAbsurdFee */
-                true, /* isCheckWalletTransaction */
-                false /* markZcoinSpendTransactionSerial */
-            );
+            // The transaction has just been validated, so reuse the mempool entry.
+            AddToStemPoolFromMempool(tx.GetHash());
 
             if (CNode::isTxDandelionEmbargoed(tx.GetHash())) {
                 //LogPrintf(
@@ -7255,7 +7390,8 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
                 for (auto mi = itByPrev->second.begin();
                      mi != itByPrev->second.end();
                      ++mi) {
-                    const CTransaction &orphanTx = (*mi)->second.tx;
+                    const CTransactionRef &porphanTx = (*mi)->second.tx;
+                    const CTransaction &orphanTx = *porphanTx;
                     const uint256 &orphanHash = orphanTx.GetHash();
                     NodeId fromPeer = (*mi)->second.fromPeer;
                     bool fMissingInputs2 = false;
@@ -7263,26 +7399,14 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
                     // resolution (that is, feeding people an invalid transaction based on LegitTxX in order to get
                     // anyone relaying LegitTxX banned)
                     CValidationState stateDummy;
-                    CValidationState stateDummyDandelion;
 
                     if (setMisbehaving.count(fromPeer))
                         continue;
-                    if (AcceptToMemoryPool(mempool, stateDummy, orphanTx, true, true,
+                    if (AcceptToMemoryPool(mempool, stateDummy, porphanTx, true, true,
                             &fMissingInputs2, false, 0, true)) {
                         // LogPrintf("Accepted orphan tx %s\n", orphanHash.ToString());
                         // Changes to mempool should also be made to Dandelion stempool
-                        AcceptToMemoryPool(
-                            stempool,
-                            stateDummyDandelion,
-                            orphanTx,
-                            false, /* fCheckInputs */
-                            true, /* fLimitFree */
-                            &fMissingInputs2,  /* pfMissingInputs */
-                            false, /* fOverrideMempoolLimit */
-                            0, /* nAbsurdFee */
-                            true, /* isCheckWalletTransaction */
-                            false /* markZcoinSpendTransactionSerial */
-                        );
+                        AddToStemPoolFromMempool(orphanHash);
 
                         RelayTransaction(orphanTx);
                         for (unsigned int i = 0; i < orphanTx.vout.size(); i++) {
@@ -7322,20 +7446,9 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
             //btzc: index condition
         } else if (
             !AlreadyHave(inv) && tx.IsZerocoinSpend() && !tx.IsSigmaSpend() &&
-            AcceptToMemoryPool(mempool, state, tx, false, true, &fMissingInputsZerocoin, false, 0, true)) {
+            AcceptToMemoryPool(mempool, state, ptx, false, true, &fMissingInputsZerocoin, false, 0, true)) {
             // Changes to mempool should also be made to Dandelion stempool
-            AcceptToMemoryPool(
-                stempool,
-                dummyState,
-                tx,
-                false, /* fCheckInputs */
-                true, /* fLimitFree */
-                &fMissingInputsZerocoin,  /* pfMissingInputs */
-                false, /* fOverrideMempoolLimit */
-                0, /* nAbsurdFee */
-                true, /* isCheckWalletTransaction */
-                false /* markZcoinSpendTransactionSerial */
-            );
+            AddToStemPoolFromMempool(tx.GetHash());
             if (CNode::isTxDandelionEmbargoed(tx.GetHash())) {
                 //LogPrintf("Embargoed dandeliontx %s found in mempool; removing from embargo map.\n",
                 //          tx.GetHash().ToString());
@@ -7366,7 +7479,7 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
                     pfrom->AddInventoryKnown(_inv);
                     if (!AlreadyHave(_inv)) pfrom->AskFor(_inv);
                 }
-                AddOrphanTx(tx, pfrom->GetId());
+                AddOrphanTx(ptx, pfrom->GetId());
 
                 // DoS prevention: do not allow mapOrphanTransactions to grow unbounded
 //                unsigned int nMaxOrphanTx = (unsigned int) std::max((int64_t) 0, GetArg("-maxorphantx", DEFAULT_MAX_ORPHAN_TRANSACTIONS));
@@ -7593,7 +7706,7 @@ bool static ProcessMessage(CNode *pfrom, string strCommand,
                     // TODO: don't ignore failures
                     return true;
                 }
-                std::vector <CTransaction> dummy;
+                std::vector <CTransactionRef> dummy;
                 status = tempBlock.FillBlock(block, dummy);
                 if (status == READ_STATUS_OK) {
                     fBlockReconstructed = true;
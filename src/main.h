@@ -36,6 +36,7 @@
 
 class CBlockIndex;
 class CBlockTreeDB;
+class CBlockUndo;
 class CBloomFilter;
 class CChainParams;
 class CInv;
@@ -143,6 +144,8 @@ static const int64_t DEFAULT_MAX_TIP_AGE = 24 * 60 * 60;
 /** Default for -permitbaremultisig */
 static const bool DEFAULT_PERMIT_BAREMULTISIG = true;
 static const bool DEFAULT_CHECKPOINTS_ENABLED = true;
+/** Default for -assumevalidproofs: skip spend proofs below the last checkpoint */
+static const bool DEFAULT_ASSUME_VALID_PROOFS = true;
 static const bool DEFAULT_TXINDEX = true;
 static const bool DEFAULT_TIMESTAMPINDEX = false;
 static const bool DEFAULT_ADDRESSINDEX = false;
@@ -204,6 +207,10 @@ extern bool fIsBareMultisigStd;
 extern bool fRequireStandard;
 extern bool fCheckBlockIndex;
 extern bool fCheckpointsEnabled;
+/** Whether Zerocoin and Sigma spend proofs of assumed-valid blocks are left unverified */
+extern bool fAssumeValidProofs;
+/** Block which, besides the last checkpoint, has its spend proofs and those of its ancestors assumed valid */
+extern uint256 hashAssumeValidProofs;
 extern int64_t nLastCoinStakeSearchInterval;
 
 //extern int nBestHeight;
@@ -359,6 +366,22 @@ bool AcceptToMemoryPool(
         const CAmount nAbsurdFee=0,
         bool isCheckWalletTransaction = false,
         bool markZcoinSpendTransactionSerial = true);
+/** As above, but the pool entry shares ownership of ptx instead of copying it. */
+bool AcceptToMemoryPool(
+        CTxMemPool& pool,
+        CValidationState &state,
+        const CTransactionRef &ptx,
+        bool fCheckInputs,
+        bool fLimitFree,
+        bool* pfMissingInputs,
+        bool fOverrideMempoolLimit=false,
+        const CAmount nAbsurdFee=0,
+        bool isCheckWalletTransaction = false,
+        bool markZcoinSpendTransactionSerial = true);
+
+/** Mirror a transaction that was just accepted to the mempool into the Dandelion
+ *  stempool, reusing the validated mempool entry instead of validating it twice. */
+bool AddToStemPoolFromMempool(const uint256 &hash);
 
 /** Convert CValidationState to a human-readable message for logging */
 std::string FormatStateMessage(const CValidationState &state);
@@ -514,6 +537,8 @@ bool GetAddressUnspent(uint160 addressHash, AddressType type,
 bool WriteBlockToDisk(const CBlock& block, CDiskBlockPos& pos, const CMessageHeader::MessageStartChars& messageStart);
 bool ReadBlockFromDisk(CBlock& block, const CDiskBlockPos& pos, int nHeight, const Consensus::Params& consensusParams);
 bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams);
+/** Read the undo data of a connected block, which holds the outputs spent by its transactions */
+bool ReadBlockUndoFromDisk(CBlockUndo& blockundo, const CBlockIndex* pindex);
 
 /** Functions for validating blocks and updating the block tree */
 
@@ -828,7 +828,7 @@ CBlockTemplate* BlockAssembler::CreateNewBlock(
         }
     }
     // Add dummy coinbase tx as first transaction
-    pblock->vtx.push_back(CTransaction());
+    pblock->vtx.push_back(CTransactionRef());
     pblocktemplate->vTxFees.push_back(-1); // updated at end
     pblocktemplate->vTxSigOpsCost.push_back(-1); // updated at end
 
@@ -1044,7 +1044,7 @@ CBlockTemplate* BlockAssembler::CreateNewBlock(
 
                 CAmount nTxFees = iter->GetFee();
 
-                pblock->vtx.push_back(tx);
+                pblock->vtx.push_back(iter->GetSharedTx());
                 pblocktemplate->vTxFees.push_back(nTxFees);
                 pblocktemplate->vTxSigOpsCost.push_back(nTxSigOps);
                 nBlockSize += nTxSize;
@@ -1072,7 +1072,7 @@ CBlockTemplate* BlockAssembler::CreateNewBlock(
             }
             CAmount nTxFees = iter->GetFee();
             // Added
-            pblock->vtx.push_back(tx);
+            pblock->vtx.push_back(iter->GetSharedTx());
             pblocktemplate->vTxFees.push_back(nTxFees);
             pblocktemplate->vTxSigOpsCost.push_back(nTxSigOps);
             nBlockSize += nTxSize;
@@ -1132,7 +1132,7 @@ CBlockTemplate* BlockAssembler::CreateNewBlock(
         if(!fProofOfStake)//Only Set vout of coinbasetx as blockreward in PoW Blocks
             coinbaseTx.vout[0].nValue += blockReward;
         coinbaseTx.vin[0].scriptSig = CScript() << nHeight << OP_0;
-        pblock->vtx[0] = coinbaseTx;
+        pblock->vtx[0] = MakeTransactionRef(std::move(coinbaseTx));
         pblocktemplate->vTxFees[0] = -nFees;
 
         // Fill in header
@@ -1142,7 +1142,7 @@ CBlockTemplate* BlockAssembler::CreateNewBlock(
         }
         pblock->nBits  = GetNextWorkRequired(pindexPrev, pblock, chainparams.GetConsensus(),fProofOfStake);
         pblock->nNonce = fProofOfStake ? 0 : 1;
-        pblocktemplate->vTxSigOpsCost[0] = GetLegacySigOpCount(pblock->vtx[0]);
+        pblocktemplate->vTxSigOpsCost[0] = GetLegacySigOpCount(*pblock->vtx[0]);
 
         //LogPrintf("CreateNewBlock(): AFTER pblocktemplate->vTxSigOpsCost[0] = GetLegacySigOpCount(pblock->vtx[0])\n");
 
@@ -1303,7 +1303,7 @@ bool BlockAssembler::TestForBlock(CTxMemPool::txiter iter)
 
 void BlockAssembler::AddToBlock(CTxMemPool::txiter iter)
 {
-    pblock->vtx.push_back(iter->GetTx());
+    pblock->vtx.push_back(iter->GetSharedTx());
     pblocktemplate->vTxFees.push_back(iter->GetFee());
     pblocktemplate->vTxSigOpsCost.push_back(iter->GetSigOpCost());
     if (fNeedSizeAccounting) {
@@ -1530,7 +1530,7 @@ void BlockAssembler::addPriorityTxs()
     {
         double dPriority = mi->GetPriority(nHeight);
         CAmount dummy;
-        CTransaction tx = mi->GetTx();
+        const CTransaction& tx = mi->GetTx();
         mempool.ApplyDeltas(tx.GetHash(), dPriority, dummy);
         vecPriority.push_back(TxCoinAgePriority(dPriority, mi));
         //add Index validation
@@ -1560,7 +1560,7 @@ void BlockAssembler::addPriorityTxs()
             if (tx.IsSigmaSpend())
                 nTxFees = mi->GetFee();
 
-            pblock->vtx.push_back(tx);
+            pblock->vtx.push_back(mi->GetSharedTx());
             pblocktemplate->vTxFees.push_back(nTxFees);
             pblocktemplate->vTxSigOpsCost.push_back(nTxSigOps);
             nBlockSize += nTxSize;
@@ -1663,7 +1663,7 @@ void BlockAssembler::addPriorityTxs()
 static bool ProcessBlockFound(const CBlock* pblock, const CChainParams& chainparams)
 {
     LogPrintf("%s\n", pblock->ToString());
-    LogPrintf("generated %s\n", FormatMoney(pblock->vtx[0].vout[0].nValue));
+    LogPrintf("generated %s\n", FormatMoney(pblock->vtx[0]->vout[0].nValue));
 
     // Found a solution
     {
@@ -1766,9 +1766,10 @@ void static ZcoinMiner(const CChainParams &chainparams) {
             while (true) {
                 // Check if something found
                 uint256 thash;
-                   ///change to x116rv3
+                // Only nNonce changes until the next time update below
+                CBlockHeaderPoWHasher powHasher(*pblock);
                 while (true) {
-                    thash = pblock->GetPoWHash();
+                    thash = powHasher.GetPoWHash(pblock->nNonce);
 
                     //LogPrintf("*****\nhash   : %s  \ntarget : %s\n", UintToArith256(thash).ToString(), hashTarget.ToString());
 
@@ -1929,10 +1930,10 @@ void IncrementExtraNonce(CBlock* pblock, const CBlockIndex* pindexPrev, unsigned
     }
     ++nExtraNonce;
     unsigned int nHeight = pindexPrev->nHeight+1; // Height first in coinbase required for block.version=2
-    CMutableTransaction txCoinbase(pblock->vtx[0]);
+    CMutableTransaction txCoinbase(*pblock->vtx[0]);
     txCoinbase.vin[0].scriptSig = (CScript() << nHeight << CScriptNum(nExtraNonce)) + COINBASE_FLAGS;
     assert(txCoinbase.vin[0].scriptSig.size() <= 100);
 
-    pblock->vtx[0] = txCoinbase;
+    pblock->vtx[0] = MakeTransactionRef(std::move(txCoinbase));
     pblock->hashMerkleRoot = BlockMerkleRoot(*pblock);
 }
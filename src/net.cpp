@@ -68,6 +68,7 @@
 #endif
 
 extern CTxMemPool mempool;
+extern CCriticalSection cs_main;
 
 // Function body is in main.cpp
 bool AcceptToMemoryPool(
@@ -2362,8 +2363,14 @@ void StartNode(boost::thread_group &threadGroup, CScheduler &scheduler) {
     threadGroup.create_thread(
         boost::bind(&TraceThread<void (*)()>, "dandelion", &ThreadDandelionShuffle));
 
+    // Release embargoed Dandelion transactions once their embargo has expired
+    scheduler.scheduleEvery([]() {
+        LOCK(cs_main);
+        CNode::CheckDandelionEmbargoes();
+    }, 1, "dandelionembargo", "dandelion");
+
     // Dump network addresses
-    scheduler.scheduleEvery(&DumpData, DUMP_ADDRESSES_INTERVAL);
+    scheduler.scheduleEvery(&DumpData, DUMP_ADDRESSES_INTERVAL, "dumpaddresses");
 }
 
 bool StopNode() {
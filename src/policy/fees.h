@@ -9,6 +9,7 @@
 #include "uint256.h"
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -87,20 +88,19 @@ private:
     // Count the total # of txs in each bucket
     // Track the historical moving average of this total over blocks
     std::vector<double> txCtAvg;
-    // and calculate the total for the current block to update the moving average
-    std::vector<int> curBlockTxCt;
 
     // Count the total # of txs confirmed within Y blocks in each bucket
     // Track the historical moving average of theses totals over blocks
     std::vector<std::vector<double> > confAvg; // confAvg[Y][X]
-    // and calculate the totals for the current block to update the moving averages
-    std::vector<std::vector<int> > curBlockConf; // curBlockConf[Y][X]
 
     // Sum the total priority/fee of all tx's in each bucket
     // Track the historical moving average of this total over blocks
     std::vector<double> avg;
-    // and calculate the total for the current block to update the moving average
-    std::vector<double> curBlockVal;
+
+    // The moving averages are kept multiplied by scale, which grows by 1/decay every block.
+    // Decaying them all is then a single division, and the current block's transactions are
+    // added to them directly with weight scale.
+    double scale;
 
     // Combine the conf counts with tx counts to calculate the confirmation % for each Y,X
     // Combine the total value with the tx counts to calculate the avg fee/priority per bucket
@@ -126,11 +126,11 @@ public:
      */
     void Initialize(std::vector<double>& defaultBuckets, unsigned int maxConfirms, double decay, std::string dataTypeString);
 
-    /** Clear the state of the curBlock variables to start counting for the new block */
+    /** Start counting for the new block, decaying the historical moving averages */
     void ClearCurrent(unsigned int nBlockHeight);
 
     /**
-     * Record a new transaction data point in the current block stats
+     * Record a new transaction data point in the moving averages of the current block
      * @param blocksToConfirm the number of blocks it took this transaction to confirm
      * @param val either the fee or the priority when entered of the transaction
      * @warning blocksToConfirm is 1-based and has to be >= 1
@@ -144,8 +144,8 @@ public:
     void removeTx(unsigned int entryHeight, unsigned int nBestSeenHeight,
                   unsigned int bucketIndex);
 
-    /** Update our estimates by decaying our historical moving average and updating
-        with the data gathered from the current block */
+    /** Finish the current block. Only touches every bucket when the scale has to be folded
+        back into the moving averages, which is rare. */
     void UpdateMovingAverages();
 
     /**
@@ -166,7 +166,7 @@ public:
     unsigned int GetMaxConfirms() { return confAvg.size(); }
 
     /** Write state of estimation data to a file*/
-    void Write(CAutoFile& fileout);
+    void Write(CAutoFile& fileout) const;
 
     /**
      * Read saved state of estimation data from a file and replace all internal data structures and
@@ -210,6 +210,13 @@ static const double FEE_SPACING = 1.1;
 /** Spacing of Priority buckets */
 static const double PRI_SPACING = 2;
 
+/** Classes of transactions with separate fee statistics */
+enum class FeeEstimateClass {
+    TRANSPARENT,
+    //! Sigma spends, which have no transparent inputs and a very different size and fee profile
+    SIGMA
+};
+
 /**
  *  We want to be able to estimate fees or priorities that are needed on tx's to be included in
  * a certain number of blocks.  Every time a block is added to the best chain, this class records
@@ -241,13 +248,14 @@ public:
     bool isPriDataPoint(const CFeeRate &fee, double pri);
 
     /** Return a fee estimate */
-    CFeeRate estimateFee(int confTarget);
+    CFeeRate estimateFee(int confTarget, FeeEstimateClass feeClass = FeeEstimateClass::TRANSPARENT);
 
     /** Estimate fee rate needed to get be included in a block within
      *  confTarget blocks. If no answer can be given at confTarget, return an
      *  estimate at the lowest target where one can be given.
      */
-    CFeeRate estimateSmartFee(int confTarget, int *answerFoundAtTarget, const CTxMemPool& pool);
+    CFeeRate estimateSmartFee(int confTarget, int *answerFoundAtTarget, const CTxMemPool& pool,
+                              FeeEstimateClass feeClass = FeeEstimateClass::TRANSPARENT);
 
     /** Return a priority estimate */
     double estimatePriority(int confTarget);
@@ -280,7 +288,12 @@ private:
     std::map<uint256, TxStatsInfo> mapMemPoolTxs;
 
     /** Classes to track historical data on transaction confirmations */
-    TxConfirmStats feeStats, priStats;
+    TxConfirmStats feeStats, priStats, sigmaStats;
+
+    TxConfirmStats& GetFeeStats(FeeEstimateClass feeClass)
+    {
+        return feeClass == FeeEstimateClass::SIGMA ? sigmaStats : feeStats;
+    }
 
     /** Breakpoints to help determine whether a transaction was confirmed by priority or Fee */
     CFeeRate feeLikely, feeUnlikely;
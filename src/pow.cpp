@@ -38,42 +38,35 @@ unsigned int DarkGravityWave(const CBlockIndex* pindexLast, const Consensus::Par
     /* current difficulty formula, veil - DarkGravity v3, written by Evan Duffield - evan@dash.org */
     const arith_uint256 bnPowLimit = UintToArith256(params.powLimit);
 
-    const CBlockIndex *pindex = pindexLast;
-    const CBlockIndex* pindexLastMatchingProof = nullptr;
     arith_uint256 bnPastTargetAvg = 0;
     // make sure we have at least (nPastBlocks + 1) blocks, otherwise just return powLimit
-    if (!pindexLast || pindexLast->nHeight < params.nDgwPastBlocks) {
+    if (!pindexLast || pindexLast->nHeight < params.nDgwPastBlocks || params.nDgwPastBlocks <= 0) {
         return bnPowLimit.GetCompact();
     }
-    
+
+    // Only consider PoW or PoS blocks but not both. The blocks of the other type are jumped
+    // over through the proof type links, so the cost does not depend on how long ago the
+    // last block of the requested type was.
+    const CBlockIndex *pindex = GetLastBlockIndex(pindexLast, fProofOfStake);
     unsigned int nCountBlocks = 0;
-    while (nCountBlocks < params.nDgwPastBlocks) {
+    while (true) {
         // Ran out of blocks, return pow limit
-        if (!pindex)
+        if (!pindex || pindex->IsProofOfStake() != fProofOfStake)
             return bnPowLimit.GetCompact();
 
-        // Only consider PoW or PoS blocks but not both
-        if (pindex->IsProofOfStake() != fProofOfStake) {
-            pindex = pindex->pprev;
-            continue;
-        } else if (!pindexLastMatchingProof) {
-            pindexLastMatchingProof = pindex;
-        }
-
+        // The rounding of this running average is part of consensus, so it is not replaced by a sum
         arith_uint256 bnTarget = arith_uint256().SetCompact(pindex->nBits);
         bnPastTargetAvg = (bnPastTargetAvg * nCountBlocks + bnTarget) / (nCountBlocks + 1);
 
-        if (++nCountBlocks != params.nDgwPastBlocks)
-            pindex = pindex->pprev;
+        if (++nCountBlocks == (unsigned int)params.nDgwPastBlocks)
+            break;
+        pindex = pindex->pprev ? GetLastBlockIndex(pindex->pprev, fProofOfStake) : nullptr;
     }
 
     arith_uint256 bnNew(bnPastTargetAvg);
 
-    //Should only happen on the first PoS block
-    if (pindexLastMatchingProof)
-        pindexLastMatchingProof = pindexLast;
-
-    int64_t nActualTimespan = pindexLastMatchingProof->GetBlockTime() - pindex->GetBlockTime();
+    // The timespan is measured from pindexLast, whatever its proof type
+    int64_t nActualTimespan = pindexLast->GetBlockTime() - pindex->GetBlockTime();
     int64_t nTargetTimespan = params.nDgwPastBlocks * params.nPowTargetSpacing;
 
     if (nActualTimespan < nTargetTimespan/3)
@@ -32,6 +32,20 @@ uint256 CBlockHeader::GetPoWHash() const {
     return HashX16RV2(BEGIN(nVersion), END(nNonce), hashPrevBlock);
 }
 
+CBlockHeaderPoWHasher::CBlockHeaderPoWHasher(const CBlockHeader& header)
+    : midstate(new CX16RV2Midstate(BEGIN(header.nVersion), BEGIN(header.nNonce) - BEGIN(header.nVersion), header.hashPrevBlock))
+{
+}
+
+CBlockHeaderPoWHasher::~CBlockHeaderPoWHasher()
+{
+}
+
+uint256 CBlockHeaderPoWHasher::GetPoWHash(uint32_t nNonce) const
+{
+    return midstate->Finalize(BEGIN(nNonce), sizeof(nNonce));
+}
+
 std::string CBlock::ToString() const {
     std::stringstream s;
     s << strprintf(
@@ -43,7 +57,7 @@ std::string CBlock::ToString() const {
             nTime, nBits, nNonce,
             vtx.size());
     for (unsigned int i = 0; i < vtx.size(); i++) {
-        s << "  " << vtx[i].ToString() << "\n";
+        s << "  " << vtx[i]->ToString() << "\n";
     }
     return s.str();
 }
@@ -7,6 +7,7 @@
 #define BITCOIN_PRIMITIVES_BLOCK_H
 
 #include <deque>
+#include <memory>
 #include <type_traits>
 #include <boost/foreach.hpp>
 #include "primitives/transaction.h"
@@ -129,13 +130,31 @@ public:
     }
 };
 
+class CX16RV2Midstate;
+
+/** Computes GetPoWHash() of one header for many nonces. The fields in front
+ *  of nNonce are absorbed once on construction, so the hasher has to be
+ *  rebuilt whenever any of them (e.g. nTime) changes.
+ */
+class CBlockHeaderPoWHasher
+{
+public:
+    explicit CBlockHeaderPoWHasher(const CBlockHeader& header);
+    ~CBlockHeaderPoWHasher();
+
+    uint256 GetPoWHash(uint32_t nNonce) const;
+
+private:
+    std::unique_ptr<CX16RV2Midstate> midstate;
+};
+
 class CZerocoinTxInfo;
 
 class CBlock : public CBlockHeader
 {
 public:
     // network and disk
-    std::vector<CTransaction> vtx;
+    std::vector<CTransactionRef> vtx;
     // memory only
     mutable CTxOut txoutIndexnode; // indexnode payment
     mutable std::vector<CTxOut> voutSuperblock; // superblock payment
@@ -189,7 +208,7 @@ public:
 	// two types of block: proof-of-work or proof-of-stake
     bool IsProofOfStake() const
     {
-        return (vtx.size() > 1 && vtx[1].IsCoinStake());
+        return (vtx.size() > 1 && vtx[1]->IsCoinStake());
     }
 
     bool IsProofOfWork() const
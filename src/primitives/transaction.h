@@ -12,6 +12,7 @@
 #include "uint256.h"
 
 #include <exception>
+#include <memory>
 
 static const int SERIALIZE_TRANSACTION_NO_WITNESS = 0x40000000;
 
@@ -558,6 +559,12 @@ struct CMutableTransaction
     }
 };
 
+/** A shared, immutable transaction. Blocks, the mempool and the relay and
+ *  orphan maps hand these around instead of copying the transaction. */
+typedef std::shared_ptr<const CTransaction> CTransactionRef;
+static inline CTransactionRef MakeTransactionRef() { return std::make_shared<const CTransaction>(); }
+template <typename Tx> static inline CTransactionRef MakeTransactionRef(Tx&& txIn) { return std::make_shared<const CTransaction>(std::forward<Tx>(txIn)); }
+
 /** Compute the weight of a transaction, as defined by BIP 141 */
 int64_t GetTransactionWeight(const CTransaction &tx);
 
@@ -12,6 +12,7 @@
 #include "libzerocoin/bitcoin_bignum/bignum.h"
 #include "libzerocoin/Zerocoin.h"
 #include "key.h"
+#include "primitives/transaction.h"
 #include "sigma/coin.h"
 #include "serialize.h"
 #include "zerocoin_params.h"
@@ -32,6 +33,8 @@ struct CMintMeta
     bool isArchived;
     bool isDeterministic;
     bool isSeedCorrect;
+    //! Mint output, null until it has been looked up; stays valid across reorgs since it names the transaction
+    COutPoint outPoint;
 private:
     GroupElement pubCoinValue;
     mutable boost::optional<uint256> pubCoinValueHash;
@@ -41,6 +41,12 @@ namespace NetMsgType {
     const char *CMPCTBLOCK = "cmpctblock";
     const char *GETBLOCKTXN = "getblocktxn";
     const char *BLOCKTXN = "blocktxn";
+    const char *GETCFILTERS = "getcfilters";
+    const char *CFILTER = "cfilter";
+    const char *GETCFHEADERS = "getcfheaders";
+    const char *CFHEADERS = "cfheaders";
+    const char *GETCFCHECKPT = "getcfcheckpt";
+    const char *CFCHECKPT = "cfcheckpt";
     const char *DANDELIONTX="dandeliontx";
 //indexnode
     const char *TXLOCKVOTE="txlvote";
@@ -96,6 +102,12 @@ const static std::string allNetMessageTypes[] = {
         NetMsgType::CMPCTBLOCK,
         NetMsgType::GETBLOCKTXN,
         NetMsgType::BLOCKTXN,
+        NetMsgType::GETCFILTERS,
+        NetMsgType::CFILTER,
+        NetMsgType::GETCFHEADERS,
+        NetMsgType::CFHEADERS,
+        NetMsgType::GETCFCHECKPT,
+        NetMsgType::CFCHECKPT,
 		NetMsgType::DANDELIONTX,
         //indexnode
         NetMsgType::TXLOCKREQUEST,
@@ -243,6 +243,38 @@ extern const char *GETBLOCKTXN;
  * @since protocol version 70014 as described by BIP 152
  */
 extern const char *BLOCKTXN;
+/**
+ * Contains a filter type, a start height and a stop hash. Peer should respond
+ * with one "cfilter" message per block in the range.
+ * Only available with service bit NODE_COMPACT_FILTERS as described by BIP 157.
+ */
+extern const char *GETCFILTERS;
+/**
+ * Contains a block filter, the response to "getcfilters".
+ */
+extern const char *CFILTER;
+/**
+ * Contains a filter type, a start height and a stop hash. Peer should respond
+ * with a "cfheaders" message.
+ * Only available with service bit NODE_COMPACT_FILTERS as described by BIP 157.
+ */
+extern const char *GETCFHEADERS;
+/**
+ * Contains the filter header before a range of blocks and the filter hashes
+ * of the range, the response to "getcfheaders".
+ */
+extern const char *CFHEADERS;
+/**
+ * Contains a filter type and a stop hash. Peer should respond with a
+ * "cfcheckpt" message.
+ * Only available with service bit NODE_COMPACT_FILTERS as described by BIP 157.
+ */
+extern const char *GETCFCHECKPT;
+/**
+ * Contains the filter headers of every 1000th block up to the stop hash, the
+ * response to "getcfcheckpt".
+ */
+extern const char *CFCHECKPT;
 
 /**
  * The Dandelion tx message transmits a single Dandelion transaction.
@@ -295,6 +327,9 @@ enum ServiceFlags : uint64_t {
     // Indicates that a node can be asked for blocks and transactions including
     // witness data.
     NODE_WITNESS = (1 << 3),
+    // NODE_COMPACT_FILTERS means the node will serve basic block filters and filter headers.
+    // See BIP 157 for details on how this is implemented.
+    NODE_COMPACT_FILTERS = (1 << 6),
 
     // Bits 24-31 are reserved for temporary experiments. Just pick a bit that
     // isn't getting used, or one not being used much, and notify the
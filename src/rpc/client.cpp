@@ -26,6 +26,8 @@ static const CRPCConvertParam vRPCConvertParams[] =
 {
     { "stop", 0 },
     { "setmocktime", 0 },
+    { "getlockprofile", 0 },
+    { "setlockprofile", 0 },
     { "getaddednodeinfo", 0 },
     { "generate", 0 },
     { "generate", 1 },
@@ -10,6 +10,7 @@
 #include "net.h"
 #include "netbase.h"
 #include "rpc/server.h"
+#include "scheduler.h"
 #include "timedata.h"
 #include "txmempool.h"
 #include "util.h"
@@ -601,6 +602,159 @@ UniValue setmocktime(const UniValue& params, bool fHelp)
     return NullUniValue;
 }
 
+static UniValue LockTimesToJSON(const CLockTimeHistogram& histogram)
+{
+    UniValue result(UniValue::VOBJ);
+    result.push_back(Pair("total_us", histogram.nTotal));
+    result.push_back(Pair("max_us", histogram.nMax));
+    UniValue buckets(UniValue::VOBJ);
+    for (int i = 0; i < CLockTimeHistogram::BUCKETS; i++) {
+        if (!histogram.vCount[i])
+            continue;
+        std::string strBucket = i < CLockTimeHistogram::BUCKETS - 1 ? strprintf("<%d", int64_t(1) << i) : strprintf(">=%d", int64_t(1) << (i - 1));
+        buckets.push_back(Pair(strBucket, histogram.vCount[i]));
+    }
+    result.push_back(Pair("histogram", buckets));
+    return result;
+}
+
+static UniValue LockSiteProfileToJSON(const CLockSiteProfile& profile)
+{
+    UniValue result(UniValue::VOBJ);
+    result.push_back(Pair("acquired", profile.hold.nCount));
+    result.push_back(Pair("contended", profile.nContended));
+    result.push_back(Pair("wait", LockTimesToJSON(profile.wait)));
+    result.push_back(Pair("hold", LockTimesToJSON(profile.hold)));
+    return result;
+}
+
+UniValue getlockprofile(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() > 1)
+        throw runtime_error(
+            "getlockprofile ( reset )\n"
+            "\nReturns wait and hold times of the locks recorded since profiling started (see -lockprofile and setlockprofile).\n"
+            "Times are in microseconds, histogram buckets are powers of two. Locks are listed by name, and\n"
+            "within each lock by the call sites which held it.\n"
+            "\nArguments:\n"
+            "1. reset  (boolean, optional, default=false) Clear the recorded times after returning them\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"enabled\": true|false,  (boolean) Whether locks are being profiled\n"
+            "  \"locks\": {\n"
+            "    \"name\": {           (object) Name of the lock as passed to LOCK\n"
+            "      \"acquired\": n,     (numeric) Number of acquisitions\n"
+            "      \"contended\": n,    (numeric) Number of acquisitions which had to wait\n"
+            "      \"wait\": {          (object) Time spent waiting for the lock\n"
+            "        \"total_us\": n,\n"
+            "        \"max_us\": n,\n"
+            "        \"histogram\": { \"<bucket\": n, ... }\n"
+            "      },\n"
+            "      \"hold\": { ... },   (object) Time the lock was held, as for wait\n"
+            "      \"sites\": { \"file:line\": { ... }, ... }  (object) The same for every call site\n"
+            "    }, ...\n"
+            "  }\n"
+            "}\n"
+            "\nExamples:\n"
+            + HelpExampleCli("getlockprofile", "")
+            + HelpExampleCli("getlockprofile", "true")
+            + HelpExampleRpc("getlockprofile", "")
+        );
+
+    bool fReset = params.size() > 0 && params[0].get_bool();
+
+    std::map<std::string, CLockProfile> mapProfiles = GetLockProfile();
+    if (fReset)
+        ResetLockProfile();
+
+    UniValue locks(UniValue::VOBJ);
+    for (const auto& profile : mapProfiles) {
+        UniValue lock = LockSiteProfileToJSON(profile.second);
+        UniValue sites(UniValue::VOBJ);
+        for (const auto& site : profile.second.mapSites)
+            sites.push_back(Pair(site.first, LockSiteProfileToJSON(site.second)));
+        lock.push_back(Pair("sites", sites));
+        locks.push_back(Pair(profile.first, lock));
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.push_back(Pair("enabled", fLockProfile.load()));
+    result.push_back(Pair("locks", locks));
+    return result;
+}
+
+UniValue setlockprofile(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 1)
+        throw runtime_error(
+            "setlockprofile enable\n"
+            "\nStart or stop recording wait and hold times of locks. Recorded times are kept until getlockprofile resets them.\n"
+            "\nArguments:\n"
+            "1. enable  (boolean, required) Whether to profile locks\n"
+            "\nExamples:\n"
+            + HelpExampleCli("setlockprofile", "true")
+            + HelpExampleRpc("setlockprofile", "false")
+        );
+
+    fLockProfile = params[0].get_bool();
+    return NullUniValue;
+}
+
+UniValue getschedulerinfo(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 0)
+        throw runtime_error(
+            "getschedulerinfo\n"
+            "\nReturns the state of the scheduler running the node's periodic maintenance, and\n"
+            "runtime statistics of its tasks. Times are in microseconds.\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"queued\": n,            (numeric) Number of tasks waiting to run\n"
+            "  \"next\": n,              (numeric, optional) Unix time the next task is due\n"
+            "  \"tasks\": {\n"
+            "    \"name\": {\n"
+            "      \"runs\": n,          (numeric) Number of completed runs\n"
+            "      \"total_us\": n,      (numeric) Total time spent running\n"
+            "      \"average_us\": n,    (numeric) Average time of one run\n"
+            "      \"max_us\": n,        (numeric) Longest run\n"
+            "      \"max_delay_us\": n,  (numeric) Longest time a run started after it was due\n"
+            "      \"interval\": n,      (numeric) Seconds between runs, 0 for one-off tasks\n"
+            "      \"overruns\": n       (numeric) Runs which took, or started late by, longer than the interval\n"
+            "    }, ...\n"
+            "  }\n"
+            "}\n"
+            "\nExamples:\n"
+            + HelpExampleCli("getschedulerinfo", "")
+            + HelpExampleRpc("getschedulerinfo", "")
+        );
+
+    if (!pschedulerMain)
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Scheduler is not running");
+
+    UniValue result(UniValue::VOBJ);
+    boost::chrono::system_clock::time_point first, last;
+    size_t nQueued = pschedulerMain->getQueueInfo(first, last);
+    result.push_back(Pair("queued", (uint64_t)nQueued));
+    if (nQueued > 0)
+        result.push_back(Pair("next", (int64_t)boost::chrono::system_clock::to_time_t(first)));
+
+    UniValue tasks(UniValue::VOBJ);
+    for (const auto& task : pschedulerMain->getTaskStats()) {
+        const CScheduler::TaskStats& stats = task.second;
+        UniValue entry(UniValue::VOBJ);
+        entry.push_back(Pair("runs", stats.nRuns));
+        entry.push_back(Pair("total_us", stats.nTotalMicros));
+        entry.push_back(Pair("average_us", stats.nRuns ? stats.nTotalMicros / (int64_t)stats.nRuns : 0));
+        entry.push_back(Pair("max_us", stats.nMaxMicros));
+        entry.push_back(Pair("max_delay_us", stats.nMaxDelayMicros));
+        entry.push_back(Pair("interval", stats.nIntervalSeconds));
+        entry.push_back(Pair("overruns", stats.nOverruns));
+        tasks.push_back(Pair(task.first, entry));
+    }
+    result.push_back(Pair("tasks", tasks));
+    return result;
+}
+
 bool getAddressFromIndex(AddressType const & type, const uint160 &hash, std::string &address)
 {
     if (type == AddressType::payToScriptHash) {
@@ -1300,6 +1454,9 @@ static const CRPCCommand commands[] =
     { "util",               "createmultisig",         &createmultisig,         true  },
     { "util",               "verifymessage",          &verifymessage,          true  },
     { "util",               "signmessagewithprivkey", &signmessagewithprivkey, true  },
+    { "util",               "getlockprofile",         &getlockprofile,         true  },
+    { "util",               "setlockprofile",         &setlockprofile,         true  },
+    { "util",               "getschedulerinfo",       &getschedulerinfo,       true  },
 
         /* Address index */
     { "addressindex",       "getaddressmempool",      &getaddressmempool,      true  },
@@ -15,6 +15,9 @@
 
 #include <univalue.h>
 
+#include <atomic>
+#include <deque>
+
 #include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/foreach.hpp>
@@ -23,6 +26,8 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/signals2/signal.hpp>
 #include <boost/thread.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/algorithm/string/case_conv.hpp> // for to_upper()
 
 using namespace RPCServer;
@@ -287,6 +292,41 @@ static const CRPCCommand vRPCCommands[] =
     { "index",               "getpoolinfo",           &getpoolinfo,            true  },
 };
 
+/**
+ * Calls which may run concurrently when they are elements of the same batch
+ */
+static const char *vRPCReadOnlyCommands[] =
+{
+    "getbestblockhash",
+    "getblockcount",
+    "getblock",
+    "getblockhash",
+    "getblockhashes",
+    "getblockheader",
+    "getmempoolentry",
+    "gettxout",
+    "getrawtransaction",
+    "decoderawtransaction",
+    "decodescript",
+    "getaddressmempool",
+    "getaddressutxos",
+    "getaddressdeltas",
+    "getaddresstxids",
+    "getaddressbalance",
+    "getspentinfo",
+    "elysium_getbalance",
+    "elysium_getallbalancesforid",
+    "elysium_getallbalancesforaddress",
+    "elysium_gettransaction",
+    "elysium_getproperty",
+    "elysium_gettrade",
+    "elysium_getsto",
+    "elysium_listblocktransactions",
+    "elysium_gettradehistoryforaddress",
+    "elysium_gettradehistoryforpair",
+    "elysium_getpayload",
+};
+
 CRPCTable::CRPCTable()
 {
     unsigned int vcidx;
@@ -297,6 +337,9 @@ CRPCTable::CRPCTable()
         pcmd = &vRPCCommands[vcidx];
         mapCommands[pcmd->name] = pcmd;
     }
+
+    for (vcidx = 0; vcidx < (sizeof(vRPCReadOnlyCommands) / sizeof(vRPCReadOnlyCommands[0])); vcidx++)
+        setReadOnlyCommands.insert(vRPCReadOnlyCommands[vcidx]);
 }
 
 const CRPCCommand *CRPCTable::operator[](const std::string &name) const
@@ -307,6 +350,16 @@ const CRPCCommand *CRPCTable::operator[](const std::string &name) const
     return (*it).second;
 }
 
+bool CRPCTable::isReadOnly(const std::string& name) const
+{
+    return setReadOnlyCommands.count(name) != 0;
+}
+
+void CRPCTable::setReadOnly(const std::string& name)
+{
+    setReadOnlyCommands.insert(name);
+}
+
 bool CRPCTable::appendCommand(const std::string& name, const CRPCCommand* pcmd)
 {
     if (IsRPCRunning())
@@ -321,10 +374,76 @@ bool CRPCTable::appendCommand(const std::string& name, const CRPCCommand* pcmd)
     return true;
 }
 
+/**
+ * Worker threads executing read-only elements of JSON-RPC batches
+ */
+static class CRPCBatchThreadPool
+{
+private:
+    boost::mutex cs;
+    boost::condition_variable cond;
+    std::deque<boost::function<void()> > queue;
+    boost::thread_group threads;
+    bool running;
+
+    void ThreadProc()
+    {
+        while (true) {
+            boost::function<void()> job;
+            {
+                boost::unique_lock<boost::mutex> lock(cs);
+                while (running && queue.empty())
+                    cond.wait(lock);
+                if (!running)
+                    break;
+                job = queue.front();
+                queue.pop_front();
+            }
+            job();
+        }
+    }
+
+public:
+    CRPCBatchThreadPool() : running(false) {}
+
+    void Start(int nThreads)
+    {
+        boost::unique_lock<boost::mutex> lock(cs);
+        if (running || nThreads <= 0)
+            return;
+        running = true;
+        for (int i = 0; i < nThreads; i++)
+            threads.create_thread(boost::bind(&CRPCBatchThreadPool::ThreadProc, this));
+    }
+
+    void Stop()
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(cs);
+            running = false;
+            queue.clear();
+            cond.notify_all();
+        }
+        threads.join_all();
+    }
+
+    /** Queue a job. Returns false if the pool isn't running, in which case the job is dropped. */
+    bool Post(const boost::function<void()>& job)
+    {
+        boost::unique_lock<boost::mutex> lock(cs);
+        if (!running)
+            return false;
+        queue.push_back(job);
+        cond.notify_one();
+        return true;
+    }
+} rpcBatchThreadPool;
+
 bool StartRPC()
 {
     LogPrint("rpc", "Starting RPC\n");
     fRPCRunning = true;
+    rpcBatchThreadPool.Start(GetArg("-rpcbatchthreads", DEFAULT_RPC_BATCH_THREADS));
     g_rpcSignals.Started();
     return true;
 }
@@ -339,6 +458,7 @@ void InterruptRPC()
 void StopRPC()
 {
     LogPrint("rpc", "Stopping RPC\n");
+    rpcBatchThreadPool.Stop();
     deadlineTimers.clear();
     g_rpcSignals.Stopped();
 }
@@ -429,11 +549,91 @@ UniValue JSONRPCExecOne(const UniValue& req)
     return rpc_result;
 }
 
+static bool IsReadOnlyRequest(const UniValue& req)
+{
+    if (!req.isObject())
+        return false;
+    const UniValue& method = find_value(req.get_obj(), "method");
+    return method.isStr() && tableRPC.isReadOnly(method.get_str());
+}
+
+/**
+ * State of a run of consecutive read-only batch elements. It is shared with
+ * the pool jobs, which may only get to run after the caller has finished the
+ * run by itself.
+ */
+struct CRPCBatchRun
+{
+    UniValue vReq;
+    std::vector<UniValue> vReply;
+    std::atomic<unsigned int> nNext;
+    unsigned int nDone;
+    boost::mutex cs;
+    boost::condition_variable cond;
+
+    CRPCBatchRun(const UniValue& vReqIn, unsigned int nBegin, unsigned int nEnd) :
+        vReq(UniValue::VARR), vReply(nEnd - nBegin), nNext(0), nDone(0)
+    {
+        for (unsigned int reqIdx = nBegin; reqIdx < nEnd; reqIdx++)
+            vReq.push_back(vReqIn[reqIdx]);
+    }
+
+    void Execute()
+    {
+        unsigned int reqIdx;
+        while ((reqIdx = nNext++) < vReply.size()) {
+            vReply[reqIdx] = JSONRPCExecOne(vReq[reqIdx]);
+
+            boost::unique_lock<boost::mutex> lock(cs);
+            if (++nDone == vReply.size())
+                cond.notify_all();
+        }
+    }
+
+    void Wait()
+    {
+        boost::unique_lock<boost::mutex> lock(cs);
+        while (nDone < vReply.size())
+            cond.wait(lock);
+    }
+};
+
+static void JSONRPCExecRun(boost::shared_ptr<CRPCBatchRun> run)
+{
+    run->Execute();
+}
+
 std::string JSONRPCExecBatch(const UniValue& vReq)
 {
+    int nConcurrency = std::max((int)GetArg("-rpcbatchconcurrency", DEFAULT_RPC_BATCH_CONCURRENCY), 1);
+
     UniValue ret(UniValue::VARR);
-    for (unsigned int reqIdx = 0; reqIdx < vReq.size(); reqIdx++)
-        ret.push_back(JSONRPCExecOne(vReq[reqIdx]));
+    unsigned int reqIdx = 0;
+    while (reqIdx < vReq.size()) {
+        unsigned int nEnd = reqIdx;
+        while (nConcurrency > 1 && nEnd < vReq.size() && IsReadOnlyRequest(vReq[nEnd]))
+            nEnd++;
+
+        if (nEnd - reqIdx < 2) {
+            // Anything that may change state is executed in order, on this thread
+            ret.push_back(JSONRPCExecOne(vReq[reqIdx++]));
+            continue;
+        }
+
+        // This thread works on the run too, so it completes even if all the pool threads are busy
+        boost::shared_ptr<CRPCBatchRun> run(new CRPCBatchRun(vReq, reqIdx, nEnd));
+        unsigned int nHelpers = std::min((unsigned int)nConcurrency, nEnd - reqIdx) - 1;
+        for (unsigned int i = 0; i < nHelpers; i++) {
+            if (!rpcBatchThreadPool.Post(boost::bind(&JSONRPCExecRun, run)))
+                break;
+        }
+        run->Execute();
+        run->Wait();
+
+        for (const UniValue& reply : run->vReply)
+            ret.push_back(reply);
+        reqIdx = nEnd;
+    }
 
     return ret.write() + "\n";
 }
@@ -12,6 +12,7 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <stdint.h>
 #include <string>
 
@@ -34,6 +35,9 @@ namespace RPCServer
 class CBlockIndex;
 class CNetAddr;
 
+static const int DEFAULT_RPC_BATCH_THREADS = 4;
+static const int DEFAULT_RPC_BATCH_CONCURRENCY = 4;
+
 /** Wrapper for UniValue::VType, which includes typeAny:
  * Used to denote don't care type. Only used by RPCTypeCheckObj */
 struct UniValueType {
@@ -145,11 +149,19 @@ class CRPCTable
 {
 private:
     std::map<std::string, const CRPCCommand*> mapCommands;
+    std::set<std::string> setReadOnlyCommands;
 public:
     CRPCTable();
     const CRPCCommand* operator[](const std::string& name) const;
     std::string help(const std::string& name) const;
 
+    /**
+     * Read-only methods only query state and take the locks they need themselves,
+     * so the elements of a JSON-RPC batch calling them may be executed concurrently.
+     */
+    bool isReadOnly(const std::string& name) const;
+    void setReadOnly(const std::string& name);
+
     /**
      * Execute a method.
      * @param method   Method to execute
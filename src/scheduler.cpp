@@ -8,6 +8,7 @@
 
 #include <assert.h>
 #include <boost/bind.hpp>
+#include <exception>
 #include <utility>
 
 CScheduler::CScheduler() : nThreadsServicingQueue(0), stopRequested(false), stopWhenEmpty(false)
@@ -27,6 +28,15 @@ static boost::system_time toPosixTime(const boost::chrono::system_clock::time_po
 }
 #endif
 
+CScheduler::TaskQueue::iterator CScheduler::nextRunnable()
+{
+    for (TaskQueue::iterator it = taskQueue.begin(); it != taskQueue.end(); ++it) {
+        if (it->second.strLane.empty() || !setBusyLanes.count(it->second.strLane))
+            return it;
+    }
+    return taskQueue.end();
+}
+
 void CScheduler::serviceQueue()
 {
     boost::unique_lock<boost::mutex> lock(newTaskMutex);
@@ -37,43 +47,71 @@ void CScheduler::serviceQueue()
     // is called.
     while (!shouldStop()) {
         try {
-            while (!shouldStop() && taskQueue.empty()) {
-                // Wait until there is something to do.
-                newTaskScheduled.wait(lock);
-            }
-
-            // Wait until either there is a new task, or until
-            // the time of the first item on the queue:
-
+            // Wait until a task is due whose lane is free. A task finishing in a lane
+            // wakes everybody up, as it may free the task we'd run next.
+            TaskQueue::iterator it = taskQueue.end();
+            while (!shouldStop()) {
+                it = nextRunnable();
+                if (it == taskQueue.end()) {
+                    // Wait until there is something to do.
+                    newTaskScheduled.wait(lock);
+                    continue;
+                }
+                boost::chrono::system_clock::time_point timeToWaitFor = it->first;
+                if (timeToWaitFor <= boost::chrono::system_clock::now())
+                    break;
 // wait_until needs boost 1.50 or later; older versions have timed_wait:
 #if BOOST_VERSION < 105000
-            while (!shouldStop() && !taskQueue.empty() &&
-                   newTaskScheduled.timed_wait(lock, toPosixTime(taskQueue.begin()->first))) {
-                // Keep waiting until timeout
-            }
+                newTaskScheduled.timed_wait(lock, toPosixTime(timeToWaitFor));
 #else
-            // Some boost versions have a conflicting overload of wait_until that returns void.
-            // Explicitly use a template here to avoid hitting that overload.
-            while (!shouldStop() && !taskQueue.empty()) {
-                boost::chrono::system_clock::time_point timeToWaitFor = taskQueue.begin()->first;
-                if (newTaskScheduled.wait_until<>(lock, timeToWaitFor) == boost::cv_status::timeout)
-                    break; // Exit loop after timeout, it means we reached the time of the event
-            }
+                // Some boost versions have a conflicting overload of wait_until that returns void.
+                // Explicitly use a template here to avoid hitting that overload.
+                newTaskScheduled.wait_until<>(lock, timeToWaitFor);
 #endif
+                // Either way look again, the queue may have changed meanwhile
+            }
             // If there are multiple threads, the queue can empty while we're waiting (another
             // thread may service the task we were waiting on).
-            if (shouldStop() || taskQueue.empty())
+            if (shouldStop() || it == taskQueue.end())
                 continue;
 
-            Function f = taskQueue.begin()->second;
-            taskQueue.erase(taskQueue.begin());
+            boost::chrono::system_clock::time_point timeDue = it->first;
+            Task task = it->second;
+            taskQueue.erase(it);
+            if (!task.strLane.empty())
+                setBusyLanes.insert(task.strLane);
 
+            boost::chrono::system_clock::time_point timeStart = boost::chrono::system_clock::now();
+            std::exception_ptr error;
             {
                 // Unlock before calling f, so it can reschedule itself or another task
                 // without deadlocking:
                 reverse_lock<boost::unique_lock<boost::mutex> > rlock(lock);
-                f();
+                try {
+                    task.f();
+                } catch (...) {
+                    error = std::current_exception();
+                }
             }
+
+            if (!task.strLane.empty()) {
+                setBusyLanes.erase(task.strLane);
+                newTaskScheduled.notify_all();
+            }
+            if (!task.strName.empty()) {
+                int64_t nMicros = boost::chrono::duration_cast<boost::chrono::microseconds>(boost::chrono::system_clock::now() - timeStart).count();
+                int64_t nDelayMicros = boost::chrono::duration_cast<boost::chrono::microseconds>(timeStart - timeDue).count();
+                TaskStats& stats = mapTaskStats[task.strName];
+                stats.nRuns++;
+                stats.nTotalMicros += nMicros;
+                stats.nMaxMicros = std::max(stats.nMaxMicros, nMicros);
+                stats.nMaxDelayMicros = std::max(stats.nMaxDelayMicros, nDelayMicros);
+                int64_t nIntervalMicros = stats.nIntervalSeconds * 1000000;
+                if (nIntervalMicros > 0 && (nMicros > nIntervalMicros || nDelayMicros > nIntervalMicros))
+                    stats.nOverruns++;
+            }
+            if (error)
+                std::rethrow_exception(error);
         } catch (...) {
             --nThreadsServicingQueue;
             throw;
@@ -95,29 +133,38 @@ void CScheduler::stop(bool drain)
     newTaskScheduled.notify_all();
 }
 
-void CScheduler::schedule(CScheduler::Function f, boost::chrono::system_clock::time_point t)
+void CScheduler::schedule(CScheduler::Function f, boost::chrono::system_clock::time_point t,
+                          const std::string& strName, const std::string& strLane)
 {
     {
         boost::unique_lock<boost::mutex> lock(newTaskMutex);
-        taskQueue.insert(std::make_pair(t, f));
+        Task task = {f, strName, strLane};
+        taskQueue.insert(std::make_pair(t, task));
     }
     newTaskScheduled.notify_one();
 }
 
-void CScheduler::scheduleFromNow(CScheduler::Function f, int64_t deltaSeconds)
+void CScheduler::scheduleFromNow(CScheduler::Function f, int64_t deltaSeconds,
+                                 const std::string& strName, const std::string& strLane)
 {
-    schedule(f, boost::chrono::system_clock::now() + boost::chrono::seconds(deltaSeconds));
+    schedule(f, boost::chrono::system_clock::now() + boost::chrono::seconds(deltaSeconds), strName, strLane);
 }
 
-static void Repeat(CScheduler* s, CScheduler::Function f, int64_t deltaSeconds)
+static void Repeat(CScheduler* s, CScheduler::Function f, int64_t deltaSeconds,
+                   const std::string& strName, const std::string& strLane)
 {
     f();
-    s->scheduleFromNow(boost::bind(&Repeat, s, f, deltaSeconds), deltaSeconds);
+    s->scheduleFromNow(boost::bind(&Repeat, s, f, deltaSeconds, strName, strLane), deltaSeconds, strName, strLane);
 }
 
-void CScheduler::scheduleEvery(CScheduler::Function f, int64_t deltaSeconds)
+void CScheduler::scheduleEvery(CScheduler::Function f, int64_t deltaSeconds,
+                               const std::string& strName, const std::string& strLane)
 {
-    scheduleFromNow(boost::bind(&Repeat, this, f, deltaSeconds), deltaSeconds);
+    if (!strName.empty()) {
+        boost::unique_lock<boost::mutex> lock(newTaskMutex);
+        mapTaskStats[strName].nIntervalSeconds = deltaSeconds;
+    }
+    scheduleFromNow(boost::bind(&Repeat, this, f, deltaSeconds, strName, strLane), deltaSeconds, strName, strLane);
 }
 
 size_t CScheduler::getQueueInfo(boost::chrono::system_clock::time_point &first,
@@ -131,3 +178,9 @@ size_t CScheduler::getQueueInfo(boost::chrono::system_clock::time_point &first,
     }
     return result;
 }
+
+std::map<std::string, CScheduler::TaskStats> CScheduler::getTaskStats() const
+{
+    boost::unique_lock<boost::mutex> lock(newTaskMutex);
+    return mapTaskStats;
+}
@@ -14,6 +14,8 @@
 #include <boost/chrono/chrono.hpp>
 #include <boost/thread.hpp>
 #include <map>
+#include <set>
+#include <string>
 
 //
 // Simple class for background tasks that should be run
@@ -26,6 +28,12 @@
 // s->scheduleFromNow(boost::bind(Class::func, this, argument), 3);
 // boost::thread* t = new boost::thread(boost::bind(CScheduler::serviceQueue, s));
 //
+// Several threads may service the same queue. Tasks scheduled in the same named lane
+// never run at the same time, so jobs sharing state can be put in one lane instead of
+// taking locks against each other:
+//
+// s->scheduleEvery(doMaintenance, 60, "maintenance", "indexnode");
+//
 // ... then at program shutdown, clean up the thread running serviceQueue:
 // t->interrupt();
 // t->join();
@@ -41,18 +49,37 @@ public:
 
     typedef boost::function<void(void)> Function;
 
-    // Call func at/after time t
-    void schedule(Function f, boost::chrono::system_clock::time_point t);
+    // Runtime statistics of the tasks scheduled under one name
+    struct TaskStats {
+        uint64_t nRuns;
+        int64_t nTotalMicros;
+        int64_t nMaxMicros;
+        // Longest time a run started after it was due
+        int64_t nMaxDelayMicros;
+        // Runs of repeating tasks which took, or started late by, longer than their interval
+        uint64_t nOverruns;
+        // Interval of repeating tasks, 0 otherwise
+        int64_t nIntervalSeconds;
+
+        TaskStats() : nRuns(0), nTotalMicros(0), nMaxMicros(0), nMaxDelayMicros(0), nOverruns(0), nIntervalSeconds(0) {}
+    };
+
+    // Call func at/after time t. Tasks with a name have their runtime recorded,
+    // tasks in the same lane are run one at a time.
+    void schedule(Function f, boost::chrono::system_clock::time_point t,
+                  const std::string& strName = "", const std::string& strLane = "");
 
     // Convenience method: call f once deltaSeconds from now
-    void scheduleFromNow(Function f, int64_t deltaSeconds);
+    void scheduleFromNow(Function f, int64_t deltaSeconds,
+                         const std::string& strName = "", const std::string& strLane = "");
 
     // Another convenience method: call f approximately
     // every deltaSeconds forever, starting deltaSeconds from now.
     // To be more precise: every time f is finished, it
     // is rescheduled to run deltaSeconds later. If you
     // need more accurate scheduling, don't use this method.
-    void scheduleEvery(Function f, int64_t deltaSeconds);
+    void scheduleEvery(Function f, int64_t deltaSeconds,
+                       const std::string& strName = "", const std::string& strLane = "");
 
     // To keep things as simple as possible, there is no unschedule.
 
@@ -70,14 +97,29 @@ public:
     size_t getQueueInfo(boost::chrono::system_clock::time_point &first,
                         boost::chrono::system_clock::time_point &last) const;
 
+    // Returns the statistics of all named tasks run so far
+    std::map<std::string, TaskStats> getTaskStats() const;
+
 private:
-    std::multimap<boost::chrono::system_clock::time_point, Function> taskQueue;
+    struct Task {
+        Function f;
+        std::string strName;
+        std::string strLane;
+    };
+    typedef std::multimap<boost::chrono::system_clock::time_point, Task> TaskQueue;
+
+    TaskQueue taskQueue;
     boost::condition_variable newTaskScheduled;
     mutable boost::mutex newTaskMutex;
     int nThreadsServicingQueue;
     bool stopRequested;
     bool stopWhenEmpty;
+    // Lanes with a task running
+    std::set<std::string> setBusyLanes;
+    std::map<std::string, TaskStats> mapTaskStats;
     bool shouldStop() { return stopRequested || (stopWhenEmpty && taskQueue.empty()); }
+    // First task whose lane is free, taskQueue.end() if there is none
+    TaskQueue::iterator nextRunnable();
 };
 
 #endif
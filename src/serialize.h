@@ -618,6 +618,13 @@ void Serialize(Stream &s, const std::shared_ptr <T> &item, int nType, int nVersi
 template<typename Stream, typename T>
 void Unserialize(Stream &s, std::shared_ptr <T> &item, int nType, int nVersion);
 
+/**
+ * shared_ptr to an immutable object, such as CTransactionRef
+ */
+template<typename T> unsigned int GetSerializeSize(const std::shared_ptr<const T>& p, int nType, int nVersion);
+template<typename Stream, typename T> void Serialize(Stream& os, const std::shared_ptr<const T>& p, int nType, int nVersion);
+template<typename Stream, typename T> void Unserialize(Stream& is, std::shared_ptr<const T>& p, int nType, int nVersion);
+
 
 // Index - MTP
 /**
@@ -1132,6 +1139,30 @@ void Unserialize(Stream &os, std::shared_ptr <T> &item, int nType, int nVersion)
 }
 
 
+/**
+ * shared_ptr to an immutable object
+ */
+template<typename T>
+unsigned int GetSerializeSize(const std::shared_ptr<const T>& p, int nType, int nVersion)
+{
+    return ::GetSerializeSize(*p, nType, nVersion);
+}
+
+template<typename Stream, typename T>
+void Serialize(Stream& os, const std::shared_ptr<const T>& p, int nType, int nVersion)
+{
+    ::Serialize(os, *p, nType, nVersion);
+}
+
+template<typename Stream, typename T>
+void Unserialize(Stream& is, std::shared_ptr<const T>& p, int nType, int nVersion)
+{
+    std::shared_ptr<T> obj = std::make_shared<T>();
+    ::Unserialize(is, *obj, nType, nVersion);
+    p = obj;
+}
+
+
 
 
 
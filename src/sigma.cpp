@@ -138,7 +138,8 @@ bool CheckSigmaBlock(CValidationState &state, const CBlock& block) {
     size_t blockSpendsAmount = 0;
     CAmount blockSpendsValue(0);
 
-    for (const auto& tx : block.vtx) {
+    for (const auto& ptx : block.vtx) {
+        const CTransaction& tx = *ptx;
         // Check zerocoin to sigma remints against the same limit as sigma spends
 
         auto txSpendsValue = tx.IsZerocoinRemint() ? CoinRemintToV3::GetAmount(tx) : GetSpendAmount(tx);
@@ -200,6 +201,22 @@ bool CheckSigmaSpendTransaction(
              return state.DoS(100, error("Sigma is disabled at this period."));
     }
 
+    // Obtain the hash of the transaction sans the zerocoin part. It is the same for
+    // every input, and the spend proofs are left out of the copy instead of being
+    // copied and then cleared.
+    CMutableTransaction txTemp;
+    txTemp.nVersion = tx.nVersion;
+    txTemp.nLockTime = tx.nLockTime;
+    txTemp.vout = tx.vout;
+    txTemp.vin.reserve(tx.vin.size());
+    for (const CTxIn &txin : tx.vin) {
+        if (txin.scriptSig.IsSigmaSpend())
+            txTemp.vin.push_back(CTxIn(txin.prevout, CScript(), txin.nSequence));
+        else
+            txTemp.vin.push_back(txin);
+    }
+    const uint256 txHashForMetadata = txTemp.GetHash();
+
     for (const CTxIn &txin : tx.vin)
     {
         std::unique_ptr<sigma::CoinSpend> spend;
@@ -228,17 +245,6 @@ bool CheckSigmaSpendTransaction(
                              "CTransaction::CheckTransaction() : Error: incorrect spend transaction verion");
         }
 
-        uint256 txHashForMetadata;
-
-        // Obtain the hash of the transaction sans the zerocoin part
-        CMutableTransaction txTemp = tx;
-        BOOST_FOREACH(CTxIn &txTempIn, txTemp.vin) {
-            if (txTempIn.scriptSig.IsSigmaSpend()) {
-                txTempIn.scriptSig.clear();
-            }
-        }
-        txHashForMetadata = txTemp.GetHash();
-
         LogPrintf("CheckSigmaSpendTransaction: tx version=%d, tx metadata hash=%s, serial=%s\n",
                 spend->getVersion(), txHashForMetadata.ToString(),
                 spend->getCoinSerialNumber().tostring());
@@ -265,24 +271,6 @@ bool CheckSigmaSpendTransaction(
             accumulatorBlockHash,
             txHashForMetadata);
 
-        // find index for block with hash of accumulatorBlockHash or set index to the coinGroup.firstBlock if not found
-        while (index != coinGroup.firstBlock && index->GetBlockHash() != accumulatorBlockHash)
-            index = index->pprev;
-
-        // Build a vector with all the public coins with given denomination and accumulator id before
-        // the block on which the spend occured.
-        // This list of public coins is required by function "Verify" of CoinSpend.
-        std::vector<sigma::PublicCoin> anonymity_set;
-        while(true) {
-            BOOST_FOREACH(const sigma::PublicCoin& pubCoinValue,
-                    index->sigmaMintedPubCoins[denominationAndId]) {
-                anonymity_set.push_back(pubCoinValue);
-            }
-            if (index == coinGroup.firstBlock)
-                break;
-            index = index->pprev;
-        }
-
         bool fPadding = spend->getVersion() >= ZEROCOIN_TX_VERSION_3_1;
         if (!isVerifyDB) {
             bool fShouldPad = (nHeight != INT_MAX && nHeight >= params.nSigmaPaddingBlock) ||
@@ -291,7 +279,30 @@ bool CheckSigmaSpendTransaction(
                 return state.DoS(1, error("Incorrect sigma spend transaction version"));
         }
 
-        passVerify = spend->Verify(anonymity_set, newMetaData, fPadding);
+        if (sigmaTxInfo && sigmaTxInfo->fSkipProofVerification) {
+            // The block is assumed valid, only the serial is checked and recorded
+            passVerify = true;
+        } else {
+            // find index for block with hash of accumulatorBlockHash or set index to the coinGroup.firstBlock if not found
+            while (index != coinGroup.firstBlock && index->GetBlockHash() != accumulatorBlockHash)
+                index = index->pprev;
+
+            // Build a vector with all the public coins with given denomination and accumulator id before
+            // the block on which the spend occured.
+            // This list of public coins is required by function "Verify" of CoinSpend.
+            std::vector<sigma::PublicCoin> anonymity_set;
+            while(true) {
+                BOOST_FOREACH(const sigma::PublicCoin& pubCoinValue,
+                        index->sigmaMintedPubCoins[denominationAndId]) {
+                    anonymity_set.push_back(pubCoinValue);
+                }
+                if (index == coinGroup.firstBlock)
+                    break;
+                index = index->pprev;
+            }
+
+            passVerify = spend->Verify(anonymity_set, newMetaData, fPadding);
+        }
         if (passVerify) {
             Scalar serial = spend->getCoinSerialNumber();
             // do not check for duplicates in case we've seen exact copy of this tx in this block before
@@ -503,7 +514,7 @@ bool CheckSigmaTransaction(
 
 void RemoveSigmaSpendsReferencingBlock(CTxMemPool& pool, CBlockIndex* blockIndex) {
     LOCK2(cs_main, pool.cs);
-    std::vector<CTransaction> txn_to_remove;
+    std::vector<CTransactionRef> txn_to_remove;
     for (CTxMemPool::txiter mi = pool.mapTx.begin(); mi != pool.mapTx.end(); ++mi) {
         const CTransaction& tx = mi->GetTx();
         if (tx.IsSigmaSpend()) {
@@ -517,17 +528,17 @@ void RemoveSigmaSpendsReferencingBlock(CTxMemPool& pool, CBlockIndex* blockIndex
                     uint256 accumulatorBlockHash = spend->getAccumulatorBlockHash();
                     if (accumulatorBlockHash == blockIndex->GetBlockHash()) {
                         // Do not remove transaction immediately, that will invalidate iterator mi.
-                        txn_to_remove.push_back(tx);
+                        txn_to_remove.push_back(mi->GetSharedTx());
                         break;
                     }
                 }
             }
         }
     }
-    for (const CTransaction& tx: txn_to_remove) {
+    for (const CTransactionRef& ptx: txn_to_remove) {
         std::list<CTransaction> removed;
         // Remove txn from mempool.
-        pool.removeRecursive(tx, removed);
+        pool.removeRecursive(*ptx, removed);
         LogPrintf("DisconnectTipSigma: removed sigma spend which referenced a removed blockchain tip.");
     }
 }
@@ -634,32 +645,64 @@ bool ConnectBlockSigma(
     return true;
 }
 
-bool GetOutPointFromBlock(COutPoint& outPoint, const GroupElement &pubCoinValue, const CBlock &block){
-    secp_primitives::GroupElement txPubCoinValue;
-    // cycle transaction hashes, looking for this pubcoin.
-    BOOST_FOREACH(CTransaction tx, block.vtx){
-        uint32_t nIndex = 0;
-        for (const CTxOut &txout: tx.vout) {
-            if (txout.scriptPubKey.IsSigmaMint()){
-
-                // If you wonder why +1, go to file wallet.cpp and read the comments in function
-                // CWallet::CreateZerocoinMintModelV3 around "scriptSerializedCoin << OP_ZEROCOINMINTV3";
-                vector<unsigned char> coin_serialised(txout.scriptPubKey.begin() + 1,
-                                                      txout.scriptPubKey.end());
-                txPubCoinValue.deserialize(&coin_serialised[0]);
-                if(pubCoinValue==txPubCoinValue){
-                    outPoint = COutPoint(tx.GetHash(), nIndex);
-                    return true;
-                }
+void GetMintOutPointsFromBlock(std::vector<std::pair<GroupElement, COutPoint>>& outPoints, const CBlock &block) {
+    for (const CTransactionRef& ptx : block.vtx) {
+        const CTransaction& tx = *ptx;
+        for (uint32_t nIndex = 0; nIndex < tx.vout.size(); nIndex++) {
+            const CScript& script = tx.vout[nIndex].scriptPubKey;
+            if (!script.IsSigmaMint())
+                continue;
+            GroupElement pubCoinValue;
+            try {
+                pubCoinValue = ParseSigmaMintScript(script);
+            } catch (std::invalid_argument&) {
+                continue;
             }
-            nIndex++;
+            outPoints.emplace_back(pubCoinValue, COutPoint(tx.GetHash(), nIndex));
+        }
+    }
+}
+
+bool GetOutPointFromBlock(COutPoint& outPoint, const GroupElement &pubCoinValue, const CBlock &block){
+    std::vector<std::pair<GroupElement, COutPoint>> outPoints;
+    GetMintOutPointsFromBlock(outPoints, block);
+    for (const auto& mint : outPoints) {
+        if (mint.first == pubCoinValue) {
+            outPoint = mint.second;
+            return true;
         }
     }
 
     return false;
 }
 
+// Find the outpoint of a mint which is in the state, reading its block only if the outpoint
+// was not recorded when the block was connected (blocks loaded from the index at startup).
+// Every mint of a block read here gets its outpoint recorded, so each block is read at most once.
+static bool LookupMintOutPoint(COutPoint& outPoint, const GroupElement &pubCoinValue, int mintHeight) {
+    AssertLockHeld(cs_main);
+
+    if (sigmaState.GetMintOutPoint(outPoint, pubCoinValue))
+        return true;
+
+    // get block containing mint
+    CBlockIndex *mintBlock = chainActive[mintHeight];
+    CBlock block;
+    if (!mintBlock || !ReadBlockFromDisk(block, mintBlock, ::Params().GetConsensus())) {
+        LogPrintf("can't read block from disk.\n");
+        return false;
+    }
+
+    std::vector<std::pair<GroupElement, COutPoint>> outPoints;
+    GetMintOutPointsFromBlock(outPoints, block);
+    for (const auto& mint : outPoints)
+        sigmaState.AddMintOutPoint(mint.first, mint.second);
+
+    return sigmaState.GetMintOutPoint(outPoint, pubCoinValue);
+}
+
 bool GetOutPoint(COutPoint& outPoint, const sigma::PublicCoin &pubCoin) {
+    AssertLockHeld(cs_main);
 
     sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
     auto mintedCoinHeightAndId = sigmaState->GetMintedCoinHeightAndId(pubCoin);
@@ -669,20 +712,19 @@ bool GetOutPoint(COutPoint& outPoint, const sigma::PublicCoin &pubCoin) {
     if(mintHeight==-1 && coinId==-1)
         return false;
 
-    // get block containing mint
-    CBlockIndex *mintBlock = chainActive[mintHeight];
-    CBlock block;
-    if(!ReadBlockFromDisk(block, mintBlock, ::Params().GetConsensus()))
-        LogPrintf("can't read block from disk.\n");
-
-    return GetOutPointFromBlock(outPoint, pubCoin.getValue(), block);
+    return LookupMintOutPoint(outPoint, pubCoin.getValue(), mintHeight);
 }
 
 bool GetOutPoint(COutPoint& outPoint, const GroupElement &pubCoinValue) {
+    AssertLockHeld(cs_main);
+
     int mintHeight = 0;
     int coinId = 0;
 
     sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
+    if (sigmaState->GetMintOutPoint(outPoint, pubCoinValue))
+        return true;
+
     std::vector<sigma::CoinDenomination> denominations;
     GetAllDenoms(denominations);
     BOOST_FOREACH(sigma::CoinDenomination denomination, denominations){
@@ -697,13 +739,7 @@ bool GetOutPoint(COutPoint& outPoint, const GroupElement &pubCoinValue) {
     if(mintHeight==-1 && coinId==-1)
         return false;
 
-    // get block containing mint
-    CBlockIndex *mintBlock = chainActive[mintHeight];
-    CBlock block;
-    if(!ReadBlockFromDisk(block, mintBlock, ::Params().GetConsensus()))
-        LogPrintf("can't read block from disk.\n");
-
-    return GetOutPointFromBlock(outPoint, pubCoinValue, block);
+    return LookupMintOutPoint(outPoint, pubCoinValue, mintHeight);
 }
 
 bool GetOutPoint(COutPoint& outPoint, const uint256 &pubCoinValueHash) {
@@ -885,6 +921,13 @@ void CSigmaState::AddMintsToStateAndBlockIndex(
             index->sigmaMintedPubCoins[{denomination, mintCoinGroupId}].push_back(mint);
         }
     }
+
+    if (!pblock->sigmaTxInfo->mints.empty()) {
+        std::vector<std::pair<GroupElement, COutPoint>> outPoints;
+        GetMintOutPointsFromBlock(outPoints, *pblock);
+        for (const auto& mint : outPoints)
+            mintOutPoints[mint.first] = mint.second;
+    }
 }
 
 void CSigmaState::AddSpend(const Scalar &serial, CoinDenomination denom, int coinGroupId) {
@@ -959,6 +1002,7 @@ void CSigmaState::RemoveBlock(CBlockIndex *index) {
                 });
             assert(coinIt != coins.second);
             containers.RemoveMint(coinIt->first);
+            mintOutPoints.erase(coin.getValue());
         }
     }
 
@@ -1051,6 +1095,46 @@ int CSigmaState::GetCoinSetForSpend(
     return numberOfCoins;
 }
 
+int CSigmaState::GetCoinGroupSize(
+        sigma::CoinDenomination denomination,
+        int coinGroupID,
+        int maxHeight) const {
+    pair<sigma::CoinDenomination, int> denomAndId = std::make_pair(denomination, coinGroupID);
+
+    auto groupIt = coinGroups.find(denomAndId);
+    if (groupIt == coinGroups.end())
+        return 0;
+
+    // Only the last few blocks of a group can be above maxHeight, so subtract
+    // their mints from the total instead of counting the whole set
+    const SigmaCoinGroupInfo& coinGroup = groupIt->second;
+    int numberOfCoins = coinGroup.nCoins;
+    for (CBlockIndex *block = coinGroup.lastBlock;
+            block->nHeight > maxHeight;
+            block = block->pprev) {
+        auto mintsIt = block->sigmaMintedPubCoins.find(denomAndId);
+        if (mintsIt != block->sigmaMintedPubCoins.end())
+            numberOfCoins -= mintsIt->second.size();
+        if (block == coinGroup.firstBlock)
+            break;
+    }
+    return numberOfCoins;
+}
+
+bool CSigmaState::GetMintOutPoint(COutPoint& outPoint, const GroupElement& pubCoinValue) const {
+    AssertLockHeld(cs_main);
+    auto it = mintOutPoints.find(pubCoinValue);
+    if (it == mintOutPoints.end())
+        return false;
+    outPoint = it->second;
+    return true;
+}
+
+void CSigmaState::AddMintOutPoint(const GroupElement& pubCoinValue, const COutPoint& outPoint) {
+    AssertLockHeld(cs_main);
+    mintOutPoints[pubCoinValue] = outPoint;
+}
+
 std::pair<int, int> CSigmaState::GetMintedCoinHeightAndId(
         const sigma::PublicCoin& pubCoin) {
     auto coinIt = containers.GetMints().find(pubCoin);
@@ -1114,6 +1198,7 @@ void CSigmaState::Reset() {
     latestCoinIds.clear();
     mempoolCoinSerials.clear();
     mempoolMints.clear();
+    mintOutPoints.clear();
     containers.Reset();
 }
 
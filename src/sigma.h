@@ -38,7 +38,10 @@ public:
     // information about transactions in the block is complete
     bool fInfoIsComplete;
 
-    CSigmaTxInfo(): fInfoIsComplete(false) {}
+    // the block is assumed valid: spend proofs are not verified, serials are still checked and recorded
+    bool fSkipProofVerification;
+
+    CSigmaTxInfo(): fInfoIsComplete(false), fSkipProofVerification(false) {}
 
     // finalize everything
     void Complete();
@@ -78,6 +81,8 @@ bool ConnectBlockSigma(
  * Get COutPoint(txHash, index) from the chain using pubcoin value alone.
  */
 bool GetOutPointFromBlock(COutPoint& outPoint, const GroupElement &pubCoinValue, const CBlock &block);
+void GetMintOutPointsFromBlock(std::vector<std::pair<GroupElement, COutPoint>>& outPoints, const CBlock &block);
+// The outpoint lookups read the chain and the sigma state, the caller must hold cs_main
 bool GetOutPoint(COutPoint& outPoint, const sigma::PublicCoin &pubCoin);
 bool GetOutPoint(COutPoint& outPoint, const GroupElement &pubCoinValue);
 bool GetOutPoint(COutPoint& outPoint, const uint256 &pubCoinValueHash);
@@ -152,6 +157,18 @@ public:
         uint256& blockHash_out,
         std::vector<sigma::PublicCoin>& coins_out);
 
+    // Number of coins GetCoinSetForSpend would return, without copying them
+    int GetCoinGroupSize(
+        sigma::CoinDenomination denomination,
+        int id,
+        int maxHeight) const;
+
+    // Outpoint of a mint, if it is known. Mints get one when their block is connected,
+    // mints loaded from the index when their block is first read by GetOutPoint.
+    // Both require cs_main, which guards mintOutPoints like the rest of the state
+    bool GetMintOutPoint(COutPoint& outPoint, const GroupElement& pubCoinValue) const;
+    void AddMintOutPoint(const GroupElement& pubCoinValue, const COutPoint& outPoint);
+
     // Return height of mint transaction and id of minted coin
     std::pair<int, int> GetMintedCoinHeightAndId(const sigma::PublicCoin& pubCoin);
 
@@ -209,6 +226,9 @@ private:
 
     std::unordered_set<GroupElement> mempoolMints;
 
+    // Outpoints of mints in the chain, keyed by pubcoin value. Guarded by cs_main
+    std::unordered_map<GroupElement, COutPoint> mintOutPoints;
+
     std::atomic<bool> surgeCondition;
 
     struct Containers {
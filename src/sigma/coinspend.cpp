@@ -15,8 +15,8 @@ CoinSpend::CoinSpend(
     denomination(coin.getPublicCoin().getDenomination()),
     accumulatorBlockHash(m.blockHash),
     coinSerialNumber(coin.getSerialNumber()),
-    ecdsaSignature(64, 0),
-    ecdsaPubkey(33, 0),
+    ecdsaSignature(ECDSA_SIGNATURE_SIZE, 0),
+    ecdsaPubkey(ECDSA_PUBKEY_SIZE, 0),
     sigmaProof(p->get_n(), p->get_m())
 {
     if (!HasValidSerial()) {
@@ -97,6 +97,28 @@ uint256 CoinSpend::signatureHash(const SpendMetaData& m) const {
     return h.GetHash();
 }
 
+std::size_t CoinSpend::SerializedSize(const Params* p) {
+    const std::size_t scalarSize = Scalar().memoryRequired();
+    const std::size_t groupElementSize = GroupElement().memoryRequired();
+    const std::size_t n = p->get_n();
+    const std::size_t m = p->get_m();
+    const std::size_t fSize = m * (n - 1);
+
+    // Vectors carry a compact size prefix, everything else is fixed width
+    return groupElementSize                                                  // B
+        + 3 * groupElementSize                                               // A, C, D
+        + GetSizeOfCompactSize(fSize) + fSize * scalarSize                   // f
+        + 2 * scalarSize                                                     // ZA, ZC
+        + GetSizeOfCompactSize(m) + m * groupElementSize                     // Gk
+        + scalarSize                                                         // z
+        + scalarSize                                                         // coinSerialNumber
+        + sizeof(uint32_t)                                                   // version
+        + sizeof(int64_t)                                                    // denomination
+        + sizeof(uint256)                                                    // accumulatorBlockHash
+        + GetSizeOfCompactSize(ECDSA_PUBKEY_SIZE) + ECDSA_PUBKEY_SIZE
+        + GetSizeOfCompactSize(ECDSA_SIGNATURE_SIZE) + ECDSA_SIGNATURE_SIZE;
+}
+
 bool CoinSpend::Verify(
         const std::vector<sigma::PublicCoin>& anonymity_set,
         const SpendMetaData& m,
@@ -13,6 +13,9 @@ namespace sigma {
 
 class CoinSpend {
 public:
+    static const std::size_t ECDSA_PUBKEY_SIZE = 33;
+    static const std::size_t ECDSA_SIGNATURE_SIZE = 64;
+
     template<typename Stream>
     CoinSpend(const Params* p,  Stream& strm):
         params(p),
@@ -74,6 +77,10 @@ public:
 
     uint256 signatureHash(const SpendMetaData& m) const;
 
+    // Serialized size of any spend made with the given parameters. Every field has a fixed
+    // size, so fee estimation can use a placeholder of this size instead of building a proof.
+    static std::size_t SerializedSize(const Params* p);
+
 private:
     const Params* params;
     unsigned int version = 0;
@@ -1,698 +1,710 @@
-const char *sigmaRemintBlacklist[] = {
-	"1ac01d9354f66db31804c5844808e0f3898874300cde879bccc207a39e97819503f60128deae11a27f930c63946b352c11a7db1fdc465ca30629e3783afee290899a4175ab645137f87ec68d5317bc805fecab043c7f6518211f2ef55bb1fb9b79f6aa6a52122ff5faa344cc7f5f22a2e0e92cb12ebe38ad5aac41ab466a267",
-	"71e28cae3c3943e52a2d2eac4bc4486c5991b3b929cf18b1fb24e924151f551d9b0fa2ceeb4d18a331f9dad0f299e10650ab7a43017ae3ae89398ced4a9ffba48224ac631c584bae45a9e3df16071dbb3423981402ad6c3d6036b88842534c95c8bc908cbf103a663e8c34a596b8114f6ee457d2a8ee53a1d57065956f2d1ea5",
-	"7adb3ac13e20dc486214bff514cc0b133e8e1b4cd904ad28c276dcb10dc92adee0fb3d05b563312404701f7876d327394adfd8eff7e88de2a1eb50230ed1eee806ebff9ac22d2d62dbf3e2c1d846ddca8a1ef3d867154384655de959772f9574cd77d02785da2fab8c366b71b84d193dd4da9787763bfcff37db5d1e44cc528d",
-	"2c0f7ebd42ed8c13cf8ba7ddf118f34897c264c0d024af68b69a40e716bab7abee6358e8a2c0326212ce727cace42e36b75a65f1130a62cb29747a6327d7ec137aebafa7a7555e232fc0f39fbc6b11127d77975f070af8629388bc97029ff7f64079d4bfda7034ef51e7c6cf3576a1b714e10596b6755f98371d8835db177743",
-	"965011d5a5f75d2d7e9a6023fc05f423dc36580aa8b2c6695b5906bc4ffe6c3e883b2bb87d5632117255577fac6ad0144218a9f997233f27a1e92d8b0d54029a7c8a61f0dfdf5a474df9a072ed11356c1801c1a52ba664856e910acbf5dd4fd3526ac3a32f815ef20af0b2ee3e805d6b8ce5c910b2878550048843d0f5533ca3",
-	"6f0fda7834a98831eed01aa0ffbe88bbeb2c7142f924ed5433ebac10f254e6ff863ee2235c647eef8c628231e9b416333807507f8440e44f66b11f0a621d06e4b59f4a4db61808d0b14444d59aaacadfac69da6517102dafcce545efb6d78720a1e48ec3d59163e5e744b5ccc26eb62038f65e7bbbf6a75d597075fd7e970e6f",
-	"779eafd81e8ff3b74288b6741c9d043feeac8d8c267ea3ff3e03f49c3dca6657aae83d4e631613d4934c8dc0a7e429cc5f4fc0af1c094e7508c58a0056165f2f4df4acaebc165a8d9704382bbf671bf44a2be92e4eabe204a59a6a1b758c6c7259d08c4d44cec733bd1246affbdf8ce5819ddd9e8b7cab45a651c8be21b189d7",
-	"81a4dbd32dfaa4d03e643cc4a9603678c96c6d7e2ded2f973b507dc9506045effac17820cdbcd1b5d9d0f1652807d414f8ed2f7f46e001270949cd3b68e197e62b486653b891114b02ac6abbbb826a68449faba357c36810a57f9b121f8f8d6a9aad8180d1823965e56cb0048b4bf5387cb4522e7b0541f9ab69237178da87c9",
-	"8eefc905c9d358d68edf5ce980775c947ea9c8d84068baf37dbd0e4232ff17bc605e13ad0275d17c463b1a53df43fac11f2e2b75c546f094870ba5b24922c14118b0b695d78adaab10802c620afa14a49ef0f5907339074a3e8eef4b3fbc357fb0ace2628a02473bfe118eff9b6c0acf866deb6a4437ef4e0227ecd9deda115d",
-	"3caa628cafc970249e9281f8bd249ec5b12ce083cc713cd7c94afd7a7a60691383b048e8a05fff57ce6d860a92e1d2572f809caf7c6a3adda372888d0f1688038f71d4e74ad6faccc0fc9feeb6269f48067e5c34294bfbca87407b6108e02a99cd0aeec051a219d010e1e7ac8cde9e0273c848edcc3e737e81f3a02d453d9cd1",
-	"c0d6c8556426f5c429898739126d2e16dbe9c0fe9daa0cb87770cdf1b06b54a4340c973a3177d69cf5d62e17b15f779cf6fdec4bcc925ccc1ab4ee1adaf43efdfcbef3995f4b5a72a32b8f02a19e053c398846a654d94b00bd63583a3340d5167809900b39097e47fac743764aabdc8351583dc5e479c537e6117056d2d7801f",
-	"cee68a8c0b3bfadf532dd97eb5e1c08eab22407f3247e2a0739c561dc2129901d0a89116a7f656707785df5762b836ca46dfc130fd228046d3cd9be17639797244e0159c40aa7d6c8a779f054ce7aae77ffb52a86f4cfcd28c4c82a457edafb0bb1a6b0c111d925da51572f962e13153d480a964f708b50a4ea8f4e81e77261b",
-	"68f73a0aba6da2d04f719801c23099e996756515074e7f1569f913552838bdbedae1c066c322e13895a1a4d09eaf57987af7670591826c8c22ba290f395c0c41c305b88728872971649a989f096783e6624235c4addd1bae0d83304c3ba0bd4fc1db12d9cfe0a1c076b9f08745f2c5ebfbfb6a7360d9607d1fe813f3f06bed3d",
-	"5dcc76c81e5d42d0a877aee3fa03be9fb1405dcf459aa03458bc85219bd4398dafcd33c4467fdc969484ba03f6852642966293c5b753437d27c44a251c739fa28427d11bcdb257e02c31cfe607a5581027917a4c7f0cf0ecace3d301ecbcea4870b0cd9284cbb559c6e08cf9211b72082bf88180131ea0fdbf5d374fb5e66945",
-	"d02b6cb702643c99a0d51a6d76a35e18074abe5b6738bce9ba5fb8a04322c2ee188bedb92aeb0295c2171ad32285ea6bf6c0c1e6a18157277504d688578f33fa9c8c6b4efdd002bdd828aeb02d7e8a6adafd0a66baf1d49d64aac9a77bb70ef8181999a05d54597375f83a54b19e0487b577b5851784e10c42ba543df6ce4445",
-	"38fa989e087ac403ac0b6e7732c111142f01ff32817cd8e74d9370a9d5d9708ba65aaea26966a7a76fc30d323f0bb21f2c1cb484effcc9ec6a0724389e88ffc1e60dfd779b38a8b7ef264df8daa929d93ba378eb6f0716bce0e3973aca6c996159cc4659f5873f8059491928194802158983925d888cb268830474e4d71f6e7f",
-	"51f592df7df430d79bac344c8f86e7aa3ca760b9d62bec11d7e5128220d6eca737d25257aaf337f4268a2112eae6a94929372b989271b968f3be0316894a3df1ccb2b4fd03663162e12c52cd43906e68c9ebac2fab17c208fc7bf5dfaa7b17a6fcb3833797291ca78dbbf7b3e1b33af8827dc6aa012c20b8aba76f9e37155a65",
-	"b45f7c4a4448e5d2097025632142f94abcc77d5346bd17ae53395667f649cf071fbb10d86b664c17eddb6b0fd78cdd262033ae4f44160f959b520ecb38e33396d8b9a9624d4286a2da0c1a024d671aa403fb2eaf0f9b5e448d712cc617c85839d8e1b8b3c9406ebc748330bd0d46a1d49c10424c755e7503bf8e4587e0a91467",
-	"10a349670bd4f5c8d77ffbbbaed7745183cc282ff8b03b8dab3d26dc1ef7229677b7fdccb91df09eaf5dab38b8b111dfb83aeb9af6a1251ebb0ca9201133d391435ba1abf5712ae783d43a6ae2d4faed7bde387c25227638c0af366a62e34f5f48b57672b942af6686933bf199f93642475e35d9db137b88928c289ea547a49b",
-	"85c7c4299d30c50027e4985531e9efed71d85165b357ac3678c89044b4e2396daa4e7bd2daefcd867047c0c22b0acc59e8ed16fbc69a873839c1215f08a79d935e532ed450c00d67044c98fb02144eea96bd9f374ccc2d90cfa0347873a9cf49df9b9d2fd333972ebb4b15be9e5caa2d9e1ab5b38905976342600d729b3201cd",
-	"17ad04fdcc0ae7b061eb5309d7633eb8ead115c87718cc97bd6760dd1e368fabeb3697cd0711a5cc47a70a72cb34f0bc23c4861514efa04f021a0ea3d7e253e9a981a44cb3f625bb7d8fd0127e35b52fd68f5b2f44559a681534214ded0ca990ff964f312736391f1e71f078e8463e612726f95d06bd3b8ca2b2884651f924e5",
-	"c098906355320bc2d91a793b947c2011f6a0893945a1cfce111391a3a11eba89bf9529d641ce6a49ed7daea2412faec7833392f4b237782f003f8663cdee65d85fac82b1319e695b82588f55718909313bdafd0c3395bc0264ff2f28fd96ecf395a0f5e40bf3ff1989fbd34260efff9f3b312243d9769408f5e0fa29e1fcab87",
-	"99ed08fd94b8da8741bd570040bfb88c87cd55385f0f25383944ef6006b770517edeecb2379ec255f93d84479aad45ea1760e463fa41593187028fe8bb403137cdf4336f62b2028dc46e37c59afc5f5962991afe0278b9f018178cab1061cc5a6ddfb724faa8b417e190cdc3d156bc9cefce231c3a862def6f165697c64070b3",
-	"d05fb5fa956f62db07d26ca8c292af58ab50102e85f0f1442331c0d9cb0de055187e2188b97d5652e0cf20186b83e3994dc9efb435e77c2eda1a82023ff2f84e488cf779eaff3a7a9f5c41e3adc3c0cdd6e31c2f83e090dbef184f7c021d4fd0d72df8a3bb2be94ed024be927d74afa39765555d6c3d32cce0237392c90d1421",
-	"bd066d4908099550695bda119574edeaac74a8ed0a2bb66ac3631e0a35f12237db7e5fb154bcaad43b294448885c7c632fc78c4c8545b6932dff07d916de4c57833bea86e5b556480628be94e12ea1c5653f13717ca85028ea0cfc0ce654a51a5658ec1b3a049c59eb6d4cf3364b628b2bc415e749c9b582cac61ec55da85253",
-	"2fabf412e316456c0c946a39a82727f6860422b47d506d3dcdee0d4fa3d1d8a81479ef5763cfc6717d2b7a5397575204bc5b6536ac8cbfcbfa37a48c0d065f8b295e0938e9eee8a2165239a076c0d3d6720ef6141e4059b19e67ccf5a3151e6721a5cc14a4a6659726847a297fa4997fab9f95468bae0ed923af19f993c01f95",
-	"2504213317a2dfcaaad34cae999d51a7d3c9311e05566c296f95549c81761da7cffa7afd0c79f043f32776be45415adf1aa2e96a8f88c7faa4270de9b006dd713ce52805527a4d6cd403fcb7cce784f713d55a4155c2d6c3c456a07db7cbf998d277f3ba8019f2218fa429d62eaea27a57f6b0213d312e9d3b2b58cab857f645",
-	"1af6c99031cc1e27e822dea6b45d87764a960ff745d6397ea868b9fbe36fecb7143d2833452dcff3a8b19881a046142667819d892d4030a979d6b9a964df5ab6eb43301c554d604b6639a4002dd7de7bdf91264a60d2c560a124ffb43a03a2549f53665831c73b33c7e8a3a5650959db50af5e9afa88d9912af22e7eecab5719",
-	"a2b7e78cf66acf4a3bbf6a936031a3587e03a272a127b1f08d391e61ff9538be96c1d8e0d9db6285b6866d86b3ced8db70a6eb533140dc6e90b99f47d3a8f1c5ced79d80d868d2bccfada1fa5da547495ad2fec10763136fb4e28889d5cecf825a59211203f016152d910781c1c40f2ab6086ea5d4c2bf653e55b8b6e7e0b82d",
-	"9175ee5d4910b65d2a8118acbe3042f080dda855902c097904596edfbe85b4aa888252bc983ab8d756412a24525542c03c8492ef1a9c9a8332f317a82103f387466565bee0c1084e04fdde8c0b082100e4c455e60d9f1768365d05358d8148f625e8ba7f021dfa889f06e764492e1cb7300ce2b48337c54092c70e488a6529a9",
-	"dff38295b10f96daa51d065dd66e071bb62fa01ae8dc2a6f9381d687db0f2946505e36da4be4e1aafc8fc3a388bd427244a805b80f75dd176a41c2f7f200fe0f5f4365e7a9250a148dc5f3d00c83dddef7a8ff1b92feef1a2f3589ea1ef811c0d24a107a7c9b5989c243fcf167319293717678efdc21dd840a180a79002b38f",
-	"46162eea62dc1b897012179c6577451415a5e8b3c758fa5f89255c0547e0226c985101358bd4619fb02706069b03c04329966eb2ec26eccf15b0c9033147721b6b2a1cb87298c83920fdc42584a8e6471cfbe48d0e0275fb7241e9862e544512e18ccdb21d18fd4bb81fa93a42f370f9f1bb031c2e9d1c51700bf12fad2aa675",
-	"1a7f6b6b3cb2ffe2ab871b724c06629b91586c71e3efb22cd5b53d5800942cec504c5fb78f93b8000c5d31b3af6f4da7fc7278432e6b3f87caadb62890b6a2c00fe8b8a99d670e06a9d6565a0d26b55e40439def0ee6bd13dbefa7d51d8247b336eb1347ed29bd68a031503478c5a69b845a7c7b58891c35507365e3238b8b11",
-	"c58050d35c808f572c8ee8039db21cfbdabe0da1207ea608c816ecec37607188239531f6a2fccddb1f4aa156d08da5f121f2c1fcac3ff7b2d399c961d94ea1a96b72057a516ae7a6e047e36a0431ba3707c7a1eec48bef9ec1e6bdc7a3b2e94df7785a85de41076dd306712032e6f20633fb12fcc27c49ae56f10ca2970881d9",
-	"4bd86c03bbfe47684d08b91b35102ed56c012d91ce4a69e5ea38c04b30736c74490ace56f851e21b405ebe422b5183f0d3896477e5019197e7d502b5b716d3f35e984831b8016cc5b5b191a34b5deb32a9569797ed0c2cfe8159ceba7f5976759a219bad71213e0de0b8cd841d1d6b863d32a513bce40cbb1458f4da9d401d4d",
-	"7a6319e0a8410670031d3fa5ca94743be5b30ff4ff5de0c34f3ddf45e4ba51f6395cefc7970a436d33138e64704358f4c18a5183956e551b36d46403ceb5315d87931fdb7ebb39587e2ba6f7e1df2a34984c78c0e10304b79059e210149ffbc12e4af51f797b17575eb90c6441a5dcbd55e1587fff5c37bb60a17b67f2d9f93",
-	"4c456095bbac8a757db423c46599e0ea10ee20fbcc2dcef1c5af2a9b0bf2eb52a00d0b2d942db72ee23c32e524af09617c6a1764ee5f6dd9cb09c300775b61ec81438875bcb98f007ab49595d22dc46b5010f8cbebbdaa77fed834dcd5b93c60385e7d6fea5c94cb268653897cd7546ea91b0cfe9ae4958e922d2e6c2f42f61d",
-	"8825bb355af7911f46bdbe88e1258889afc42c336e8da97fc3482db30f912513b4a9d27f82aa3c3ca771750448a7310bfafe274e277f6f911de5e117bc0790602bdf0bb2972c5bb8f076dcf08c2bfa6c27d0eb75df913d5a977d0a2d6481fedd4fafd409e68da1941c28ba4909c80f2ab6b84545309bb102e9d865c71d9e530d",
-	"4310f2d4aaf4a7f98cf1ea2e5df8f25c9d86646af4590ebe7be3c925f78b320852301ecd6a2d8d95edcaa5008ee728974165c60f7da739528dc020d983950ba310ec8ded0b5b134dfcfa77b681bd6e266b891ba963a8ff5d9224442d7c95d35fefc29c41f1cbc38e40d83dadd90a07b3684c0df74453b12b8a046596ea5525cf",
-	"73147ee881ef88654caa0cdb3ce9605e3239790c6a44dac4d180d56469e0bc25c0b8d8bff6c5f2ae18eba2982d6b0413514127b759453512ba55d769c516d995058266d80304c56028d7d11a1545a807b76e98d9dc868f4ae00f918bb84d80fbf5835ec1334cd30abd833e9e44bf326d5f9029f01d92f311c4bf6e8fccbd2b75",
-	"58d786c8c1b23c76dca41fdba4636ebb93a278bc6fa8db8f9fc0f57e17a432f22b60c27f1f8ec800dd65d041cdfa01d065b61ea6d15bc37c3514ed3432103855e590813d3b523f3bad5d1c4c35b8f1d9a3e2737a69d2cc21fb158f0a2a14b1337e909ff10382ac68ed215ddd152c6c0686966e23f52deb3e15127d349d0e451f",
-	"41e9200c4eb1c276019ad6b52ea45649e8e528303585c6c99d9535adf9ed4a51e0855f49abf5927f6f0a3f4b23f355ce51cf49ae2bb18227270a15554eedf7d6d8747cdcaa7044b84d1d00484f269f26cdc5dc02952d76e7225a6af9dc7520724748b5eceb1c5719e1d1500ceb111b9514d10102cc5b0ccbaa51386542745215",
-	"8df4a02d0ad928d4b68369c6d43864efeac509141fd616ab9fdd682bf9d220b7de67340f47a09e3558704c7f07df42d1a3b5e2bb9851169e35bccd49910a2470a0ca5af34666903f0014576b042f8211537c5cf71e6363f7ec3cc6a244d6e281bae44679999e776d3b180c4090a2601ab6316252987dc3a93844c4f89356f599",
-	"101c147666611cdc289e5d324f1d3c03e0b26b957ab5aaf40a02c3f71a27b4bf28ebe33f98e9dbc7c1ca6e28597002beea4b22c2f8b0c6e52ddfe76ca56e413d92fce3d44eb271badde62ab82811f5725658f9242513060e2f1bf8209ebd058e2dfd2af32410486020c6d2fc74ada8cdc3c275d9708e88b5369ae56bf524ed4b",
-	"a919c42e8f3d75b8824f2a89a8c3a4ecfa00f2938159e1ed2db04195e41d245e3a26b7f2620ff9449f0a365cd68ae3b9659f10daa893c5d88e611eec1c29026b88ea3eb5ab6f267ec1a9afb341df9073d38064a930125bbd9c082b75b308a09fbc10513d0eedc1f6b54808d1bd2d1455e3c29efac7573495a9804b25893ac1bd",
-	"82a2eb21bcbecd9f10a050f074c36c4ff1ed05fea929baaa6e3ef999eed19276614203c159f11b02138f88e6720fc9b5545c04b0dbfd5555b1233320a7513daf10dac3af644c0eb3d57b10940b1715a0d1e49d5ee095fded60c0783ecb97b648b54cac8dc8cf59ba50814acc2eae7e8d5f62a5cb0e84ee036527ab4592b6ab83",
-	"5c24cb0c513807b0f5ce04cfe07ec909f81a97d163f0afa4a4b1a6517f1594cffc6e76058f783a9817edbb7daa5ebc2cf9f74d21f988cd6e0cfbbb6579ccc3cffa6303e6dc699f70bfdfb7d99f21658890ac6f49ca3310f7242186e7e56ef93c55fc827832c01f85e5ed3b29cd78fb69015487791fc0c207c96bcebbcdd21ced",
-	"c15348a50a25e9df7abcf5306a3a0a031fb3b894c761382d12a9468bd2aa10d01bc87b64953dcd9256a26afaf8ee99386c9f12298781a620c493c2ee99bdf1056928090202860a204b7e2177761b102c47e8d4b96b0485e5f8705384e8158474a51820911c1723332a53220f86c33b6a205816df23a41e3d494ba530a161a271",
-	"116fa1963ed42e9167898062ac504cdca23007f1400dfce2c7bb161b3e0d9f32a4df6272147ddca2988081ef4f11a16be269d6b1ea777ca6f7ce2c1d4cca3f36704320a0111bd01374f9efa650f5fdbdf6e29daa30a7bea42a2b6e54d624606752f2f1974ff615c6220ddf2f59e097154c8c6ee620ea12fe1f6e7d31eb704ab1",
-	"b25ebf2f644910c7b0b172f3a6eedc3d468459b549471684c1e3423f329aa378e8686501db02bd83e7efe7c751b9ff0149e70d43b18031ad3e9d3a65f7f024b1316fa17d375b6cf7e6eb26e9fd1d35afe0410f09d2a41b86b4260f60be88b30b45b8aeea517c10eb10272c34f6cf234bb11d92de7a24a7167d50c832171a4dc7",
-	"c94d0bc7c4c103ff80e56ee06c7537c9138915c5d8e12d0c389e360e0dd7d66d4ba2dd1f28fb49592288be505320c3be0ccd50d11802372a71769fb6e77117e92b6b8ec9eeaafe608023ac82bbf1e6fa824e97fe77ab96118ada8030b5ddd437f762c0e8b74923a4178937e6b9df470194ba8d3d5ab975b54c2100ad2a46236b",
-	"87895dde5ee964d7af9cc860f412f92b014ca509609e5bfec7d6f293bf48c6f7dd9c38db19987b0bf2e23303c64ff122e0424131ca2247a376dfab189f6335405587695ce3d942f59d34a96dd2135abac3cf1b730999618297671cfd226fece0842b5b1710c31e1697eddafa3727c60d116b4ee34b109b081a5874b830fbc5b7",
-	"3577d909418cd7738e324c3094e922cbef4fc914375825c979c77f3239ef795fab7e1310e2071ada5256808afa8c3b8baae6074ba98f6affad623cc20beaf910ef57a1ce0062c71e74a6f4df0ef9b1cfbab7cddd3b13e08a707543ef0c607be3b4ad4fedb13e54e22b0e8929081d31b913f9be566a94d4dffa367e312e453cd3",
-	"47b7f2ca563178b5750d0cd037b993cb7d68ba8a681859fbda189e90f6f74f7343c5c7c2b0d4a6e0ec0ccee88df0e1a0b1d6d9ea6376dc8d80ef1110cfe5077264a0937dfec7a2b6ea71494d8d48ad7751738a9a9aa1901af41350316c58a80c8710d4dc6e6ba62f8d46dde65ad8f9e74bf6f262feb06765d78fb2bf6b5bb31f",
-	"938b8f243677a616f09205e747aab06bc894b4dc5b3c03d80f4dc45e02df29ec3a4d0374062e4f8bc7d211ea833f4e22716ca5e5d63764657c5f7998305ecb5dadb9a569954740692e1d68722a2266afcf4b1c4071cea6d7eb3d09c52343f3097795658254ef2c63d87037ac349f99bb2a9888f635f4044047cf397a9d859171",
-	"1ea310dc37751bc21daef2da4ff00bf48526ae8e9ce028a7b5892a5b4e7d618abe00b2cf127683a670e53502a4c0f05beadbe455e78d2d81ea3809f4b2a7bd4cd856301e54ae54a9bddadbfcdfe78d3b1373c1e55f55626a76d5f1bdf360df576ab06a0915b88724327f0f7649b4670c8e3c80c0f0b538c0d288cea3f110a5a7",
-	"39138ccfd004fc24cf55406f65c0d4585bbaf1976901c77a65564ccdf44ae9e4a18b9df4318747ffc72b09b0e86f6818bab94a8e7e220fe3fdcc31f819af48d1bed8ad4340742b7869077c0ef5d2e1a3f3bd17e5e7ca87abb7a3992f8e4f3d715ac2c1c098b96b39cfdd04b46fac5a93fcf2778cd25a7c48bf57039e3979c59d",
-	"7671d7a82c8fbf46fb9c19e74f18727dc819828de5d71b2c98e2ee400d87a290d79770b36ca39d8559c8e4a3eb6c3e2993c1634a80f6566fe285b3cb5a740d78efe0f06d57774a2d4cfa3295bc650cbe37ecc9dd79cf822013f3cb94052607e0ac72809b5cd80677ccb97e382e59b83cf826908085190a414281bafa6797111",
-	"4c99b9568968abde5b9b21571189e7ed4fdd1471508636b30990cf77c74e5743c05691ce367fa0e182ca7aa4e1a1f92d6c6938234fedf5a05b45171847da99d9daef7c578ece96df1cb833727cee127d4eb23d1912a2ed7736e55e7b56c2716b8ccf5c0062155647f857f802dd8ef19b425019afe4c47adf6a0d14fa2fa31d87",
-	"5a3a9ba68fb9bae902c8e54931aa7029672dcf3a182f6ca3847cd40c7f7b42de0908909f0673dcbc2785cc7bab55c8589c3c9290f70ec6d70dad1e3f48ad3a7e8d0ee2927642dc70951edaa225fda4b92625c0ef79c75064e4a731c9c4c05372c05a709b118169a3ea5c88f92a640a590e8ed506d3a9d4a801ffab2c8c8ecf6f",
-	"ab3b689332b91231de926c234f44c5c5ef0279ac206b9b8a804a9e62f4f1ad23431e45278c5713e6942dc604b924bb7b15beb1da1cbc74a7912a1e9720f72d5bf4e231f263add8c1ef2c70c320ac51122317d4246c61c7ab44be6580d6c59afbbba1cbb72601977a8834e5dc6782ccea57878e02c06f41e84342bf26e2f902f7",
-	"1ca4e68753a9847e7f2c90f4482ef364874a431aa8ea35c3d50f0d66ea5a9bb2fa00ad00d041118e9b184794452e0da89c156e14dbf856196e8e9876362cd2f60f3af6eaa3827ffed9d66ffe516a469617e48e7ebc3df60915993658d1d1b7ffd7a73dea4b3300292a584e22797f2f08c6e09c5ec3e749a131f1f262a599611",
-	"44e55b4e6a04f485b2c4297fc89923d81364cefdd3f277a321a65397fba5958a903e1f5b9a2f421ae6a24d42cbbbeab9a3d4855b36e1d82dad11b043b80e6d564e56ea9f9f47a09ee13c99ccda2d474b756bada69d7f8d7fc4bea9781f0ee94e92a1a564b66499dfb3c758415c0c0b2ff78e3359ee589b51b8cd8275eeaed30d",
-	"ac1efc71cb3ec9580109499d0d6b07c3530bd5a1ecb05aa594bf4c3e6fb3f637668bb20c59375fb211641daba3c5abb5b98e0cebcc466b8d78bf89a5ae44256cfe65b90b7688a7f38d0326e7e3ac0b0341ffbb5cdb29a21f2d42ccee8799946ccd0cc786204f1257c2b42f4c25b41ce3eee1f5790c4706ba5aa147756c7dc1d3",
-	"e9176c8bc44f54c16cc59d012415c57815b469d69dc1a396300f68cb0abe0d445fda5bada08cde41c50ae4c783e5246cc41860c5ea24f9c7f8c884747554ec4ac417b7c676c0c73d17b8c25ba2e654bc32410842c9790f20f8b29aec3e2298c4267ef7aca587143dea0e1b0ed9b9196b8dad7d9d27d7a489a640155d3831d3f",
-	"58728e220b921081677d21298e0850e2aa31c055b2924776d7a48bcf76c2e327e33f96b0b6ffc84aadca1e86827d4619c6c6acdbd857d4475ff357bfa867ba808eb6be599f608e9ab56bb88a2c522ccf997baf3fc5da2a922e099051c3f6659fc1001a7334a81361c10f33db61aab91d3291e59c96468f5a0ebe55a21fcb98a3",
-	"43248d29e2c0aad30d14b7819b0e1360d1a23e21eeddce948ec7b3dbdcbf14126d1423d2e226c46dde96da5ff206e547b6de4ea9e7e4667637fa3fd142acdcf5f1029f0c4399eb5ff2bbc7340816817798fb16bd10f3d2282d6144b2c8825f639cfa33e22caa774804e4aa04f065a219fc041b2bb9b912da3a49256d863cb4f",
-	"2a62c9520f692eafe17ebea6eccbc757279405691c06b6f6b5419711d43dacea8964617ef5a90da9bdbb2ae714f5c60a8fa37ebb7b8ea239ecae20f716524fba263abe323081178a05bed18c0599647363f824794af92c4891cd90c1abf5e448f80159aa2cfd458ecdd5567a30d0ba844723e8bab2968863e82f08e43745d26b",
-	"38907d72bc2208928fb57ce244e53d35175f1c9fdbd11402c0c0339720dc9268c2d4a1ccee8c1696562630aeee90890267d90e9b88fa48e8ec3711b096facc67378942ae37fd74cf26a8d6e84cc4fb35944a33d1ed29c35ab9bb78c202d92944b5ab54cf873f358818476236be7ac47bbaf0574baf547d1790125371db58f091",
-	"7da072a45811441eccd2a42ae9bc3abe4d1dcbbbc8e2fedb70007cda5d2d448f267180ed2267fbb5cd629e5ce91d079b79889bd641aa6e7483ee9c5f7b92b89250386f42d33dfce14ebc97074eac9b4bc8966f259c41280dd60767c24fed0a1e3751e7bdab05642767e7a90b80a55cd1f0896cc6e97497de7765d46f79afe8dd",
-	"1d9df12589638f2b4e0688905e399dec8131c29effd29e091e700e78d883c3239a2a537823b2932dd21027c083c699fbe1bea3de412e6771c8bb2ff79418dcf4b3677f741a25794aa67247fc8bd41365fa6ef892b1c0bcb87e30234f7813d87161aa34f6b20f1b9b6a12ee2fce9d782862de3e949e676bef73d83e575ccef6e1",
-	"18b8716a3ea43b02279d9d63c5a29bc542f1f24b5f6900dd0a58d4db091791d979258e448a00ba839e6241e39c524a47b75d37a7f519b2cc16b06ece9229b21eb969b77334e7ad7d96f24d0dcad0d33a5f93c071848b015f148ea309ce48fc9c014d82bf20c2f671d7f3aec1aedfe18d25e69d476c45c8f4a4fd02e25b2c7147",
-	"bb04e95e8f44a2f21a7e807e7e256a4cda37b65963415e334e5a17122b14b28dc107db23d7d80a591ddd8202c06f81cb767627baf1980d5f308e842e116a4648b00e0a07bc28d38ac83fbb9f4a50ea514ba9bc389301be89f131b52fb34ba3650835e68ccb9b46a0dd3cdad37ccc11229aff7226b44533f4caf6fb6b848d464d",
-	"8dafcf01130a122b142b2b57df9ada5269d4629b86143787d7855e37e67c4c035907b3f1897927d73152dde50ae1a79a49e975f8e32e5990971db286256f3e088ccce857819eb8ca7b8369f75558894bc5864af4a9c5898cef6100b96f808fb53e43faa3397e605984cc597737a8764e6d8a97b37e8587d65a91512f9d6aa37f",
-	"5cf49311035a8c8f63209c3725d63f54182418f3220c82ecf4ba8249871727b11d544b3ef60ba4546202b2454c1942514ecb3a93762f7d11ea42200d3e9f721bd62f5626c76e8feec6f4571ed80c4f0868aaddb6e4840dd45896526fd10043f68960e1103322bf36eaa301df360a91b5795c897a75fad8dcc859542b19fed94b",
-	"8bb5830d4061624147d64bf7185d5d1a3a49b494c8ac8d7d82a2cbb6824f9ac327aafe12204c71d0354d2417e245488fdc3380050bebba6c6c434de3a997fdac0f2401f3ed3afadef00087e969d4234a2ec6c78e90358d6c3a403df5d1b9aec9846822d3ed0c61d88cc22ae0c153e09c41b46ddfe0d822381bcac0f6d167c0a7",
-	"9176d00352cede3cac1b9d3f1ae2aa5bd386f3373115a8ad02b76675ddebe1884b9c93da2cb139edf11a423847878dfc820ec068ef9e78a945f806ea0e7fc810b75a0203987c3ac1400b3ebba3031ec7ebc548107aed3fd656b36b377910bcec1456b4614ef1e580c472fa2cc7871de95dd10642118dd1d34bf3104b743379f5",
-	"ae340208fc9704542920e73851116829d0493057e7ef7c1a64d1b86d6caa3cc3215e16a1d8797fd3d9f9bc9802d668e07d2b8f68b4ff2dab0b01ef3ada410fdc77dfa1a341191eef94525843f2a0290ba2ba71ba13c803aa241c4f5a241889461a14dac292bb8c9543537abcc5b6ef505ec98016ac9e79446ef25e2c4ca4bd49",
-	"3f182b07a1cb0d41493f6296ca9ab176af82e52295c79793996574c642bc1c9242108ed5d671a235d80c7b23f06b0f8383de67ef5e5295328f1d198549f9e6788f2831a98e20a6991dfaf626ca18ffed5f8939cae6507a31edfa5bbe6b2451647e0c6083232cd76f2e1627d0282962952843fa076d37841b0877ccb67853fe17",
-	"a71641551886e76ffaefc9263b65ad67fbc0bead0abec8732346ccea8c0ae129bf7782a6f24b7e4c1ce66c71a9ab99b703b4404af4c237f4ae011a8874e4b760d51c5b2fc610f65527a6dd4f1f1c45e0f1fa2963f49def1b91165eba0ed5c5d0083713177b645ead4a359144de3d876ad1a4318b9a5a323adcf97653d4ada7db",
-	"7d568047ca6f1b7db8c7e1619c88deac49ff6b11c3ee3306360b0405b2eab372efbda044fb052816b9bce2bc5fe2f87d736d28310f29944b0ceec2aa5678bb3fecea655421d248c15a30a09f82e7660c16b75a7d72401e97f6b7d837ff66e0abfb8ac031aab9332c5f689e72e622a533651c171501c6f8076516abc41eba452d",
-	"3e63ce1a1ef2ea8d242279fdefcd20c3d6b7e0bbd34f12256b526fc435d61ce240a7acb6d9be83ae4cb78379d7f1d0eca9f03344fa69197620c1f0eecc897261f57f715ff78940fccd41074134f801c2ed9f3f99331092a0ba42d339c7ab665926533891f159ad809fa533836f0d732888dc5be0b05073fa4ccaebf549bc9107",
-	"3effe62302923097b78e913abcb7e04461a8b744084a1f8b5855b85344cedba2cbddeb0e047201978e9043233ed1a552ef3de6fcade1e4dfeb0670c7ff717fcf1142485484fc1032a6fcaf0aceeb21df378bf53511da9f1548ddbc57c4dafd4a42b384fb29c54da3c9fb4eca8edc751334b782eaacaf4f173f1ecee36ea2afed",
-	"3b0daa121631d2cb108732d2e93910d0d4c45117c1fdca891d8de739f1b2bc446463ed8c256a8dd320edf0531b9cc296ca643ec3eaa5e2f0ab2a4c2dd089441c8cbf2734e6fd0015550e1c26b483a415b4c5c5a5255f39739142c84e9ebb890516d71effecbe85ef7d69fde27fffd367b27c9c6037a9a07df900805adedf5873",
-	"a079b9b453b45d6c7ecfa6efb28f0ad0cfc8d02cc150dbc5e425aac8d4c97fa1276a2eaf88e30e85ae5f70980b68d36d462bfc45912b86397eb7e512427d82e88b7aab9a630036765278b06ced1491d9efb4f2a6b4fd20127ebb89c7bbf69ea46471ec9150ed1c30d4f052c93b681e620c2c0d8894e2934878938b16fd4fcc5d",
-	"af89f56d0333e89d6ffa598bf6fa7880d09dd06788d127bf415dcf7e21bd85970065fca281a9571a2b7906e40b1b1272db5d4855485c4bdc1c9a72c14f1b8316c295d9ab6174bb2374130d5f5b86e986b895d0aced1036dc5e0cfca8fa238215985157d6a5a74d7c03f69696c2bd442d731cdda87f02af4f5df88806922fe5a1",
-	"942cbc63b098f434ee353a7f45f1d3d83205845db2fd337d12f39cbe306395ac0aee514aa43aac1cb14177d9bfaa7dac095657cfee78003556baf15c82ce0a59825331f9be926d8260de9d16fd982394d36528217c4eca46011820b6a14bc0ffd386f8c8927c38b28755c00788223823f837d5df88d6febe79332d419002c615",
-	"1018157885b4c4e8720bd13803096d477bf1c48bbf38ecc36edd7d7d05dab19709159ae65d54e4a90f0f0e3907a324528b533025dd2ed21273f0bf5a48efa64427cb80d284b62c4d4cd535e28f739fc1d65abf9adc1c21e2b51e8bbbca9cb8fbe219d6aa1979fc07d499e1bae98cfd2e8300c971d0ca7aa3c505998f28172e77",
-	"7816a7141c16c2705f15b9dd44863a19252ece14f46bd5d67938196f48d8ec695f0ce5f46259acc309dbe2c526cc23630a31c7af4378eafa0cbf84ca4f3a4ab4a5c197bce74443cbf910d7072514d765abce9890d7efa1fccdb24fff0d3bbaaafca27837e0390471aea70a7cf2f810cabae1cb956d007f1ba9383eee29350b67",
-	"6586199f334dd4675a26e29d979edfcbc31a0a9e1eaa3c591bc322449a9fde23bf1ba10efdfe42781d43ce61ecb3dde35626fc785f9c3c4afe50ae531e642be7e6eca5fb6d8a66161b4c1e57089b2d79a2adc7323405496e2c2507051671f11e6955815d20d47dc224eed16d9a137f22c64a440017aa21d50cec04af0d2485a1",
-	"9969f28b2f67ee5f8e95d6894eaf1c43af493ea462200e5449db36f32953961d15bc8e26923a4a7e05d6a0ddaf1322de5bafbb16d8d441dc53246988042a1a135df880fb2c1f09d764487572cafb3bfc5f3c109b849f6b4d4464abea02ce70b14e2433f03cf36eda5797f40364158eb478c9dc54434abb61d927a7367ab1e96f",
-	"641c0caa9740127058e460be3b2e1487b77ce3411b5f40960b8f7a36a7b0b37b0356a4c3e9db481d0bba23d9aab1769a6c63fda137b26e695105fdf88f5f3ce7220d257654cfe6e1a2be4fe25ecea168d1858bb80fc4ff67d04bdf6712f7f740b70e6a1dc4baee0f9870cd9a9c7a8c8e39727c48ef9804578b728df1d10d1c75",
-	"34c5aaa13fdda44dca4dbb77429bf49eab5cdb97ec330e0ea3d20bdd8e1b4a03af2ff5cc6d62d978224b64e3748b3a4052c7dcfff8c8644845e726fd9d39bd28a20c118e650e4a5f4db46b7631b18ed614e2324968b29ba39a918271a838bc01332f5b734cb37e4fc850dda4972bb970a2bacc95237b54819e3bf0fb4aa9c6bb",
-	"b26b40f2551b1b8e67eb20cc1fed117bd008f008cf85ef2cd9db49708e94c5d2a24a94dc20d4848b643a4439e6cbfc212558702784e154c64b5dbeb3cb2cff60048effe93818d98b7c5651d56c7764ca2c8b2d9893fa32b15e738e33918fde54dadc71e0cbdfbd81176a938183f269cff14b7a2ae1f3dcf35b98c6af3b884e41",
-	"5fefcb1367241969ce5e539c68d097769c828bfeccfdf09a2517d70d273821ecd9a524a7e8956c0925d52184a0b898495133f5f636edd2a45fceafdfca4f4b47318baf5a5f5f91f3a6679449271f8371cf564d164e99530b8a4b4864c72fdb07ae3449f7708f3dd48475aa16345e70631e05a1d92e5d1f2bd2fb50927b19aaf3",
-	"205553dd4f563db18d086740685c0c4bb5cab13846a2b6cefe65a9b08a30d099ac93789a832a310834957cc0baf7a4c52ac1de906421feb87d290888d9ebb976b62f0d6e7ad0218f4461787e8247d79ad98691719f31ae393a2766fd63cd73fe98a344401377f8ea52c02a15e41b5a0397ca8cd074b962beb9ee683af67ddba7",
-	"325eaba6c20e3e5442eeec98c7f7bc387e58e6ea506ffe85cc1ff37ad5636bfbe3e372cd1e0da1dbc659d6ec61b7514836b4265e7d12ef66bb504fb9957bb81d4ec84ca4fa706c05de8a7f3680b7fa03e56d4225354ec3706ab87a7499b39ec6d5dca82520838182659e14b0322114160d0d1e8e7465fd0b2f3a89408be7a7df",
-	"320d898892469a5f31f89382fb612ab56d3a9d02d5942fd0dd8220b78adf5f80ab0a591de42e69459b8eff19878490194eb5ad5aced1bc65edbfb81e915333ed57097f08fc12bc8ea6dcc4e927f39ebb071cc88f6cea2e1b7b267be71db2d5c968ee1c396c04492cda206ad82c7cc1d530cfd3727090bb31b80bf743092cdadd",
-	"91539b3c1e33a7585affffd05f5eea05137b6be29198392ff2a9d016515396b44834e3827d9276f7fc313f628be9ad34bd5f479bb856596794a780df2c3e2c1c6c3f90e453b6a10638f877ab748ffdaaccf555625b897120449a72b3c1406deef477ecd87f368fd503c341a23da0c4ae2a5a148f0b2edf68c479d1f6613d4df9",
-	"56b84189a79e49a7f4b1b41fc5a54de68a84c024765e9d51e33d6ddc55dae77344fa98e22de7cac5e62b790a28c318569533d0b0e1fe0203494128ef401f6676be9119e848017fa8308072b3877351e783b96c36293445d56164129c9689dc82e6257e49c8ac4baf8dd68a24d547298cb70fb960e1b48d4714d3d60b6dfa56a5",
-	"5cdba1e248684eaf9a58227206e85c4ba0b8520dc915e44feea48f7ed154ffcf855e44e85d752799dc89819e8a8900a6754c4e99f0c1a4779cbe178409eafed67a3bcea9960ff465c767ce114faa2f9c8d57daaa8c1f5d3e9f43f68b27a90a643e6260479d8c8d1e2cf3016e8ec38ef7510da955c7a2a7f5c2029474b6bdcaeb",
-	"bdbed1107e53fc5ce558e7bfceeb4cf7407a9dd7e4f5b98e3bfd059e9cc575d6e33420bc4e8fe09374d85ecf59fff992078df85012f5f0eac4e91674e5b46d3975eb97d3865ba0fdaeda59b77595f8618f271eddbcb4e200db89c552085fa357c2bfa5d61d2e0c784699d6d0d38213f802f02a2b8a78c886ba9cbbf67591db39",
-	"5b0a8392acf7dc73067b403b1db09f3524d188b56626aed9ae14f3357fde7e4702726f223e99dc246ce8fc262d2605d9dc1cce7365ca2002941cdf1333ce48a775029ba8a329de7360d569e0b093535391f51e8adc455b8293d12cf729d2444978258c620c6bd7b216180baaa10f99b43f38a1baf3f7b5e67912a1e0a1fdbf9",
-	"897e4df4c51795dc7cbe9492d8535cc536fd9a9d8eaf0b583cfd7c7c2a6d8c84533d9340835ac092895860557cdcaa926e4ac087eba194273095fd5784fa421b389eb5f81a7695f1961217b22807a28815d460cee3df56082470beb5ab7df38172aac302d4dee7bd27c30df9bccf5ff093bc01ad423fdb63e826c9e18b89355f",
-	"2eaaddfa78f2ef73bb95cd6120a23637bb671ae3dadff5fabac3f096635103b981ea946632854b9da132cda6646bcdabedd1b7674f66eb9465500d4267dd67c5d6b259eec9618601cc08ad5b531ef8422de36d60b72df7e5589131ee86e76023d21c55617722baa228480bbb59a0d99960275421f6e093e863379dfbe504248f",
-	"1c54414f7be6aa08bb2f437ff8822fec2e22e6315c0e27530fe1d2f63142072b2f165b2d6b24f3d111bf57394caa2e39105c3247296b22c3561760c4e23f2656e6351bb860476a115411072ec918c41c8342a87c81614a421af999b6dde81bfc11517d2fc2464a5738bf1c1f8181ab126af617acf56cac3eb8669978b48dd3e3",
-	"9c29d1a5bbed690dd9edccdd91d2cf837eb2bfeb5668c0ff8ff49ce57b4444d27a2c5b2237f1a63799aed5f88581a1913c352e346f211946a7a876f43e01a66333b94022f28c49710663a7cfcb04d281f6c55acf41a2f259c5d9d04ca5cce2c3177670b8e67be3801d35b2f498d1159e0105acee031159cb074c4d3f702b48db",
-	"8f27df85f5c59aba91d2116712358f3be79e600d40e89784bf2e9700aed90322421e7962bb3bfc988e50e6fd044af3802d6734c30f271495b40de290928c65242616575e225ad38e5cad5cdc808df80cc164245fd5b053f45380415c23c8e0360f7cd9921c6b643f62f2b92d923b83294a3206829ec62c93983af1e260ffadc3",
-	"bf5dd115af76185cec1d463539402bbd4819b2080c51864a196b013ac723a018ceeb2ae5351275910b42cc77adb92300051acda183aa9838e3c161adbc7e00cdc533d83667b3c6ef873551c5dcbfa9e35fe2b1c93ecbffa74219b0881fbb97c0c7c4d5a4243b690697629c142922865bc47a10189f6591e3d95b5cc48d1f1e2f",
-	"9a827b42d6362dacdcd180ea7e24293d6ea38e14423402916193778a48fe24826a5a000a23fb768277ce6b6c0ccd5de588d33d545631caef92db5a32f9aa8dc0d8c2afc74e035e9f847d7099e98fb7c55ff26cfff6e5b6d922f568d56dbae8f44c175ffddf46af6ea08faca46e610476c25258bca25739ae8203025709a3eaf7",
-	"c24e0bb82a8c24151f1c43702195226e779b773d4897ea80a24d20b024265e3b9b2ca92e465c6ab3113ea13b627ea233cfa5d73f4964415eab5644f27def059fa7a53920c0ceae6cce2233aaa85a14f04b376a2da88c55e8becd6301d6ba899d2c241b8725ece40c991617deb07d5fc7f4f591769f71bb51a8259ce511c055a1",
-	"a879edb6fd73d3ef00282f7499e19850290a22ed00e7d8d9ffb3c307b3e3e19ffa9ab730750605991101ed49404d8887527b935c65b1d60d0d7a693b988b2d280ae7755938cb38f6e19e605ce5d98237286143242411c80cc17b18a08ff70130ac99d3c29c61ce8036b698efcb46b8028d34554aa2dd3deeee205fc9b2feed55",
-	"128fcb914188ab4251e2558d3863dcfe03c61d55659bb6b3979feb9a2236b677793e91bff618d8d6d45ff1b594927c16506733aa4cc6d0b5ac28070db4d77eacc6f820c4f317694c44b0f4e065a983c862bd35903a4c5034df176eae75607760f94cfc98079fdafdf6732219b54cb4eb457f4d10aabcd49657132871661502e3",
-	"36ae6dc82de05efd56dd0508fbe2b6bfed502c80087c26ff25921b5a785308dce1a6464e7b837b2eb7602c2c9e1a2c47e37f19dc546411438bd508afd749120d1988facc58b66a77a8e1ac3b7580cc64974388e796c0915669fa4da40006f3209b02d66c5dc092e3f080a6843496267cf84123e526c6defb4aa0b9a27768fe89",
-	"b0e7bd3edd7031c52714044565b048dcb3d36de79c1520b750891d0a9d35606577a017330f1ffd8391e4d7b15f6b27142ef8512d6176cfe606b8131ad53bbca8c25ac4c9b050071ebbf229a10926b7ceff3337128e5bb2cd4bc9d837dcd9e3bd862d84a381fbaecb89d02e22f13a7ddefeccbe9d0e7329bdf0903aea6639d357",
-	"caa31ae4db6dc09672350bd2b99fb02711a414bb86771b373a6c2db2fd780415400b8fcea247f85e3de241645d48f5d7015c6d569919751b475e4de621f00060c1121db58abc3fe5297135a0081eda8ea5a144d1e5dfd09130243e0843e421f2e84f78c98ca69c1fc24e9f126ac2185d54823c17a1e4f651e5f0679a6ae677d",
-	"ae03ef7503ef1166cff7b5795357ee8722ef1f39bc3f8302ccb92d7c2518f28659b9c7758da39309a489e8bd7a2d55b8f5eff34a08d2cf1ad19d990924a921d3013105ebb9ec655c501faf6fcf8c7cf5eb232c8da1b940a01a2c93258ef076c8ebc336ed1c2c5c69e0386627c278fc1f1362de0b8e9c161fa40f4b984e846967",
-	"d01b199e9f81e404102bff37960536123f733319f5dc23e2befe73ee5e9b53176eaaa92830082ffbc5d42cf6cacc6c6135444222ba8fc50b001090908cf488edb5992da1d0a67730bd477611b588c2a2dc55fe5f5dfd1eb0d981a883e4c606250bd3c626c95c1f431dadfa6fc10784145404810857c000bd3b46b8234ecbb479",
-	"569e1801b2867553b89cf62dd032348a369927223948d8563503a4696ffaf41916fda507ae0dd356f9ffcedfc65c2defa81de3037a9ff4434da976242279e3114a24e849c546a4c53a0a297096e6a03d2e6d91385558b7ebce82e6c6f1c3967263bb776b6519d28b1318fbea561d98e921afbafebbc347a2a4bd067cd284ff6b",
-	"5958b0c3f0e681b744ac239bc264f59f45623c82a702a19b1e54e4eb67125c9f2f1f759fa821ad8234606a489cb7c70c3deec5621d6593d2458357887be5c3f3fb0213704aaad02a6dbf6718fa9d9e91a4e1df11e01ed14380f7a3f3d4b52e5baf5f85055f3ab0cf4b56cd44393fd8de296117fb23e5012f135c925308e41acd",
-	"74f98505f31f8b9c39687df0a1f068abfb14411ade6de2954ad399c2cb6a19a8c168d8336399ef51d49cec93574f7afe9d9c08d2f42ae22ea1d2e50e55d7e1861aacdc431fefed7c93a8650d675ae50f0424c79d3cc94a6f991550d33536b15c079062cdb34f8f70e1f5f5a927556853c9cf4017117134bb2c1273258e97a923",
-	"488d97bda252581655b341b3f29f1f5548d23399120e7244e3504c85f3c1076ea4f2514371fe1ec75cdfe52a2d52e1226f98c49a56e7fa99c81e92b0c750ab773826c3f3ceb6881b21bf773d7899f0bb8b35e0d8823ed2a314dd622bc6f4be1160eb0473b550b9ca9f0035caaa2948b59264da91083596208e3fb307461cd51f",
-	"8395db980cc4ec6e3a70049471e00ecf157029f828c08562ef1161cb83d6814c7022030477beacb19b6b6c4e538ce74a4198d77ff7c3c3739420c0af0ccd6c5efc87521774e5bae3f2df7b3430191b54811fe58dab8a462d79c5da4cf681b8244f32a7f747ed6fe00d17c1d4281d58e38db2d69b08fbd965aaf6bd288dddcfad",
-	"9c0cc4fced23c673bdd4b55408d84cc034944c4c5bc27525a461891ea60b2b856828b558a75b4875cdd84704a47597cd286991809e25ef55859aebd32cfefb3800db7cdde52977f3e76d0f1dbecf244e77d0e2094cdf93a49b1482b86ba40e7baa471ba7f88a4d9966b20f5ba817e293014eefff7ea97af73a98adb3460abfb",
-	"a661a373ffa257844f8ed35da31f8f497310daed5761e7d5b12ced28604bd6215b44ee2255e17208b160c41e705a674d17a5c4e357117b095e60e5a05586bc0dfac532fd12918dd069050782e82a55ae082e7886fc71df32d986c7dd4e403fa62611ac2bc9a1b3124c64aa5479c413996f49572325a0d4b952faf9c6e9a758e5",
-	"2694d28411f472cb0e83bde78ed2e3217ca6b5e8873405bddcc579400cf9d3f50827330c50688fe8af9002d955383ff1e6f5e2b8a8568a12da52afe1796f37f4f9ddb69ccccb53e70ddbf862818470c69fec283b130a84c5a94a40ecef2feaa3677f65ec4a9eeea9ca854cc2f76dd5056891ac86f7e3d6d786b9b97b4f5d833d",
-	"b912a43341b3e50f8c596f6256bd709b4fd90a364abaeeaf9a52b77561e083b06e64739dd4948ae53aea2099d7f32262136743e01b83820755b00a6fcc8ff95129ccb1284a4940f73f991abc914cb8732634d295b8fffa095c2c2126467d0d3d333097c5b30998b23af725cb49e5daf097fdabad33d3e59ab87ce64d19574945",
-	"622f770aa067cfda142fcf3a0feee48bba7f286e420499319987961281807bec85b50491cb55497f018a0a38d7a10dc268013d2eb058992a4ec349cf6be43e4aafacf58f6e8277ef02f2bd42a669fcdc5abb0d505563ae347a7e3066540ce177465bef9e211dfcf04fa3c77588bfa6f57f746cbbc3e5a9caaf09b0bfc71a783",
-	"8b691806f55f22cffb318d86fba6c0c886725453c76aad6faaba6a1d224b847426cbd0a5d72c9223fedbcdbc6faa1be206dd40ca1b896794d3edddc24844afef02ffd08b93f033ac5761c197a55f8390ec19c554bc906997feec06c60c19ba059fa47ba17d47474d0c7ebd1c6bfc3977f5b0a293a5605b0b3982cbd7b1563b6b",
-	"142d3551637b8a61ccaf794e498b0f77bcf1564084ab3ca54262f5a3a59a5d57df0dfe63cc5a30f6ade1a3f32f50bf99e77117ce58e9095c0f024cf7afe6b2ccbdf73a5cf0b008e58a98160c9f67a2c9a4b81253fae637b5b9f521e7fc8fb4f93c5897cfbebe565f1f7647775f1ed0f2e14710cd5142fc8082c62c84814ccb39",
-	"2349148b1d042815fcfd32e8291cc38f84015cc71e3f61a0c765702267a00b752d6095e0cd739d0ef6e6a0d00c792a93b6eafd743cd52c7602be9bc6f7a6772864ed15f36375347ca15057d052bc76c8d9ed164e21439a8108e264061190cdf6d49f385801819925cb79e354ea58d765649af1a29e92f128962f0c05af1db6b3",
-	"46544a45c9e374c0ae02340b2595dc3a47a7bf75b5c1add4d10dc4989d789e0aa18ef033cddd807bcb746737c97d0d8e86b0a470ab2772312ee8b9dee822eb67c9f31cdd1e82f8ed97eca7d2b237e7ebf27c68f9d58d297c650d9f323ffe56e077f0fdddfc5591abf5a38715c629038c367c4c4958eb76fe897972640182217d",
-	"225dd3050fb9992161ec8c5d6b714dacd17be5365fbb4a382a6ed4dfa45425228b1a043bc3c31455c441fb56983c0ada82bb60f5cc15baedb4836bd25a91b0f894110e56e62a5a29c003b70c04416a8a89acb31f98e0a0f0932fb4a9dfbac0ad761c630481930fdd436324358b70847680d9eb1ce94c7caef081fdc5b008bfbb",
-	"c62e27e37a36479638a35912f106a959254a0447f86a6570b9b87f1492ce7436d312075e786eaf4f8a62f55d90792750ef02e81a614798b7db5f536dd92f77e6818c868cacfbd0a0a135c2cdb21bb5843121ad1d85948649e4d20d5bc1c9e94403255fb67ea6b3c7ce11f91f63ac97e06fe144a3249b4a6f8bba05ca9e71d2d3",
-	"86d7401db5f687fb04436c793b2bcc563e1a610ddbb5a8b2727b3486366d229e32b449c3e2bbee2764ce9b36c34cd2cadc1945f35ddd5da854765d5bf67068a8949802a8e8414bcd2ea0c842046daf32e352ec45eff1d33ecd4e0d46e95c00dc6a053097dc2337905aa0d9d28a4779389dece596e044304ccea9f031b1e3b61f",
-	"1b860a3c743be96baecf5fb629c9533fa7af472d78fda9a449058b449fd6b6085119a02b8623ea0f5468e43f8db7bec0309208b227d398dcb6dcd2353eb9a558da8b11772cb9c29a5ca97a9b17ddb3e43c39194cd6dae454fa3eaaced3b53f66c4391c9b4716d6a7419270864f57e3bd820a3feff58857c97cc31ebaf4ac967",
-	"2e45d68b910f19cc0c00ea994101fda42cc2748f470a25a6af2f630963159fc887df73f1ffd22ef473a6a94e52cf1e56baf03aee3f57dc83354572a17cf369b7519c6ea812b96ff8ae0d003e510b013ba633947a90f6be9a1cba1b45a946d03e1ab90fdd5334cb469f1bbe3f19dd4f4f49880644a8d05fbfaacf5ba7cb8fcc31",
-	"3e8615e8cb2100937d65ffdf111f9cd2b4a58e98eed7279d26c7e411a8c76918fda9df9720f5f87cee350a4bb9e0f773274348f9570883c109fccf125e56838c49eef09e86a9b18ac288e2dc89f9abea2c7bb6e10785c724da2663bdfb5625026f5da5629309b81e5723973fad573030cab49002f1d658e8f5a5374fa97d2c87",
-	"621ab2d095c7c3bc2ab1616ddb85e722d8cb492d188a199f72ccbbebee33b2c3d4e8f790ae8de22e6df208c896a3e495630f14e86769ac4d65480b8b0ba35e40fc43ee5eda4655fb49b9f9b4863b470212055ea46066e8a40f91a9ed0b61c3e384a173f76d94301a1f36ce914ce7230bf1c37454711877dfd934905c3ba313d9",
-	"41be6bf17af1c8b6ea7bb9c3adc64af4d015dcf4c9b4a974060a29d27fd60e0c92c3fe695aad4d1fa43ef37673d6713dac71f2c9abdcf8415e3722547d946e17bbed80296829db3ff233eacb4a601a426d3079a3f10ba4f54124f40a4702fb660618143a78693ce4e12495bcdc989874965ebb724e161cce2708272aa52387bb",
-	"aad4befa9ed48d216bb3372652a4fbcaebde965f3f64e68b83e7d765a6b0df0090714c6e0058d1a67592af3de109c1a8520f5be8e715f05a9b88a89dfd7ab21e9dc39752f09d9abbded6e1bb2780bf595fc853773af628cf15c0bafb8f32228999d19bff4ddc14966e4ed53e031a58f24164c63784131ced93d5abab4a6c64ab",
-	"295b437978ca8d956d1364d182db52543fd7eb9b8ab664d06cadafe85b02d2195c190e9cf8e8af2bba252f0201d5e7582bc5cc1ea4c7eb17c660903ce70f020a4231f8557a36162c9cfaeafc37290fa02c3eb264df0bd63aceb763249506424e7db27a3c8350319215086dcd50c423e5d4ddf68d09b3eec822796b519a41535b",
-	"871a886a46aec978dcb11a0f7ea4dfd9e83e80355da2095a7ac16bc519cee846e04022c8fd09afdd37acd0010b632291d81ce8d4bb33f70b8bcdd6c3bef738fa4f1eb48fcfecc4eedc3ea6d7066bd4304522c0c6322465fc72734c0f53ba9d138bdcec6e377e3ed7f403405a443ad113d1e8f1204de56690ee187730d1f1c3d3",
-	"cb1c6d2a8211ee55d022c722ced6ea7da8a08e756298378cbca38fe5953072db3fdb4f66a6d3b5653c518b3d4dd22457fe02524f0110bd07c6ad909a8e51d24288672240bcd02f1decdd6195c1f192edab8969402a966bb4edeca200371a781ff43e9fd5cf279a9029eee54e9b9b18508b61d57dd07a2ef3f497972f8e528aeb",
-	"10897e01f55a7ff3f4f00c99f3d2c684d8354d4db18e31d725826cae8c119e31c1f5b5688fd81c54986bb0f40b59047efa91284f093816323ba43f392bedb9792ab5d55e905aa19c5c3f5dcbb247923d21171d7dc0eb2061c8e78634eef1bd239ff036f0c19123ac72440953a1bcd5e1191966539473aff81c19ba00490e877d",
-	"6bd6edb073534d1b59fe1060f2f2156dc7e020b95b3db5f20c7877fecbb9250728e16d53c591ebd9f07db8d0fa9b968b5b374acd41b4d8f7c0c51ac5c95034c23f5e51be2202579de193d1de9a478af0752cbd94d2a8806de2df82f7f343fc8496c36414da9ae1c65092c3abefd21accbaf2385fb624eb7eb75ce9fa764b8e7b",
-	"32aced8013a28e0c685ce4ac742720b108fa50e35a968120986c1adc40361f48aace5e659bc39e382fcedce7fd90ee31622d17ff621bad9f854e97df95864496a6554296632f852ed0055520337009d0081b251de8a71d23ff985f98c17597a55af2ae9f9ad3a18a7fa98373f3b25e1b1ccf081be8d94b88c0903bbf1e345297",
-	"7d8c36aa0a5c417ef931239c33bc80591840439c7db52406c96b87313f6853a3537f0e93ff7522dbbeac89c004bd9e05601b1c8bcc7df2e42eb2002985413b0a1c19d2bf1bc6ea5167bdfdc3e3cc265c4e6f3dc779341ffbfa514a24bb53912a418b42713cde841137356867862ab9764399dfafb45c325f0b26e88d1f5e58b",
-	"7495da72125f49fa9eb38d819679ec766484b33388b1d06fe3d4f30db25943e1f5c2ae963071f2386377d926bbb6ee3be74fbdc627ff3e2d89508aa65a909646a2252065f8e47e0c8f4d4481183bb700e7982f5a9f8295fb17f61e31dae6ddb3c6531a9f7b8dd77beaf42d2d9f82c1f47db631a6172fa921a60a56d6cf548045",
-	"a8f11c752c2d25e6a975d358eeeea68f9cfa80885e0696f554772b7559079540a09f42fd8c4706e09854c6813e086bd32db7396c66375add8a38436bc243482981e607e4c1d697e35e414766f7130a00fbd1741895648b29e098ed54e32c86cbd3952e50459ab729cc3125a917bb0ce2ada25598b2301bf2a1a0c8abd6f634a9",
-	"c1405475757356d3b0150adc1976e6275d51e1eaa17b822048c0e12d99fc8220f601b74becaf421cf3b872a20500efe0ae916425594afac2d3d74c3809f9ce72a66d7ba9120e55fbe2840af62a9631bfaeb8326c85fdc6924ce46ace6f6a3bd9e531542b0539e2bd2de21a0c18762e13eee2e22868bb3f6e15e0dc061f0bc93b",
-	"bae6ffb048357900782e4d977d4ec8d9ef034c6be652bfd2e5bd8401cd989e0943a838b23429cf7405fc8ad0507549d06fbf69aecba0c95f85414ff4aebbde53793c1a845903de32a3b63ec5caa90e7a890db4085b673c33c5915a2592fb08d92bbe2485013b38509b4cf6d365aecf57414bb6fd505b11a6835761e7e6c9f5bb",
-	"47e27840438680c10378f5b836af4b0ff75aa581e3ec3f7f7536ca05306dae28d867852dbee042644d132fe30e5a37ca86bf1c1b93d6d8cbd2de4ef18012f06cdc012e1cb68bf82992a9976527a8ace52bb9f5130c403b5bfc470aa7aad0730e75e15aa8eee8effe6feac5ed6b45653ac88319529fe201ab672cd0bbe27fe6ef",
-	"769f29a719ade842340dce61bb8c68b55185f3607dfd845d6f95e6d785451a94237003eda280450559c3e4a94535dc6ba5693f7f134e18b9f5e7bb74e105ebee46f3e01a67a1046ab32b15bb6d4cba348f1d57fb4907cb88aea22c5f5c845bda4a6048db9dce6d0d3bb73f064a81b855b46b7d9f494b93e7ff27fb2bffacd5ff",
-	"583e849fae860bb9e3d25abc2eba85c4e2c7b7add263c0b696e91813e538a7ab3c63ee41a041a9eb5a2a8b233dfa1530793feb1208a1037496a98771a174e9398e3acbe4cef8a7cf67c090cfd61eb6a1ebba98e690f12b50316c48f121b9ff9e9fb327c389a4723581e72af47f849d577424260db7fac55c342a8236b47f495f",
-	"b49d604f8b777926b2ccb8afab42c0879aaf3c8c1ca38d2a88e63b73de914dccc413576ed46ee884bc9e8afcc3dc8d6ad22b07d14be4314950b5516f1e3b87da149316849e94d6a94517c58af0563db1ff88779d23d7af0437232ba1728bb56d0783416cee435a9dfe73e543bb567378590a34df9c4303d2efb5f0e822ea07bf",
-	"9b5feaf539e506d6a4884540619bf10bab63edfdbab320864844bd4dfc7ca57907e76791a26816ae9f9787bf1508f4260b67942e8d01ee3a2cb4c4bb0b20681b6b656b36d44d9b023b6158fe0dd08b7c0bebf226603119a2c5a30f6428a751c626644d7fd45de8acf6d581211e59ee0365b78ea8468dac8823cb58db7dd8a4e3",
-	"6a6b366d4a8ba1f61b0171daade751828077b1262ac7e72fe292de268132cff288025a47ccb65dfaa9d4695b5862d87a173481b258267198c19bd09a8bc6996598d87cf99a5b280abe77cdec16e89df664965c7dd2ac40d93a9a676cce26214a181fe8132e460e699f91bf1bd7a3ef0749dcefa5d532addb033c9a3447e34d31",
-	"2cc9683e3010d0f153eff72087c88c83ab5937ce61cd684c1dff5cb6fd3bad6c09130a3b55095ee559e7124b71b73b08e6980f2efe6895f6a8d59004f9f6ce7daf0c6c41033576d3825062d8f6a51687b2c0ff3822db7b01720283da0b22c3c3d44760baaac97d584170c802e1848b52469efc061f71e08c6361eb61c2e2d5b9",
-	"38b6082f306a05b16ffcba0b9aaed848681c9110a79c6deb2f4bdacef39fff87f88b32b4da1e4ba7d4151e48cd4c03432c92e5223d267413198dff37266a1a2dc35b13469c665f961d8fb938412d0facd901995d7dcb929035ce328c0e1e0f53df2f0089811444a55d97b902e1072005a115bf2a118c07547f594b91538516ed",
-	"6cfaa39a5bb395e35f5bfe2a7df7aaa8d2c5299ea438262a0dda43aca1f56c2096510ddd9eaa0e07fde8cb6958f103fd86e7a6202393d6b01849e5f39bf5660f5aff3869b627afb55c0db40021021bb33a5a4ecf8e2eb9b922e0029a8ac63cbae9ba1e74e9b3cbc10fb9864d31b22f22b151ace56d5ba1f6507e9577180f56e3",
-	"b3ae2aa221cc9e5a4aac50abc85c3902753816683c7bd3f4dc1cb86042715cac35478052f1f6b119660b5136d667a5a34de9ad3612cf9009a39b02280b8f2976867d3d6a666ae90ef5b11621067aaedbac3de00ceb39017de89add11b4f05c95c5032a2760b0042450d9287f9ce70560d9d42b08faa6e2a5ab6ca54943143f0b",
-	"41fb483cd3cf569586c3cacdf82672d2c1a8d3ab24d8cca44888e3e9e4373838b517f3eb2eda6b4492fb4781b7199514f433f837b71dddf623a2bb67cf6999bcba0f5b934fee72661500492e628e8ead44a9e7e393a5e8196c7b8132dad14183128b81812e9990ea63266cef9c8c51bc037711993c2c401292f5bde8d1ea14b7",
-	"ab092faf12ca42384cac20ba2d3c00fb867ca9427c2cf047e346867af948779e2eebd74b24fefe69164ac1a78b986180781f1b17a812dde34cb0a610060291a0df1027b80baf732e8453720c8d5676c3b87bb07695ba80683edcdff8f31dc4e9959c73759ceadede652c682cc71e8a0a204df60aedb1e6ec81dac25844961a55",
-	"4c420c5aac282ebdb790372f724fa5e768e19fe2ffb482fc77c19c9435d1cb60aeaece09aa1cdfd737e02e7d3f7e57d1ced8e12afea27b3beb9d161c54d27078b83c1ba3d3fab74c662e96e840ae491476a409571e1fa54b06453fab35467835dad43ae6e24f77a2aae2ca287b186f58b7345009dcbb1ae684a1dbb575dd90a3",
-	"62a821fe97f0350d605488fe5441f8cc89d5e0681ddbd7e5ee0d3c399398076e30de9669aae7d2834284d5c3093536bdc486a384c8a238da6e758b082568b34850364010abcb772ece503d7c5919e361cc32b488a430568dbecb9c88c834f1972259fee6dd0b7f21f208bbc3e2d4c5bed1a1f4ce05ca551b934ace02692fc0f1",
-	"39f152892aac3da9950b3b998ca16ff9a4a6df438cedb8818e9e912b1e789637da18e4aac235b2bad566797111d477d993b642935afa810a658f2391e988cb4943231caa168ae30c49ce2248fff495f173db3994a0c1e57322d94e9076bb2935b134b86f894fb60514525938ffe0c8a3a722d47fa65b6bdc34c092c96c230347",
-	"5a0a258bcd67261d2e76796a54646ad48af756b29f6004c71b5c8f5fa7ee62609b194b0410661dc8147b370e9ce3b4c7dac000f92227c2b00bfe476c6f0497d526187572ed2c200244ccc94440f8cff68354f82ac8ab8f03c0d998389da0d555ff8d9fdd76bf6c5c48251b049dac51130352308dbb699deeb14bda151aed82f",
-	"16055227e2fcc7720588ec4f75f3a5b29ce6428dd64c5cdb2f6dd1ecdbc97db7f1a04d97a212ed5e32ebc164995afd6e0f4ace2d610882e7c1089a8465138d299a0fc0d712e23d28af450eca73140f027190b4491ac1c076eb570954b6d21c1dc3e90ed6884472830649a1896bdabfae9fde90002fa4a6238b10992c9cf385a3",
-	"25440406a9d1e76eb39e5f535f5d460649c88d6e41f36b24683b1a88fb8c9761e7a2ea5658313681cf10de5adb9ede1a655e41e5ea73630a4a90b6d94009cf111ec84b7194142245de0b0b53d28d7872ae77c1879fa1b4c0e51c387f01b2b77f9f7d5d948c337691e02c54b07d2b374d0af173405393067720ad26033fe34ea1",
-	"7a1a36ff1a355983e664776b37dcb8f165ef02329b51e5cb9eece4eff6370436e171aafadcb646ac289eb4accecd76a10bb494b8b9b078b909f14faf4774be322a03c101e7eeb3ccbd5a59545298eef08f0a2da111503b8bacdeebb910822026051df5974490b9823a9f10766c66672d370c30abab6623e07246a9998d3d3823",
-	"c65df686e42664932d3fb33a6a032cad8823ce1f031ee33163bb7a7709995dafdcaeaf483575cd616c3a1030efb21e1aa1052dd4b459a81bc50794a15c2dbc528b9ea87a84d13077b11de3182e8490c9ef15dbc5a5ab4fd33ebf2cdc7d5638cbdb07987eed157978641e71210e1ab8e5f7cc717cf0d427a4acf65f3f1c3bfc5d",
-	"705ecc9e7280e0191b1210029d7cfdbbe7a38c08cc3f3ef8c5777d7f9a6d8d6db91b96c8d3930a54583d502746977469c1d94852f5002df4094f39d56fdd230c23106fa9e211601eba78f28e551e84a50d74b2205910ec13e358574902f6b15e462b1b9a2a0c8b4e08ce4a3575acb3458a5363b68d852c443a4d2e8de5785a35",
-	"1d0afe4384a0ea2711e2340ac741a1d460c417d7a7ccf0cc333c035cca7dffe89df6990249cbafb2b5721bbdd2025791443c4820e62050bd869a22abb1878dc56f1299b794bab2b4dd2f477b6ac8ea12b267f3b682c78ec0ba32fd1f11ee12cb432359bea39605ee43d3060d6af9bb450277210c8d2a97fbfa21f31a938ce041",
-	"4f3211580b291c060850db8f11bd500239a5ac951f5c398615edd4442b250c4ced79e89a87f6f2143e783a865ca61132776100264fdac57efff9460561b7a4fcee4c8eab62ada46d692ac043c4e39e51276b60d5a570aa231c705375046aed4dca535afbbd164cf410128b59543f3716810e2d31021130ec4f00d05bdb7f8453",
-	"be70a104a5e897946139936cdbebca8f8a2e2b3c1004d9065e2f9752c48704ba3aebe981d989e495e62cea3492b3b75d9b9b5c46fef1e274cee0aabcd0bff531276cd10b96253a7e5ebb727728da66dfe1a83bf8a39dde3a183061ab1d98a3732f6d69c182e2a902777fe72adf9ef6186e0cf701e2e3aa27cab6a8d7f1a21d9",
-	"c005d03f4c8dbc7e3e68dc2926c946c9eff86eeb092d743dc14dab4fa30bc6062e0485a83597b33201835ed4d1cbe74e62b001325fc946e5b1e75cb5514ac53e3b318f17fe3a6f29d800a4f3e9ed35be36d334a70f697ef0b822c7ec89d4778a145839437043cc626a1075496cb7447988266f321c5a2a8182924aba3b9b3cf1",
-	"b5d07e7a605dfcb5c7982b6c90fe2bf075d2ed6ebeb4248b30aac86593949fdaa07e7090689f8bf655fb0c7f7e550a7e61175526600d19e717c98aa90d8b96c79ba53d775900691a252833d41b5069433ddde54a8c633d3b38e2bf8b8581db784007a84997b87a37e52706535e3d9b681cc2caa55ed36029e8d30f5eb6025c31",
-	"7d82850a227ab756d2d9fc64305c7bba5518a0c5d16f0d75ca79b724027b69f3e376bea428b0929ec175abdac6623eba4c8ca9daf707f9a2cfff6040ad7a9dac5948aa662366690f000ed72bc60a14a0dd0a747a5740a9768282f76358286b8e9a65987fc73c2df29e7a1c68934f33e5b87fd5e995ff2523eed6606e66a10ac9",
-	"cb8e2b9c04ed0119c98167805d709095dfa1b8419299b7783e2f2b829acc66852e789d116204a849c29b6fad1e96a4a4119f0f08647f41d5c79b3e883acb6102b82e10cbd6a1212ef8f99842581e7cd50dcb6de86b54a45f0135568066c8d7ff75ff207c0f7bb69dc59491e160b32b9760cc86f06d8b080c2e37067bfb03954f",
-	"6a83067842a140331fbc4ecac25cd89b956471e8c9389a5e87075829dfdbacc5bc62a17a9ae8e803fef59010b67a79eac98d7a9b4b8b76bdf936fd2712e7fbc39267b74cbcca07d5d2e0f6bee5da0f55decffc34fc95e8b922ad17f6f29a24e5f82e0c4fa573bbd5b47a2df9806a8f50513d7dc3bfb5b9f3172ccc36f2559291",
-	"43e6bfc6cee28b59e480f17cca892f409c8509537f37fc51f04e010ef8acf693804fde3077f8e02f4a57577036ce314ba55e535b7e42b5a5dbcf0d40ca1f035c1205c828bb08c005ac1c61445f4a90262e6b627639dd55a60cc5a176c7fee7765419d258bc0168d98e0b63cb42d0506b799340d76ed54d9ff862cd1a8a8082d",
-	"26207b9721b5418ba9e3a13386bdaf7b535d05c1bb33b423443e50eb1de471785032321579132ddaa60e857ef08df1d37c1544ba539d52c1b76ebbdcdcdd46618375c085370387fb68ba696f54be197918b53e8de7d50cfc319d720b5afb7a64a076e0abc67a1e805245f14d68800ac631838b0b40437b88f9a14b2add59d045",
-	"b8b945e8ad6b203fff100082be19365bec5418f6a75c8269b7db9a2c82fd01f92d3be61663d5ee6bc3ab5dacd045a336574d12e7ca90e9c54a8376226a00dc417be7bba6b96c5dbe44f8b1c703eff74e54533884a2fc7632c66d5a9b3984fccd7850be42acd03e1c0d16859464dbea27d8335044332ae69d0ea13a09c53799f5",
-	"9700ba38c43d56d5ee81a39e31ab3154f713fedbb3d666549547c97a29aae3f969ca1415e8d5a148034c71b447b9610346f850ab013d877b248d7bced7cfbfff13f493f8ca2c2b6dba247dc04a4d3b832d00c206d27e70f8ea45e92687d9fdbdf21f63eaae2fcd701b1fbda648819ae2816cd9196fde2e8c64c2f5d299396605",
-	"c70d05787bfc498c2c9643e70e953c2cfc2b4e39ddac4a4d3f99b8c1e1489e4f01c5560a21b06ed50dfa8cc922cd6f2f670c6967f8cfe76845797234b40ce208e1c4d18c63febe92ff4f3ddc6d7c33434c5470e50ea0c3f147f6c73cabf834311e11aff52ff85b929ff5e28b3439817285f42db7a62f6798eeea7ca1978e91ef",
-	"1a697c1aee0097ab5d17b4b04e1e57541418731a4198219bc2abda7dd4421ab3cb0ea99443d3d41a5322e569ed58cfada9bb862cf36835e6d82b0ba349df53704a13e4c6e82fbb058ae2e93311c58da8eeab520486ddcd954466bde08b5d9d12cfd7e95039ee2309748786cae5ebd4276e220666b861b8600df12cfe686571f1",
-	"c03020338fa395fc3808ad37960965745aff035e5b076017af65d0f0664ef6b98552af3ea94676202bfce721f981aa5bddf21ec819715c5d77de49fe6d72aa4a4f174b28a88bbb41d558e12f93172456cebb41243016b656a35821a24d99226e8fd2a305aa6c98cf85472d9d88ee27bae03fa67cf668bd376c6b8913bba03b2d",
-	"6ff478e60cba3d50464435bb82a177789c043633578043f7c06a7013a4c3b6433778ea6ab16fdb4cc9e86532aa60f490da323aa0ea27d265a736cde252109d00dd9eee4041f3b62f8f55346e378a075e4eb41779be5a7226d7213c5a85f034dd8a87268de9a3c72f36aeeb4f2d7d342ec9fa933a12a7a13357c38940a4b0ea1d",
-	"92db4737292127cdf985ec4653cf3d2be7aff3a810316843119d2822520e8204ca1511f97ee9b93a83fce7d294d2e887e69d0255dba3a701dac4fad972964e9600ba0780cfe0d8218bef6cb22a79d22be70ca902059b813616437e09343af88ecee01053cf69e299f82b5b9d292c0f964f7f055ce292dd12fb95b724dc41256d",
-	"2e121361ecab621a276c996bcbaa887948ea07c1e5b56fc3447029f878217d95f29841e646e0e4ef6c312d5e324e7c381b2051672c6dd770f383ff134943edd002d0ebfa91c42852dcaf8b82c5201e9498c3a30c9f8bf0dde7072136380a73e0f96ac592038ae31557f18415d0241c8eb4199d25787cef592c91f09934362d01",
-	"289337c4aa70e40fd911c606f9a9d0c0fc9873c739b88aa20c5e4fd17e75fdcd68fc0f4afba597db387e71a28e4a6975f043fcc712b69520cd88b6fdc751985ae905c6b8b8d63b4e5aba2d77f70b11086d28c5f6b19f2930f9bb91f46288da2e86e2b717df835fe29e59548262f77e9ab0847b3bedeb542ea83edbfb619261d1",
-	"b206e2ffa69ed91c459ba528c1c1e2e3c416f9b6098e17e8030d7af7e9c0601a2ff86022a5eb7c0698f4e3f9a2bbef75a16d7b21cf08ae99663d6f25ef403da25b8e0f31c1b377b7298f293e3b4fdd91643887b3e8f17f0af471df4f16a2622ad6fbbc88fe0e4b1c318aeb9a088cd5b616c3277302567e30a8d890940653f351",
-	"75ca0efcf74332ed3f826dfba5471a42e945361b3b3dcf86cdd98299b009ae080fcc7908897fca1a7f8da5eac1d8d76a3d0e8ae5c6fb40de8b06ec12120ea9541c2126290ce6653361c3749cff335064e7bb82ab15dcafd713f80e27c8181515c509bce9d5f51f79d63ecc9a8e88ceba238f66b8aa048dbc8e48a0a9b6fbbba1",
-	"20f397e966c64af29df8c4bbdc2ab2337bb187b76da0ee0449efd788ea4c383db0134af88fde1b9acb89ed758230329e76654cb6f683829922401a4033ec5f7a193a46f50768c0b8f8b5b017563670a533f6d93047e54a76eb1a41c27f86385f0db146cd4c7cfb0967af5ba0a403e0db234ff276423d63c4c5513a56a324e123",
-	"4cb2daa339f984b67d8fe04891bc49c546ee8f246f196c6c9432c3bcb73ceecdcd9a146a9410780861ed96797a1de1fb0b60748a4bb581230609540fc90d6a5c6ad06b61a97cfb5c9a9cd6aa871505975b6365dae0da36a010cf3fa0751d18cb664fb4012bac6e52109782d5da934e4ee5fc1e68abcb5716afc321afbf02e9ed",
-	"b89b4f5d55c805e66855ff85537eca3c77c7a5974e62ee2b067ca099975b6e97a604c300728767b29881d9f986e19a6ed68b7eee5382494febdefa951b5a6c19b19eb605514fad8013441449fe8b5faaa5367f01c98689e2bcd588e8ad20f307013f42f7c2f419ef18c36ace17d5425c30f9242c5f6c5e5de9ac46690b3dec19",
-	"4f8a55c1e80165bc352a3233443f2e30437029980208d90c27d76958cb42a193aad212cf286be2055f59cebfe8e282c472faaffedc9bb90124b2c584b8e2a69b53672ac63442adfc86ec6d223178c19ed3f2176c4cbc1212279f5e7a46b24da6c5decbfdedd01522dec3d6b006f16d8f93914a24a44f7892d0108f03e349a7ad",
-	"8ea91293650a9d31bd417c3f6a44b557b4a23d4da79a4ea27ea5b1e407eb24fb6b67f5f7ad257b48ee6fa66ee7f9362bffa13efe574bea06197b1305f128b89c7c870166a13b94fc2493568cfb958165bee4d0aafbefcddcd1dad4ca8906ba65069b5da7315a97dab39a2d7ccf5d2358f364b7f2175062e8d44929af3e589a61",
-	"3ef112680850e76847ce08ae6889e202bde15a9c2e2f3e3145f84f41f78789e6f57672fe6fa6c4ca9c86335fcc5cf2e74c0a78308a7dad1ba1d673f81ece64c9e016ce97ce932fac0710bf746cab869ff7c7bcfcd8d882c0d06ca485c3ebd34b51f6a048b3e25dbb3e00848b7410f69102e17cdeb6307cb684fb34171973c1d",
-	"ae990e8105440ccbab9bfccf3e3f6c583e8b52ba83395af1c0fbe04a0f67d48df64706debd7612cced5cee7c1e1a29a7888674239cc54bccc09ec12b5b02e253de83c8600023a10f30fd470a6b44a56bd1a2e0b41b14af5188d6720cb551075aa95e69dbfafcebc7c5178d74bde438c11be821b5739a576420da57640914749",
-	"c7360de83920f18c4755f0575cb51efe98efe6747b80c5daf7d3cf9e0044d2216ba0219aeefeba2f8c99e98e1b877d0c186114e4bf1dff03bb7cfc7b4d4b4543c4b0ed005f2a3af00209b898a4beedaf1c1f4afea3182048a75f941537a2423128784c1e7063aa707270ddb4b42f1e935c2345477859c2143436ada1bc2a1433",
-	"5076e794c29cd74b4a867642b0449ebab0012ce546b3d87abe8efc13d896e13f748e96a695b2702ad86a152a9c3c33205c0d1fff99154a44c4d4ea61d52a04cf8a1fd548486a296a8a153095bbb892b3b9d0fdb37a470eaa4c1f1b4ec6ed39fc6525e1d8d4e90201748786ca6e9c5e9d7ca82294eb305fea517901674da0514f",
-	"87b40e73f4affcac9d7581032f824e360551691ff4a863122fa091c2b75dc39bbd35c2e90ae0369afad93e72af9709dc277a75c0429ee50b98c43c56cbf58cac383f4eb0506ba7b4a596c9d7d7106085e28892f7ab168a644ccff2277227a2a88d0eee347757a6f7c1fbc25d2aa5d39a68e73cb231127fe9e493e5a5ff284d4b",
-	"4ee54e9ecddee48b4f98111199da5837cd2b72c092452db679515cb3f109dcf5a1217e5c7ae9c6530da35018242e501cbbcac317fcdc54bcaad8a41c336bbda08498547bd8161903d55f1009db6b5046de5be58cf708bc72068991430f502bbbc2844b516be22db563509aed68015041709772bc075d9b48e586fad80bc9f6b7",
-	"b214fe596e221daa4bfbcdd0290c61c01792699c03ba66a51bb821459b80190e94a5e03a2632516137d8e389c82b8469c30c2c93a49380ad8102fecd08422655bcbb6c158cb5082009af82e457e40f7a39820ec3e3ea16080866efbf2e470caaa32071e1ef30ec246298032c8a30d86d896ec5fa91cc80fa5899db554f0d9f91",
-	"3d2a7684336aa09844a0dbb52ec351d15cca69a39310833eae4d5c4a9e677e77d58ee2ac6adf8bad7530bb91d156b1290cf88e99f6147e7b1e8cb61bc189b3907a286dfb2028c2f35384e824189450e13ac4fb145a99d22b6629f1436f5de2bd399a8de587d6c5ee630040dc207a7c642286623a84f51dea478a70c3216391dd",
-	"449fb14d587e7c18fdc05412b3c96faf8d56becbe1c208d3cd73ed44e5da11197437909689af8484b3f003c5306ad3ee5684105a4861bb1a683137064c3b0d8d1d702c05efdb183a987d2d3e4aa62e7b0456cde57dfb2d88d04e6245fb48cb8bd7f17dbb2e2b7c969988148415e383e2583a896c76545dd570327882c1cf1585",
-	"aac01f9daa2762aa8e1e7fc031c2cc73a599b4da98e2de7139fc4c1ab88253dca96364c36a4e192123886e12054e247afa86a3f9bf9fb0d0aa91ae68ff90f6abc458153130078016baab89a74814c8801ddae3036a0887e4075e75c67509b75e598df62b530658cf887e16c54f3f462f924e53810d670081d0efadb0091c60a9",
-	"59090682d5935989c93837f806a221c8ac59b50ee45a439a708fc8e102d5cce38b86c1fc6db9d9ac786640afd6e6d93461ef12c1340100c85cee291a52d061e149b5dbfd75433be5ab2d07aa6e9cae3e0ef4d7b32f6382f41c63da25d65a51bec620bf3efaafb26738b4e8185ddea50b6e7d5216936e4b582b7a3057a63350df",
-	"3a5dbe1592af222ec229f47a011d0049550443da68cba216a1a23824117037b81d6d0d75fa738fd69e7a5d61d60ae73830af1dd5aa7fbc06c5ecafbfa4e9e3ff189e592c72a901667c02fe3783136d698682385d2eae7f3c5f0f12400f51cb98e1a3c4a2d758ac4c575de07f127accca1d35a3d81b2c9d5e4931f81bcfaa430f",
-	"6c684ae55563f80ec66f49b34f3b78e8bfbd75758dc1010f2a32bbd059018a20391474f687109c3eacee3571d9f65e33e55a4a49dcde5e2346730c9c07646d46dbc6a6cfc395854e9118bd9a5b5cc49d1e828b1ed9d1edd89b8253f439533d6830800794469309b46b3070c5839c56b74d7269f659764c355338cef112abba9f",
-	"34b61d4ea04c13d92de85166808b967d84e9572519627f4e66b36ce5a1ac78134fe317c757a5851b6346fc9b9b7a97f6675b6a8e499e934c00c06c60e4631b8fab94adfb7d3e4e5b692abc9f9c70bb97b0ea442b372538bdbe03d31b95d4f4e6601eae4d85a453b238c55af55a75adffae6f0b3132f63d8fef08416b7d583437",
-	"a023b0f4c1bf399e149759605c6b2e8a6c20ea47213f8569edd5b3452708632faf141cfba66b0a7137905b5901946f3a0a6bb8120e7214eb1f2a492014b674febc97e426b2a1ead8f0fe003cbae87a8fb2579a3aeb16f9d2175a7e40b5159eb963340529dc4bb9475afeb732a3bd9dcd4d5e259d8a913b7b8bddccd63fbf51ab",
-	"9024b558606cd7187a30b2fdde644042f579703204a2e6382a676618bb8c2c5ec9c1a939fbee26325a39ee6f87d7daea0cdcecef7b0349fa1bd1eac0e0938f54b7974d99c14a1b584d68d11da9d4ad6283dbb31183a717d7e4cc3600de769e071360122909b2c6b4b1c8c4ff6ae2c9a1ba0c86fdc9dc005daa6b29ff3df0c95b",
-	"90f2bfe07dacf60423ef65c7422af57a97e788d4fb16eb57bb97099dff9dfdf78a60f9c1ee2e4c140084493aceebcaae0378097046798c7107eb33a522b898f703fc660e2bf551a71f52b6621a5818a357062657e2f585e25db4f0704ef37fe906ffc6a0bfce86898f24056f2f6e09da6ac78229da63f1ff9527932e9c386add",
-	"2b71dd8db9ddc0525cd4b458f486c654e93647f57b60540f777567699097a6fe0b384547b098631e3a430725eb111cf36c189908920f55f357fcf9ded7712f2a5c2039571ded20f90c75d9604682b7a7eead6257ccaed4b3c8609a00ffc8b9900e787d08ad8bdb0046c071a65fca306fb06ee1f6241a78c88f5220e0fd627ec7",
-	"43a713469364af4ee3e9d81013ca6c170dc6d52aa807de2131bfa1afab38296fce027e27d2f14e654072c9ec01b4cfe6628e35fd6b704b908cfbb18f7ed62f058c8046ebe807ff43ec9873744d5c5e1503e9010d07a7fcc8a996b7f5c115a4c42426d602021a08999608a24e3f8777549c559b423ee445f960d98b80bdcc9b99",
-	"a2a5fbead1efee5b6fc8de4cc26b83a4fcc0f5922283298ce1059fa1c7cd78fc13dbed3866226e11c3be363859be96fbe96b94ce12bc9e524d89ad50abcc1c411979a35ba31e5ee384f6910f12bdcfb083bbcd76f4dc6c376fc71d8cdd513df98562473e7bddb6dc10237deacf3d4cc95531d18157c86a37ef66ad8a5175f519",
-	"2383fe871394c8c5c04df9ddd4a6ae80748a9053e491530f27491f47e6111784271d8a9c5299a8c79900a2ebd31fb5ca99eba3c4753e8732d37a92d587fc360901496f3d731cf330b8f4cd1fd4a2485c45f9185e5e8ac2ed858693c1de3991cbb967a3cbb218fad38e5f226d8bd621953aaa2bb2732c80c48ee5779a46dcca8b",
-	"421992dfd7f1d01214449cc7aa4151eeb26ea81c52c705048791113973df6c2bdfd84c6379e430bcdcc5d3b04b37d664ec797cfd18004b6e8140b90dc5fd1c099f2afaec6ab17dc1fa8505a7431cb7f1beb510850148cb4fdaaa7320a76cb01e0a3d7965babe3dbda68fde2db414f1278483a359cfc225cf805bc397fbd56063",
-	"55a218964cc2fedc1f449306b5d326c42b2f3c4950b98c236cc192c76bd1aa32c533ab16fe4be865c614bd128910fe68c74cd0d6777a7c8f114e8b723ee89200ef3311273946fa1167fa55dfe6664763aebf80ec64000f149b6599ed1056d4b01a4badfde5a5f956dcfca38fbb43bb0709201da59a00ae79b766ef0697cab2bf",
-	"a0030a528dc794ef1a075989807fdc6df8cdff4ae9a3b3230e827bedfbdefcb015114f262ea3b715ce76576acd064582cf111ba17374d26f19104614fcc3faaef469fd10e6074c4a66fc44729881e6cacc2e766c8e0adaa87450980110d996d4c4025088d5f9c2be3f79b8c8c76e15afc78ba34d25318508d6b3842e95c486db",
-	"bed9bde0e305511a3460bb75e6f25936f3534d5b3b41fbab7658b4983c3278c68f0afe342edeed39968479bd2498dfedafc103b6141855182e7d36b32f9cb9c3977cf5088e51684ea8c235a26f3f7ac1fc82aee6b845240c2b808b212d348e75b6550c68795c354b509722621bf999ef173eb94545b95eca49f59f92a9972315",
-	"cf2d5fca99221bd2f4707daf405a6dcb0c8c467903206c2c98260a4c2547b40b6701e6942c803cb55c466540fd2b80a376423b11a3c9c64fc781afa9871a38148843353b3b0a3d8a18c9eba6326f35f2e253723b2f986ed73454134590762a5aecffcf7d8455869ac983a02326640b28ec7b26917f5ab298cf2a751873d9b019",
-	"c8b5548748b1fbf7428f334c8a21413eca4ea8081ffcf29d3517a64d09151f4d67b9fced513274fae896532b9b732c2c8369ef62d3353759ab71c21239e71d817e62ef72a0f88bd52b8c9161bc0fbab8f2218b8066b681074b6c3e1df0ebb44b2739750fd725b089fa85ad7b0c738b9e435b8119e6183471a595f53974bf3c8b",
-	"58e72122c39a54a428d1df34e5447769cbae0d4835b252b0a856e66e3c7125140d9a5d625f3a3a3d98977e7d32195c9aee54a14e214479b7584ac466fc362c3b48a74ba9d16cda831ef7853948b236f4851ca31f30cc0dee9269b542ad442cffb87a258ec9025fdbf2840e8f1bcf1a28d7b34392b791b8add2c91481ee1b2905",
-	"792e09e7e10e5fe8905c4d7abd1ab5d758a7b90a96675c3129f22230d9f40e8fc7d5ac442563f59d13a8aeada741790a469fa4fe0a5b888c933e13546c0324885bf9ac936f1ffebffa05abd21641fcd24bf2c638907102ee7c726cf266e94f0b933c2cee87f7a495dc227bc6e48bdcb591709d2dcae94827fdd3aa8231c2bbbf",
-	"b96658db2e8315bfa6fb86a96443584216a0b054bccf7034eb8b73334f1d8725fad141d1f4627c22db497f430427af7705b1dc06befd1f4d1557ee224b45510f942c93e58b6f88b7d74126da5b971aa66adb0f94c9f4f8926b57fadd454c528056730f108cd4e264d45e1db768cf4d1cec65b89abd97aafbcfcc71f196d56943",
-	"82b3c42e11235a7e8607347e035a13f2be962d4e5269d535848bbaced99791d679323f02115dcd71bc0b3e120a36bea038586d7bfab9acd2f7826bf6e19a1827ef1b155fedcb4fd3f612d44fb121635185a038d281670fc64730933b492e81e6b62eaa28bc2783c838b20a0e330f481e267b0818bc6a80f7840bc6c753bd193b",
-	"6f1f765f62eef4dbf9e9f5f6c152e42fed328b17237cc9d2673702a1fb811f11da98cb1d60cfc5265e2e192722998c2f7bcb919979f87e0967341e9ac27086a259d8626fea6ed3ac98f7aa633e9fb37458038dc451d223c40e4d266b57e319220edda1df63a641a422f68b208e542335d0e4266e60307200214e9dac03c6be51",
-	"7923fab4514d4db30bb2cf6d0fcbc4a944787de28e4ee62ac101661d79a4639598e635f7b2aa72826ebf2f4e395887de70ba4d758efaa655fda198b35412461ca3aba7a29e6eb040a2b8e4a81d05de072c9b5f0fa96b26f57ff4a6b30abe3bae1415989c2dc8893d38b5e4c4057ed54cca27c9d230effc20d27af8a1eea939bd",
-	"7cc0d617021040d6bb44fcef9fd1d02a29098773d6065922a522909c5eb3d3f34a9476886bb1a53cfb866a6af77cde783a6379a55b5cfaf426009e4f3fa41a6ecbcfbfdb645e613bd5a58cba82e184173839470156a4e364ebd7faaa406c19f8e1bc664c4bd89db7f2a55d230e585f25e94e85ca2d19af9fb4170f4230bc11f3",
-	"76ed17aa36828eaf836f3affe8aa626f340d5840700a2cdbcb79a3f9ac8254e888bb26e7fed38e5d57a14cdf599256c85a520640f2838d2639d50f35f4c491ad0ddef36359eeb775e8305b574a245d2702679926b8c54a6972e32a18d8519e49cd5f13813666ab75df402cc47ab8a7319c2dc498ffacb53b419ea480195fa655",
-	"9345d5261b9f29816f33e8b3eabbc73500454571b29b6e56fffe87f9baa52eb037a777f03c769530a8e2f25027d1cb1dbc44c25cda074f8507a56567b64fe59f0a4582f62fd0285471572984d4e7bbdb7656891fc996711320f674ee8eb480f26c31a7f374fe81e0895024462b05da208c2d963d8aab6e7e1b9ae112c6eb07d1",
-	"b3741fb2aaf5bc6e2d80f199d4b911c4272c1b0a8737f72401e7eec50a5a2cca748e7f49fc02ce40e713a73859d45ee39ecd7d04f2cd8c6dab877590c984c3a1d5d9d72a3a7396ad6c8a00f16fcbb4b1fe1c7755663332714493b81b15a6518dc4e01cbfd05bc435188aff3287391d2261d227654de6aece3b397f0d403995e9",
-	"38373e4af868c45d300d135a3691bad2ddcff985f5ea6c252570408e89cb0c06a5c3b5c3a930d50be78fffb65c2372a39e0c34c69a60014cc51758aa2a3a147b682bf243d9d7221fbc11cf3389a5d71edec4517d495565ae507829e4af1d54c124818c9677455dd1b2697088cbe6b0a3f49e2a108e64ad95e6384acf303089a7",
-	"b061efc51693f40929431b5f9c8219f89f1ae70f8c3b0f108fb3c4c8b08eadd5baddb904031ccdddf562210ae1a9363e8d903d3b97d5d0c5edff8cd4f534f713edaa732900f8c30de5179aab6b256769db65aa3dc216f4bd005fc1f83d93b8a95ef1d9a6907c1a5674672436da7eee04ef8eef80f04a4c7e0f09de24cad8afad",
-	"89ceafe8b4302d3bc67e84cc483a178b6d593decc04cc9cfa2776571d370d887cdb57b6f06a6e6332f9a2a9097fef20b5b916e912ef9b03cd49003d4a7d2deddd7ec4e52a350803c8b8a3844d96b65c5caa90b14360d0bc5ba3cad4857541bb2234b5d9314b222b370a730b83c2415f014843af04d2317aa6eb9bf2da2f2a0a9",
-	"97250257aff0b9454eb239c5350e930855fb8f8bca7e68da6a8632d7394b451fdfb2732aacd6f9f9cac1023f5e653407ba4fb4217385ddba0d43e3fa984f9bfc4221cb17f917f0cafb653d356463c392fea3c6a2dbc8e705eec43033541eec640dbdc535da12335c0f660aa7256c7d6f3a9c2bef868c873c954174fa58dfb9d9",
-	"21190316d758284768de6afd900ce5170f616aa5fa4cbf739eb328e8fbd6ba7b9d1a2a5ab2e3601369f175050c599be68c11672c7e2f384bb5e2b5d52c60660e98f1ce4e59eaa99c33d6e02a11196e728747e2d39767afcac33a0365ae60ae3d4bda0db95bdf74f89270a3cc0abe7929f4b739aa1ad2bce9a624c611c5bb520b",
-	"a1b0a890330d3d834eb4dd662139c62919b5cd2b3204564bd04ee7cce874f43974aff6dec296ac29efc1243f013f19932392db815fbcbb16048b9c319edd9c4ebf61a547f555edb849c146474c27a998df9f100d455c846456faf84fefd2fd4bbd2934db6e00ea985b9100bda5e864bd78f8797c5a24b56685b9650a334062e5",
-	"741235a107cea8e6c51cda39c67288a84333b6ec2efa87257f95fda1b7b3cb73177a3435a22549e71bc5ab5d29c7c4b7d5142b84991437aba7b6139a36274d12c11d7972fd51e2f28626ab82ac2af00eedcc63bd660e4c20bb18cd181cfffdfc7c5e3ad5f597432c4be0b50b46dfb56a70f244690f5a65d295e708d0c753c821",
-	"b32d8ff242c8fad76ed3d4fb0645cce3f84c8d384efb72af2ac784b76fa41a0c4c59036de149703993cc77767d685c981ed9e41cbaaecad9f494ef09656858342581b269fc94a256bd2e320db5c10f43f9239a5abfb4802c4c90ee94ae1e5d58cb068f848e61f0e4a1649d95384ee288d3aeb12ff4cff7ad83632e8de4e0aa21",
-	"960da064ee12964c8713632db8b183321e1f1c4357493ffca23349bb83d0446fddf185566cdb45f62ddc25a959eeded8a978ed6b069ed8a3db165bdbd8e38b4efbd3694634b0ca2c279a59c390789e37f2e762eb24edd5f55fcada8ec03b88746036ace3218bdf210e361d20a0e19514ba8720eacdfd30fb2266f27a6b9f5629",
-	"b6e4adc12bda21aef1e60934275a230d31614d0665651a658dc7fe95deada7e066c09f8b6a1142b20d13971f2217034fcbb9614a1db19f66e5262a263e0d6f37b039cb14bdfffaa65d308f3ee197520bc8eeaf479aea0426a2a3c9c147f14dc090361aa9d22ae8771997f5b21b1a101eb99af8df451d9c5a9bc002775f556661",
-	"7a59b1780ac12e4204473db88cfb05fd1395a6c877586a37e9af388114431efb5e407bb81772936a3497065004097e7c09a03fdc5c5fda773091383097d6f6522e0c139b2337e994ffb039f3b0b405c9f71a12e035a47ee8a7ee90ff44a8a3f1dee3a065aa41596a01f546e9de16afc4e6cc1bf84853a2c23c14e36249623127",
-	"4683bd4561e3bcc0b39613d14318d1fec64aff4929de803df19386a49d7aa000fcf3a650f2eba29e249a86bb0d2fe5ebc79f5dd58919265e6823b2421d66dcd79faa2bea84c4a6daedf9876380a2133c9f6fc1fad1937f0b964255ca30ce274d43612b45e3d89f257a2503dd0badc794e7e3caf1836b6fad942f6af0a90af7f5",
-	"4d3c1ee547d8052a940a86e2a42015744a552dc7ddd0b6cc98d9d6199094af4a2e3230b3abeb94894b5c87b702c48c1166263122979bf12e3db144b9fa01a0a8477bd9149f8dd5ece3c6221e8750fa0a0e5a2d4bb320735e3543fc0486ad354054aca7b78d1316edb565fdf830922d86bd5ab080378ab1d693bfc745d3509539",
-	"3abb9ee2af590ce242e6e0ff916dfc1bf9466fee7b2784c43d59768860f5db49b199ef73b589be61aa10a7e78420cbcf844b825c866683f850cd774e3bdb513359480a1c4acb9614ee2f301246398f7c0046794b3ffdb05332f847ebf2d4708601e6a07290cda1a04e3a87613f24ca05210ba431c6b2e009d2d0ebd1674d0d53",
-	"26b6fa853db0bbcd0af246d29e7078cf7368e8f9bfddbd4744efdbb14c72301f9e88c47ff87f6451102ed6619610e7f9226c98602c8a14fb347f81ff7150e81c928503395e20d6d74ebf70d0b086ccc8ba6f9064b89dcee8b5f49c69e3839fc8fdfae440d734a83ae1a8639e6afe9214dc52ccc376587718d5953b55a8837b51",
-	"94a9069cd9d2f5fd66a0043d263b9286562907c17ef1fd2b72a116b28972015b2b2ef8560bdb3dfe2dac701081a20f5ada5abd61cf3e5a0789b9b3be7151003f98bb5b107cd4ad39380dfe5a30865b3727c8af5110adad5acb4735ea58994164407f516d196e41cd8c97d2cadbe0db91a34a4db4ccba7704bb0dd622304f0efb",
-	"df44dd362730966e8c7e2414e579eae458b266c7b333df0b66abe5f9808d78763640aeda32377197bcc635c3a36a485d61bea8abea466bd7cd4fd0ad31daaaac6671037d1d2efbe95b44de3a81f9703ef60300a3ed388070ee7b1e6a15d96bba94def82742b55e030d80dd4ea488fe34ac7fdc140d52bdde0e8fc5af2607dbd",
-	"9c6524cc27fc9570d49191ffa8f7c7fb49b82cb0a66b22dc2d33eca7e1bfa694a1cacde440562cbe2f28a26bf36a2dc7c3ca290cbbdf7d6e62f4ad60a7102dab8433b9695204a95d184e6d091992d3717f7d169d8344a1d47a41a94313cdf91cc3d4b375d5bc647309632d2548d10e382e9cd0966cd1281cdd13bb3eabc9bdfd",
-	"424841c26aeec25d854a2ad1f5dde484705576c1a452029935c0ba38b5a75b4e07e8d324c3aa1dcb55c2b5daae6685adcd7572bbb019b9f49824e15dccf94f3ee3825d900769f82146ecabcc99c07ad23d2ad19403add6a37fba0225a1f19945a9092c2e96110ccd9bcefcfdae180ae91108550a79d69d9f5c108fdf0b147e41",
-	"a8d7e04d8a36f1ebda2f38ca5669775aff68c85debf9f5197b56b6ea3acd532261ad2f15b355a0bf50e34fb2ab4c91e2e308bcfb9e7ffc023ef410ec161f74ee5e5037988f93acfe023d61366556ad15774b922cc5d051ae69dede4af521b3384b5d71271379337f6d73c10db5c52b269ceb5d73e1d2ce541163da324bb32c43",
-	"9b79b82aa002bf67a3f8fe7e42aab89e82428d799264e138043b78ea6a6f20dce674fb7f1b937b6efc73a1487682324a86179a8704465eefaf4259f54dbd164ee5e1ea472da34f30e913fef9143d805e63d6b33085b6141704542fbcd105583a98c82433aa9dff4684d928460a1deb1309f7166039858c9a6505c7d000e5d617",
-	"bf4018b95ae02744fe82929a7bc787d0e8796c0132ef8577d8c0a6698a378da1b161109ad9849505570f254d66ff09217911b28f5e87bc28338bb518cd0a5744bbacead2e9b3bc596f241aa3264ffb4fb4afe7ebedb1890536bc3c55927bf5486c1a8607f20a692c01e48a6774a05181889825fdc360a10bc31accd1ca4a03e7",
-	"9213d7ed4c602a8fe057d22cf9805e16a7b923b3872c2d0f55d51a1b47927b6f419d912c92b745108d801221ae350fc1854baeacaa9fa095c06aa9c275e5e2e90d076e525b51886e7c3e92d3b6e456ee2065568b107568d1edea7ceb00e928dbb00a6c935fda9d49f5c495ad88fde605a79fc7a5f0c788f0d3cc2afb33547efd",
-	"7086e27f06dad2d363aaec5ee238ebb05b4c0786d146e97547586e1db16d0b479c2752e2362e46999ca11c44af3858c859eee0159b0f48fb36aff5ff1a1a838a4f058f0fab57127e4dd9c92d8c26f7175860b7e362fa6343d895490433815e23308b89201fcd2160bbbbd3bb226bd8c4701213d9fbc6c9c24e78c2c01f7604af",
-	"aa776e552b60c4ffdb0effadbd75d854921950f32e73d0973d6632c669f0974416d378eff3f7899eab8667e29face2b12c6f3a3fd05378e2868a8aa68c9d1c4ec406e47787bea677e195ee14ae0ee7ee36860eea7955be556f6e437da0d7c11f5bdf7c29f0c8886a51af86495f7a01c2e6760bbf27f8ce023bdc67b98e4297ad",
-	"a86411acdb04d5dfeaf1e790e5f1750c9993e97c8bbbc3962deec1c894b032ab56845fa883243a975c88ce2e0de7c2cf1a3c1b47cd0afbe8464ae5506bcb6a4410d9f8c5b71375064f08a5592b16b0bbb3fcb32b8fc148be72d723d383b00da4023307cd55e8038bf11a8ebfa62e4df2096df3bca033fa5004d0c29b0992201b",
-	"90658bbcfa300f64476038a8a6cdc5b48242a4a75e21ded75fed9fdc6b498fdbfb2fc7bc03fbc214004a18342dd20e773d8733c1a3c35d86bb719e511d0ff7999f6cc35d8c30a43a66933ecc727cc600d310729db2e164fccb89b779aeaf1171857712cf7582b80cecdae6db3ba0ef98a1e78e336be2fc17002397991114cfbf",
-	"309fc7fd36b6f486bb27bea6c2e17d404298c37f98f349e85e353c2aaeade0bbd2328ef1f8b1ccd761293620b7d5acf33f4ca3d471329a705fbd58088e56a37971e31706fc0671d9133bcbcbcef123c6bd54a7e5eb0cae174c980c54dfd904e7a24259e113759aff66012d67c8173047ea67d519124b30534aa09a2c6b549d2d",
-	"bedb4376028baf10cb747378448fd0a5e4eeb78cba909cc105a150a86c03e6e0dade3840e0acfe43ce6c955e029797899a860ec14dc3210077902a53d9863267314501dad89624654f89a69aea08211180c4217c81ac69c764ac8192698f8dc96a419d2cb4e87b87d7a871a1748df2216fbdf92e7ee1765354085a46a32f5d9d",
-	"6f8cb4eed81678ab331de6d6dbe3bc0e6bc66fe1d1b9dc9946a1508e0b050c7c39519d441e51eea05ddbdc4c65cf599bd2a0ad9e81280cdc992544236ab68c52b7d500fc085478ab66c87b0b7d2f79e3e5986e23614ee75e91f8cf504cc77b897c22fc2610ea12eb5576ddc4d9db3f14de927b0564b5948d23065d5658fa9c65",
-	"672a9a031ac0ecc5ffc32a52efe087d7ae37a60b3b20d44bac063a31071eb1204a93a10fcf15768837569fb757beaa3098cf1cc831b65e48c6942febd6d09b241b681596adc9c514a04f35a9742fae8bf2dd68a46564ff096b38e8561ce4f9655510e6dcbb0299c209d72ffa59b8fe01431fcb3469cd78013bd639119abb19cd",
-	"21ee612b20e2f87ed0cf75d3ebf008e87083e827a85bee9ea89f1a60821df00d45a17efb9217ceb45f4269d8c630e8227124479ccdb060ca9604af59539f3a68a94d30f4563ae8679f7448313f1f0426d7a7bbd7361bd5efa4b8055193cba7d7255057ba6c9051c0d46ad731ae9aa1f409dae577bdf62b78e6b870e1c04b2bbd",
-	"bd75be5467d78e23a4121efd1bf1178279e24bcbbf0eb76a77ce0bcda64b41b38457213a296f9746d9c59cfdca84510ccf6489df17dc45332786e232023e82a219e46244608ef9b60935c2438eadd72dabae450049692c935f49928ca1bc74325712bd89e8bb0f7d6a893d49b41808798cb35e191400a13961448a698dd93551",
-	"bc63830b1996cfa4eb7d596fa4abeb7eb488c7b5580813d2265c751b506af6f4de9422ca334ff2f2c11122acdc8ed06bcc64e618282c6e5877928b457d0cac48067d776510fe2e3ace9d8bf2c28ea43549cbd8a478df38e90331017617bb2b73f93c6eeca838578114dc2e5f8c6e85571f38d04c9d830fdce37be696cf3dc87f",
-	"8beaf23307af5ffbcaff10d73026fa624a0d7469e3b7d2ba5bb634c6a583c6edb52732dda446049da52cf95fe5590167d708e3549c872bab27b21455c2c92083582eae573139e3ee3ec4f5b46c5744c02c52adc29c532f6e5d622cdac8df55b69953fe8b43358ddc69c0462a37eaec303d22b6ca91dd402a5ccb8902f3527737",
-	"74187be92b7ef13091deea9c11a1186f0716a81cceac8df228acd0d0fe191d6b68e3c89feb273e86b5869278056fcb81762ca58a1c5c69d019dd564526b41bd8cd298920760f33b47c7d82a6cb797ef75db862e664d1e18b3cd2a56b9c567aa8d33cdd5875b28a9d2bfef3d135fbb468f35ebe4a48c6ad9e87e0c9016cb46f3f",
-	"a59868cee2c97b6611ba956272627e8b5f02a7afc18d08cc29a1de360db7f0286f63bc36b569bd65dae35154d73f14fa9a3bfc8139317174d79725b03fdef9050f7a15bb9abc7d30aa4d0c867c66f441ed0c6a5c36918d13b2b780b1184543ce4dd3463b07c3ab7c18ee415d8bbb13fba3a5de44e2804049af112bd478a9fac7",
-	"8f0bcab6b7310974766a1dd2f063f4ab8c3576b3ba785fb38de1537d280aaa327a81d93c3736fbccc7a76aabbb1e3cc6bd27094c0239c7aac34d3d3b23f2074d853d0d7ba6a80601e96b2c261d0016ef8f00964fa1c68858b2e05b3309e2a7e1dbb7cf27bf17559d7dcf1c0044b4ef01aa7e832e0250a11c69a2f75cac44f0c1",
-	"7ea0d98d63a4c32bbfa6045e78f566d32970bedb59e812974d8813c5ad3ea8ac923323544014b94cb55abd07db77a92b13f50f40b27bf80a08c70536faed2756255fb1b6ddd3b7b20ed9f08076cd8d9fece81bce880e2f55ca04c921585f75c73ac8e44dccfb763a341b34fe043fc71631670787d4a07c0fb12e5a8517f10b2b",
-	"f99cc1ce6f8f79b566d2a4ff8bbebb7d3c905ce3c7c68438a0a2a6c89e46a2eed7c78bda787ca0371af16bce87b2f80193e79292ff85fd82fed3a499b09611a4b1ecf36080f99956ef1d3c84d8fc34426e562bc49404cff9621512ff08b519c6293a6c64f177ffb16cdce7d906023083afdb566dc7c69f7539a14ea3454cb69",
-	"15da8ec9f71255754998683e4333ebb64c8e58574210b16f602d86faa6b9ca596c13cea3def3aa4c4786f4f455e21dd9bd61279114393effbaf6073bc8aad03e21cb529ebcd0c29d1fbb2d0640cf89f590fa6c676ce6cdb5a6e24d58665f31442d9bfcfc8570ad63ad3b83ba87fd96b5c1fd554b3426a63565f02094d09466c9",
-	"65fbd02e84338fe45c1dba1b76a2a8b3612823961902272de16e4ddffcf25fbeedaef9f48a1e7d8bf9911453794d941e48e05c95a4d7fed9c05c51d1abc00c0285c3a8e57ef62d5e96f7b99b9396f624c5d00bd8f413f9dff1ba768f94f2286f3052c5a05c9231606607d53f1ab0daba5e5136df3158302b66d76b74dfbac1e9",
-	"babf3ee8cd097ff4d80adaeb7306a9d46711fc9d1673154c19b5ded464652da378f52fe58d56d1aff90bae1019b5057029ca2f4d9ee45fc4f728604198a460e2fdbe0345f6286fdcaa85beb3d3d709ba19bf145ae774496da930545c607501894868ca9b69b2551d0ec12a4a565f5ec5666f0ac5ad278fb868a7cbed2dad82ed",
-	"ae6aa05520ee1fc08c2972854e6dacd6e7b6a8afc406347dccc554d18f5f3327e21206cb256a0e57a40decc31ba38c915110c27944e86f96f2f637f62add8f236f87554c1c0c0afddae73b409e1f211547cbe4c9b025f6dd88668a54cf653c13f47692d47d51c833ed5fbb7e1b73e52763a3d2a7079a43584fb568560eae15d9",
-	"6e62eb4446ec52b109ad671d6c8b7053fcbbb48aff8a812da2dfc1b5fa21cc5f15d83a06c2fe65e8f1af355d953a512a908c53beb529e703d1c5d4fa3000efd04b6287d050e26871fb5a9c99b147da09404da2c39984e027d5cc9b338b08aeab2115b99318eb7546ce9e6501c625b31da5472c4a5f4a5cdac724033bdf34b39d",
-	"c233dc3a21d65007d81ef3f7154280f2d39021cf5c6d6148c728f76fa43264a9e7b7c2a354af211fa10e54e72c4eda62073faee2defa55d246bdfb7bd6cae4fe0895e2b18fb5022aa01bc25b1973ed75a19336e17b3fb88e594490991077643ce69b229c4933b3fd61b7e6665e0b6e3ef7a082e335698c5d2adc41d16f058c25",
-	"7e4428a36420e1d4b078f831c7606333f0e9bb508656d01595c28749930bd24e913272c99b585093e878a2605051460a68c67a47a0eece76be382b36798cfa7e10e6842d8d14108519bf858b0697985277b4258aeee88027ec3f6251a04978ace0a9c3499b908e75f68835925cff00e6efd1cefe8855b903c9b7540924991c19",
-	"45de1214b339f6a3cfb1ca5aca231c0a39c3e2dce84f5ed17b1313def3ec8881892345802c29b7bd62c78cc3a873b4067f40ba1f712f03e61ac2e77cfe99d3af8c37387ef23dfb7f077305e69b71649030b2eaabc090c08ef3811edd434ff5d53806f34a1c3f37815d313539265979d1a62e577332231b8982eccf8081ec1b71",
-	"68bbab378a8c11d0ffb86e8fae4a19f51c4ca9fb27e45ceb9affc9886225241f20cd80a4ba51d4f7dbf9a363244eab1e44026622eb2fec3b270ab0cb8cc98a442472cf9bc4a280615b0a635b46744b1999aaa911631bfa0d0138df5c377a525c87600c5bcdb90416088d555817979453e3d17002cec9215808f8e4099d5295dd",
-	"69fddbbde43306855103a1f896befe2d09ce5dd984c1356af644de21f9ed083e0e329b965abf573ff9e665ad278d701d7d73f5ae983f006a1af51dc66533af2c1ff963fdfc3cc39204964653f39bc6f1c15d4ea0bac062e50f7dc56cf6ba51f6d920aeeef9e620ec3cc3026406f9a51dd1ad296fd66d304f2a20cc36bf38ce9",
-	"bdde6254050273caca4c6ddc14df1557529af8a6d73dc633ca5eefc2d6470ed9d90ed21a94bce9b70de418d330a00a47339a71b48ca707fa88033ce542a9cd13c677f2ffbefe70c0a68795052c2930df7b8d12a30e2fcfbd6e1f140cedba09e39191812c51d3cd443d23bbc75f35601cc526da53d735b98fb77d38513ee8d8f9",
-	"4b2f4217154b7c939f101932f795f5288a652da73a0d7d752d3387d042e4a4ffee03e6ae5e9a650ec25f40915b3510d72af4b971d9ff492178ce5fc3bf871f231cee16a4917fe2bf970d8cb7e127b7141c8846a3f32d3b924e25a66d6ee3ea385bd883339c8452c1e0ec41db535d90b9c50fc713132e3979cf8ee5e567b1b939",
-	"a4fa80d6737f86837487d477c1fe47bf32866a5f4ce94db121b4e2a3b6c05dec8bcc7415bff6201af5bae457768655ce93397c5382340387fc704d50cab523b72f95e63cf96e77111e9eb9d16efeb0eef8f9c3d6e28ffaa04543a21b777c55a4f78c13d0b241e3f1ca0ee7f5cf6b42cc376d3a569143b8e1b93c7e515038b8af",
-	"6e97d10fb38cd77009e1920336cddfe462b0a04c1a78305c89556c874cf0a42752bfdd7d79533d1186141be80641e647253fc1a680b1ab45601c35771d253f38955ba2bb52f1feca73dcdb8b133df5f28067ba1d52fca1e423406f751ed495b59929ff53b39d1319daffec63d66fd6e1565a326a8aa8c14dfe2c9de579d5a517",
-	"7841349e7c2eb4ea7d5b7d8bb3fb65765c4e490d0657117e2112f2ca48cd99c9edfd0e550682e4f1508cf78ff1fa4dbec9b2a98ef2167004a32721146a4ee3f3c605e40287f90c12dd469cb5a8ce2baaeabaa24055e26f1f10e2f056935c61002cf31261d05a7c44041e11918a1e2948daf9d977cb6de880f0fbd761b0afa3a1",
-	"ad644c74eb99f58e0c2c3a35b241d2260939ef5e3dbc19a26900eb6db89431e303e8c05515b80e866aa51bfab9211bc0e71647da7f00e5a4c3ac7599a7f410c7f9c976d07489531e4417580d3f520086156d2ead434dd1f30e1fdd9bd9d68307b693ac9d055708a9401128a457cb9a42f292a76503d9745a2beced9bad0d19ff",
-	"38fd097b98985fa8563bb64b57f1eb7fad72ab21ba6ea8ec89e7cae9605a7e0620b748c7e3cc379cbdadc1b37c2e2788cd6cc804ae75799dd738c5976f58453b593e71b293a063c493bc8bb798843ad50fc3bd49f3093c790855f3abf50de3ca8739238d1479f4ec6dab192706bbf0f6cac1a7e04585bffbef8d234979d95153",
-	"c94d821056f2813225f0b2ed1ca8d14bae2bcbe53bded3ee53440b045551d33521c07314ffe4ddf4a7900fc2ef1808bf8c8897fbac1b62f2214c2db623db3d2f6e18dc93468a064ddaca7dd9f777a799dfc0112c6cf6dec752a69a36ba1d4949deeb3986dbfd77979c0284ff582c607ec18f1c40a3acd9763e842cb3c0e58d39",
-	"6ee66a7b5333d4afe6318879b3cc01764847f7e2897774f9d0333f799bdee0386d2542974c771528ffb95df1d73aaa93f27061ea6c9b3e237db5ad96632b86dc2b5b06f8eabe920ae98b1b088305532013a4ad4f6ba3cf25e795d8ee6642a2497605d24d715c967e523d3a0998059c3334506c22e07fe3f45e369de31ff9d75b",
-	"ffc64cc0ddc0e41b137ade064be40b1cef73ca6cdabb638af273e727575211fbea692569e3a406fec907b935b44179bc8f246f3e630b5b63f55df1eb41b54f4000dae334281ade7697b1c9dcc6f47d735d4ca1cdd8d31ac870beb960c81211425381c3fa35e8112e2c773149ef00d995a57a4f55b239ba7d7a697bf636f0bdf",
-	"395ab23ac886b0aa26df53d5723ba78ca5d3c5e2910939a42d6540b9274cf6cbee6e2f3cecd3d26dd7882424e65c7360e9ada6cc1a3ba370fab81e1a2aa270b16ed37ac66fafab1008d8e8e296428e73cfa6507892f18a7eafefe6f34958e90e360ef50b6968cc007c4dde2800a138569658192b48522e304080b48c24eab5c9",
-	"483d8e95f86687f4f2e8bc10bef1ef8d6861d05115ca4c74594c8e20cfa47ecfd164957b8d22a748d08c2ade388d25fe6f5b9b6051441e7509d77f85262aeb57aa7a75fc8baff20df2a0d3df130885c96a1b0a5be7c2a4b7e67a69ef581a32219ff22299a6ddcf2de2e1d25d530db5f57b7c29d55898f0b59cc84e14f9b903d7",
-	"1efc231023d5dcccffc2c951f71ecab34715b3a678d611cd7fa5abdc7e8c80f01678239aabc189dfcde2059126b0de6498a5361e8731a4024bfda2c00da42107e19188e1cb000f2edfcdbb45cfa77ef6ae3fe6fa05af76d2873668ca1a9e95c60d93ff67ae80d49b7134d11f83d021bd88b6450737fd21ff6b84e154607c44d7",
-	"bd2843b422aead28655caeee404b3b71807a3886701d12a845ed8465f7aa3f0bb730696ccc2b0cd4508005f1bb4cdbc7d4493d5571b862a0fabc688a9ceb3d8ef31355b3bfd10be2ec529de6590d78592ca9b3148090b6dffe8184639679e47d74016f3c1a5ac684e12a2843a1a67ad42a7c6c4d802a5ea1c39a156fcb6576cf",
-	"ed216f6d8d5403123443d2655a77a616243c6af96f27903f7e48ae977e1673f96a974c3e6c20e11ddc70430143d26a821e1c3c3f28c80c81c36084bb49f3080a315469d398221dc9d77133ab0bde288e1b447ba4e55b57561e3d56218ada7e7e460259652e855d45c177a65e4660a4d9a7ef2d36b4c9be275199e88dd84c2a3",
-	"20a357741866a99f29216780ad60adadd11fe667e1573419c373e4f1cfe6db2d1ef11a58372ec9f536f55c97b821ea181593466a69acf82d059fa31ae59067fed94be62f42c39564b8e726f18210dda9914a6436a83b13b8c38f8aa887760447f51b1f929b81afbe2bf86f9f12f4d66c856011b37f9faa92bfec1d10b1327545",
-	"977564f89729312dc52cc61461bcaa750f514493e29751ec52acbf9de62948a5ab5b113ecedd92ae79e927a68de365bf2331e007c15a28f923089150d4dd90e4b4758fafce5a4762c79ec322c68ea901a8b1f4939400130e1b7ecad700211578ce6b9bf8dc72bd167f1b6e0189e9782b3d84d30c80adab50e5337596e5aec9e5",
-	"3117d32913a5dfeafb4aabb4f85ad09df6a502f52c85ad14ffcf2e734be53dcc032a708df54ce1728a804b5186ec78e2b7ea384550d2c8ff2cc73565f47c9b9ce8e6eb08b896695c2c4edbd1cb11a4211bdea3b10755e135ee3e3751ee2413580ac46cc62b6e4015c03156e5e28ba353a0ab9ce1fd4e7588049de42e432541bd",
-	"21eff43e8eae161f7376d421a31622bc648346f74a466153c4196d830ecd0c41b1f6f4e7740aec066833cd0b2cf78105e4d44138bad2382d56354e4e96f3bc0e0331503b75f4ed7afd4654158b13f1a07252fdeb9674e974c2b744a0f42601ab83e8b544171d97d2e4014c2615ac377a2085aa75d440f95d4b46029a1c6768a5",
-	"ccef2557d3a23ad7e179970455f538ce43cec6ff04ac3eac04831c98bdb28b9e19cf8d7c5ed4b4c645cf2cd91f65d5c5dd3e13066903f8acec085fc7cf9c98434a6df3934e2901723eda99b45df5e0cd31fc34792c3678f686f2053b42350a9722d5905d1a03c68fd7e588cdf9169647b68a5a7fa7067dfd8976ee89923949e1",
-	"1b1340ba8e577b50cb450355c4002cfd892489fec622127a99c7dedfccc1fe0d2d9cb30f2677163cd24d686d69f911aec58012406e6c1b575acf6ef720bce52f13b0595110e385a1352705b0b3b18e97bd340ef67c0ae4a02afd1dafa312a7647fba7cda04591b6e1af0d3a9849c97b34ca13819c73dc3e54ebde079df9a8d4d",
-	"2658b2c9ad41fc4071bd6e8af5c49ac86e10b2f86fde8d693dbee31c2620fc12723a43bafbd58ee2d092bf37be44f8608af67641e4dd02c59d15a5de0203306e5d848e04326ed9edc6b28c4be7c09f50946ec09a1b9e040debbc2aaf3d6fb6c24c7a1a0185d0d9512773bf922fe20a53e17d2201dc08bc06c7de7e435c6be8a9",
-	"bd8bd187e60e709aea430c9626baad263809257bd2e162341be58b9ce2c8ae6cf86e810e85820071e458d3c68f4a93572c34fdc37a56c05caee5b1c70aacb9404060262aa3afc3487bf8e233d7f40688b168c8182f991fe6c59f8f8f28f56d5ce85914d6af1098723e824ecfd1b42281cd26978f2e9b5125cb1b93e4ef0149cb",
-	"482cb1b17eaf152516617bf161e4e39f5704cc58048979a64d9889e76520c17ed3af5b884ef50c0d8efbd8f3c5a01d5694735560302b89093e6de7acfbf9157fede72c9eb1c9b611cbcc11bb57bc000f5cfac31b8427b31fe7eaa06ab5419579578219099d1091c33ca327889101d5f510be409b647fd7d4c00b7c2d8a0c2f43",
-	"2f26d8ca66970bd7d6375d3bc903ee616eee3e180f30594239ae16caad1d91fc6b70892023081ae351a89ea7a52543e127679363392e3e3a7de4c44113af5bbbbbe53e5a112aaa9212a9e26be6f23b0dd8a4623446b95db6edca1c74bc55cb537e887585adb5d7a26a88ae24f1f3d9a15d3301580cee74af91eb7861be66295b",
-	"3c157c2d0a0e03501f3df37db8d767c0c9d9bb72f15cec83e4d19b3df53a7e2f3ad100cbc3aa3d75bb441493a04b6e4cdb4bc8a9cb2d0d48ea3b353629ca3b0cecd190879f95a4004e3b54b21bdfabe971aced2a2d92759782345ce5ef93ea31fb17edb0a06fd161ba0522bb6614f14cf88073e975c8cdd47dd752e99cc4de6f",
-	"d8c381d0e72facc63a89c474c04698f87834617485804946ad4cc1d46f7cae6423a0f5e9c13641b7d558c606426c1686f9b16a7df25a41aed9533314370d19a0bc84f8e5be95f95b78c4a77eb6342ef3ee809f6e84f3dd787c337b1196dca096e2f51cbb3598e703f67407b67a4d65198f6dfe8f657e08ce4e8ec01acf85d9b",
-	"9df5f713be930bf24e01e383d1545dad5248341df665cb73b8fec1fb3571de663590e3ca47d16085482fe6c669d8ed5666f9443ecae256f7fe82fd166f0d0ff927edd6e84bdc6353159aeda8daa71032d54361e8445074eda940fb54d19568eccee47f54bc2c033b913a210ce984ec99ea38a810c4ce6188035695c9e99bd967",
-	"c9542c60e390a141c3fde5619d3cae61109aeb299e0a559929ac96b9f9390968812819eadf1bcf29e52cd9af8fb4ac13c059289dc844d3ccb3dfdb227e2ec26bd6f215da1e3c607af5b5761ff279ec5acdcec9328e4627bb83556c721d3030fe4d4073b2131c4944b6c2a666d22b27a491c0272f6e42060791af3325d9eb2315",
-	"bb486e8c26d46ef7e786643e889aff4dfb3b84cf4ac06d960bcda133b0325adfa40d45ddb43b6285285c254d3a2f92d9ef2711a012b1542951f42b53f72ffdff58144d8ba2c9a8fd09068df118602362c58418acd07fdbeea36c94ea19c38e0b4352e993bec248aad2fd850bf2ad478af21ba6392c9d9584dfff5152820f9245",
-	"bf6212fc49d20efd846b0ad86ccf13e840db54c098afce5c77f89f5c62fb0f6a8ad9cfc473ca7136dca2fe3929560600baa5b3983f60c21e2137576eae40ba8afd74f0e98745ce2022993dd7767a8e1407d02f300b6b414862ba7cca76ad47b5de7f98decb9a356ff6eba2f924d44a170a4d00800d8eb277b98e82c38d4fdfef",
-	"5f1fd64fca1c1202fdb0ae6417d4b996d99c39c930e3182542915bc160668b6f81cccea8d54e3a0df6e3719dd227d509e96f38d0f8fe9b1dae8a95824e1d104afe083d9534365b9c9c268f9c66e5c21993ab55e5d69b15947f0e67d765c09a9a43cf376d7971a0a3c01e0732e178dc3ccaaa6396a485a678019253c227562827",
-	"276048e76205e232269a9f86457e9cdaf4667fc79429c27480ad02039cda668c53e4e6cd89b16436fcb1d4f855e278c2f92df49205b84bc7715640f44ae01ce325e38f28499ce42b48b69f01f01e201439c66454087f30635f262946388dd9017eb4d5f20193b2494bf42135e4ee7b91b6246cb71c069f23e578a0e9c9dab64d",
-	"94dc1f7c483262d7c5e046a022df95a77b81e0cc7e9327f98fe4151c7fc62955bf87d72a01747babe9ec32b936da9d3684cddddee35fe4bb18a87563cdf545bcd8e4722f380766c117bb9bb8feca79bfd0ea4b9e726f2c9d5d30c5316deb6b61dbd75be0c2f168e11fd59ef2f43492afd226dbf51ccc2287befc4c50bed2fcb7",
-	"73d83cc25fd4bd2ba5e2de905bddc36ac07189831555b250fbb711ea0d86150c6ed33c341ee2513ffc121a528f4324cf55242559b1c54b89a3997968ba3ca6a1717965b69fd4faf69f9c054fd98cf46fa6dd5a5f9cbcab5d67773c946a7be783b9188287e1b9f616af9296a033d75eea0af4250b755147454736ebe70b9125d1",
-	"cd6af963d9420cc6ee25b8285503731e2aea5ebf699b1cd6526ac2f7026a68c97b1fe18336f0725886b55b2f9d95675de382ebecad206ab6635344caab3ea7a1f1c1b6d306744be54de1f84021e8cd19858dd843ba0828ec141b38f5e8dd012ca3519022bfb8213b526b6bc181b226dddf3b0f9e165a5f06c7cc046072e75539",
-	"44d723d4eddeae0816224aa8506c751394aab7ffc6a15c76cf6c1e2d8fae3ee2e57939fe59e9ea22fb287940586e054214bace27ef4bc5138215c80fbd6b6aaf3082129697fd898d5614b832be2affa4076d89fef85ddfb9bcd55a93bbf5af079fea50cc8268299a06c6f17c5c6f53864251bc36e87e7e2f0733f682aaa8d1a1",
-	"9800b8b9d3aa45b43485e65a7679fc6c8c1fce9f116463852ce5e3627e2e2c7cb7cdb415a5e2a0cdb914b33b82cc1d655db3f2cc36d36e2f2d3ed3f6785ad9c00b3840b7b6e5e55ab6cd98afa45b0449bc462edad2752b3f0b64a95607748b8ab31ff74f70cc56ceb8ca876007e65ca45510d0f90e823d90ce48c1d796e63a13",
-	"787927f0ce34208634f11bff7089057afa074d02e5733a1cfa7544f3dde75201d104c5df55f500a9637d6c70e28915f01ffefe61524b9242c16cb5be207fe6eca045d959d6c54b62f276af53d570c14b14cb7e859e6b7168d96a1d33b21318f985d26d98a2a4981401db35757c2669415763d30f039fe6f1e1645a87a09f06a1",
-	"1f241e15838874e56038763af844b19735b7306f71b87068a2d97f4064ec420be28fdbdc9c6f65c3421744a2631828ed80f2608384998923fc958efcc3d0f230463f59002df8cb213a0689db05994ef909e976338762b47899cb4eb69a6b3f68363f7ab85069a0f97b74e4c14127ab62fee18a3f88a94125821cc43d81c7e2cb",
-	"3c8d7a80afdf808f3d8cbcc5867ef46ee9702c65f9266cf0f3e2af0b41d43daff958df745d02118b4698ef609da68e47a17d8e81b4d2f7997e18a9c7d7ca3bc9633789dc8907c18e88776c761c5fce1a286324fd1b9286bd9042d17c4f8766875bdf10337d2e3b50da8184550e368aea9be085c9a0f02254058a3d158c1ca119",
-	"5ea1e55d54253b982e7242c408a0e665785c5b7d3de29ae44ff1c3f0294c9ddf3a9dd5593b04adfc45eef7d6fac99f4497263a2973b1af1b40453ebdc3d91c59c9d2c57e5215b3f40c0037b6f1736fb5ec7586561774053bd722305f03071b5cd2ee17f9032878e2c5e1d5ceeea83b47367f7fb671afe5966c92f86d98c71fed",
-	"c965cedbee911cf8e5f31cf670ace58fb0dc8fe0f438f67575c5e8c75d8c2960d97354805601594a428139854f274fe799adc93fdc5fbd90035ab5bcf2a9ebba86d5c2784a41f6129bd63eb76ba01fe8221af9e9f8eb730c145814e3e0789c78af8e4c0f8b8e5eca3183298080ac5813d1c449a1953f58531bd5c2d01ad0a83d",
-	"959029db70f49f9f314d7f0a80055590e58304a6b8f8e553328bde9780e63dbcf982d2026be076a7af174184328567a8ca178a190aba36bd38ccb7b6165a3719ba0623bb128c097fe88bedeec1bc7212b333ce45dd4a493c62beaf471e828271638adf8a856ef037d6893254f5dd8ee6cf39bd3db081836673b7fdbfea5dcb1b",
-	"dfd2bf6f96b516651a3ea15c6e5891fe1060d8a1bd09eae329cf9ad1b9acaa3d3109604b82b6875fd781d0ce8376d9f2ea0dcc0dc1be14fdc5d9b435501a3b4f4ff021329f8533cf880e6bc73d19d1a79b417505cde676d7d9c58a67068f0ecc0c744d1b97c96fe98bbcf065f6fa94267499095ba5da57b4f03450ec5d4f9f1",
-	"337acffc0a8ad19da9eba9e204c7740e2d44599a30ce31b3de7cab1e720f15c2ed71f4889c50fd3d46a16d03407b76e668974ad4c36cb67df8406b0dfc95875c05e5b947510d820c677aefa62c029f4c12942505610dc45c37d18fcabdff49ef22d3d021a49d0c472a62bafb0d15d837679ed630d15108e0ec1edb457daa940b",
-	"5ded0aa434065bbf49c401a1f794c8f6f562dc76684c755566ee09eb0ccb9e68ab9c1f6bf151102cbe48d0a6e8ac32410bac18de907814faa9f04b672431a12b99d6a48005f02fd679cfe62b90dd7a006632a5cb396c56a23810ecffb868ff6d02fc2ed4bceaf9be6a361bf7a0b2019ed728a1a29dcbce1127af1debd52e4e6f",
-	"a7009e072160aa6eab54e30406cece044fe4cf4eb67686317f53aabcaf642c291fdd7a717db0d086e0031ede5b94221617987231f28031e5eafe3b8bec1646216825a59f3589abf6d840d165e58249b82724c739c66ae28ee46cb8f96c96c4d59441465605f87ca214ac7313a80a9197ade61bf76c5c03dc24d61a7466665d3b",
-	"b38531a1e4a0155c3983a464387343b9009ec0cdd503ff9adcf8d55d30308abaedc9b2630d23be02265f3c5d8847ab71d25e5da0b231c969b5e6cfc82b752d23eac8feaddbbd2b213c3cacb5060c2813a0ed9bbed82222f0893f2203d104609b78a2c585820c12e34025524e327083ce1f17d211159ff154e474952c8af72515",
-	"464f61199e4c3807063bf1b7b8a6fd7f734086e40f8d30a60ce3c3ef1f61491bd9304bab98f38ebc263d5977e4d6e0ec648beba734c44317f8eaf76b0cc2070943d24b794f16c6c31b794aee9fadda5e1205c6c5cfd043a44978da90520c7b3532d73bf446f2dec39fbefe0d1b0ac373e623204efc1c982ac6b63ee8a3f99d8d",
-	"b1472ca91f4fa7b2e9eb4c85603602f4a7b70ca1dd7020563044a394e52b2b8dad2d9b3c3bf481a85f49d41afe4d27062ffbaf29fef973acc8e427b524338355bb8e08609e6c6760137de986c0f8b93ef8905d66efe729229bb5169e291c7100c77d4399d9f208ed7f1fd1b6d3fc67c2a314931e31e2b75c618acc58de2caddd",
-	"28c47ef408e66e5a05358eddc8eece2736eea49c2c88be5b7656b30cca9748e553c7584aef2d698c3d324228dd72626d7dc6a5cc64d3ecca30db0f4d19b445e97967e9fe8b2ca0f5f758489ca1072129ad003cbc6c14d2b6ec8e19d0fc62ab8eec06ad9eaef8a33829b98d31b5d0409a2cc3d0e77780e6456b1c0ab3e93fdf83",
-	"1b2647695e1976bbb22231d954751e34717a1043e5c220b8cd3e73cf51274b9d1f143c32b5322faba85219041c2dd3003977da550e29a0ff8dd97f2d153a3995210fa432b81ad307f113edab6bdf56fd319e47eba441e37c8cd746717689014d14c989045db440d60bef50f11aabbe16fe98c70c75b03f347eee53e88e075425",
-	"c5516667c4cb435ea02442ea67c458ea24b6720ddb4e13b247f966435a7f8999727694e04ea367168dad20887bcd1dd7ca4ad749653d0acaf163d95f90d4b24ac7d6a372f192433a93d93d64c00dd0a66c7f9485eb6bd5ac4480094308fc63c4426b1ac88f815e39ce4abbaf917dcc3a54a48b9d6cbd40af129d187fbd5ec79f",
-	"60e8a45770deca43b27bd49a548c168af4f2090aafaade5890c6a1f268c94ac4ef8f1ebdc2064a9be078155aa813541c4e3f8cde133ea2e642be8658c25d098263e911bec1b2bac1899250e4b3cf271c95043b1b79532d50d346c256a4cd8738fd66c5fb0284d91d80bd6b832d796467897b4a6a6545e16871261932e3c77725",
-	"7d1cfa4d46cf90bcf025380f862301c996cecf9e75fe5203c3d82d34171be8c5aa9556e8c0e65beaaee616738831405dad202265b2baefcc455369cbaeeb7f747ec4315ed58eb15eea355346f664fee8f53f588fa16670e19d7ca8f0f40e52945d093054926d9205c9242dda259e441077785984b0a320897afa8a470806c687",
-	"b7c776c78382a0ad1f20f4ad39ff8989b81fd340365376afe35a3b6dbe6417fcade88e7dd8de3d2e1fb170e602eafe9e0ce42b9d53db6e3b948186b104c8ad36fa3deb08871659b8dec912e439af9c6848bf8b9892d218090d8ada6db62a99d5c489d713a3d9cb8afaadd0432a72c61d60357c663b65aca70e1d51e22540469f",
-	"b7a3a01aa34f8ab96590c7d65cf943a1295a14708e650aec06c68e0ec9a51d9a9ec255232707604946340864552dfbf12024e72b35a855be5838d801c498bea30324e456d48d57f258c46d349441eeabbb97cac324205c42c1be7f89f22f738e0fd4c07a61c5e10b03fd9df74ae6880f2bd206805e8ef82a9374cd8dd7dc20b5",
-	"7f06298ba86b2840f534b28c7bd01a81de5f3f7d4981594cf61b9c7adf1c06ba9974bf8c7d6a8f6818c2b0409fb0b4431c862d37a44821a758286b13bf1e274a4623b1d44056aceee29f5f94e2bbc1458e9bc5b2efbc1ec22954d2f2fb3140223efd414c2b46dce274870b5333cb864722dec94191c4cf087079c9aa6db851f5",
-	"2336f75082952b38bd193d29f269029225d53e5ce38011794ee22f5045f7d2a1afc89cbf6ab0a7ceef0ba26586e0393bb8ecf358f37b27bb85424ac14d5c5e5c1bc1b535c750b2fc33fc626fa49a06723e12fdf6418bccd3abf5c56a740c506ca11e4546867a3f21c7418960f6ee22b1b080afa2373966c0f6e0fd203d8272ab",
-	"cc194638fa73fde5cc8b77cfcad97e927b62421553e66028d2e44ed95c7ef52d6f4890b17c0c6dad260727de4794bb4f6f2dc571b70f78eead21a2b8d943193765e7d1b993b87aaffbcfe44b65364acfd87780d48a3cb1298693e31902d0681318c3d142d5a11d80045f70f754a1b148db68708f09d0e1168d5ba73ea51596f3",
-	"3aceefc0b52d6747f7b24a805f42f06827982e97e7b0234c9de5b2fc8021ef5a1105953a505a1520dbe1e2c597ebb88588ec82f4ee90b7071ad5f109e5fb885ddc5eb04bd7adee26a76f25bbbe130c8ddac0ffdb6ba3bdcbae2af00f0208db91f4997250bdc904a6b351905e2f36223feee28bc06cb870ce586ac5d2771fdaeb",
-	"6e5f24a5f3c72ccd3698bb743149333adc66c09a0bd5d2383aa5f13ea3e4b29f4c053d5274c6d53c6a79c6f4eb3c2838896fb390ec175abff561f61b46b4a63ab06d4df4e7a721da92ad95603d1fc30087e27c55a381a8c88bf0c8877a587cb024b6c0e9ebed7bf9c4c90e65049d7c74cafbc03214374485bb007a26a18785ed",
-	"80225bc3a749a9f2d775fd6a70dbd0dd2e4c19037864e6debf39c4329a56a039b3591dc475d22f0ec60eff66ac0ba3cb73296b12c9d13e5f4299a934ffc6621dd060a8db15697f9732852f91d31fe2afd8d5fab399fdfb8e3bb84ef89dddeda33622cd65950bbe6a8afb185eee4b29e640695822615ff03502f9683cf03b3e35",
-	"b5d1f6848808a14c51e7b3570536c652a1025d9bdc0abb415068818ecde48d0ca32f882ff09c0cab4f450fbbc52cb37e82242d4fcabdcab42254c14a24eee4759d589f6832ee98a448efb8fdc1fe4d79869c6c29bd49519f77feaa4efa66df06724128449b7ba8029b4f25089fd8aa41f561ec4ac7253a5203bd2710f90696b9",
-	"bdf8e2f93eb158d9983a243a5de146950a0356c30558e7fd1cf622410e5ad81ddec6cadb9733e2e9fb6bc58fd708a211d049231b382a6bf5cc41e8306a7c67d8735a09211ac15bf1d707bd27db0a1cede271839a6b88b908669569cc332575f58c73fc383c58db4f65e324a522a5c6b83d8555aa842657f8d22283a1e5a1bf4d",
-	"7c7a3119c5e71b9b73d77688d6a9f02e0582deff3fa20430dc13ced78a6f8f6c23b0f0841515379f7e8b86b6878e8986d5809e35b161b956aa044b7252f1e0a4c59df94c94fa7f6ce8d6de63b8d625de856a17a74141d1263d100dcb98a64d29d1c33281704bd7511b867b7ecd77370d633bbd66c313ccdc5b11f2fa5a2a4645",
-	"a3e16e5707f8c7df88976bb72ba754e7ec4a7193161cf054847543ea589bdb37ccf8753c7e5e20844f77f184e20fa46f20e1ad51e4e06bd8f58096ce392ad395fd592e2a6ea1e7507ef51b394ef44214f37574771a74ee3000f7063ad6b9712d180af204399b95a946a1c430a7be992457c6b3b8c81b8f9ba364ae53d80300dd",
-	"addfa6de4ed9d15b5b1d69af355233badd0d0a1068a01db85e31a07e5883b8a059d03b0eb7a79fe9880cce196afe6d7834020414be7b78d1b9177899525ca7aa1166deaeb3bc029f26694fc4d5f4eb8f71d562193ae3c722c26a0c72c0bdc3439cf1f462d85af1b610432a0267bad692b8990f1faecf7c50aab69c104f1f2e51",
-	"5c35d7eac2ab5b43b166a008a902b8fc1191be82d935fccd4d9773c4a5ae36404595e29516202b3b373c3eb292d31cb4bd2cf429dd3ecfb0f7ed493102dda2d88f3ee2482b7e65cf4590c382c7bd64c991812625ebc12086b3440bec0345e8f5af9657d013d4c177fa7f19ff0e330c137259eca77f02dca7918626f68444b303",
-	"ce87550422a831ebc3db66bc27deb05b1f4d5e4213d8652278d3b0866d5193ba23cf82653c34bd7b25dbb216df73eee346f105fc91230c66cc50987dd5a4302e9fd505e46ce297dc499adb7e5405deb007db3c5f2c8099379503d5c72d1c8ce29106d9adb483181942a77f55e0fb0f4b87f680bc80bcb2e60102ae0359c3d47f",
-	"c057e8549a15a5e396792e0b8e1442099bcddc546c3a78d7ec11ea2d108b7ad4345894d6449b2c7362fabc47329fb0eee10102bf9b55cacc6e4a922f7010a868785d3d44e02b5aa7830dbe5b62508f59e39feae102ea264545cd030887942e570affb566f5163731a95d77286eff87b2bf46add67b19d7fa5e5c85fcc7756735",
-	"34596db72661cc78f1bd20e8a96e04ac2e7e14330a0e35765d86eebcd023f672bbd219e1063fde293451b891b382b7a1c2c1dc5864f1e30c5ec1d3801e387292e935379e19bbc97ac275e54eaee8b0b93b330649966a152220e4a712dbf87a8f4aa50b0e04eab17f8ea6d79e3cb1bae21a1dd85d5a82abac0885bfd4e88336d7",
-	"331a2f29f2061574a008b4a0f01f771331eb80f5ea3719de201b19dea7f60695115ac3a8943c18ac895038a63866fe01348c8882b4b218fa248d6493151aedd76fa3a593c94d5fb58b7d8c1e05a91f7f5ac832c36fc3420e93870fb367a0ae2b079f1f435929c60306d42d1104afbdec8e121390fa23e6c9742647de27d71c7b",
-	"3b30f7b010c892fe23c99932aa79cdac08ca97f38cdbe14396326cbe5d986cf00ce91e02a162a53283db4e593a11f890eefb09161ed3ddec75c9a8f7b7b2b6eb531382c9d4c2a04529b942a6d4a7d3764f7223cb477ac8f63adedb9cef540acc7f7b6ee5d8b0b69cbb808b1d12ccc0a2129a1682b0f3c893ba2278d575af6229",
-	"6a1933913e5447a372763924151e9a59ac5771b676807731e6d0438516ef348d762589e4db5221a68a8213db9bfe7c4ce2fc37b2f3a1b49995cc5a4855ee4abcf03ce21aa46538a5b1a93a4bd23613500c79889461d3a29f8efd17a54a6e61edc8eb8e15ed390be20cafa29deca01cd4376a9bb2e9ae4392013a94424ee37601",
-	"3c56f9f5849964b98a054ef11fc7db7b83aa08b66a1d9a8e4549895bd78eb06cdbb942b016afb389071a2a8f18a24137f0d1f2b5b7a6a0d8b6ab48b3addd4b68798b5e3bc32b8170384d4ab65bfb13cb3e3027332569d3bc8dd36f279fa7cd79977720858c3c19cc3ba24ece38d82e3e620c8e9d3e0fbeda520d5027b389de9d",
-	"23a9f2a16bb7a261db8bd36882ade311f22286cc24ee612ded1f8d5f23ac6a29f5d103fbdbf825f17f799f0e8ef516ae6e014d2fa38841da32dc10a71eaa251150b122f459ada603f4fe11f5145c85136da8407e1bfc38754078af4e5453d4d7a2d05d580bc96fb434ef7f5d17f6ecdb34760bdeb6296f173f34f138978e8419",
-	"65a68a5299f9ffa1cb469e44fa406872dd026dbdaee164d2ecb933a451b5b801cadb27a327231d68176cf8d2d5e6e57184ed1ff8c1afdc7b2f72c4640892be847d51e6575e7b4402930a21c678f66ec400928a85cce5fd1191491c2608baf63a646d1a73226fb735c9430f74eafa4d82fc8849fdb77631e3233e72bcf0de50bd",
-	"5c8b61109c2f8e776174860409bbb4a5ca8e733355db477e49301fb208cac9269172ddc03f748de06f6277e954bdaf078fd96fa993e1d5a0516d908e4dc212326e652f75847517557a109557d96ede6e3e3f842567cc5198951862844e0601c8e5734f207c342d49f299a68267dcf0b991eae36e719dcdf43726e3334f5a7c03",
-	"cc0766c388a50aaae8b12b46f37145745da3343db9186be10b48e0af35b93a1def320f5a0cbf0bb8c300be28713d7ff23690102144370be19ef7c8e5484dcba6ea4e6d7311063b27d34e359a263fa392afd59098f365eb92438a4dc2c73335c8536d2181d34514793f61a33c6601af8cc8be47ad75aef0036120dc9ef2a8a955",
-	"9596bf9fb6085b601ca31861167fb7f472fed1759b0251611fa0a80a05afdfe8503099280a9e2beb25dda4db58ae9d7b7ecf807598004a5df4c765f08b9453084962d1663da9618c87e0e415a60a028b41650343b07defefdb677efa6c1572740784d92959bda33c207f67eefd852fb8fb942f42e6175d98ac4a2686203c0d01",
-	"45ebecd08da6ff4493e2b3cff6607b8594d15f518660b39b944e04962aa519c73c5f92dccdc3660d230b9e2ef477ec22080376c06daec07a4aba81357c98e3cceb0eb8def7a73a47215bffc0bca2c06bda280354ae2935ac38686c130805f001da6ecc11c8f2c67d5d06e75a4141273a2ac0cc75dc634f29fa7b07329d791441",
-	"354c9cd8d684390ab83f3ef4f285102d36ad546c0960ff9220223968c7e1eafad7e88e750d80a57a222027ee69ba1daaf953e531ce5ebc4565ff1d80b5d5bb22601a2b14315f626e0fe0c0523b930340299e2196bd2514409e3686bd4aeca77351223697f784fe576cefe326a2b909b55d7ce24130054038e592c1a525434be3",
-	"1185576860b49858ac339e7b9ee8d128936e3ab615d6ae94d7bc50837b446b3bd1922b69855698be74804f4d030f4832954acca55f5810040d35fbc3ad3bbb7d81e9a2897870b44652c709891952d95c19d36aba65722d663e26e1cd289a9d466bab00fa60b9af8abe522dfb4abd9dfbca77db629c53cc5c2bc519dce294a5db",
-	"a8b7031d4ddae8d3a5c0db14f3508164d374f74870f761d37c79692738316395979f7b4874d2d7d49cb173697bc12e1dd5b6d4d6122099dec64de1064d8dadb9e0f1fccea3ab54481aca68eab65d967b1797c227c937d5592abf17ab1e7f5ca3bbea9e7dbd2800daf140ad35482171045f14373fb6124849dad352c66f4e2967",
-	"5a46b46060f06dece4b2491391286f489b584356790c334bd9d251447a71ae4edf8eed7e2fa3a124657ff4743c31665f66ced45c35dd46b8ada2c2a21f1e25cabedc96ff8adcee79bb182224cb2846a0ab2df6caf3c4589fd63ef963f950d582c789edfd27699c1d456a8f39ff4c2c40c2b0a0bb624d87a8c340398bd3a0f607",
-	"28e3ed1971ed4f87e5563373cad58d3b4b14e5d29986841b94cc84bc338f0ec03f15f3d3f404235f213f1f9a2d875a949247a031bed0ee3dcb9ba8b5fead5dd3d3a1051324dfe70418376ebf3c867614dd5d7fd2ba6437596f1f7bd2e713c6b0576b739fedcca65860802ae9b44dbefbd0b75d1f34e4c22a73def133aa944e49",
-	"1000c3792136c6dd1ae4ded838b096f6b0fed4b314f1e21cd36e594574682995438133d94b1e8d3d3ab444e28b220d301eac8c213334c0b7bda033c1614bf2da5cefe2fbc01eb960e20518d887f18851fcdb3a20faea7902bd69b8a5d0ed07ed703d3e02de178761c271cd3f1ad7a9bdd8aecb6701b498245991ec0aa703e5d9",
-	"3c677e114a8fc52a5dc09e449b65d3d3d960999af924737536a094b4a9c37503d12172e01d63f7bdc62c5289c3c17682dd2733a8165480857d89ac1d20f8a31fc3e23f8e3929aa60376fa38e6ecd296236018127a4dfa1c65f5105dff2074415450703c04aec054207e948cfbb9e21e6afd812afd66c021af92349746add9f73",
-	"5f48594adfa77e18756eee52462e7caa45e04ebb324971fc790255c6b73871bb0effb76d76462761f601958a446d3e971efd1a9286e0c0a2519eac684241d8ddb7352190a419b94d5f6c19881ff475528895e729e082ee7a0b15d1a54e9a631881374ade31ec03b3ef91c2d248a1215dbd47d33781d418c58fe0819b6a921f51",
-	"712ae90e66cfb0f61d506fb3b744f953cf3706cfb89eef3bd6b05c95c041cebe3ab599658c52be91e9a5732757068cafd7fea78a6cc58b4161754f043b50364020024812dd7231deaac7d3d720104fc96227ebe3d11de62c875de12b05cce48a2884b4033a1951c3be23fc362381bae4f51ff55fcd22142a57f59b0d8f30a1f9",
-	"8a1aa56144aa29b8839cb32e125546b23f312fbd9ab621308242030887d48e084e0ad453790748d740459cca5a13bd294c2ea7d0bebf1ae268d3e3a880d5815f73d8ec3c84d048eaa26e3aae9f503dad850d2843d04182fa21b455b629541c3b2bcc9d3b4ffd5a91ed1e482104d4efaf1dc8fcd77a7176ce2cf855b82eab490b",
-	"18e0947cede25ffbf9d8089985eb5b349e16e3e18de6780fc1d7c8eabcd36af94a70e5c339a35b8005206ae08a71d3ae13f885d825c42331004cc269bf30f77a7223f4cf8c19c558fbcf45838a56f53442e996035a62393dfa5ee2f37bd82dd9bc405cea4d9a862824272d4434249b19953220898b6557932f80b1e4ad1d6b99",
-	"75f4d81fad22fac8dcb843989ce6e8a0b6419725c0f6d40f37d47b2e267f56cc5c5baf764ac697556bdd7e6702d949c5c1d6c3abd5ed14a1c264d27a9606b19688a998f5127a0c2ae7a80467ad088694bf8b63e96ed4263f6796582517b19ab6792ff36fbe162b0d12eadefb3bcb4cd367d00c14c1e563ce1f998d88a44c9d85",
-	"7124cb49363ce351f6835f96aec6e9a2de9e40398fa1c32796246ef14ee1ba9b431babb0735939ac2d6fe62623ba43fc95a685593f28424b056ae8a8758ea5794ff1237e4f428f7bbff8991a9aa9a28ba0d2bd6d5977a8e4a7132c2b0e9cc03d43557862b98ff2de414ff40ae25296e1a8ae14c07af2c077c6834778301386c9",
-	"46bbee7d4776df286b7effa48acb2479334fd17e1088b43292bf92f14fe4e3f6c2cd53e19c49a82203470242d6643d8b0c006a7675ce28f89ceb7eeef9af6f732fad3b07ecac8164ee74ddc7758b4f922608ccbc02097cd7361ae6e7e271efef1a11b923ac82e50992dd4377cda95d395b379cb6090c8a00b18a2d70d15634f3",
-	"96d5ba09dff0b1ba9b59cba1de6cbdcf84d4bc528af1f79d069a57f25634083393703252836f64bb7da4179e1831e2eb1422908f11896ceef2f42248fca9400b868c8905f0039d733ce6514d93ebede7697cc845111095f1bac48d07dc441a4873c9c13970d61d18cc6ebfd73c527518a722c1fb4c70de748ee6e1924ebc317f",
-	"bb4186408c3ad77569b65b3ae864ee0999993bffcabaa72b15f50cb8d2b1892c2177ee5b4f9c3b49a368022c63a3c5173e7e0d12a16bb2105dede8b36ec97cced01334d88f9cd8c196df076006b7c1198361fe8092ec57beb112deeec8c3faad1acee259c6dc877b4839d85d4dbab040f48276b951554d5da18169b5b789efaf",
-	"54b691dad0c5816d715c1dac9a427e0f72a782bfe02aa964ca8d0d4a47cd02cd92582bc27f51d04fc5138b896189ff21744babb132a4dd88635ce612e49fcf7d2bcfd6361705ee8a0021c00a6566428f043823526e7b13e264be859dedc23e2eb8bb22a0da285a818bab34010ae28f48db65b182f266e8be77effa26fb24670b",
-	"c3d9ab029145cf88090ce3e3d4670c1f87507a79a5584888d8db3dd554d9c3ffc95cb4112ae4860692f252016d980d727eb2b9c95b8b13c55b14c57f6790792045637c4fb4d2c56d40a9c763c663631823c168456b8d00fb8ee5e6b70a937fcc5a372c4b22d540605e21a84ae3a9aa87ca433b4918d81ffa2e758e950f905d0f",
-	"54d6f85ced0d20168775786975c20c9f4211d91942920b84a9945e6d84e2e2bfed845ae45f323bc94ad85400c9cede5cb10da389327553199ccc97c9ec528d9189f0407919188abbc7cd60c058eced4289beb1d4ecca0892e03548deb24fa8d0d1976d745b268644e8f22a29714fab2183aa2179de57e6237cd43469ffb08745",
-	"51abeda29340118a28be18f096ef3a939bdb2dd46327d88a9cd4140292e47170ed91e570a2edcc443461b1ce5278c04d3b12664bfb4bf3195d4ea0e0367f8ef46589334a6e72c1a4d1fc39b54188d3d7334a7c71a87ca92ec23c499d033b8aa289ebd5cf740185c7e01c16f174e5a593b0f1647614930265d4757d5fc6f78e97",
-	"46b8cfa155f351ee573d2100799a55f2bd604a81b7b9c97ada580dcaae0296a16c2201ba7f0a4dffadff766164c9d0965f97153024a67f434b499cb86f0cd4c6d8b43dc8860e648a0b6795feaa1667461600ec156922e06eae0dcf0365eea477013c4d770539cd28b65b78b6284609f175e300119c5d1fc67d3c57cd1f14e73f",
-	"9b832c8fddb66073d15028b1297ec36d2aac9830343a034a8b69c4f3192734770ed11f7fb22553a2c68dce11f7a6e24037eb1d2a65417682ee65ae5119fac14a35d55cfcd623f333c4d5c87a29fc6c10a327062518469e0bedf6c98ba94b7ee225730e26f2561bf3059dc246b39efe6df62e2e2c8f1065188c86873576d297a9",
-	"9e09222f0c69530f1becb6d240d56d7a6926069a22fd87347782ed7514fba8f97ced049c30ae108f1565eca08420ae05209846b8054a874eacc5b0e1c793f488e6614eda07bfe3a1fc054260e8a55826dd956668dddad2f7c81035d0ff6b281eba3adb59102beac80ae0574f073ab77e88b31e2f618eb6bd7e255e55a2400bd1",
-	"6e3183c43f04a0f01dce72354785be816f6dad4f4b526c91f1ff8d663955aac91f1ca49729d33fe2e16d9d2634064604a99bbc3122e94ba4311b6752561b38c33523ab0a0ca06790c6e239170cc6d2691efa55beaa39c8d1a9cf8b02fa8b4188275165467e62723de09fa287fc8b09e4e8de0c44f02b89687aaabc86526d82af",
-	"3302f9e88884c6301aa14dc02db1f16b0da7ddd65f9116ecb11fe74a3d43936bdb5816c621609667e0149f945611f5968fbf95d1e0b824be47668678310013d752fc8824874ff2776db6028cb42aeeec105ccc0e3c979b94079596bacf138bd37dfd328f3de4a6840af68a350ab792855a0b01bf430497c665256cec3bb2ed81",
-	"a2eb65fdcf8af4faa0c8d78382165a994045da28bb37cec500e5e50c643e97b3637e8c8f405b0ad59e5b9d6103a32d31fd63a3462af52af5835de6e48db6f7b56383b23e0e59ee40564e8626177527e2889f9aafa0614e43c09a67820eab71f3101b62837baedaeb7a114c751ea62e3881340997da875fdc9cb0e5944c517a11",
-	"3eeeb4f40820d7be846dd448ff60b1569eaee73365dfa6819a909b36f13682fb36a4e49fd7111f7b93d07688439a0515a97278eb1f7aca426dbf96419a385515d6e9ce97e4edbefb05f04ba5fbb506315ebed0692313f3a6ced2ec496b2fd67d43b8c48ba04e36c9285cc59d70a141e68bd1c635ed4d3538dfca521b1bc08361",
-	"23bda83081bf3a04ee814d8f7957683de5b3330045107da016fae34d24ef2d6efecfd4ef136e8b933c201ed77d244edd388ade53b5117a5f829a8873aad121d799e717ba1561e4d062807f375930524b3ed972311e589004e1cfa2cfda849ea8f12012b57fd0dc47364185fb2b696aeb16e6039cb4663c667d250b8cc4fcedb1",
-	"9442196ff3816e980dd9e68eab2b57eb0eecf54509d1b8461dfd6d4d27ac6d5f01685d37cddcacdbba3a754af0bfc500f4ec1f0fec2e834657d9343b3ac9e8ed1807b4ae3e5bea97fe25aab2d24c9b4f0981de9b02a566e434258fedd0928c5015ea584ab5715979e6eb732e7da812c9e48677c04fb7f09532817777b19f0e93",
-	"8a8eed16e4a7c9e49046f94bd752e93b693e2b761f806bd26b52d213e30eaa9b47db0c61858f2870d7938a0a6b6aa0d7380f83137facc59a095a8f2e40df96c4d8aa8cd070857958c12960dad97f6629bce49f39c71ba036b5cc8449468ca93c2d4adf2f12d20a5e8a421dc197ed5500c4946ca1ebe140476f8e4cc3199fc9d",
-	"c412f266c79fbc610e17b9bba7a57727b853373533877a03da5b55df91d41761590a7e94bbed4c08cfb3804a2a83dc33cb3f22c00bea9ae5da1993f6e12f8deeeb9ef1528406b5bc04cae8769588583d566432def29b9464252eb2b527504d97ffa6195bc7b7b02596ae27020eebee58745aabe08f7515ea749a49873f4cc24b",
-	"ede54cf184531e645c782c443fc39654ec36568624e93569312e0516eb2144bbd6d628a38e4abdc56cbe4305f0aef8927411fc85e3982b3d96e8270cf40ba684bbecf1c4ce4ec8d7ef729542aae2d53522b7fedb4870a20eaa492bba38f023ed541a478bd6a4e7a29ba4aeaeac4d2f15735bf86fa9f0ecc0ea632c3c186236d",
-	"8088c11fbe1421838bd1aaf77ce95f8714b22e2320f16d98bf5383f6a3972c8db861cbc7374a49d28d1e726a68a798b8774ff9bbe9b0717b1dd559f2b11aa712c544847f3a2ea7277630964f2f518d147004f59b973e99dda67b1f125207055fb4974cc527666f9b4fde51db6a6e139534b02526b4ae4defb315a5601faf9d4b",
-	"a8478afeeaac2564abcf8182b5eefe6b8ca7c0254a56dbf55599a1b091e83011c57d8de8eecf469f8b4699f10b7f89961f15d757d5e3f970f11fd1543baeef6c54869e749eebf3bf40882fc993dfcfba4352fe3247ca87d3380b5710238e4dafb0510e473984e728c4ff3f37fa762251f7f099bdc350bab52f09e6329d5aa289",
-	"5ea98bef9d39bc4e6258ee76ea5f7e3caa2c2ff554066012eab3b1746bfd750a7a32dc9ed87af16af2d12f102f90672a479499f051761c7c32e94348c4e98edb93c27ff68378d32b35cea92c91731aaef3429d006583cfc30fd4d57b4053214b2768161971a780aa6584ed12ade2ebe5b8249d37ad7a61a438b416139f92cf0f",
-	"c538e745dce15edfac32a7af912ccf02e0ace3ab14dd4c5487f68a67090aeb8a2b87da28d9888a3ae23f9667a05b685dcd2f3e3196c5e1f4317c9f26b8fe8d8102809085d7e4f0a7252b1f6aa58024df0ada0a79159b1b5a26f5abf37f9edd20a10cf5fd79c251eb8e99ce6af3fe73675caf633fca817c1b6ec2c053810a6a09",
-	"144d367edd9c6f1157b5f1e4fa13daae3f02d3d2ccd775050b47def934c4885c8efa33aa5044b019b3db7fd675246b51f9c56ef355349b344c36aef1e9b44fccbed098b8b54fb88800a948dc432e00393f9363a3ff7f9fdcf1107e2c13acf3801fcdc358ae5497f5ee53648554910f949befc8cfa0ef015fca62a2894f8e0e17",
-	"4cf46fe96a02b1f71cd489611564027ad67ad59478b3d4cfd7e28a21262bdf9fafbd02d8e0aa18947ad10118148e573a23e4413a26c5c2338c581af9959b6011a2d55be504e48db4887e0f5727b29fe04610a3142964f9ed23fa802d4f94da7709b357e5a039b8955abd096276177c1ec014fb284050df15e10d2749391b871d",
-	"82c6443e6266416796e0effe79666bf94e2b1bc7b88ae891dc557a987b7fa6af12c4f4e83b6b4751897451a94212eb0c1b2be0c848011d93f47879cb27a78bddf372dc5436d9cd68fd19467a88ab06f89a9a8d08b9a84b950bbde2ee9d92b41a2074fee92aa8828ff87e98ca0ec28c7fb1342bd039260cc074a8227c6bb45899",
-	"84224a6c7f4a39225033573cae5a4e51f2d624098aaf46dbd62ff939961e7d5983c6c6defdd316b86579881ec1a9284949c9fcc4e11123db074b7f5d6340247f9b0f563c8c318adf29902da53c71030dd2d441ef43a9a22fece24086e11ab77a56372cdf2420a465d63cb889c9a24f758ecc4817b7c91b6574b73cc64aec9945",
-	"335ec26f61c8b1df434db23ba0503a9cb27f2721ddfb676c0c812b4b7d3d97b593822f56ad95e3b32680dbfabcbb1c0ba0e7d70f3696dc5980c3fd4c80e20c1f465a1b774d9c868d5cd6a56bc72a6270c74af346b4c88e01b6e87b768a6d6b9e0bd449dc3534fb38aba4fbe4182028af7236b81c7339c2714275d1b20a48e887",
-	"5d376e53648d5c910090618266f233169caeec120f08689000d6bdee259f310a8b0cc39977c3b74380b87b6f182123c39ad58894f58aaaa3568ef4aad0b09ed321108e6eecc9127dd2129787d12ae13ddb35ca35fa874a7f01cce3d9f1c0330d846354d5496c4dc01bd71cdc252c11b5e3b1cb671691281068af9a7406c20b6b",
-	"bd40ca2e2850999485c9ff5a78cd0ec248a36f134c9e18d5821022ed746cc6633b7c25abebdf13d225ab81cac085eec240759d68e972183aa960ba3408d448504bcc929747029defc212bc5e84712e34d70392bc2f8e62961db8f2e6f9dac693e67149d188085e19ffcc44e3667fa8e25fbbf1dc1114b27054ef691920c349b9",
-	"a586a630d57ee2716210caac0987f9fbf87035d888e055b52ba278ef3500e8954734e439b89b6d273aa509068f2997d28dc670c617bbed19502a85bc8b22f7f0bf50496a6668f0233c1748ca6e5b1199f7cd68dd1a46660c4a8de235393f5b553d9c3f5e87a3506b5e18a2b33b9dc888065ed09366f3bcff2bd8f0822e65847b",
-	"d096ca38c114ef86d08b6249ad4cc0769f07c3e9f9f07654ed3c1860d88ac31ac6327e93afd1faaa1406ae8752f2b1b1ea83f46552b95ce18f3c5cc16632aa644393e51c255e59315ac5f3fda1ba92cc79c46b7d7ac14dd645159331d458de574991769c943320dce3b6c97c36810139fa540805ccb6ed4ddf8b96ad0b69c925",
-	"846674a9ea30e694f1b8193d68090a52478212ee43390371543525a27d15c384efe1077aef24fc651ceb76225623130f95ec01208f0e32195ff8c546e1ec9635ce7feb466b1ff97fefbe6d146f9d01054864a01b2ab344c5546e4c166fd1dce8acfff0c30b73f9ed3ad5d9b7f9ac46d7f7db93fb5c379846c02efe09316a9447",
-	"af6a20ca3649c5f9f4000e9bed7b491100a4bcf46d476e9738de961c0b60cfc41f5b33f6c2a1367a71ac8ea91c813b750c30215ad8bce693ccb7692e99894d309c2994b101862aff9dbe0114e16cbdf278b19b517a65bbe6d9cbd84caae23ee70eb5257c60368fa263596924902610e6285da6fd5eae5dfa0ae0beae91169c77",
-	"c8d89d8289b551301b48f045049c8540c50a000103a47a6bae697daf3e5ee25b9c46b18069fd8d816c6c469e37674e7013967c8d0e9d27f00f5f181f310eebbcf95012740557f82d695248e7ec31afbdf72d8561ab77bbfa969e5c1b02971b980d8e7ff3ba0b50b45085c26ad5ff3687ba4942141242f4647eb2f21cdce0b8cf",
-	"74914782454ece2e214cd3581254b8c7cb1ecb7ef50323161e41d2e2c3bc4c677a67b80479eec3f3a73f28e239b56450813cd62b9625a9ea7fe8d1f14ffd27a9297c9a952740272e3b040fd8aeaeee01dcd495908c83196d69fccbdb98102db6356ffa60439e366a4ebdd4b66f3755daf429a49ac821801e2d0b20fa9e2c11df",
-	"79beebae77ac6663a9ceac45b11dc93acc92e0ecb509541f04e3d0a85e9faa60b02fc42717d801169983af4cdef79b0421b881cf6269551c202c317377b933393dd2b4eb645b50b46ee4f689e0c9d372b769539664ac9c15d25185902d8b87ecd505f8008ba98a8107ec30a52f75d557fb322d6e7da701842570bb0083ec4997",
-	"5b7888186c05c925fd27f00b0e89c46c0a061cdd437d6bbd6a55d0bac2a578ef0cd3084f54c560d1736b870ea2623d3dbc8df0d0b67222e95fd093cdd6fffe235c2cd7f7576e0f959a504f27aff203a51e7c8ba3e2e2fdadfca6508322337de299a8678c3d7dfd287e792ddb75c09e97d9900d099f3109ef05f923e18092d8d1",
-	"62ea7541e9f0ee2b692c5e0c62827111c6ca40cd79179782e89fa87586b2a2a0735d46d4b4b270e531f5aacee1b852113b2cdd502c25f2cf4f40f5e28666d0460f914325d569fe6e92712c803e7434fcc1d9cf061bdc78d147866fcc6c9759b537232ded70e178648b3a72a53894aac0827d951641da0a131ce819e30a13eecd",
-	"312a0f8a85157c7f08c9aecd901da1d009639752d76e3fc6677a933a3937c12d093a51768584f441ae11068693ca5f4bab4e4e09357a6209f43467debd9540e1416ba4b5c597122a631d8fed76248f729f4a5cb9dd6e75d14afcd99d2cc4f0597bef75853e3086d001cd4c0c2f4427363f3a8dcb1bd8767484597fe5fafafb71",
-	"b8790d1d0ff807217c574fea7c83e4f39338e3e0ac82dd7ed5604309a9aa7e0d0eaa450d22d7e2072b54c773e84e7ea602599e5009ba5f1f67824d66660de3e0f5be0ab969e0e8ae1739b92ec6ce61b593058c26d46ac989bbb5bc69724549446ad8f7b102315c18270998700725710bbf6bf407ed3e1220484a1b32a52c9f3",
-	"8f1c78d04ce817d99601ff8eec719038184d10920beafd5ff21e71d7ef997ba68e64962152e8b4c233d4e55ad7b6bc33c02261fbddeeeb5f9a9892cb35ab983c75a5805ed44d2dcc69ae93023ae2981afdf15a558d4725a45971c5c376783bac0543055ee18524bd2c8b660a9cf213abf966751511b9c5e30ba0ebef37c5d9a5",
-	"1ded5d314a15af743a42a6a76f16479cce5997e4fdcd7382a36a9b2525cd2836e0bcd9a95dfb315b1fcf6a2e29c995d7235eb2ffe3200ffddd43932e456496990eb4d1fa60f8f3da1601d24a167d08835ef90cd5d6e02fa22daa2c27a72b53fa5b5299e7a29af0f9279f8dad059d628a36145b2075d5a38a1908a68e3de74901",
-	"fab3a97777c07f09f09461052000709a992ca3b74154013cb7e091a31f796e94c39cb50b5657bd9739b7206047d71998178fc66d72013c50a7495873e1484dc718c72607da8a83fcaa53fbeef1007147d62b09fb2fd6e1ed6daa1fdb5d9f4b73e1f7326330a33194bd6c3fbb76ad9d59cf03a0acafe292bf68a0474e0015897",
-	"9116e144efa61943640831b73b727c7cc2108335bb6be3b52f082d47f0cb751e9f753dc465cc799959ac8f44571741ccc2ebe100d8d1c94621070262ccf693616f3060cb4e093ce51f9f750b9e36888f276d4c7a26c3b42f27eb70e19c2de69d173e8474a5cfc854762f16efa743a2669bb02f947ea4c63f024032c6f7cc4667",
-	"86e4a1b2d01fa392b8952d7b72e02db63c7e9aa0bce8e48eec3b3b68bfe54cfad5009352f5245013e8b15edf219e902c324d54a1326315dfe1faf007d2ec47ce3e08238acc92d967fe34f23307bd28b1f76ad5bb1ab53e6d98848c41d036a75814101ac3b55ac9381f162953bb04c9ab882767c7ef39f4d4e08959cdf721575f",
-	"c04d5cdf31c41e9ec434d92a0a1c5e5cd500791b5b019ad82d166724ef1598a30fb1f78b33038f5b43df85910fb7f21ad0bac66bcbace299af29923cece337ad2120d9a1ad5c4446d2ce512f09a8485870270bce265170fe2a9e0ea0611d320d69704f3fcd9be8aa27bda2dbb300dc55a4aa67a6dedde3992f1beaf039bd4883",
-	"aa7081a72aea3c44dec39d42c728ebae89d258b45a62e79520f6fdce6c5dac17b11da18f60cdd748523ec1d58ef3bd0f905a08d0b0ce2ac5defc8ac16ec0dc0133691f0628c685adf7679d00cb01d879c0d8a599dab9051c3ac92fd435d6256dd63e68ed463b003b54c64dffe155ab8f039f8c63d82debd377f6fa7e8b8cffad",
-	"80bb22f32ac1f5c3e12175b3289cbc4124e15634c1ac36627bc8d8464d2a59417fa1a25920393db3d792cc3d0d649d92447f912465c5e6087d46db59ff37aeec745f2ef57f72d5f864debdf9f8ae773dc409a64ccf47e2e237f540a7572ccc04fada4cb5a713f0d7d0135d6f4ced560951132c9c95fa325251371f00db05e0d1",
-	"56b0de172ba2f3bc6ef838ae4d00a2748525073361b974c96421d9338fc10ad9227733439c936c96261d28010d3bd21359a6a789e9c832843037966bd7fa1476aac5d33ec600889f87b4ac26d06cd56bce1b006f3f8afb95461f194aae22449830b332b5507e913ce778171762950c3281b1d6e67409862d3b3390cd0000fd7d",
-	"580fca6b71fa32e168d968903f153f474fd439285a1be7433329fc450858a603351256956a41e66758d7d5c436d69686f3cad92f3d661d063b41788bfac35ddef81fe9032a8ae274516df4e2284baea5660f518b9de623db3a60f85ec49d665aa1a79ad48e54184607902a5b3a6bdbdd8d25fdac13b74e18995c83715f4ad323",
-	"99eab9a5721d6a5a95bc2fb40e367af5ff68db383841768d9124a0f66e9188f0839c73fedb187c74bfed1e7776506d65f7a8ffc41571ce9f2f573cca861f095016e2dcd192f13e4fa67894c9703efc9a2e37d421a02fb879c6540688e45b1695f3bc9be236ff4d06ec511e0a456397822beb9030209b66befda33169ad8a5d21",
-	"66e9451d1883319f82bd5f8b19a9bb20b01337d2966d7d6998a7d454e92c855ea4de0a55f84cdadb23636bcb69f5b71a8ede58e9bf20b35561666464e0e8b6cafada4ea610462485be9f606b76f452b9e5a91d69c7c355ca3808e8b13d011f1ed3794c0661c219e6a2e212225e16f5d95dda34136471e0392fb8e4f9af87c1f",
-	"97856393feeae84f860e36e3fe435580079f379d8d9657855751bdcd31e9f5a97fbf3e3fd8cef6e55b91fc6845a8d7f716fe96cb7b0537562f2735f2efe4ae81a0677c58d745f693a96908a425766110546d0074d9113741f15437000c7bc6e36b11c9886f5d087967731a2c6c1a65a9ebe69152127118bb20dfb7cab069bc57",
-	"b17c11e2756a3cc860cecf617be084d81949199a423082e416105d1891574911580805af5934efb61c8f5cd2164d8df3b5af61293cb25e3eaee8fc0106f1efd5409a831fddd67fc279efa82d836e0fbfbe25790ed582fc74e6008d8cde38853d98ddf595522ef3b5c0feb5429071d3c9acf51b800d61e8a98367a0260c95e77d",
-	"8359246a6f318b36333e75fd77d2e1d421cf36ab456e289530516ea6a908aac96418cecff1a619d693eea26983200ad4e211134bb905c2f8183e847d38d66150b8386d5b6f849ef54a2da58a1a70630818647a1f8ec8ed90ff9b97d877707aa9c5e834de408c86a83d91d64ca92f0b63452503e6e8d0a9b1d0aae6a07cc25053",
-	"2acb153a230dd55d4ca3d04521b9f1be4b65d6e9814e55fd856474141c3b2b6396ada2582e6f6e9aa07aac1a19029728706b529b5f382faebb3fd705a5ea4bf6c9c48f0f6efd16ad38f201e291a908702713433f2ed17a99193a57513c805545c5bf8724c189e6c1720149608e0eb0bb9dacfeeeecf810c5ccf7ad3d5cd106e3",
-	"77fb9a551cb3d75bee5d68ce9d88f4f76c68571d4e28ca4c340254f5392c1b943fdf7254a631af3180acc8bdacd584dac8b2fb4735e18fda2ddbc5feb08756833d8b9a1614e9be3ebdd2bf4d90a5a37d6d4ff0f2f0c4289615e47b28c8f329f8c9a9283b68d2eefbe88fabaaac391b49024db830cf39351e9bf36180db39bf61",
-	"1d039d129c9cad69f2969e35e5f10e6db2cf931daa5182a82a2c9a5072488b509bc7c53f50f3949a1a4d5d2e04c01a56e470f44d06f1457479f7dec0e25ad9e7cb91da93c0eab0b547f0a73b5682220f4c60509dba97dd1aac9b43979deaffae41e9dbbf47cd172936d46d5277b3fd5ca446cf8c0f52e467ded7176221786241",
-	"7e604048b28e2e6c92d2d46c9712044e822ca6a2486eca94857820d5da8feed1f26542dc47f7b8c26f2de5805293c6ebde95e04ac421c2befb6cce625956e3948b55f109de01494dc55c615e62c88915282f51d86c9f0e32ca7d960f8a690d2a7eef7904cc970dd711183b32fa4950e5e43cafe140d6aa0a17e363a8745dafe5",
-	"8db6f53b37e1c8780efbe626e55ba7f443acea6dfbda6d8118d7fbdcfcaf26a4911eb56eb46f9ccbac878530b37e36086ca8c53ac7f37d87de352fde4335f2dead08641d37dcaae054e3217bacbd14558ae257ade179d52b8a4552765272ae0883f64c2a13a47fef1c6fbf08c4abc3bfc4c935d60fde7dca0e646540b6050f27",
-	"2ac228e36e55952fc59df7a4ad1adc700f18700f938d6bc15ba90db812f3f1ace2535121011e3d3f714ef2e425927674a78e6afa8b83a344afde2dc18994764dedf6c0373d1dfdd17f181be6a7cdac29e120c1913a288f92752680c665adb765f2750e269b951a0e80d97244b7312af17b2f919b46f961eac7d8f37b538d18e5",
-	"35cbe2a516984c3fdcd4f075ca69a172b37ad3db36c39513585bba3a4be114ca87d6de847aa9dbd1110fac8f53e4b7e19fe2aa9f4bb033cac1079de1dbc1ec39e4e17de763fd3ea6d0b3b55b074b9949108aaaef47cedbbb5958df807471f9aae67e67354cfc6a20591ee7e5a09920e2f15ea06c7d79df79378afa156a99647d",
-	"4afbc06a01ba98ef5aea4813dac22d51df1c530bb3197405e8d53e8d5ab985b6fc5a07412007d1dd4b3cf9d9626d299548ded9428e5c092d8ab7c9373c40dadbdbff1767c567d40023aac5c26376f606f80a9f252e98a7c6f19c8a20a28e73d3bac34f8067e7f84d10c9f67035575611afe7789e8f4e0cf4014626181d97488b",
-	"1700631540387fdbde56b7f6d7e3998f7f6e678a71145b1ceab2d7bd26e14ce2570812e19a74a89713c46e0e8cf7cf8808590d5648d574cb673272751811cf4176cee57d12df8ad8e95486bd5bd93e098a973c166059612e603b2bb2e76dcc590349ba9585bb617821983e8cd13367a992c1719aff5c36d68ce9595f855f7f8d",
-	"612ba0eeb4d77894d24ece62ab349aecc86e2476640af0dbc59db33a467d8ec5e08038239a224ad5c07fc0cc9c45c07243330f9090325ddf8bea7a5e7231a02c589f459d605b17aad08f8d578b9f1c34517f09cbe896ec8bf82c2a21fa6bfe7201738627f741e3bd93eae91e95fa20764c68221964cc0d15014a97a2268fcdeb",
-	"f3441348e4355bf737632fdb05d8565d883f6178438aa1a4bd0a841e3f657d34f63e95892dc23c7642bd342eab5a0f756e14ea5a1e4f7f095c8cd3ef36f968f44710d2bd5dc5966750d071bfb8e1530509c04af658206af5178eabc7c162d980043613517c97cd2e2f283802fe68540f4b963a5b3c421ebb2bc045301587313",
-	"ce2fb9f712e0a51e8dd48f19e24d3ddffaf9a21c4ec6aa05cdae6c08be5dd6ffac3d9dd7bf9b6f49469a4587e347cdecc0fc8ec01dd50b0589a00d598e42311f8401248d42fceb7760168b4a14869a28a04e57ba8f10388957160840de402d974aabf7a331f24b29eef25ee56c252db88160f415e3302fa650a5105680fe13ad",
-	"b785920e6d54db81f6e759bc141dfce70ac84738782dc50dcc339141134ef82dd35a6fb1468834a28e121434075f92cc393a085215a9c83d199a5541d629b955ecde0495ab4369e698292e28a291a72a2230884325e177ddc0f99597d3a68b92b8464836b73f19e7d02f75493cf8d46714352334abbc85109231a312310c0b6f",
-	"7e52984eb99e4ee58edd2580775d1a4dbf7d19756b3210222bfb4483dd4745d2aa1530c49f784d08e5078ffbae51a17336d1fbdb836cce96e64aae4d9a32367b157c28a835eed164ad592519c0f1de94762e02d3667b847b349112dec56123bf7834b245b67ab5b16322a2f0bf4b2aaa6b25b010c86c2249472daef0df8480a3",
-	"4a2ae7fb11e9d71528da89d4e3f9b9851453b9c45b7c075ffbe10c189fc72cdfd69db7fbf99097bd6fb960213e419412c977ae203f96dcc11b871562fc14ed8f4786b14cadec14ee97b6602bf7cfc47c69dbe4e1be7bbbc65c91426e92fa0b1b87fab5047dc2d2a14f320fcc9e2c435a9a3d5bee83cbe856bd822e190b674699",
-	"4f6d66ddfcb8f10db13cd34a9592cae206bf1663553ce1cd19c24122b367157094150f8f1e640e966355c8c74545c55039b5807f7b0e96a299b64aa83950624209621f99a71f9cd9ce78ebfd860a3a67b67ef16e17fbf6ad1e9771cfe6af79262f993c41bbd57230f0591881ff12eeb6265bc90d34cefe56ff70aa3fc7ee2625",
-	"6e0735b624df517367d1f4c12d33f95cc7ab6782066a806f756821772f4d922e45e2a84a3947ef32305eba6d458bde23e0af75aa0fc9ef279113d485645b466516fa17f49dd8352e36a724bd84c052f4860113639ef0b1e7bc1983f26e41def69d78eab2587a4ff707bfe4d439bc01f4b495c3d3d81fd403a09cea98bae32017",
-	"d2d8048963ba2097d5837f6c3a5884511238fbed8b75e74453cb95711a8e4f2488043e36ead059bcb1fe06a99dd471466f7d69aa96d1683699520c11cd1e00c1c656de293c04d870096f47bf3040f19f0112d5049603dc842afba880e548fe51b9a465cd251b9462b6c98fa8fac48c8edb002635a8c03dad5134eda7092f4ab",
-	"c0084c32ffb6957486d2e2c68aefc75840c20bb699779207c043b9e9da7338246cef3cb81ca9c8fe84e29af008088d724147fc72e615e4a66e56e34862903d211cd4aad14494a0930b1d61d91d08fb7f0a3b52e386199a98f8988775e33bd2df72b7d27a7d97c82ea041b43ec290f30528c221655a562c43db34f0c872d36629",
-	"771bc55b0977e05642aa934fd84dfb1e53b9dbda378b85b60e9f58bd91fb48ced9e2295cd9c0765c7c620eaa6a0450a3a019f5ce9e5736558b4822e6ca9dd8807dd661037e4fe639ffcecdeea1aef8e598af4933ffd6e224ac4d24e29cfbc0e2143ef0e4b0ce5da06435db41a8c710d02a90d340cca5d4200498c039b6605fbf",
-	"b468f9169211b500d83f7d6f63d2f51fd69519c231a6d3223dd0394ed2a6c5a35229b2f3efbe4136f7b65d8dd6473e6f49d7f5da28756b07230fa85835998c462709084aa931b7101f8b026cf40b89c513e3163b5142f1a11e803ccff4b37874338bdb1563fb15a8db5690f7a8dd05a1d87d133878b61a39e2100f95b9e40f17",
-	"5ea53d5e7ed27cc8eda760803df6aad0d94f30c2ac30cf411d70b2121ac500812468d2b0fedb9635e53d1fb9568680e68eb101553da09aa52c8be36072db6b283b81a9a1567bb2b04c619fd9fc8f4ccb646d4451cfd8da76c017f9b490314563a14e31e5aec4f7c038733ae1ab979d2bb4cc7a0b39c9344a501d6c9e1d405119",
-	"36baaea2b059ccf1d51525ede1113c144369519f0cbd1f976b20439ce87878bc2778d0401e6cc09e4432afc4b83d53be13ecf6c0a0cce7f639e74dab558b1c7fa7ed9f56ac381fc32f1057527086963af69bda57d459166545726cd18b0684ab8b6a46cec0633ccd90382b5f14c478be14145caa2878c937f988d4d62e508be7",
-	"af215352f1532943fb5693052e2d149fca1d94231bc51b7ac5541f806b71a035bec7a5ddd1c37edf8caaede6d7919c16fc77fa308529608d7ae7f1d1cb98007649cd8a52e0f4352c3dfa510cd8987b40378db791bdf0dbcc9f109e9320e52af3e66d2ecbb99b8d3d2e326b7b8465a229fd166ac95ec9fb7354551752a2405543",
-	"8d8cbc7a466fcc5ffbdf92a8bc9b844d921bd66667a1624790a44a72c8ba64dcaffabb25045c448418c98b644a2b930946902ddd38aa3f65264f0b785ca50f1b1d9b3b61328022136f49624c8a9eeea1fbce847593a35677d57b9f1330aef1a6bd1d2f0620d088a6d186e62e17bb5d55d0decf37c9f2f6dd8aed869d3844d351",
-	"a5abf791054dd8ef0b1cb76c2a59e2543d42093e5cc53bac360ad1e286da45b87b41233819c0b414eba3292739356b236a221ab8f9a7535e53294ae243b66a002919d44d77b3d7c205f335fdb2a46f9755516e1f43bdcbcadaadec0a255049056eb32d686327a336ebac20d0b59120019af39371403a37de8851845946aafa27",
-	"20177631c6da085db0d52cb8b7697269e097455ff5e260db28f088af0e5fe55aeadb996fd9ed3a9347f4e9b55f3a4d59889d86379dffa376119c9f918745a71acbf7a2ceefbdad919f025c50726862ea13d5b51ec498cc15889929bf4bf9ececbaedb8a2a8d60dc97abb246bbbd6a3cc7c2004daffbed0ad029cff0170576901",
-	"18acef25f5ebb902a5dce4fcb1812bdc5c3ae5aad9bade1556249c4cf92cc20bf1ec9e5bd175778fd8c26f7b834decab059c2b0dd898876fc405c48f6d1c159b8824802f2e003ebcdca5ed5d4f1336a1c72bc5feec087047c0101b1a28106212632a9c81f5dc13f2469300e1782cd08dc2b1e7d903c89d0af869de3925b09a7",
-	"ae6883a34cd55c49fca50745bf8add611798d6d185c51df8b9303204a1d17e545df97623909cb8190c55ec76eada32b0482246d040f929cbc977c64dde07b8260290ff66af99b70290474231f47b9e3e01da09796a3024e5931926decbc1b229a40adf25ffbf4594a2fd5aac7aa48cdbfa0283c4fc64ff3a1b50dc32fc7ce119",
-	"8d85f256e0f0d78727869a4b697f9841fd736a49cd0277cc96519eb83f214f4b6b7ac5a06ac207006830b6b9cc744aed3280c8270f9996207c0e41654f6d58b5ff0ad19a610ef1350ff5eaaac03f5bce1d0233ffa5965570a6bc30c70a1b15a7aed585b37c3ad331926ce8e9916a41b37d2b8f0d8c9179bce4a2cec181fb5843",
-	"a6baa6155958de2dcb8216d02fd87a6e57e43faf8f3d1bd12d6b9cd571d4fd552dad2c5d8f1e447ebcacaf1583173738b32e27e4a85d4fcfd59fde533bdea6fa1b3c37b2633551fcd37fbf7ece086b7b84d3b4ba55a32175eee2225888845075ecccb748b462b8bd3b0ecce18a25da8947f6479e95ccd78ed6ea23d6e096525b",
-	"9ba712d65a385f1c7b1bfb185f64208178d24c4b0f85d9e18fdba896b5b7460a56dfddfbb635d1043c9f239d07625c4acf820683a5dc08147eafd46f64b8016fda02e279c0f1e4ff72c8d22d381ae0189e03faab61217c17a6c85f4776624e3773f8f1d7242b1e4fe3d0edc89c72e94b07d7e1dc8df5abbaf585a64fddf2c5ef",
-	"60742d08a5261603d000fc0bc952832091862c1cd6843603e517407d1fff126d87e20d7aa019ea3208dd891a818f605c84bfe86ab4e68d8d05123ba5b4ac4a89a9784760a03102d85c79c0b882016d2640bf8cc4ed1059a2aa9fbc1524b7df92556bd66ba53fb1d9d70917ab3710630e2df6c2241a6767bc61057df6aace7da1",
-	"11daf614fbae0af40b36926ec1b37b2c2f7d0cabaa24af4ab0f8384b166460a1da72eff35064ae2f5db1c3b1d723384b09224bfdb3a4c3c6c4d56d3d5b923824c701da0e5cfe9a6a2f35e6304a28a6bd74515456070c8d2fefd8dab1c0c31a0c4e4c70b17f21f1d2c23f6c7e8531ee79bf2814d1023e620ac13bfa3fde014267",
-	"317daec5e6679cc9a07570359dfd249f8e1a9d2f18294eac5d15663f80d0ac492f3c69b5eb637b339c3b72f0eb6ca0d9e5c17ba6b2c9b58fca44298c2420cdd501068751b266b41d5a7cda17e162ab22cf9bc288713b0cea1c8573e0987c2b8b6428205b58e3d72d6ed2c5f9bf2de96253deeb551711f2f48b83344e2e25202b",
-	"6823c1fef3c32be66dac146e72f3ae84a048468c8a26c18f90eb1958e49b3fe5136f5b2e01fa804300e97ed2d06c71d6acd817a90dfd2707320377a83142e8a36a6a2d7763a9797593d3bf566effb6e01d926c0b5dfc924bcac00128ebcf1769e23a3b79e7ce0ae3a3d5b2cab9ec3001874e5e94d15db1e04f262a2fdf4672f",
-	"80a7077861fc327b14ff6a98de0dc2644ec00e41fe8d4b4ba6f26c7c46df0445f6834c8abe0eaa5a423e76823052b61e8202ffe245dfa67d7ec90c85b6bce417dd44cb6630a899ff5d493429f8e9bb76d2f5def7910e2f5f169b5da64ecd1130c9dad470483b020a8ad7071313cfffd57895d4ac0a3756929dfdf154bcfaf7a9",
-	"799449932521f9958f86da71f6887245d59681715106d9c4b37ba9c4358b49251f630397c85ab849c00e894de153901e92db6d50d532abde2930959dbdebe6bc9295b9e53055996dd7d5ee817b9814a332b2fd3acaa81bde8a05a9ff179e86d0d7f769eb7c944fa9b2cbda91d6fb40759eb8dd9b856d7635703392f977a2ca5f",
-	"7aef5dcc35f2614aee203a06ebada00aed403260d7638bff5d7d04c93a1fc2cfcab49af39787e49d9ba00d2764e7385cb8aa451ae5739bd210ccf6e4c2cf74cf740137d3feddb9e597867621428dacce2cd30bfe43c997f7cb011a3374a0843191e3b171505ed24598d7b860cb0fb5b62f0ac2c1943a62b1791493f74ecd9daf",
-	"9ccc0079cfdf445d0853866a9d8086e028c4d6e0c180e16ab82776876d2ecf9fececddfea5043b0db670655652a53475455efb3f473ed813e7cec87ee45a46c7b45b1e62d6d91de7037b62446eb14809f49b88be7966571ee38854410a845967efa3a00d746d60160ce3575afe8efc3a731880e9fdeef94aaa26e04042dd434d",
-	"bb0705c38fb047ed21d94ae2166be10036f3a0874bc311bf66ad9edc3b3974f01a81905e975d7997f384479b17f297e2ea8af3b2d46e2092356c524d0d0a93520cfe2a7a06f26bb53fc4d3423af6a31488b5f2ef6d9aa181b7acdbf21e49f456a9bf38f62ce060a0950cfe95b9efc53320888cf2ea26ca5a72496b28f8d8b52f",
-	"9373e5edf5ee7381af5dad975d7d52098e6baed8d52e35773936c6a7e59bd620c4c8dda8ee2ae5eb3219f33f9693695e12cc29de8e3406fd3423e04bb20fa2330c1b36da0ff233a00b0b8fad479bfb286279853326325c3ef9d75b39d42d2b5dbf447adeb2b56b9817724d2ad74110d4052c2456fbb2a3889f66dacf1436601b",
-	"355dbcf7e7c1bc6804097ae963436a72c35f8b88ffcc7a1f8916464b572655d700fc4b1a6cb307eeb8f546b3b15601ab37c7c1c3ac681f3ebee20587a0a6445e1da3457ebb46cd3b832c41305d42070019ebc8fee465fc393b21f60311b85729edf32686a8ed63b7c9c089995a5e0185b8e9dadbbbddb20c6715989d0a29bfad",
-	"9617846f48f4ad813f1afd7092c05e09e28a747a09f375627694a909f8f4dee3f8b6b62f67a98d606bd11f65e2be732a43ba4cc3af99333ececa6d1cce3f7ee9cada29594388391428de606eac249fc86c4dc291a8b72c5f488bb325334920177aa4f829472eb3472942d360635b5f7d173b84d558ad4c8c0bb9d70ca74738dd",
-	"8182d776ed2d8a89fb2dae94892df8ff759cdf0b28eb4330dff456d5c0b512165fc4fd2d3b5b4ee9ac868577b8d8768fb59b7fd09bc3eeac33a6a6665c745989e4360cb98b805199f30545cd83c9ce7e942a7cf2d0201b4537777d50655431aabd8097552be96ffea9e53919c913d8ed37a381ef2087181dc85c3d82480b7a7d",
-	"88311d95f841c5d1ab65266a3fee1cfe44252da9c143f87476cf5979ec5159d128e9a5e10fb8752cfa15bea2a59390fcce93abce5d67d3b9a6d9fe8b9df06297237a16d11144f7157f8d81acff419a0dd40216005c5572ecc4835e309cc01b5d92b46edae7c6f4a6bfdb126a11f2b1101fdb684fc24575ac03e05040c45a19f9",
-	"59368f72ec74c5733fe6a94f66739d702522ab814b8a4344be4b0f873792fc893740932013b4b4c04005fbebe9f6a61290c984a47c1dbee76fbcc709c234affa9729ccd3fc2bef4801ad3c0de4023b44d7009335bff5f170c1889dc21023e07c359fc89ebefe1a1dcde15f3135c8c937eec172c382063ea410f1bdbc4dd6f6f9",
-	"4d4f62785517c9395ae947b68a9039d3c7708e163bdde7cbc2d86cacaf89535e1c2bb2572b9c15372b7cda2eda526ca60464255f27a06bc94081491ed6925facf7ee36033d2dace00cf65ed96204a0e2fbedd60e50b7682577256b09fc10a8919c6dd4f9ee988f3c4fb9f92fd598cc0395b762edbb875c71f936494f20c2a1dd",
-	"9116196419936da008fba019ef4d9a7f1b9dbfa69722ac4f58259620f72b8a89a0d6e1a45805ed58f17fe3c62097e9998b0676729591329b5e42cc63727cf157b5a63d76d90998a735ccb6c8e3376c18bfbfc86fa220d23a63479585de994c098168b1824cd38bfccf6aa50e7d7310fd15271a004b4b67118fed246f68d133a1",
-	"bb16e59f60d7d9ba2ae98f2b7b705d9f9c970488fa53b19bb953e541ebcad9ad6172a9c9074b4edaecd370674951fd504bc02d11c4915b977f327a2a614a4ea159fcb972a999037cd621ae3837e1660005b468f4e78cd8c9fd82a6b0df89867010a1d5d2c820af318b2bbed17479d92fa0b239990576d454065d5b2d3246c229",
-	"bd9e75b78543b4526dc4b54878f03486015f5e05ab45cc57b3032b2059ac312b4001c9b7880c15cd77c2837444e44b2af60e638aec80af4858069c48a9fe6c8a8328ee72876c128ccc83a4f5dfcf72a141566cd08a9fef4a1c3ccc56063455defc26b4c8d4e94a64d80fec224947dca9734fd19436457dc0d95e0e7443397351",
-	"2dba97f9ac75bc50df833487ac096ccf688bf1126b07ed714004c2e325563aae201510632215d42144a2cf7198c20db743b3d53da74d20c6694862a7cca8fed0421bc9281fef268005c2a2c7f3ffea8f7fa3d13d62fd43e1cb2b8c054e4f4c044c81447f58da5d561506022febaf0e26f1aa6dc8504ac520a6d7f73453c02e21",
-	"a545b8fc83daf67191b702106fad8628a5be8edeccb5092f0697a0f19fb3648718bd07bd4bdb7b550186054dfd47a92bafeac24417b45aabd7af32cab3405ae332ddc5fab77d56f6280f6e835477a1bf36ca49ad6fe6752707ea16763cf587dbe130bb18f78ac8f60c6e7625f06e76714315f56d91e0b989cbe3c820a214e8d9",
-	"84b281ee0089fb8effaf8f4c595c359cad98fe45ec6e69d5844dddc862b4cf204bb61ba2e227aeaa28f2747feee5c7c324bd10057ebceb66e53fe8ae1be102422a339f12615f5fd13c916e0557395f20d15edc1059477bc9f877c9f6d7257ddb6ffa1eb46186bed9381ab1565d5e729c8ff235272d53570133c60043cfceec03",
-	"438a707e4d5afac81e835aba8db69de2600207e3bbfa29f88c70b343b1db5d0ac029087d02db8d0cb7d5c2107e6cc9d391c318dc05e7bd2c445905947d45fcd99891fa2e8005a72474b9af3f9ce7d147a2690955a4764a757f572be1a264998acbfca65d40fbbad7e35b64cbdd44a012143241cb112af23e914b2a4163a979fb",
-	"4fb8cdcbf3c17e8ac90a923f32220603ef6885b3ea5d91644d7d65d1e32102024e020140f39b102620fc137e0738e26a70e7a28d0b6fd69ec8c810fe0ca516d1c50e89e63e8ff10b85318b8cc60d79f39b1cdf9ff2e556c9b426a3cfd46f2511840764d6859125e3912ffc7e8a620006b3b62c7b9bb517c7ae92a9f1028e52d7",
-	"4a3000f3a0f8a9b10e4a847e61a094d4afac49d0af57fba79cc1b1ebae69e3c60ef9ca711f4968dea00e599c4511f6c7d4d1b95417221d6ec8322eb8c4f56ad448702588bc0d3ae92ed0e74f79b8c9ddf9653628533bf8ba8aec775d041fb28c26d5ae96edd0b83ac82d33d8e595d80abb3526ec9582e48e41cb8bdb7d668e0b",
-	"31a89d475edacbf4680f6dca872bd1893e1d5a78645fe1422a8937162b255b6679826bc9b7d33798b6198512c744bf0348890c39d8049c6a4abad88b2cf43049f5587e1f827223ae48aab18f49d3580c6cd9455b269729ea7291a33e50c538248c7615d3f50a14e8b643955055c0efe7bebd0ecaa7c27367e4809d4572762d91",
-	"9524472492f8c86bb90db59fee6a4b7bdb5bd5a8691daaac04adbed50e55cd1d0b18e6a865d6cf8c7d2d71d6df6fa6737764e9dc3750b2c41b02e55b1038ff1ea9cd36d0f9cdf6cac5718ce306e9878d654675c991d244a435c0ac1d66978d70cdad663864c140adcd4438af80ade010494cafda52a7758553d0385f5cab2faf",
-	"a937b4828e2726cce101824e66919f025a8db093ce0922bde59f4cc276e63b6c833b96c7c9abff71895b1f7d9d1c66e733114e75a527048ec40af5d5de9d7f9e34c64fa1e03422e4306ed47ee320196b5d8eae99395fa927d58d7c743a688afd71b6059f8a202989dbd2bea051ecc254077dc1c3a1ee80045d01503e17510883",
-	"4d1db428421e677e18e368af5ff0701789a8a16469bfc9dd6b1d870c63ed5a4283f7fbecfaae3a761d3d35f017c993c832e47ce62961fc6d5a62ba887965329b6ce704e58d04ebf3cc6e69de4453b7604cf10065b66fa7628b78dc80d0f635ffa5d1c01c65a3e954d0bd4698d107a9df27a049653a871162184e40413a922c9f",
-	"1a6c3bb4b4dbbbf694df13ac3907c9083da57d4ba0c3e48406d905685ce2566d0094565ff101f40be4c9081199b3c59efb63b16696ab480b1f62ba9bf84a1a625178ffeee3cc0a51554009b33c68a115a6d78223d570a43dee1e50e1d3e8d79a36162f80b9e6d0c46048cfa88b8456f54b02786abfeb27c53a22af918d6fbb17",
-	"4a067569feb1fadb9179b005e7d4c68d53e070acc2217ab2e6fc77e9f43e5ad6b800b2b4db94a7658e7f724f80187eb27568ea550e4539baad85dae5e17f6ccbcfb5d3f138bba5095f4e1f2c0e939b28319771b2d2f36c3183c353eda13160eb24520c751b802db4b49fa817909b85691a44920ed90189ce7f474f99914454bb",
-	"b5175212f7768838fc8ac3cc75c3d24e39a4a10d24f079814c12dd53aa64850bc933d103cd1e7aacf6d0ca6d1e4a475ee5d1e863e2c4b03d10e395ad048d6c17fadcae2528ddb0ff798d7d10d9f4fbff91512db5c956237887c5214b1d28ee86d47f953f78e4deb1f61e8e5306ab99f8df8954698a7efe8d850fc35bd233c1b",
-	"6978a9b1d4eeb5c0e2f17adf80c3234ab966c2ca126cc0cc9f7b5768c7476c959f6abe320c782eeaffa1e08bff9dc565d7274054a6c95111437fa18a241a6f64634f45c9706c7f30e16f31d870557c9ce608f29ec3e5e32456eadd05f0c4d1fa05501364df5572a68ef641a3ea86ad3a9524676138cce8d655140f2fe0ef06c3",
-	"be89b5dbe05b96bf56ba48d6dc6dc18e078b7eb80f90dcc53a547a59c395b192749a1c617d1389bd4ecc1e8dd8c502e6dd9351f37e70acfef23bd93436ccc6f834c5a7200bcd444815abd24bc9e582959f7a7ae670f953ae50e501b5fca40c06b9ed236753a568a5616590539e68c742b7f2f6d7258156eb9be999ff2cacf1d7",
-	"368d937c9fc0caccb194f17304849bf45a908d75d2dfe1047a3e4ed40b37da5024cafe31dd7664e864ab6b14906c3d33582ed402b39035f3dcaefd59abffbe36a7178d504c899bdd9bfaced76682228bc64c0ba288ad30bf073b273996c6ade2e85e4863b2c8fb79ca1fa8fc133139098402f98a8490c13f31ab21402fe1fd41",
-	"1c80fe5c8a3f756dab7e3c6f2988511e155a0f7e9c99bc92bab90d7678c900140a021aff16df5cbe2568cd0364e21199eb86f052ff3bdd98638849fada0495c7859de696369ab727225e5f7f8ab91f25d00372c145d38e9763f3e867c83dbe7448e10cd200e8aa4c9d1483e3cd8114824751ebdb8f15dc8edb45dbe4585ec177",
-	"aa5bf0556f502615c8ecc1c406b96051035aa17fb96cebe20739bd777a518aa049df1a2b9a7af1c203942b1317f2e2d443a5302b2be2a96f6e4f60d7055c9305010fd0074a7f9e2b597f6e8009a88900ab7ca949fc5f0166b6a7adacc674b8a6fc691e8ce3726e4907757d9786f5cf6d097217ac4dd39fa24c617235976e29fd",
-	"382bbd66d52079a657e9ab7c0e3f94a549442864cbfad38dd40efd3cfacc823c48b86fb328f2efb1ada7a24997c75e305488e054d7b8a3142409f7aab4c397c02b6a642a3b7aeb429997989d41acd2693e6afb7dc6d8eb73a803f77f41090ca63ff630ed44461f8dd84d9be7c2ddaa01cc42ccade90eaa69cec9e14a565af18f",
-	"7439c82bb22512bdf25a95872e4a6586b3f21ccb30ac5b8f95764461379cfd96faa69da1a4da1c9bfc1bdea22d2953e10f173f7481e65a45db1bcec298331361973d5612bdb230816b0f983f24cdc86af8c278b1c2c357ccf497b817765967a9a7b9032d9b6f07a2941c15ec53dd0d28642e72958b1f2a03b3eccd589065ce2f",
-	"82a67b0f2bd8a2a43920e7eb279eecfba3716b5eb8779c1bc2a17abd029390cb7487175beb371f9d8280a3467956cb02d36d3fb4aade112b824d4d547fb2f1bbe3fffa16d22b0e2ea5fd879f05a7b29bf3ee0bb424ac84683ea25feb4661a37ee37e9618482cab557823e59066e7c972a367a615065668d5721badac08989c1b",
-	"cb8da351d0a5cf297d2d1f08218a53c7833f6814fdb8116c70793c28bc319f99ca1fc98ad807174ecc7f24b1880b9f08d815a13ee2b237a50986cc71c7fabf8e49916b74d929974bcbf4c140194ff6cd2e4f0c4a92e0b0bc56dd3cf1e14bb7f264ebe20334640fb45191d7cd49cec1cd04c370b171e0b5c940746b9542e93d63",
-	"2bc100e8ecd54482c128dd94cadf59577d7ca88a5b3990c2431a8ad6d38c7a6fe7424c8621eb72f03130756ac06435d88904d6cc601e8134ef351c28caa71035281599df374fcd8374937b6230a8b17b6cf8cc5f585360923f7c990e3b3556d530cf7ff49db975e92f94c1669212dc1d01b900c6752419ff5ee8995bcbcbbc3f",
-	"1d04e287365c0b3ad4d6b0d8770fe8258a8a2a25298f72ce9510ab742dfefd0ea30b0d034b2277163bb42603e56ace5ef26f4257c97074ecb993f39b297c54e419bf8b5428ac12f82c03d13d7622ff3281a215afef1bebea3a562cd76e66a3b19d888d6c07114d9165b5c972de53a224ccc9af8671b73f47d9eccad5af506eb",
-	"c151d09d4361d5cbc36b3d9ed5baa077dcc330ba8b8c24114e987d6fcec7a9e93bdb7be02592b4b92431c8b45feeeb72f8a4179c8eafef2360db8b982d7eae71ceb4cd2437348eceee073724939efb7d9b5b17a84f16b38f3c8aca9a6ab7d7e2e655fd616af9d7e4ad476e376226fffad511b7ba2456352337f446829aa92bf",
-	"4061fba0f6d03652bb7ca9d4fd578761275d3fe7f22a593a01bf40cd28dd24f29bddecb51ca2a4827bba3f8446ef7557390574002ef1c9e53fc1f2a6ac8b0d94b6511b2dc96cce67a13268f4b4ff3d7cf487bd0fa08121dc62e7c3a5e31307b42b6d9799a6b79ceee550ff313b79e6aae65d92d1f78dea95b1461ba26af14425",
-	"2c2661f7ce707050206c62d15c55f92393b67d668e9ba67a41b997e549e003fd8c6cebbb2b1dd664201434159f84e2df48ea8e71bccda651e0a701f80e20ee55dae1187c0987cfeb85e946137832cb736f24444681c5c33df6eda98c2bdaf0889b9089a0af71e0c0c570b1ffac1be237291620d6e26e78db1c81ea3bf28fc5fb",
-	"425a305139661976f94d4fdae5612775afdb83bcfa01669dc40d8b316bbe056856ec811d48f58d5c95eec7987ba27a93e384bdbbf9721b6d896be83bf6ffa8efe7bd31e86fd44fcbcb65348578bcac6aa21bf7b0d5cf0ded594b3906d9955d62a6c7bd155b60fd43b7ccdfadbe295a4859eda2a9be1d35468fb87e2912a43059",
-	"2637fdd1ceb89adca08ac2ffc3203b8005b67c2dbabffe62900b1f39318983b49e51df509af5919cf06637d9a59afc126a408c2b8d23c07a48e09d052e698c83d14305cbf945e989cb21403674d1687f5bb57dbc5a4604413b9267690dfc24ef618eeb18692696d454d618ba3099d2b6e67896acb72961f6959d4b08a6c9eae9",
-	"26d3197b59fedbde3eee15ac0460b2d885c8d62e8648646dcccbf758e272f776bf6ba943d7b5406a03daefc16f415f33ecde0d3848290b909bebf3fc4bd30206cb73713e5e6a3d55a3f662ea9112bc2af9aad4d319ae32f4fa239f3a87120f208d436e1e9cf64826cb9fac46027aadefa394b025689b76416e871ffe12ccb3bd",
-	"a8a0c574008e6204787757316f1e086360a56507049df7cd83a03dde32711aaffa46a063a464c1fe0cfdf8d7e849d39ec463df694be970f335b9d7531f5e88454aae8279add9a4de71e7f0f1477394434070e2c5f32d032c1b7801b9957f4d10a828e695ca1b48dc6f8416f086fb6456e8844753206938c4634b9c9793433441",
-	"18679fa2f9f72d92d01da78da0e9422c48fa613f5852b65b363668496ea968894cce28f9022864dd79c37b6f082fcf269be7c06f057d4879f51831179624b2439a442851458182655dde5f292b7d6a7a2ac94d5059bec0bbb9789a4470b349bfafa9701c0c360ba3ffef14bde00fd45741ded00ee810c350a10c6c2495cc17ad",
-	"8ffe02be99707a9b65857f13973ec205d97f9a2acdaefc252ccd6d2acb77ca2766fb03217d7f862f20e37fab476516dc74bd749377f2571e383dbaf3c4a6c5b4e6325689cfef1d96702afdeae0e93087bf6be1bd18fd999be96703e1e3c4317bedf85368bc43ddaff1cbd498b72c67353063c6c59f003d174837af65ab1e1759",
-	"984c01447a85d5a66b3874cceaa9d14136c143ce7a6b308e445ba6618876ef859322e5861e1fbdcd56eb1bb9c35dfda48e4895bd0e0bd1f25af9850b42aca136861a871b61dd979450cce0a071a8f24d8fdf9ccdf13439ee19a6197b4f8ed13827163dee7ec171b704db95bd90aaed9e5913203b4937ddd78e55258b4c12e7fb",
-	"7f109febaf4878b4c76bdb47f3f49e0272f64b83bdd411876a9424c9435bdc7a3f9abc4dfe77eaeefca81855e4a6c8d766c1f4b0975c201e74c4b8857183e2061c3b932571d5842ac9f11590f693e59bfc7937612eefcad19fab38826355bc0f8aead3a9ea7bd1d4e8aafefb49d32fda07f7442e68d69f752964c2f8216d37eb",
-	"4bfa4f1b421635b4e72e22d9df07bf74aae70c742aa4665b83f8ecef53fe1631e0e2887cb01fad9e2f067defc8b18de882e96bf5cfd7233feb336b75ae6168cfd903fc1a07733d67ad3cf66e450b2cc4e62c0e8274dfc532b0018b71fb1b59672c1cd85d3bb2a5a1baa00723dde5d86fd9bd4ad15898f62d9bc058b27e563ea5",
-	"471d8fd5ef2e207d240daf110c1703de86a5c2a3777f96b79ccb84fb07834fe8ffed79d31cd38de85e61c901e5710ed87defb4db08a948f3a6c4e5d89c2d2719d06e47fd44f16919dd63366f1716debd638c04b6a4d1e600907fd90a7ea63b482c1525a39a4a25013ba093238a6e23fb375d009ea37799aff1d86157e0bf65eb",
-	"41c7ce1012c538c8d10daeb0639b3d052b5e62d5f18664f2f5c33d92f437eaa054a4449e136648b41574995883cb0c77422eb23e92c31022ad9f9eab7de4d2fe073b08a1d8f3c76cec7d16767c240a91ebeec2bb276ce122e251fcb2d25dee8eb7ac7506d69f26e170ad2f7ec7b75b1bc759cf13921bb780af5f54666d56687f",
-	"a8b9f02255b1c4490ec4057334383c8e675312cededda6c855ed86f7f03fe97cb03ad5dcd8f62dff18fd778a94d21b19fdd072607308c5f7ccd5c6f833b85c5937720d845f91728776d58bffcb248fc194b9b21ae2ede362bfa8336368d995c651dea7c8d9e47bd24b723a10b8bce38617e20d10a06c790a05dcf2cd78c04e09",
-	"c11cc490c2213ba2cf9f51af5fba32f42c8e2c1da194a0766b3ca91f2432bfd7c11ecc119eca3f80d854eee6e2562d52401b524a9a72d357d0eeac014d9150a1dea0a33bfb55be70a66846746ec1e742b23005446468a2c0d0eb2dc915e7bcd79790e7b285ba02566c6101b58ec09e1d61fd115f15cd992223420082a68b4abf",
-	"7f8c46f017ef0795a78c8086e64050c085a3a2a88ed68e057c1888e5745bdd16eeb415298ecf3cbcdb338d059040f131698edf3933f60767a5e357f9631bdd534f319260703befa96930fa02d3fa45e3056eb80db0bed4c8a6e101bf7448277113d77b57c21f8e33a85ababc9b8503a7f21594a4f2e9ed3c4c1a2467aa165d4f",
-	"fd13cb256ddfddcf764d50adc598fabc9e8372ef99d15ce3f01686db834077cdedae916be6c4dafd04d65ae375b87f85ab2be3421c915d4c12ed764da60732ba2ffff62d198c75ea054b3e86f942ad9f83ee76c528cf617abe05989fe216c570ea0ec93678362143c8afca9cc8a7669ce0f06c9269bdc7c0ba6e7ea80805941",
-	"9fc40656b33276953f81589af9fd33904017a9b3a01ded7f0d484ba61b82fbe5281b1189b853340667baee59a7129a2c0972defd415e85174adbec4ee76b155b6420c28a341d3ae599ade08ea0758c02c9a27acfa7c1579bb259f05c9d7e3dc467e37d4af60b1365aed426f2635a83d0c73c6366d1a64d503878d487d99ff77d",
-	"99ba8ac1c49fe67b0ccb3607c2eb3a1f551b8337b2e38a2a5423307e93d61a4cf016818011d228a8b0cd08916d71b8165c138e8cba947b2cc654db81ccd7f48e2a0d085ebd92cadd7df46713e3a00110fb9d7105046f8d6316de76e0af3cab9bb3ccdd2e3fee025f082754344aacba41f7ab8934734623eb0bbcd405813680a7",
-	"b0ac83a6eb9ec99061e8283f6ac65552b30dc46e2fc70a56d533bb88b3896d329b206d4e9a6b0b65a6d91e795cc9b38b5a1f0ab072b0eb25600d63e77bdf70ab7fb1e723ce6b2e11ac63e22ccab094ed9e5bead3172abf44bd5af1781412da604404e53cb2d2da4a152382c7c74c822637609ab45390b5e908a9c90e5e994683",
-	"30203c9f91b613973a7028cf6de20d7b40a568246baadb9dcd58351d4897b74e87da4b3db587e7c9946ca6473340891abddf065c075de11312cdeb5389e67801666fc188be973c0376e1e5902c72c61fd35b7752d4a364eab803674aff7643de3d7c1cbe119456588ff787d35e2478e0538994bbdaadd21c8af4803b9a666e69",
-	"1d6852aa44b3b45b07ef83dcdb5d719a35142b431a746bf94956349b00dfb0ad46729dcbfda7ee94f81bee320ecfc3a16b8db29ee94c7bc57ba476d3651ea017db993e37bc5ffe52d517909b828cdce9551519cdb2d5ccf4f034811aa9b9bccb769151035d6658d94c9851e459ba12aa68b07c03e2b8dbdc5cfe2ccc3dc4b4ad",
-	"c37de4d7100f3a9ed8c4af731031d1fef9f497de51b6a2b11ea920f0b932cae748fbfa5f74f61a2c517d32a21defe37568d9a6f42bff2bd541edcf7ba06147c596917a18f413d08b3cf4d4b0d60280300318b043bd8dedd63f691d01904370fdd25a09e4297afd686afa065ee59e85231e6dd2fc3be5dcfe0371a5530f3a56a5",
-	"2d21c0e504c55d08cea07463764c4b0ca7df741bcd4573ef517cbf1ba159d24012389f276dbe3b56ec24d180a0cf2ce022f678c98442a7267838ca950924ec03e965e8372af6fe8516e189ac6106b6e5033369b7ef8e3e736964c980a4dc63c9f7ff3f001824ae08b323fd0cbe3920fa174153e96583a5090c43122d0dc0bc81",
-	"b0068bada1e98f80d060ccf4c9c500737c4313cf3b23176e6c7e9db51e919ea38f030ab93ad2c142e932d93cfe2bbf223e36a9f3b6181c18b34ac89e26a494568e453da17349957ab77f3f70a19a87545520c27cb913f28e9d26e65b27e59159ac41f825bf7a624806d981b75b24ee883cb4835337d18affbb0b9fa87f2f4ebd",
-	"7d14f4298477bd49094966fef119a3ced2ea1659ce3998fb0b56ea6a356973c5f48dc73c48b47362c01e630310b6db4194242f5698000b47473fd9910b7ad3277ab1550fd13ac327634ce5136bb7dbe32a22967d151f316361ed8199705ceb6f73cde60818ea7a98ea603d072e3f01d92466a77e80c59dbea7b6a8b977a5f81f",
-	"831f548ef84087aa76fc80acb544ce6f88ec4c89e6dfed20763f3d9a1bd6874ac987849f8f2c34f8a5c0e9076910b5185fc464f7b8c1aa7479164ce8adf1ac5f018e72052ca0ebde92d8b2f703291bf874978ac57db043cf34cfc39ea81dae0d4444a1387adf69f0d1af79e3c308a12e5e5ca702510fab10a01af67fcb404377",
-	"afcad4b7d5d32a2dd7a4144a338a2235349f2af64e3ec932c87d5ec9f744d9af90368b5721d83ab13b5a19ea5a84c63f8d4a739808c671b0eb092f021c31e6de5a2d7eb96ea9c645def502d123df1cdcdabfbcc03abddf5d4151418c1f21b2028ac94a6272ca196fc89f452df972f31d3db5e6182847258922008e66b51df6e1",
-	"e20c87beed02e34e889bd9547888dcf9deff6917f8d69cc70b641227d4d0df391505805492abed28292ab5ce91da78cc8327687cec27c65d4d93796def98211dcfc9dc7a091190dbff9683891c39fc693973deadc6402080c551e29cecce2aefde0b5dfff4856fbce03b4d03a8c6519e0610e9ee23cd2a19f201c1f909608f3",
-	"118933149bf5fa97a19d3badfb4f279b5d736f5cb14e0012b3fb2acc84119f202415e1d3c5bc146df2d23553d725badf23c2ee71fa6cb004d27fa4ce8b9f5068634333287ab6a594cd1699d27ab16622fb1a6105dca1312c26c89648139bdb80636e45bc45420eb3b306f4646e0c1b0ce11774c2432109492f717e9a87bf941d",
-	"2c522a18e260a6506eecf5203d173f93fb639aad6b8baf3aec85beb4351b0446ec9bc5bfd0e61189525a9aa3aac9a855e3bd1b009b0ae721f832ff129d73ed2c21b33d5d47adb58b523c8f632fcc0e71569ade2b9ae0ea790d8856d7d913ae99d5ec90560c77858b5c4504a45fd8230dc170f1a4cccd4dd0ea3a485291d685b1",
-	"4b42f9cc4106a1acecc69e4a1c0403b093d2018cb96b0b255a5a0d166fdf168e8a8b9e5ac275ce3f83963232e450c9c56bf2e420802ec82fcb1eeaf25001728602911fbd53d51df2daa9298d69088716fda2d4fe167548b7604e294f89bf533155559a353e6b1d9b90d1b92e72fc0965ac974156d152a4d44adbcb879267ed05",
-	"936efef7811186428baea8c315db59d23d3fba3a5efa8fc0f8c3347c89918c763b0d8d9fbac50e3eaf1a84ffdf9e1dc86d5edd47a1ecb527cb9fbce579ffc23d1336eaf8ba64ac2906204129a5175e25953b4d27ac0742f9f2576828bc229465e0d8fb2fa1674dfe972b74675e7bab90db22af9804ec1fb6a19379b751363fad",
-	"bcb4c248af1c3a178c98864cfc88075afd480432144e27bf0b33dbea53c4162403f3153dd5b6b16d186b60ec927a4fba86f6ce3c801e1570cc88413007dd978bd103850483cef578aab68fbc60eab60a7432776c9a1bae3564b8fbefd9dbb2058322abc482cfc16bbdf4914f30bf9dd04ec9da84a3a96d2e9027a429e93a1889",
-	"478541c1282d334242027f0a87c881bf5ff30b62394f17395dd463787d8908b35e49bea96b9ee3a68b22a90029947673228a0ee0eb15e3fd1768f38a8706cf1e7fdc60abb197c93cc1b40fa34d5af4a85a87ef00201bd904a03eccb66f889b856507283c32ed1a34f2b0671e1b1b97adba85d9880b539c7a6fabf5f9a7258e1",
-	"bdf6c8fb7f2427a0b333dbfebb4108f4e6b45fafa8b56bd736ddec43449fb56628d07095e391f8b51711428563b4a34fa8afae3b3240635176b7538aa3ee4cc8e8e4d1faabf36e178488b62aacdb1d9da284420a4819b564976c4f5aafa95ce9a2de62b1c45cc8ff60fa4a37f90ab65b899ee90991d35d269ae6dffdcb55e239",
-	"51fb17839c9f2534b4aaeb8df237dc2553effa307345fb1b1601981dc47654fffec512f1d705543384014a1d5658b08b86b21f8522b01bbb7cde021be3190c135374ccf5a84adff473f1fe46c2ca4ebae572712aabe0ed7f78b27af5dd3dee80422e275bb171a789de464a9061042154bb6c4c15eb15748528385c210fbbb0f3",
-	"8bfebf0b122a9dcc614009a90563fc648f902b4d7f44231b2a517004426f33251203181e9bb6b4b0b9d5aeeeb45c9dd79c217834dcb39ccbaacc5023ec72d432cc7536d2afca68f84c7a8d596b901d44dd1ecdce0d10fc72bb1a7ab02dae4c7330e32c681dcf88e7d0ddb2045ebad2b0bc29a13128361c2423104a227dbf0035",
-	"d042ca2c262a6045cd302d6e6cd8bcf1036681fa5aa1ab8cb88df8dc5a00dd7f2553d034b558c6c6903b9b21900584e97a7f1145ad376a2f267f69de5f6f8fd1e1e8f4b73a5d01acb85e679658a748b26a30d18216132bcbe7eec5b0abefbb596e215a3f34c4874d088d3ff1a6624db519265d0cee10b3c7ff459d924f88f859",
-	"76caddf282219d715871f6cca25aaab36846a96ae34b6744790485ba7d435ce5ea5105093149691d3eec2e1df2ef20f4801fa54db469982d7997e915a635b6727fb32adde628e5ce63971abba87d451c7596b20368e1b25a243385dbde74e01fed25ad6aede87ed3b566ace662f8135bf47774fbf7a768ee2e937c64d88717f",
-	"4453398751f2d7dea45e599688741983537ecaf7cd415942ecbb0cc29d48e19059e35bfd78fa5903a2b9b7a603fa5e39c558f247d48a5befc533ad2d8ab3720b4cc300c1f86d2dd7b47b0d89518bf7e57bd4aace7d822031cabc2bc176aa3167157e0c5c46e17e63bc245a41c7ce51b1e182ec88b54d9c95efe0428e2266bee9",
-	"bb2593af231a707ffbe7db11ab2fe7a4db3273960e6187ed9121d08d17780cc3d8d7dca8091adf34c12b3e4c3561c8dd45bb874651c5eb0f615527e7b5fb090e206e084d73f3c1c6f3eff0a93661fdd3d386302db50141d8c06737f0d0bb7a08b19322552076f1ba27db983c3718ca7803a84d3b36ba0e79a10bf7f21895c9e1",
-	"cfc04fe86cffaef6decb47f03326ef9d3f0d6b7e44bbbef6c2cbf40430ee6cc4df1c41d96da643f683a05b57c704a4a7b8dcd127a0290624ddc619b419df6b92bc9fd7f7e6b71fcdae5555daec9c28bfd806f5687277cfe15bf550ebb05ade403b2c0c38ce2b5968e812a917508fe492e5b53adfac8a0a41edbdbb89fabb45b3",
-	"8de913af973dd89338c1f5a41b59b40b3f48ed7e240c1222993f4a439d5606c4911d0fabb103c85227f7b25043ce5ebb1761a9892d013983fbceb933cb1b08d528424f9d1e2432ff0d8c91aaba4b5042764a876806e636afe6c0c8ab2c69288f86ea3a7dba4679062b7776e081f383dec1512f999503a43b07ff981d1229637f",
-	"b0c67b3e2e0d19ef1d25c0d76de6c3514241a895620a1b0afe57e97cd2851c13666eccbb0f930b2d67194b48f0d5a4a83c126138d3b3104a1fe20ce7733d6a70d142da219bd110521f74590a4da0116938cbaf8e8a190ac394d32013fe0069ae97d88d9b5e5ce9fe61e74f77dc01a24b8d153b8b208afe7e838bec080aff727",
-	"c0277ef0795a14aac6cec899315f2af3b380381f331a910daa1c097d33c3f3f38b45838ec032e61603eda8aa9b14858f2784802447b7d393045529bafce9e439a197a41d193a917d3e3dc91af4f73218c7ad01a2210e283ff57f361371517f800125d236506fa6c8a57f9de7bd5195d70a6551f14ff88673eb79ae03ecdd52b1",
-	"6e6281b7d8d158f0b3243f7b85399e9e1208351ddb68297ff2ab7122ce8d024d3d75d67cbe2287e765e9b889da54038a7dabe9872aed7e3d6fe094ac7d76e5ba1daaa5618e76a86e3b1b9187901dd122b2513e04af15c38a748f83188ebb3acf4c84f90499841ef2c5b193c1f7eb647946188c5005aac9796a4494ad3a14f5f5",
-	"83d6057f2e7018e2418c653d750c834d572d900d8eeb5a9146a52bae05e3ceb59401a234b42a34282d40b6af6787bfa57a484fa69597f5b4d2818748be0cb79c324f7b656c6cfd73a25d24792f59639c1d01c825dd59af2593fc03e2b4a209171b043864ac6dcf77257df5bb67e2e0d04bdec5702bd5126b97dc6ae933d6792f",
-	"3fe7f4d4e8bf6cbb5aa6dc86ca5d11eb02615b6c27133db66f1ce352ee3bd16842570df3726b36220f9875809b0708ae3a37265fe63c15bf928f4c01ac88249a31c94f907270d1d7d418b4c73e5a47589b370fdcc1a30a65ef0bcecec0e9fe09699d98f6dbeda6beffe3d3f80aaa12071a0ff6ef6af42aaed9b5b310847aa1ff",
-	"295be37bceae63c97391f6ecd9fb331b64b78b826817682f640e0ac5bc5d83eb9bf61400c50f81c3a67bd05d3953da9792df879b06df77df53d2fa2642d4240e5169d8119bdfe83886c7e918fe4d0b604f982213bbe41ee097ee0f21596300a4debbf52906678422fdebefc934fc55d739d1f2acf2e7e6c1af0d43784c9e1d2b",
-	"899250a4b0ba419d8acfaf89a29af9945fa98eed80de830f8cc84d37c1ff62e5cac3187b0806de7bb1c31254429f304039cfb816438bdc921981e3e15052c0aa63190d9ea4c86afb4a448264ac7e634c810340955c984130b570e40dba2514dc3c917c5e6ad520d7093c2fc8c5644ec227bd823408467980c0df9af13e43fc2f",
-	"c88d2524ea499f73ad2a4cb6ea6f6a5e864447932a2aabf80260b5696909671e24a4fe577026ecf315edb0d67ba93f34987e1fc1a9fe66b155b0c33930d08b2cfd2048798763192a30bf829c8f6dcee1ed9f6b5f73a43ccb2d6adfe2e5dae53c23320b37e6eaea89ef1c6a1c62b43f4a8997f27fab110cf3c23cee5502128db5",
-	"3d3586b9bbf22da4429c21094cd6ca15f50431bfd639f7a50247c5cedc017622d08d95420b4689e42a9c222a0bb7b5c77c7b6cf9492db5dcd9e99ef21bba15e094a0946ee49266117cb649ad999be85773802b396006255a242849b44169e8f76b71a5cb83b0076ee5282e5cc0b5ff8b270fd9dbf420133bbc1f651aea89475d",
-	"ceca6dc8cbab7df208262f8b114b6baa2d3e3177b3f0231b8d3c435d6424ce95096cf4c8ef95166b7e8a1348d2a802ed9618a530a6b8d207075a6fe2c039515c4c7c66593c41dbd0476b7d282e8d5165e18bbf699a57de1272d96ec16521df7b141f9a863c05f253ca2530689d30c1ebdd54ecaa806a69fdf99d79833352f869",
-	"547150b7ca625f4f1c6eb497634a1dcc2654d999159e3d3fd9a41857222d70c55d960a36fedb7673dcd17d97941ee63eef275e2c64cc47bb86cc5a331477e8e24e3083dd6f64c5a7416b5b7439f0c3e3a1ff1006ca71d668d13bfdac107a135f795a1f2bda33a3da603eb0b2a7aa0466f7f3565adf70dffd1b3912b7057cd6ad",
-	"1663d098ae2cebdb9bcd83c09511587a25ce5661c9681755a4eb6a81068aa4a778636fc49644d9e4a30794fe48651fb9c6d0fab373fafddce27eab1ad531e5a9f52783a3089395f68a3f40aa4c9c669fe0fbf35986a52f3d331012681db2776bd41ea9a783f01e2d7ac5faaae720f5e660b071c246207bfe8362953dda791f73",
-	"41ff8c7b746680710e5298c31e344c607feba006a8bca578086601e035e633a0ae1fec883d162c48110776b0b1d20b50238afeaa60898a0bf172a75565adf8d7ba03c5842646e9d253693d747b67aece5569309b6d7ca6807e3db9e1164aed7173a735bc1045e1afe62dad27315ff2ccf789a6608fe52ce7358e58f6d308dd51",
-	"9b42d1beaea7533ddba3bd3cf9cbe232853114f1166d3adfab08e9a3d8207c5322cb5ec6fc6fadcdd2c4c146e94637c2988e23afcf587a3efc90c6944040efb8a6bde8659369a146014c804c00f295f3ee926414b548a44909d484d8f024fcb0b3e8a55f57c03b03263fd2c9160da48f8d5fb1acf40c679288b633cffe47d4d",
-	"c8ae273efd545e364fe2eb72852b8a0326da71ebf22f1f8f3873d5e5b4e5dc63547eb22ff2cda363b49a3c969004e2b5bf402942928836f23b407a2b8278bea092b6eaf59b09cc6212fe0caf194a62b222c677c25d489efb6810ab1bbb50d5d69d5a761588d8b4ca26a538e70be45ff222fe533bc0c5c196ccd48f4210c7800f",
-	"5168a90b4f2edc32ccb05ef280d8785f8ead26a12d8e88eaea8a02deae9ab3a8b69019f5fb16dac8cb3a727b1b2f2844a44287c68c5a582ed2f1010d2a8abb912c0d6b4d49e0489b2c47e5f6020372dc548e361072895aa8f0f94554be10d185afa640689c69644b40fe51b7be10e7f28ed2f07bc21ca70a1562df5856a3ce83",
-	"50cc9492e6cea399d9ff9cc479138e8a98a361969764cfe187e1762487c4104cb085dd20d7ec4ca3e79762d505bff3c6496b7ca7d32494eccc58290024ac7f95d122d9a50c2205bdc1a16e84c7286f195f8b67bfc7c9e5f181b6ae06ab3e2756b120b4bea788b546b22d522458b0d06d37de5074f266cedd332a3b1b279f1129",
-	"bffc7958dd70c5d619beff6b7bb2426f2cccf83691c149e60038134bd35de34429d8917cd5874744cb7af0155e7938e98fc6cc0b5bc5f377f83c220951a2c9b64c9a51333a38cf263a0362b327097a955b7d6a46ca9272ee80e552a42e9829ad5f126a81fa6359ae606c6465f5b867a464c1b3ba07733e29abf07b7e33112e21",
-	"b5d6b126a5c3b49703ee86132b4ce711831f4948e746a9f6f23beced712e74790815c28b48392e8edc3a773f8d9ebd214981cfa0d7487a2558c809c2ca1bb7b998ba3850124ba330c850c54322713a416aa14d6a2e8f1d0daf6494ff6e855e53c8149ffad1fb1eeb3d3dbbe4b5684a8f8670064846edc0e532f1a595572ee741",
-	"ad524cc9be2e7c53c396b726711979d45c1e5092d10c5a1406b26a7253ceabd09026230dd01d42149bcb874231c3aed9211cb688ff9eb55067be08df3237982dbc25b9bd4cb58bc4264831ef1f61939f34722707afdee344bf2f9d5b5cc3cef32b01940e75912c914f7f67ded6ed88d42eee859cdfc55016c10d2c39471603fb",
-	"a174d82915c8f10824913e6f70f6494578e69525218cbf4a449edda78f6250527532435b96aff7515097fd07877ea4bfcd0ea5baa109e2f7bf648df9efee57554bca46421ac6805b2d23dae58c9a4cbc3b9367369f3df3548fe7f7aa269342d8d872719d165e179a0ffb07eef7fd76d6fdebe9bfc3d147e7042614dc4002d3eb",
-	"78cc58f0440da71f6d552818995eebd2c9029c37afd4e1df3bc57da57fb16de3a2e5db053e62eccb437e877702068fd17496f4dda48435699d7438900d12883930fc80a296594223acda7995f8206a33b7961d8f913ef71c21d75aea71b825c2ab858330d6633bba4380e084305a28ff6e24301102a733135e8e2536c2f5bc7",
-	"2bea9d1573b8c643d86cfe10e8f5f6c7d562da9e179059c65b6aaf15073b8abb45cccca7da35f83b785767accdfa43781ac103ab0e324d691e593687ee15a36cecbcdb080815d9138acc2d3461adba1f45f69ba2c879e1e1cc35b54017da892d1b92b445b7ec608c3544fa9992dd19dcd5a87c5c5f9c7192889312854a1abc13",
-	"b3e71bc06d7459d788e9885b961ec98c4f17a926dcd1814e7479568115185403622ebc75ec22f4a3d29f8c21f2055ca47f54c78a698c04842d355700716bcf26008c7b534dbb59a8a53845353be08ccbe10a722390ba9011974ec663dd340925d1c30ae2973ea2e2868540902b9add46bfb89a5a4289dbc48d2f40d7a410c0d9",
-	"b8e72ba2f13c76a35d13c27a0e2fae0c135d6eb79a03738d7a6d93c4fe65cfbd325ac4530e84e10fe358607fcd3f6961f87efdc7c9991b0f326397d012672034ef685083e27dba8ab5ac995b862816f1ac94edf47708a78e8f4f004a78972a9e8b2e1df768bc85f883055669a6128cb66f2469397de112f9f3227c1cff78045d",
-	"bf1f5a38f7de12dbf3342228dc6fc47de45deca8d3e31f3affce978b67842e95a4ece26d0710cfd0fafe04e18094df78916abd3d7d7d9c58f93d83ab2fb6c48c6b522b5fe1618830484dbc9f273a8444115eaa693e63eb1bc0c1a90f8ade3488b20e509dfb3099aab4e118ad536cdd989f40799e5b33310a0eca2cd838f6905",
-	"67f5ef2be7632e12146751d04822813a42aa0e6418b88808814168ff4a0d0f8175870cfb7fdc3ccf5b8342623192177a461e2d172654e7af0c1b646545a197b2769765fcc401fc28a8ed42099336c896f4cdbcdfc45beb55e72767156a63d1e18a32c9df2ecce185c4f655ce1899682e1d60955257ee994af7d861f210036e21",
-	"c63ce871e782b4041c31c1718b77904d4a85bfa4fc10e8f587aeaae19f6b7efda7cfc40267126456702089d2af2ed14a3d452b72d8cc4005e2b0481f3f519748bdc4ae39095527a7a626902ea5b6b2f4e8ce53a5fb7cb4a3a2b9fa41af4a01e19a2c679388fea126fbe39c9b0c3958f6e483b3f823230a6bd3a2c56893c4fd6d",
-	"261c5151325b5c947be803fed40e1201518f6377fbba4aad723be6d4182176b808c16f63bf3571d7d4f993ed00b953b51aa15e8da78715ff60d00b2e1abdd874ac729ff2e19f47aca71dce77fa34212048a9f658e9a507027db7af72fa8bca84861044b9c87594f00fe268bf7c206cf7ecefe021783e9688d88b85d51be21051",
-	"7e6a5a0f3bf53c5b560f4981fc2a78d33f68f709e8f5f7d26cfc21b31380e7337d064aa32eb24914ab7d02d6b22cb5e5b4b561fe0737a473f3b3e091a2d114dcf3eae1fc848b173719d14605b98b033529786705ebdd980b96bdd249fc222cc5dca2b81da088db710c48fb3524244de63aa9f8879793f4848eb30279e5052129",
-	"3c8a09cf08e58b4b624a3db17b4bf7af3f0b755c024535b3d3448f885a1dd95e318e1db17cd1ed325ccb6fb33fcd8f2e1e6eda14cc9442971faff8bc962155adeb1df643f8a4a35a085179a1bc10e6619cf720e7002a9a303088d359bc5e87bfd0132613ca1dc027d75ddaa0b37245a31f1d9173302b3c0d7681c269c1582037",
-	"4c34ebb8ec7a1a8e223d488a4c3fd8ea25a7a9627276684e2404eff1a14ae79902daef224231af1a76dccea8fae22ed19def51457bef4746485d7cbeb7495b3b31cf035795109dd4f760cd88da93de3861ab9d0c837727eaeeb0a56a423678100f0707bde58bc04f3eee524d2535065670a220394224d84c0dfb31814d436ead",
-	"822ddb7a6978414ed03b563ac64eba268fe68de1beb6b78df21b1fe79735d8bab6d6f008eaac4736c9dbfd6b2f2e77cc0729b1602057d38c9b6303d6e7e741f4f57d696a2a250809add0b8a09377400dbde8b3c8c451fed950b984a717e70e3c502b221d01df5aa15f1193a372f85893474ac7eef55e7c36a1e1d338f4daec91",
-	"4026a000eb55d5afa5f5f60da7d173ce60d7de76e651a5e1232b838d83e16616949f0a5af8715db6d5e6d61324d9820aa1e421acbc85e64cfa6dba98fd333d24d47890f0a7ba1e8d4b13cceba3a1fa4cf047bf261f18626a135c6b8ecc565a0baf6a3ef8cec5465148eb27c9e88f5321a46b9c48db5e5a7c23be6684e7ec3831",
-	"4d037bb57eb5bac887a7f791cef76326524493c7b1b87881e74ca085c48af14f8db63b67601bf30825deaf0c0bb49db548ec116d9ec183df812276b30b06ebac7c0419cf2c999ecbee0a796e06435afe61ebd2eeb083818744d30bffa59419f2c5c89220abb9e2995fb6069c073174c0aa83d63cced42d2a2d2f7d681ca9860d",
-	"a115dd1c9a2e2ea6cf77335003c32b46f075babce4c8b76e693bc94edbe44fa4036dd6f435639ab2ffbd6ce9882dc071f8ee4796821044d81053c6aff11eb6e867317e6bd00348ac08c9578f6b5b984a6df58e2fb38302b7e7da9fb62dd7dfe49c7d6b07c4fbe3ff0732439ef64c72bd78f14e2ec8fe82ededa79d385ed27809",
-	"d8da12b709374f35423d5718ed9971f696b72346c06b3416858a82e5475ac7d92acb7c8545e41d8997ee14f2822f90c52f1be62e2040750dc5a73993fcadc530f177d31d60ababdad77ce6a7bec6007fd72d6152386141cde8a5423c6f63fb276c6e409e2e39aeee7a226374a24d78fc4d84509073bb5a73e7cd179bfd3642b",
-	"576fe1aa28389eebb4497af81c9f9ae3a94a29d04a559eab77699b52a11b042fe61fdc22e36a7c24ebca2adc8180264fbd41e3b37984f9d1f91b6f4ff26fa8634268fa0cc8ab64cbefb7084c36cdbb3610ec92390b8f997d3b471ef467c989d951a67af7a016a74f45f641b8e81c76c012951a334d4ba2fef268bc3dd3869e1d",
-	"b7a33b9c718e448ac9f4543e4b7ac062ff0d5ed078cc65934a4bf5fcdd651368b00b7884f8344a14deaf6cb06c309456020f1bda3984cc386c7ce901d5b7931a16f4a9b109930cf70d95361b7e55d2d211d1a1bf8cb3c819496329c3adb1b4e4f2a466e83689d994d17e216aec6eba6a5a30231147eb81a7a84629072b6ee9e9",
-	"8d458730fb9804d55ade6b2537f8697eab825eaa0165ff7d7f89301683e9bb494a1f9757e309cf3a25055f455e4231d0edb79d25b867afd5b98b5806e8f16bec3e1cac704eca2818379806db4fb59529855d7e286f6a4e7a6a8ec79c1f0f1488cd90c5f623024ee37de3546a886eb701c7f1711ff42c2a970975785e09369d59",
-	"105f74ec776eef4c630c7fc95a80ebafa2c24d239c5e7248e220859e8e93fb66efdf91e51fb37618991afaa2cd3e3f04534fe516bf75a869903256afd44739b50600611e4ba531b9a3a3fcdc42e330ec30ffb0e406391aa27e88cad0fba2b9bba604257fbb226eb08c0f6aef94ab66ffbb69d28e2d9adbba8ab29f86296b0193",
-	"74712d09330d3ed86672a1e10d4735d31194f1fe04652c7d7915990cbd0fffe4397549c7a72e4293e18238b6acfc09285a4912fa4ca0858e2be3f4f5f670c71bcf7a7c3f0927dee2ee722f5eabec35bb26e746c24eb0085b2f460aeb3b231ab4ada84df31a88cb58d237f7b1853ebd7d46e8045f7d1d750bb2db14bba81ea023",
-	"3b8a548e3b1b9d1c94b70fa7368acdf09aca6699d83716395e483d7d99e8e3faeea93d19502b40679b2dc84effc9e0af66f81fd853ad31e36431415c7ec9e37bd156d3836d97b2555989677d93c482b4ecf9c1603ac80b4de4b15cc4ac2d206ce36a9f99ba900b8041ebd05ed2e8c02f7f9f118b3eeb904034a374798675b633",
-	"3f5fea3fce9a41e7e2c5f76c1a35c8db1c4e6a530e20bfa4942d87062b9393368849c806a2c2916c91336b37c14f00daa090623738d1acb9062f95cbaf61bd24045f49d0d06f0ae3d9b0a4035d5585346d6ddfa83cd30783f1e79425941f91e9b14d9253c0aa309a4a17886d5a32ef4f2bab6528e9320fccae13ede5fc401b4b",
-	"577a6321c23cd39979c708909b712cca4c9ef58a222adeb86822f7cfdd8993d77294da223ab09d9667767b402bb7c9b58c55ddccf7a4ca09f9fd64ca19215888b65ffe96a2f1fa98bf81147e5b6aa98702a377e0b4da61c603438c6f4d221f700d1e7a46aa670b7a8b666b05f12cf95321a37b85a91739891af17386c9ccaa55",
-	"16befdbebf8bbbdda66e24ba287870da084a6f67e7d2688371248bb061aca17e725c092ed250342a1f105abb2e4c9d2cff41049afe16a62365a9f00cf99bf7d4f06764fe4a47f9ecef381fd432f13a9c25df5274ff54686b6ef2d2f618f7877a9f727da84cd497769dbc63fb08d7d6f41b5f0bf5eb9db5b0de7f704292d0d205",
-	"b46be0d30a53896dfc663aad31ea914d753256606e95c4b65c1c8ed05f33f2b1580c9dba473978bb90cd034b8180f6a1a440e5c97592bc62fd622b7ae0e1c8248bca859e019976c8be0a361b4eb13c3c7a1ff68bd238331bd1f8793f0364c45b84aa874bf87fac45b5dd54de8170be2e7437ff69b116010b0cf4b0424c16d901",
-	"174cb2a7dddfd0a68f56791260d76d3de6c205483173b850aebd0e2aa3a52bb6cfac9cf2a208f9685c475036c7a83ee9e2673dbcca0dcf8c76ab7c55e78f31d569264b1d481e1fc25f0cd8946207faf4245a198d8881989e05cdbb29bcb416dc71bc50b59158f2d0aceb47777ad5850258237f3c4b034f17460299f1634bc14f",
-	"565410eb8cf9e1c25891a79b0c1e61b75b4ba2cd875a9a1345122dd50564c5b0b3110093b8e001d86ab8ff67ef7dd946fa751844ae16b39ea3fa36c65c58fcd79edf3b91164d279afcbf83641acf9ca594024adc86dfb57d0865f28f848ab54c07ec3c7e94e51ad37aaa54d3b6c6a48869d08297816bccc5ee8bd2534b8e357",
-	"9986b74884425ba66217a12055e972246500b6732e7dbd8a607a6d8daf5fe20b7b758fc93ef2cea33e8b8b7ee851aa6b512cee25c1c6d464aed21d6ab83d05b66dc56e2f1bc27528fce88d8fd7edc53ab2192d0b542137639c36187b3029fb35d0887d71a3e0c268a1cb6ea39f5e708a73470916170966944987ebd776f5d555",
-	"8705e3652a8497f4c1b8fc4262ddb1e855b28dca38d6792fecf839d26b6d9063ace60ece2fa97cdbb27c841077e0155ad8c16d7ea08aba2d57d667e4f05fb606dcf0c67fe802651bef4b84e074cb70d3eea8798cab37a527ad62d6a1fa91ce6ccd17d7ced41ed00e6a978e5a19ca92ac533c30aab02b01cf7b8f923ff3295a65",
-	"f0a099d3f78b4a09fe9dd89d35dc034c6cd2f9f080a46dbe6c00e3cc004d569521fa384ad47b8d32186d6033e546b031a7dd30ac269caad25087fa88f9be34fe26fff14959b7ff5e5a6deb1b45a11163cbceca8739c81fbcb1d25ff07a7f2d2fe75e397edbc80495429f4cfae737765b715a0134b3b725a1e66cfd5a2ea0019",
-	"57e921d7b8685f554a0d2c26646a6cf6d080fb6c0d54d309855b0366ad63edb3a0b9cdff91292ae94e8808fd53641910ad35d7e0a76a2848a668ae80924285da5ab4df2719098071304896ea87233f7a517ea214d7485a6e65bdc191e8de34b807e6f1ed8a4829a4d93cc9a2cc6fe72e8b4831c5eb2dba2f27c0dd5265136259",
-	"a8de42193968e6cfd2df6b9dc32798b7dd582a93acf88543ab0a7c9e1091d55332c52c3d55b1924eadb19177b48e34dfaacce78b62c3b180ea29e4f3d978bf414d153eada3a192a6eb51e6fc8e37c541c462291bd1d9397ad44aa1f4dbe03e2256ec31f25e9abf9e9843542df6e8667161e3525cdb5d36e1a6605892530c9319",
-	"bc8728c1fb7823dcd7430f5da926c33fcc70966905f5b0ee04e9ed2b3984f7cda3462f7351a0707d06e826e521da0a936d65b8f7cc5cea7f2e068193ebb0339aa5ca36f1332bcf2556e203313d408c15277a8f7f4e02bb529f4ad1d9969d83f8e287a88a09a6d36ca071ac673886b70f27345f228f343b5cc8c1826d00c27e9b",
-	"bb554aaba3fe94aeddb22654f186dd7f17fe25c357602dd82c69ae5d08a72d45a08da32827b5f5de6045f984359f49dc5471b2fe1a88b764e7ae5a23811c09efd96b18242d9facfa4d21f2cf3f279516491ed6cc4e7d47311eae2ec6165154364974d3fbbe323065309992c062b02620ca4aa3eba1907733ecfdd0812d607399",
-	"9aba1c0a68d48c119d99017b074cc87a024b99885bf3e035358894418164b85d1d4591122ef0f844b01e18c19a7fa0942240baa38ef63f5b5d46bfe5524d5dbdacc62ad9094e97d7e361e2ff90adbf05ff87d7cb98fbb56708a332026445be21905c1b00626753b0d46d6080f71d5738556a87a5c1c82b4b22ab62873530cb95",
-	"418a45dabd4cdc2630ecc90f3c6034fa45d0cd63d31a291654d2c244dd71bdf3475c978e0c3516e8d344ff3d443a48f046317e06b9cb4c1823e706f408c62c885162a98ede826c889ee80bd736da4ff027cfff573c66f01285f10a7c1b3581345ad9783cf1b604231ae6846496e21a57dd4f05f7c84cddce063323b325766403",
-	"a5b314af6f8da2d6e11f80ebae1f574331f4a96fa9b1c363ca1485196481a542a71ea8b13acc3e99766aadc7edc84347437e04f5d2c89033897e0d5ffcdf7af0f062090f3d878ea94861708d4c8e5ff9cc1445a7ecd45bddab852d26f3e4941332c26b2328e8bf620b7665574a73fae72b9d2b9acd40d1da53f0be57fc27c049",
-	"88d1b2e573fcf0ba75877a5fccf5f7186943156988ecbb91168ad756164d30c83fc17c8bfba9725697bf89c68b5a7a1c95a4ebc3148a5d522934a2d0fd1f195e81838fb1dde7da02ddb2c9b22be310966eb88109823811369e8c072bb94d871215dd528808ad56c71213d6144cf625ba408b46f33038a9f10b5ec9696b75b92f",
-	"6dc79a14216b06e6536a50063f2e3d58131f9ef495a4186b636cb6669f0c1af70964844496d4afa73f7f31e4a027de6455107ca621b694bf0ed63ab3d2c25ae6d34ed1563ca2030b94724fde8dec954faaa9ce33dba2d7e641cd34f6a8c6e4637d814e936bb1311c5876e2d7fb8bcb9f64022d6332870c7ee0dabda3b5f8b0c5",
-	"c540f5a9fcef1b66ad3487d2a869d269b3281a8d630daa0d5b25e6366b1f7eb1734f2ca6770ab1fc5a5a6766bd22430e4403d77685c25d35b57da809859355e2749a4c42c928efa792dfa50677d4e3fb5ffe82a95ef9af7a1602b9d6ce2b13d788c1d2b3a24d3c0ac4df5fcbc1f2355d1a463e28c9680e9dde68b94e020b9673",
-	"846c0788acaaf2e9a76ac63b8b7ccf28ceb605d054a1fd490789d38d6e1675811c7d56c125fd44619017f38cf0b4606e597d0f98d1418c10b6bbcd540c82d3855cfcd74793eaf9d0fb362ea542ac1a390f1ba8b3fc26e47e529d01483bc67cfc1f93940644aab270bb718b8f64a723f5ffc9aab18494e9161bfe1b9307243297",
-	"b28c3ab2bd7102d40862aef93c17a0b8cedc1ac9d1581608b974c011c5c18493867fea1d4428cee389b4c5419f23ed0ad874cb1b1409e6c08777fc1cd438c960c79674f8cdf6e970fdac30a31cd20530b03f462b341a9d6053e13c220182b57193a0e6eed3d353a878f499b00a5679f097e7d387198a645e579de1e24eda8697",
-	"c7f2436b605819250deb0e69c2ac97dd413f23ff1a3d121a1523bf7c59bae751495998bf6469cd9e8765c04bcee0fef859a38cbfaaa6344706fcb35f997d02e4fbb58676fa56299877c20ab7d7cd8962096984393ae3bc726176d9826bb03822965714a9adf1680fb233235273592a1c8e990ac921d9a3fea98b18644c65d913",
-	"a419cf790170efdc1b220876bcadddf3efdb59e5239b4ed220a9891f1eafb5e3f83a4a24d297376de61134e5cb18527294f42d9b2ceb0d4a26fa5835abb283fd914eb37e7e2f79815cbae2fa15cc2e5cc2bce0ca0b661e15f66769231e1b789d225b92fb9d08842cc3ebb4f1912994f0d73dceb9c014ad76e067e22c3703a43f",
-	"2c1cfe4d2b25a5a12dbdc1c248e7503a951bcfb2ee22a145d76860944bab1eb9be9c19a740c6488f4818f1cce908e478c4859a2c748d65dc2b231d94a8c545be5b5df33b7152395d8f1cbf30796dea8bc86b3eb849614cbf854008a1c8d07e0ee15d36acf103b7a1973dfcd3dc7a04241337c0f97d6b09f742706ed512d63c9f",
-	"65042528aefb0ba5372aebde5ef5f30e8f784081703dbfe8e5d29b45fbfd0a1f3f2bdd2db145f8120dd4f459016e90b3306bc4b47004538880ed49a357c8f0e819ce306efbed507d059c36b26ca908364cee8590caacd0b2a8f0334a20a6f857df4233dc0c7f7a8b4397ffd428f6397978c813ba9269582509efd3ab280eeb13",
-	"8f40099990ff155f52b17ccc2d0cb6710527d4203a191636b0a7e322a5df4c32e8a3df38cf7a014ba080b3bc7efc5a526ae322f9b352c0149d79ba21e16508edf0b0efd8f36a467b3288faf359aa2ea3c9f778c6cb9dae4f57244387df5177037055a019816567eee5d90b5d37909a09bf148fb274190c5b501de0c62481a4cb",
-	"74b64aa4341d5ed39ac8565f8730f0c5d6eb46594aed41721f765fe71bc37b925bf18555a777f33bbb3096ec3db9fb48eb675eb15511b0267e81cf4aefa56bc9e25be4fa1739b6653228122d1612be583ec400c29343caafb98f562eccd481c496899780832ce66ff21e58da79ccbe55fdc64f37c06c12b1a6eac091048a90d7",
-	"2a895d24c319a83ff5d91b7488f6a422369ff7fd73b8a41c84975eb0975f1fa2f57624d6ecd58ad82a9d1ad39b050270f2aa7a73406480b4af4b8d65faeb11d55015bec92391c6c105790fdb1f7f4a7bd89b782a5602a2bd7159008b3e59037aeb99dd39719402074322aae47bf9a5387e804b21a61d944b731ddf95aea2a9bd",
-	"41014e378d841d32a4be5f3c66e5ead24628a6f7600cc08f5d68d4854231c07419047de586363a6a3fde06a3286f726e8a06c48dda8d2a21d4f83c385a51c2e90909401abc14ea08074b4cfd5b56ec8cc4ab108d1e13160fb14dc38ad66aeab4b57bab84877f8219e1214ddf8e9dc77f3c7e4d82983fb084e4379547340e579b",
-	"23320095de0ad163e10b6362ebb49146af6f2f6730e83ffc1d9fdc0cf91cc6102ba759ed03cf936163255c6fa55db2fc1abff043b6cb15e374cf5e887289bc20e71648eaedca559abb001c292475e2e307ca0738be2709f42e362fee413f477b2f145f7ef2655ffd98dda597d051189f32339be99efc98dd7f8f0667e11478d",
-	"22766a23d7ffbe6182058308353c3cd78f2911598f29a6959838cf66d44b2603a7cf8870ea2e8cfc94594f7a26194169a078713afa6c7a36db1a181a8fae1206a7407de74983cf7b070d44a0fb8686baa9b22aa374d176be47efa565eec09ed569215b6f677dc8f237aff0bd10c5802c00bc2e7e6a19ef36b10cf58434948943",
-	"547289d3de45768651e85f467a79616716a9b63dd214fd790a812dd678f27936a3d1d52a375ababc24243d66050628f2aa00455ea8b9821f5ba0ed8d202d909e34fe4e4c651a551f417b99d26705085dc23ec816ce1e7614a406b06217610b91f4784655b30b301172511d7abaf178340a9417877dad5137b25b0bf69cb5acff",
-	"2fbc02c3cb5f49e3c9de46d9189270f1034e8fa0e1b5cc2624a8d306c506395c83e66d2942c066d60b57343de7ba14ca93146a0a3c80cfd29a3bc061c35f2f922cca2ad7c4a9b5dc64e0a6d90aced825e19fac5b76b0c4b31814b22505f52bdafce0e8f19a80d63a7e6c2c28488525b7495739f74a5e75d1d3ea717e68851e8d",
-	"868a4d9baf71da36825fae9e729839eec998ed71204b237a66d1b91263a05b0fcc1a674e42a90140ec7486e347453de977fefb3b33aa38622e4b44aa3e5632acc612b3757bb86d2f72e4b607b0bf0e21507e6703b3d73b5ae85f8b5aa8c62350a3240329e8a1e5d2e9728977c3b7dd306b9df68e8c398c76dfb407b324db8fc1",
-	"4d157c4cc49ad4ac34e2a3627855dd54ff68b21e78b890bdb96afca440d4e0253e45be35f4bd1042007c4f7f2c997f3149dca270855e7756c6137b41ded495f5df191adb83da447379de67bc8274ea5b02d3ee0f537e997cfe45e0169bdd9f0e83a92c4a194fd2ccdf470058d0910d9d23e0ac8dd604e6c063fea1d935b6e887",
-	"c8fff080613c7ba74b2fb8fa05328c78d8c2db94b5c6239a120e0e549c3b1a8c7323d5b8899de8a92f85491ee62bf6db824303707d663a644f1845c88fd57d3b880f1b384fce9a6e3be0dd1d2b441cfe82ea6b36f25aac3f7957b588dce6225e30f14623878127b543b95de4168b28eb655e2805e122f01c71aa37cee2956cbd",
-	"7fd8dfc565db3469459f0e51edb85309f6c306776f9fd6e2ab24897f82d5384c16e4a5835958d59129a566a99bdc8e2adfb0b95668888620eeeef4c805b70db21864f6dd1e759bc7e45ef7cdb2376419c75a28c0b3ec33bcd0317ff51e5082cd43dc599356331db331c3bcd5bdfb73f2491970beef5bc0dc0155f185d05bb273",
-	"32289e82bc1c56a3250d7c848dc965af5729176cfd9bc51da014ee90910237c076c8f18002b19a79fc994066e11b486061f83a4f3cbb5ff54e7a4b1d14b54e941d8fd9dba88718fb25e0e244e801d5550f5bb113d84fab08062abf6e9d4382283bc54a732d35d0db3d56df007116428c66a61a6f370a3f13dec288f7e62e6a53",
-	"cb080f0c62821a10277de324e6d390f91701c9746b648617be159cc7cb9c7162c485c9e839200d45179fe665dc9aa5ec5313daf87be3564b663f6d9d9c40eaa98221efad877bd0581d23c036027167d582ed0144636bf0ac55a32f58efb06e165a4ea3974efab5c4bcada2b96c1adeb7514935a3a8e2a0dc6dc2e5b058870ccd",
-	"6a90bebfb86e9a29364d9f918736d4a6484a644188d0c4a2cbe6471b82a60b96e6301dbea885dbcaa3794b2e1336e8960eb615713a7e92db85e7114fe8f6eda9afd438e97959b8e156a45c8bc2d5f9e1786d225536650b9d935de3176154db74e0b0ec74367a9611b3e30e797932208f2f7e938b4cdf21c5392f6120a6ff0e81",
-	"e74349307ba9a06e26837bd32f9e751dd0dc32a48d37b7527b60b64e18670976f81836b55f13f961b9b097af717325c17b485ae107225fa58159847880f0c628c6ab862c0bc3ebe581e4412ef6945e49b5449844733e23ab5923fb4d8b0f28bdccbf7c052c83f9455da975b287de76e704ab684d6f4fe41db6fd1b230cb0ecf",
-	"c10827ea85223674fde5b5bd4677194b6aeb2efb9c77321e36f3ae08462f4dc1748b13bfbd3fe999fba709e863d81a2f9fb1918765c0663dab5c4bb468120a2d7ebfd056715fa583e3a76f60215b93ec99f3a38645d2c2c110569d219c62c81c464930ffb5555b83de27064aa7eafed24b7801c9cb8a3de50dfbb5241fddca57",
-	"78cef321cbd9f83053ed9a749245d541c54cbea9fb08ebbffbc22a1c47ef10299922591d89ebf8fa9912c802b9260f4520c73aff42306acad9feff381bb69676bc18488ed8036a02346868c0bb67d39ceba77a7f8518d7efea4f3c7d8692334b7ba4cdc51910a076a3c8643fb1f2ef546d57b4136fb2c93730f4820f1187e3ef",
-	"5c8bcce95d744bbc5570d86a4b78e2bc235158e6d7c6d216577fe1e128a380c355b8221de93f2e69dac9f17ba40fa4282e2bd5418d41229398ae2bf0cf5325cb2e90acb3d343cc13314fb4ece4053d1dc3f353e28168eea4b8f15a5fd025eb0097adac84da96c30c1a45836ac0e5a006c2ec73c71f5adb7d61905903f8c47b1b",
-	"2517b7728b2f07624dc1f24c361d86514885f6c8ba31ffbe015e2c919181a1b91f0926fd4d596c167d217b9a190c282750014fa87a358b48e8aceeda4789e9e39d6307f7b3944852fbb0c6cab2a4d017a27bbfe7834765832992be21a5f4bdd28be7b2fc5e45905cecdfcce32f7d477fc17a8a4f4ae782d11e55dc844a728aed",
-	"3edf209cae2676bccd3ed8f66e8160f2dfdfcba7ab98c38d0eba42eb6bbf5a4370e0b9ac28ad03c315a06d8022208fce90dd2a8ce0583b941a9ae7da9c7cc7d6fb5afdb2110e60efaf5baa8e6a5b6e0947c0b5792da96740358de062966758f7725d2bbb6a1315b9ce9921dcc29acbef6e0cf2b09c77387383ea22eb03b71901",
-	"345b6274cc97bb5d70eb5f3689990378e5d6c9c9adfc1124bdf3905d4bbb83d355e984a4f738452a1daa6b09830d9efba466f2d2c2161322c946dc32cb4b10929d39c9ffe8293066fed91b95b50c9a713989d4ab3e3cb3278745dcd97730479eca55352bfa45824185050ba22946211a4aca50b9821d5a65b4b2928e59148c07",
-	"d2d0eb91d4ed6678c54d4742c76b14575caca6fef2cfb3a515f92ca0fd8f134cb2cb33c8b7955f82ea7aa7df961bff90b43b70a8ad86318c6891ee1cd472cde9f209415e7b976a101a5e9a4830b8d7bc1d7787fa769a0509e5bc2aab823f265f37e1771d28ffda719625dabc17c729bda8a4e67e6559718db44e05f3ee2bcdd",
-	"458e9d809992639e13aa5c91ca9aabe4cb83a710ed666c02bbb073b0d9cedcf18ac7fad4ad7d2795a3c174e58cf83c90c09a64fbc81845eb41dba32e1e9bd373ac8da90cc1705453fc902e881b40f6fff073dcf740b987c38308a9351e94772aef74787c4296853b168fba90da561dc046565f759590cc861a26421b9de20357",
-	"7cbd87e11254dc664b5f22635630c60cbd73c52852a2332304793bc9d15970db5db708060d9f64db3275b0dc6694cf0db9f52e338d32900d42352a71f21254919048f6e3419df590118311a4b837f89eb0a4e11e1cd46d6f837938ae037f39ebf50eb2984c727b02443298f82bf5444b0845dabf969f1776b03bed78e0a04e51",
-	"476b434dabc0923e0e0ef631a60ed1e807bedeebb716dbf13891e547478f81d033f5cbd0f704627b9770067018d3c8460f1b6e1687000c8afe34e4949a3eddc94537c5e86ca00227157a6f40d5b5f1a3fe5c2921a740087f528580c1ec912f34e0e2c1054446b5b9d86e987148bf40e2498c4eef4d2e2aff4e740f62d1c98351",
-	"3b2ac61971f216cfcbb26cb890a9797877b2d564133da946a605a0382e43b93706b125ab23070ae631268970f7ad271b9e2100840146e38ff74aab4b533d902138907a9234ab257edc7bfaa07a98e6f014270b4083099001c6d3958d653a4a0ca1c1b0bedb34e997d4cb38f824fa4f8c17cca0f615c4716fc98f92c79eeafe63",
-	"2456a08fdb6bbfd7f1a92f0893d855e2d8060b832d99919a7bdf7839b44eb54a6cd3cbccef5bb411d9d92cfb40aa35eeb692d5ddf2f73e50d314ca5e737f8d7e3279eca552b73feab6c35a2935dcbd88fde1369df4c72576a78331a48e9f204b1774e6b02bd4b09f9beaa038b33c1c1dd04c905572ff7ef4b59617f2dd74c8e9",
-	"1737d1ae6f256807916e6155de2f74bd1970933a70a86c766b406c03624644a18c1bceee90052e7478c1b2dbb1440d1ff1014da45e2c14c7ebab276ae72abeeabf4be0a29c4389ac65a33c627d1218ac1e0e57dff8ceec9aad69d141cae2df52d3bb1d9d83afcbe2bc051925e5307a5e768dd433aa55123237f92c9ba504cc65",
-	"5e250cb7865269d2a41263c6644cb77df9da66980e961e8e70b164ba83ccaa4753927e7dd6f39539d094c9dee16d8e49e64da8f5e2e3823e3a6d89e20e2c6a28f45c8682fc6837fca5dd968a55d410f87dfc9c50a2b0823583f37ccbb8c1e9712caad8e525fc7b84388b9827096321e8c6be018932a442f63d9069e93511ec31",
-	"c81aabfaa1a97c15dc3f8fb17911d9cd6f740b6e7237dfdab93c0800b8139b3a33c451fcac57a78b2cd01b770de9e6814d5af720fdc4bbbab4a9236ca747be353685463d44032c123dc1e7cd3598280e183408e42e800683a88ab4203e7ec3d39ec32a41c3b17ff37b717289156b1e5810e42ab2e436b43dc6499d8587a9c99d",
-	"993f99b0b6ffee20e91db1d8d3ef48959fdfcee543cac8a44ee0e8e0b33015b416d08e56126653f54cca2686d0b7b7e45e87a24e2ddadd67271dca6385fd8a2fa5c854a2f89706b4cfd3ee0be69edc26725863c85e4c43a5408a33a0298e12cd5bc5be07632f4be836f8c49525326356a1a4817fe5e67e38e4b9dc48c3abaf09",
-	"9639148779f5437e652bca4bb3a6526a08c6806185f402f55d71b98c81d21e44595db5abc05dbda8654d48d3fbfd669c11799581c4367a3dfa7a4bed2026c7f3d551a268e2e2ff0b0a1fabc12273c4c3697b6d29a224d6497ffde41c16e70a2089eedffce7b7ce7dd1081b07a4578e9ceba7d74747d2fc6b1502d37a96aa8917",
-	"56723d3a2d9069cd354f9725d12ab3797fc794d795aace79a5eebda56bab90d48100c7dfab23363754ae74a4511a63f5a9b142c7461129254ec1200751a546e57ffc552ce7ea5304bf48a4df8d83e9b1cface346757e7a1f82f94c61dc8ca2ae437530dc814945da03793dc3015580a3271cd7113693cde067ab63ee153f8fc9",
-	"66eb854797a661c9a2bbd8122a81d518a9e8d280ff545cd18723c9a6cc00195ea224b2b4b4daad596cdd1b8fcdd71865c7e0f3d28ba68ed5b7e9c4d80717101313da087410229d183b821ce74adaa85d623f9002ee39f728261164d48c4c2213fed4286b65f51b5ef17974943eec71c9008571af112fc099b0777b44546aec7d",
-	"183ca5652417ee5f3a41d2462d2d7d5f102d71ed840f5d0f2f61f47b1f7103bc0d52ae4b548e5b0dc3565372cde3df99c0e3cf79b877a28b4739f1cf2a671d8f43ce60b4dcc23aa0b41f8a8e2ad1ef47e6ccc2d2d444996572aa6d9c683a3d3514abc768c20e1e49ea508d60735457dc9b66e9ed81826dcb33bec1d153388ffb",
-	"6df3b09f8d02bb16b8c97b0591b9e18d2ad68bbb0a941806eab397916327e4ca6b6cf2bf64df20ae5a4c667d14e822a84496dfefb8970f8f2ae7de5800391874904e2732ebd79782698d218a844e12b112d365a5d11055f21caa839f5675e10f96a369dc0073919286bc6c723772a45afd4a8ba344bb2664573b539682f8b8b9",
-	"c540c52006bd4aac0915ca351c275dc8f4e161ca461d996fa27f21a24505ad2f405ed902e1fc4594312f35a8cd3a1cacca51343eac977f44b86969479ca5b13cd000ad158231b0cab6e7febb96951d08181a9e1f3d24b0f86c365c7cdd15d617afc4b9f9dc2da8193ad270e73f93918eb18703e8527e38b1b5d94b00b9d5de91",
-	"45b8fc077d26439db9d985cfc68d820397fda6c0a495217389fc4496be4addbc4e0c18642af4a33341f6572f60a762de516e8eb06ecda93b45a50b60ae8429996fa46b1b7394d2c6b294ae0fe12c7a58232e1280963699b3ff33c9b73665e54a53657c73201601a8421d1c4b72fa396d7e3f261a70f984122798fbe1945409b",
-	"bb0ea025f4fb030b8497dc0cd483cfed63efd5618ea5d8a69cdff3c40ae5c66b54163e65df7ea83f61d2db105d7a8fdb77b7739468ba76ca4cdc13c284707425dc6b7b1cd9ad05d7de12abd28e935395fd7612561f227e18b977581d91e2ab78047bdc8ae3e777f2385efedf60a5a1683e930ff9ba4bc2e99e3a78985cd65147",
-	"37041d924f1e5a7ad5fb62d838ac4fd46c1bea056bc62b8032b2c4bab2ce8c87469e0b7da4a0c9908badbb1878847b2540208d106aaf17abaa7659502c8b1b04557127015b828cab0671905ac7e6bdf1b48d206e3537ed4644c6b7340fa4e310d00192ccdc7f1ceb5bfebd7fc4858fbaebf22b0b032adaae1b17d4d6de6d598d",
-	"4627c2f294c9203b81e9879fc9bf898ae452123cf2ef580c92657fbb74fe400572f82a23ec1d21861bf66f02604448da697d100dece2dff7a96bec8034ec00d417db4128baaeb6efa48ef844159288b6e771f88c8238a25a3b743e42440300c7df096b77df01c6ee2c91e4fd1ab02ca191f60392eb56c3ebee14687536614e71",
-	"4b975f826100addf7d08af518e44eb6ce74de324d19169f56165474f4f6a1d54d6b68d6b5299a9b13beeb1770be5a4c582d9bf25681e6d0030ce5489dc394b6e84511f456a57ad591f2360c01af1ea6925656c82618a1f09839fc2ebe3816033c811e70ff5b982406cac0875716ce5531ad91c9aca702e8e73ddcc498d475951",
-	"2fa13b9a3294f7e666d5e098759d8dbd3f923fec200eb1d8ae7321f8f25fb0a7aac787684b13e3960fe62508e6791bfe9b2cf9fbeddc3a9bfc78798b30185df3bcdc1af9d2d25a80a54d51ac7b76c25736f104c3fa28c9c4f0b07642f081d7c4ae4eb19b29b21b86abdf914f9a32c2063e65d444236ec0cca5487157b332e10f",
-	"95830379b2b227d69a341f03a67e54959b899ead7d7a4b7d503cf110d8c4c8eadd79255b9d8207d6b0144bf0ff19aa0dcc456ff5d055e9cae71c3b4c5bd7932e3046c55804b3be9398c95739038f25c887fc7fc1baf61ce102dad1920a2d1ae4338ff1905cdad4675bd8aac5d287392c3ac1e5426f1fc2be9bbb9f4aa0d7ac4d",
-	"4ce315079339cf8d0772763e8b0d4289a02e50c469b0729d93a1e58451d3a7b10b2ac55660eca3b6900c3eee5bfa567b300abf918e5445f77adadbef55adb52ffe9b863582c5e662a357bf169c1898a273a43af2d4c94a5317e36d16655a6b53ad1150d36cdab96afd4fadfec46335c0d93fb60059f8066da5f7e58d73d788cf",
-	"cf11117e9e3f76240361a9d4e72240d79ca137e384c9ce07b78c01969cffdab01410266c0063339d0abbd8978ea878bc0ca813c922568f57594f52bec5dd78b05b293b5bd31297eb75e4a8987226a81d88f6398182088dee80b941500bcd63108816da3179fd1a2d9817cc88e859c0d0687595b9af0fd8491b3cba181292d33d",
-	"5e082079e35da2a29c48c8f7ba4ab75eba8e65748366ba4dc91c1a1915399fa29a7d2ec22df1d20f7545985ed0df536aa114e6c1d2fde09412bb9e111f6d059f2c1540d0a4bbce57e2f34d53187fabedd53eb6c96d4cad2019c3fc68bdc7b42c2f534551f24e4835ebbf12fdba3b366367573826820d9fe2353f0dd59c1b5497",
-	"2b0ef45fb5ce5bad1b609c370d16d6c839b3d3285327168257eb047f1a1ce509d577d4d059ba5b678e040d6ada6ff7a41f22d82e13f3542322786dae7d6be69fb6739b82735c8c2601ce12fdf0102ec16186b629ef352f308c046941168ba827d77fbc7946cd414ae7edafee55a86e8f764624be747a8390ce221a880cd5a591",
-	"c1efc01ad3b16a02f9f59024e3c363e574d954b0a95aed305f844d81a48b25af627c93a8f60dc8aea43af0add8773bedff337a94462ec2f2e3b7106f752338232a9c790c914d718be2c581922f87016d9696da716a6676ffc326d5fbe0ec40b4534d7341aa40d60627291eccf6230db1b84c99e767ba5e84d7f5b00c69548cff",
-	"c731cb4affcbd167651b8d69f6c4113faa865d5fa80d765d0d8031791e7b15720cfce56d8901d50e0d97c7d75dc4d1e148e3761cd0a7c286a9354eafcf30f1008fda45d541d33bccf770ba4063a70b44bf05bbbb8fac4d02185a44d5aa2e76177538c914ff844341bee5e7d14f2ec4fb144062c4d65471552142a7e918bf3209",
-	"357c72a3036f52e1a8fc5f07579bb54d90df495b2677f856052a13edd158ab21c241dc07859ce955b3e3fdf8e2791c143af70c81376351703eb01cb7ed52c338c779b635520b0bf13a0d09e86c8c66bc7830821fd547009c9f0793207427451619d1cd8bf9c64b29fad8a40942dce24696e3162047ac019d7a69bf9edad253dd",
-	"3dac64d91a5754ae62f83ba32db7a0cb15d81f65296f7b0dfa25b6580d8da124817ddb3abb960791e5ec76b66494c863d68acb6193ed110467e25281e393632f5f5d09616606cf3ebcc1e2b1e4afa43525deea199bfcd42e9cc99b3c96e29700d2f535eb3f1c8bc6bd5d0d4759d42f542d0c0a2e9ec37f1138aa8e9d25269077",
-	"17d1904e31bcda4733cbe55da2ea89847695241e6ad8cc40b29842a5c35658d7eaf9439ffa86319165aae12ffb00a8b5ec5da9671937988ec573d0b8a756e65a567a8609156c4be09f46938c216d25fc5cd08d54573cbdc6c3f92bb22e74f03b3b8267bf9188a4cb6789feb9493d756d3cb5036ba4dea0ced143cd263e95c529",
-	"c387de0f7ebd75f017d468c65de90d7564fc2c7ef8e01040799f5beaeb0d7bfe8e4cc4162c367c62019f7e6436da65dca9ee194480c825217da8c812dcddce5f578103fb1ed21f0d5c8682a3c08c6eec3dfd7a6937a49e09402276ddd30439d06b1957e01b767fc347c0ee1f74a0c64d3e263cd1714a78f6f36a34f1f49d1f2f",
-	"51fedac77610e0d693124611ab9461f133a59d0cb8f0257bbf1d330e0e85726342a569bd0ea0df7bb4be8f930490b31343f2bf87846e35e14bc0a8f20819eedc23ed7e3c3872dba82511e6e71a07b23ab50a4f331ec8d58a08ca6aa482777deabb5b931f34c752b77aa72e2d623145d04174c8fc947573af4dd70de262869bbd",
-	"7469faa2dd11816d6a2ffca21d96abe7b3b5edd753323f7a2d24de4af3947f2038801cbcdbf4b7c785079f20d058c377fddce2399922b7b54ee525745a485ad43e682910886921a553d48a61cf38a6c384452213d556952b4804ca34ffbff84494e2716150ee26baa4da10c72f4442f78662b7cb6e78ef1fad73ab417918825b",
-	"2db27cb3cb170fcbeeeaa73e5cd404f6dc4714e57d4d040abfc324e88949aadd432d3e18d1c21d6f12916dc6d6b2d76b85558031223ee3143fd5dc0e9b59bdb5b72fe12a0fdb496e50a854c5889d7760ef934305127100814584b4cd6917c267f3f2ca5d44280c609495b82695afa9702aefcee5f1983fae6146cef901d6ee17",
-	"b8cfa85da981e5b38f133e08219b0c82a311bd4a45fddf207e3ad3cce4a55e1f5340a9c1f59fe5044423e442bf6a7eaecbb5fe08b220faf5868a08677179f7cc4e151273c79d98f11a3cea0480fe49bd06362fd6df1a1998e05d6df453d76d324b86e128c843d719d24add74bd864073bd958171d6186dd42521a91ec4189e4d",
-	"a5fcb1f3f4ae990da8e2d43e026a30969a9a171444d02ffe4a18a07d2c26eb526ab445bd84c52c2ad46c3ec9ff3f51090fb963512b93a118dc64e2f050578ba19b464da1b559a9268c9d96751ca39f4cfa0c97fa8571239a37f2d4c8b63704a0cf869c398b286513de0ed16b21b637441acc3aa0acbdb01fe936e0106b02a6d7",
-	"468e3c421b3b09c41ec88b17e585b24022404c459d9fb5891dd2a89af52cd9a044ae8d7b9ac7c4e7a60c56c8ca39156cffea3b61643bb7f15fdd3b45a3153a52a03332677aa3554c8b63f56f9c142e8a9e65b26183c02b40cecd5551d0f469e383f85355d6f1d3503c922fb3ac73a230736684dba7d218dfa6b499ff6ef2ed45",
-	"316d6e61580e2682b788ced2ccf3593408e24efc9e59e8fba2ba68a3c467938c5fea96924571c5b354838b0c9e2f3c29e7392ca99281711a5585dd0d31b5baab66a07775dda2efeeeb8be2dc5ef417e02b9e361bc45bc1125ea185b66851d1e16812ff5bba10cbcaf9a51588dcba2301317c7edbe7415a40a66e83576b46e2b",
-	"8e00614a1174608febaff4b86126f054612c2e7f367314791b7c7f6e9d67009451948bb5578332d0c9489fa8f234b21aa81b67a52b0d7a7b1d77dbb35a47627be5892492a9a68842fd30b0d2758cc2ff2cbcc5acdaac5bde6ff8b864bcfa2e8a1b54bf26d5e46d689f26e19916b3c29b7d6dfcc8c4986353a18ed9cb97c5fadd",
-	"b85deec8a6932374aa2c896fc4ff9f645785abd56e781e5c41f23b5f8279a4719f2d43952d2a5a37d0f955232be9eab3f789f4498db94fa3442280766dcd4589cfa37c7e77c2a84088f1fc2357966a5940cfebc6381df892e117892b330c32d38bb42f7cee83e6d203de977c740c00305a4626175c33ca6ad6a8cd3058508157",
-	"1d42ab82afd5c75cc4d4616f49ea8db2da5d6a3627e660a1e3c78a5fc941c3cf9c715ff48ec69806141aefd9b0597197593c0912ef9731e7e405bd2651b6b57983cf0312667bfc311f4f3cc5a530f56e758c2b049c312a1bf7f42238607e8b822c886277e7eb0e4634d4b51355b6e43426fb47c92d89d623ce7c6fa6a63f684f",
-	"48a454950002a4657a2c0c79c42e844e52b825619cb8a5b91f16fc19221680509f4441ec23e592701e567bbd1c0598fcf9caabc1bcc5abcdfedd40bb7b37313e62a18d9aad99414d49c3fe9b9668bc2a277bac384d332e17c72775222977bf59f2e06e437345f473d4f9bd43f9648e8f30c4e9c41bf9b66d76b832b84948437f",
-	"187bf1e57e0bfc8e611f965c04f5639bd6d4d69a19146a8304014df7f6aebb0864adf3126ef1032cd234c311249503bc131177bbab3dcc35a90bf3c8ac4de5c378db79665a8d89319763e1e092f9955f8ff94f35f7d78fde4fb4a1e680ef9e485b4ca1c16c7df77bea09f59799aceba453d70ff7b1e8e6b72b6b33b36889d9bb",
-	"7de27a766a2c2f67e57a5696098ab07b5a2f5bd00215e31148c2eb8b07891c94779cf0007ae3270ae19d1a6a7fb92bbc2fffb0ddc3349b773fda3959ff90575e67c014ccf03b34eed95b21dacd804bbb03f68bb5b82bd1ea7fe8ecc00f59d754c2d9d1fa4ffbddc9d25f3fdf8d6975750a060debc25696a272c129efaaa6b729",
-	nullptr
+/**
+ * Blacklisted public coin values for Zerocoin to Sigma remint
+ * AUTOGENERATED by contrib/devtools/gen-remint-blacklist.py
+ *
+ * Each line contains the double SHA256 of a value's big endian magnitude.
+ * Lines are sorted so the table can be binary searched.
+ */
+#include <cstddef>
+
+extern const unsigned char sigmaRemintBlacklist[][32];
+extern const size_t sigmaRemintBlacklistSize;
+
+const unsigned char sigmaRemintBlacklist[][32] = {
+    {0x00,0x2d,0xf9,0x3d,0x20,0x13,0x8c,0x59,0x86,0x02,0xf3,0xad,0x7f,0xaa,0x01,0x1b,0xac,0xf1,0x54,0x9a,0xab,0x4b,0x8e,0xb1,0x69,0xe5,0xc5,0x0b,0xed,0xef,0xa1,0x4c},
+    {0x00,0x2e,0x24,0x3f,0x97,0x36,0xd3,0x4e,0xca,0x4b,0xb1,0xfd,0x04,0xf8,0x32,0xed,0x18,0x32,0xf8,0x9f,0x70,0x74,0xb6,0x9a,0x6a,0x26,0x51,0x52,0x0a,0xd1,0x8d,0x36},
+    {0x00,0x51,0xdc,0xbd,0xbf,0x96,0x45,0xdc,0x3b,0xd0,0x0b,0x6b,0x8f,0x60,0x85,0x2a,0x4f,0xe2,0xbe,0x0b,0x3f,0x88,0xc9,0xf6,0xd9,0x4c,0x04,0x1d,0xe5,0x6a,0x07,0xc4},
+    {0x00,0x75,0x19,0xa8,0xb6,0xf6,0xe3,0xd3,0x26,0x5f,0x6e,0xb4,0xd3,0x0b,0xc3,0x5d,0x32,0xe1,0x70,0xf9,0x3c,0xce,0xb0,0x99,0x2e,0xad,0x9c,0x1a,0x8c,0xc7,0x9a,0x3d},
+    {0x00,0xb7,0xb0,0xa4,0xbc,0x7a,0x9b,0x75,0xbc,0x82,0xea,0x00,0x83,0x77,0x9b,0x64,0x44,0x7e,0x86,0x12,0xfc,0x8c,0x88,0x67,0x49,0x3c,0x28,0xc5,0xa2,0x74,0x63,0x26},
+    {0x00,0xf8,0x46,0xf6,0xea,0xdc,0x84,0x6e,0x45,0x62,0x8a,0x3c,0xcf,0xba,0x13,0x95,0x10,0xc4,0x4a,0x63,0x27,0x85,0x56,0xbf,0x89,0x9b,0xc1,0x7b,0xc2,0x8c,0x57,0x96},
+    {0x01,0x94,0x83,0x95,0x75,0x51,0xba,0xce,0x65,0x52,0x77,0x94,0xba,0xce,0xa1,0x12,0x3f,0x0c,0x69,0x99,0xfc,0xb8,0x67,0x19,0x03,0xb2,0xd3,0x42,0xd4,0xde,0x6b,0x2e},
+    {0x01,0x9f,0x13,0xfb,0x6f,0x83,0xb6,0x8c,0xac,0x40,0x99,0x77,0xe3,0xf0,0x54,0x15,0xd8,0x41,0x33,0xd8,0xec,0x9d,0xdd,0x9e,0x5c,0x1a,0x96,0x2e,0x49,0x72,0x4b,0x6a},
+    {0x01,0xbb,0xaf,0xeb,0x63,0x4c,0x15,0x07,0x15,0x15,0x20,0x19,0xbf,0x64,0xb8,0x20,0xe4,0xdc,0xcc,0xb9,0xe8,0x4c,0xdb,0x83,0xca,0x14,0x11,0x9a,0x1c,0xfe,0xb5,0xe0},
+    {0x01,0xf1,0xbf,0x9e,0xf1,0x06,0xa7,0x4f,0xba,0x55,0xff,0x40,0xe9,0x3d,0x0e,0x4c,0xe6,0xd1,0xc7,0x1f,0x0f,0x2d,0x19,0x92,0x13,0x8e,0x81,0x14,0x62,0x83,0xfc,0x35},
+    {0x02,0x17,0xf6,0x11,0xa8,0x6c,0x7b,0x71,0xf7,0x8f,0x17,0xe7,0x00,0x53,0x2e,0x96,0x8e,0xd8,0x70,0x47,0xaf,0x10,0xcf,0x8b,0xb6,0x94,0x06,0x03,0x49,0x20,0x94,0x45},
+    {0x03,0x51,0x50,0x79,0x62,0x34,0x7b,0x02,0x5d,0xd1,0xb4,0xda,0x99,0x15,0x24,0xcf,0x72,0xf8,0x1f,0xa3,0x8e,0xda,0xec,0x0f,0x26,0x18,0x74,0xf3,0xc0,0x46,0xd8,0x5c},
+    {0x03,0x52,0x2d,0x33,0x1a,0x27,0xe2,0x6e,0xb4,0x95,0x2e,0x76,0xff,0xb1,0xd5,0xfb,0x42,0xe8,0xba,0xb7,0xb5,0xe0,0xaa,0x72,0x15,0xb1,0x9f,0xc8,0x86,0x72,0xa1,0x43},
+    {0x04,0x1b,0xf7,0xba,0x86,0xb4,0x31,0x54,0x2a,0x2d,0x1f,0x57,0x3a,0x2f,0x17,0xde,0x4c,0xf6,0xf8,0x1f,0x24,0x0c,0x0f,0x5a,0x45,0x76,0xdc,0xc5,0x8b,0xad,0x0d,0x21},
+    {0x04,0xd9,0xe4,0x91,0xfd,0xf9,0x5e,0x39,0x94,0x58,0xc1,0x6f,0x50,0x0b,0xca,0xd2,0x22,0xb3,0x0a,0x29,0xd4,0x7a,0x2a,0xe3,0x35,0x61,0xf4,0x91,0xfe,0x9a,0xb9,0x60},
+    {0x04,0xee,0xbf,0x2f,0xf8,0xae,0x3c,0x1e,0xc2,0xa5,0xbb,0xab,0xef,0xac,0x8a,0x4c,0xd8,0xfb,0xab,0x47,0x82,0x59,0x02,0x67,0xda,0xd7,0x67,0x36,0x95,0x8e,0x4c,0xdf},
+    {0x05,0x0f,0x83,0x2a,0xf9,0xa2,0x30,0xff,0x64,0xef,0x62,0x9a,0x4f,0x39,0x18,0xe8,0x2d,0x08,0xb6,0x41,0x77,0x6c,0xe4,0x62,0x7d,0x4a,0x5e,0x14,0x13,0x4f,0x43,0x55},
+    {0x05,0xa7,0x52,0x9f,0xad,0xa3,0xb5,0x2a,0x52,0xfc,0xac,0x5d,0xbb,0xc7,0x94,0xa9,0x99,0x21,0x71,0xfd,0x91,0x04,0x1c,0x97,0x0d,0x55,0x94,0x08,0xd8,0x9c,0x3a,0xe5},
+    {0x06,0x02,0x44,0x87,0xc5,0xd0,0xe2,0xe8,0xd7,0x40,0x6c,0xdb,0x3e,0xe7,0x26,0x1b,0x10,0xe1,0x6d,0xe1,0xed,0x5e,0x40,0x3a,0x33,0x5e,0x5a,0xbd,0xb8,0x61,0x77,0xd8},
+    {0x06,0x53,0x1e,0xb1,0xe3,0xb6,0x6d,0x9b,0x19,0x03,0xa2,0x82,0x50,0x15,0xe3,0x8a,0x51,0x22,0x27,0x73,0x63,0x02,0xc6,0x71,0x88,0x1b,0x4c,0xcb,0x6f,0x8a,0xe0,0x2a},
+    {0x06,0x93,0xfa,0x92,0xba,0x98,0xd1,0xdf,0xe5,0x93,0x17,0xc9,0x24,0x3d,0xff,0x18,0x65,0x57,0x48,0xf0,0x73,0xe5,0xb0,0x4d,0x69,0x00,0x1b,0xe6,0x55,0x4a,0xef,0x51},
+    {0x06,0xde,0x60,0x25,0x53,0x82,0x0f,0x74,0x8f,0xe3,0xd5,0x2c,0xcc,0x3d,0xfe,0xcc,0x9d,0xb6,0x1c,0x86,0x8f,0x2d,0x37,0xbf,0x73,0xe4,0xc8,0x14,0x7b,0xa0,0x08,0x44},
+    {0x06,0xf8,0xb8,0x64,0x05,0x12,0x47,0x7b,0x02,0x07,0xf8,0x2c,0x12,0xcb,0x91,0x4b,0x7e,0x5b,0xba,0xbc,0x27,0xbd,0x06,0x1d,0x11,0x21,0xa3,0x29,0x05,0xd4,0xed,0x4c},
+    {0x07,0xca,0xec,0x83,0xaa,0x60,0xa9,0xff,0x48,0xa6,0x8f,0xb2,0x33,0x08,0x10,0x57,0x9a,0x89,0xfd,0x04,0x32,0xa4,0x43,0x2d,0xaf,0xb8,0x9b,0x4f,0x81,0x65,0x8e,0xe3},
+    {0x08,0x80,0xa3,0xc3,0xcd,0xc5,0x8e,0x77,0x1e,0x33,0x6c,0x83,0x44,0xd8,0xd0,0xe9,0xdf,0xf5,0xdb,0x20,0x62,0x41,0x01,0x9e,0x16,0xc7,0xc5,0x79,0xcb,0x82,0x60,0x35},
+    {0x08,0x91,0xba,0xf3,0x8d,0xfb,0x73,0x43,0x86,0xe4,0xa2,0xf1,0x8c,0xfa,0x07,0xd6,0xfc,0x6a,0xf8,0x89,0x3f,0x50,0x14,0x2c,0x96,0x31,0xd8,0x49,0xbe,0x20,0x84,0x2e},
+    {0x09,0x1a,0x3b,0x31,0x9a,0x66,0xf9,0x0f,0x16,0x18,0x1f,0x1b,0xbb,0x7c,0x05,0x38,0xf2,0xdc,0xc4,0x89,0xf2,0x8b,0x8c,0xf5,0xf4,0x2e,0x81,0x6c,0x34,0x59,0xfb,0x60},
+    {0x09,0x4e,0xc8,0x8d,0x34,0x2e,0x8f,0xa9,0x7c,0xc4,0x94,0x3f,0xc5,0xb7,0x4f,0x4a,0x01,0x44,0x69,0x80,0x16,0x9e,0xf4,0x9e,0x80,0x5d,0xd8,0x92,0xb4,0xc5,0x46,0xb0},
+    {0x09,0x57,0x3e,0x4c,0x9e,0xe7,0x93,0xb5,0xbe,0x11,0x0e,0xb9,0x4b,0xa2,0x88,0x1a,0xa2,0x14,0x54,0xce,0x6b,0x39,0xc8,0x8a,0xea,0xfe,0xa9,0xf4,0x26,0xf1,0xf6,0x2f},
+    {0x09,0x5b,0x06,0x56,0x4b,0x33,0x76,0x44,0xaf,0x45,0x3f,0xd8,0x3c,0xff,0x91,0xb5,0x74,0x86,0x0a,0x80,0x90,0x19,0xfa,0x62,0x49,0x44,0x31,0xe0,0x58,0xf8,0xb3,0x81},
+    {0x09,0x65,0xc6,0x4f,0x64,0x79,0x8c,0x4e,0xcc,0x22,0xc7,0xc9,0x3a,0x6f,0xd9,0xe0,0xf5,0xa2,0x63,0x8a,0xad,0x1b,0x08,0xb3,0xbc,0xed,0x44,0x4f,0x5d,0x8d,0x4e,0x1c},
+    {0x09,0x82,0xdc,0xe6,0x12,0x7b,0x4d,0x28,0x58,0x94,0x20,0xae,0xdd,0xc1,0x5b,0xc8,0x16,0x9d,0x6e,0x8c,0x59,0xa1,0x37,0x88,0xad,0x4f,0xf1,0xce,0x03,0xd5,0x9a,0x83},
+    {0x0a,0xdc,0x5b,0x0d,0x46,0xa8,0xf3,0x5d,0xf9,0x62,0xad,0x21,0xb2,0x84,0xf7,0xdc,0x49,0x5a,0xb7,0xce,0xfd,0x84,0xef,0x7e,0x49,0x0b,0x3c,0x49,0xd9,0xdf,0x74,0xbf},
+    {0x0a,0xf2,0xfa,0xbf,0xbc,0x01,0x58,0x6e,0x45,0x74,0xae,0xed,0x22,0xd0,0xdc,0xae,0x5f,0x00,0xec,0xb5,0xb4,0x5c,0x5f,0x63,0xa1,0x82,0x52,0x28,0x93,0x9d,0xee,0x82},
+    {0x0b,0x19,0x6e,0x6f,0x9c,0x04,0xac,0x97,0x9a,0x69,0x17,0x64,0x40,0x27,0x0f,0xe0,0x32,0x5d,0x1b,0x01,0x77,0x10,0xf6,0x3e,0x60,0xa0,0xe1,0x5c,0x44,0x6c,0xd8,0xda},
+    {0x0b,0x6e,0xd3,0x79,0x01,0x13,0xcd,0x12,0xf4,0x00,0x86,0x8e,0xd4,0x55,0xb2,0xd5,0xa3,0x6f,0x8a,0x8b,0x27,0x62,0x68,0xd5,0xe4,0x09,0x89,0xed,0xdf,0x66,0x0d,0x1f},
+    {0x0c,0x07,0x0e,0x16,0x97,0xc2,0x46,0xb4,0x1f,0xa2,0xcc,0x2b,0xac,0x50,0x32,0x5b,0x04,0x3f,0x27,0xba,0x6b,0xaa,0xd9,0xc6,0xce,0x76,0x05,0x53,0x38,0x92,0x72,0x4f},
+    {0x0c,0x1a,0xfc,0x27,0x31,0x1a,0x87,0xd4,0x10,0x39,0x1e,0x1f,0x9d,0x67,0x20,0x6e,0xf9,0x8a,0x52,0xef,0x83,0x58,0x63,0x40,0x9b,0xd6,0x86,0x9f,0x79,0xe1,0xe7,0x99},
+    {0x0c,0x4a,0x1f,0x3c,0x78,0xca,0xe6,0x51,0x00,0x18,0xe3,0xd4,0x46,0x0b,0x69,0xd5,0x2d,0x2b,0x66,0x48,0xb5,0x30,0x51,0xae,0x57,0x73,0xde,0xf4,0x50,0xe8,0xd9,0x24},
+    {0x0c,0x82,0x94,0x66,0x5d,0x10,0x80,0x64,0xd8,0x7c,0x30,0xf3,0x5d,0x92,0xef,0x5c,0xbc,0x5a,0x9c,0xb7,0x99,0x8a,0xa7,0x42,0xe0,0x70,0xd1,0xf4,0xf7,0xe9,0x6a,0x68},
+    {0x0c,0xa2,0x3e,0x35,0x5b,0xbb,0x48,0xdc,0x4d,0x41,0x10,0xfc,0xe1,0x1b,0x8c,0x74,0x24,0x01,0xde,0x3b,0x92,0x30,0xd0,0x2b,0x4a,0xe6,0x9e,0x15,0x60,0x66,0x08,0x78},
+    {0x0d,0x76,0x90,0x40,0x84,0x82,0x0d,0xea,0x0c,0x4c,0x73,0x0b,0x83,0x5b,0xf2,0x34,0xf7,0xf3,0xab,0xa3,0x5a,0x76,0xdc,0x9a,0x55,0xed,0xf9,0x06,0x49,0x13,0xc1,0x3d},
+    {0x0f,0x73,0xb8,0xb6,0xe0,0xe8,0x60,0xdf,0xa9,0x44,0x49,0x4a,0x18,0x54,0xe0,0x63,0xba,0xa7,0xcc,0x2b,0xc7,0x59,0xff,0x66,0x9e,0x85,0x72,0x1e,0xae,0xe2,0x1c,0xb6},
+    {0x0f,0x7e,0x7f,0x09,0xd5,0xa5,0xd9,0xf1,0x06,0x3c,0xbe,0x97,0x65,0xac,0x58,0x12,0x6e,0x19,0x69,0x5a,0x2b,0xf4,0xeb,0x57,0x44,0x35,0x0b,0x1c,0xb6,0xa1,0xf1,0xad},
+    {0x10,0xb6,0xb3,0xe5,0x02,0x58,0xfe,0x96,0x69,0x81,0x63,0x3e,0x04,0xd0,0x52,0xde,0xaf,0x9f,0xb0,0x16,0x12,0x15,0x0c,0x09,0xc0,0x4c,0x7f,0x30,0x45,0xf0,0xcd,0x9e},
+    {0x10,0xba,0x7b,0xac,0x2d,0x88,0x37,0x97,0x65,0xb3,0x6e,0x16,0x62,0xc7,0x12,0xa1,0xca,0x03,0xc3,0x98,0x51,0x7b,0x79,0xed,0xb9,0x0d,0x94,0xdf,0x2c,0x4c,0x4e,0x64},
+    {0x11,0x00,0x23,0x79,0xc0,0xf8,0x6c,0xaf,0x2f,0x61,0xba,0x59,0xc4,0x5c,0xc0,0xd7,0x33,0x02,0xa8,0xc3,0x4f,0x18,0x39,0xd6,0xcc,0x6f,0x42,0x24,0x32,0xfd,0x43,0xe9},
+    {0x11,0x85,0x2a,0x52,0xc5,0x38,0xb0,0x36,0xf6,0xa0,0x89,0xa6,0x1a,0xff,0x43,0x48,0xe4,0xbb,0x68,0x55,0x5a,0xed,0x18,0x9d,0x47,0xef,0xad,0x00,0xa7,0xee,0x06,0xbd},
+    {0x12,0x29,0x38,0x81,0x6f,0x5a,0x98,0xd9,0xf8,0x40,0x90,0x25,0x0c,0x1b,0xfe,0xdd,0xe0,0xd0,0xfe,0x58,0x9a,0xaa,0xbf,0xa8,0x98,0xef,0xca,0x1a,0x23,0x4b,0x8b,0x7e},
+    {0x12,0xb2,0xba,0xcf,0x25,0xf1,0x51,0x47,0xb2,0xad,0xd4,0xce,0x37,0x57,0xc7,0xe2,0x26,0xa9,0xd7,0xc4,0x0b,0xcb,0x28,0xbe,0xee,0x20,0x4d,0x26,0x96,0x47,0x0c,0xb9},
+    {0x13,0x5d,0x75,0x4b,0x3a,0x80,0x2c,0xc5,0xa9,0xc0,0x94,0xfe,0xbf,0x48,0x33,0xfc,0x2f,0xa0,0x22,0x15,0x10,0xd7,0xb2,0x95,0x41,0x4f,0xf3,0xfc,0x9a,0x12,0x89,0x94},
+    {0x13,0xf7,0xf7,0x75,0xdb,0xd5,0x0c,0x4d,0x9f,0x86,0x16,0xab,0x56,0x0a,0xc2,0xc9,0x42,0x46,0xae,0xef,0xde,0x53,0x92,0x91,0x9c,0xbb,0xcb,0xf9,0xf7,0x7f,0x0a,0xe9},
+    {0x14,0x76,0x83,0x79,0x03,0xa3,0x8f,0xdb,0x86,0x23,0xaa,0xe0,0xc6,0x00,0x55,0x34,0x51,0x02,0xdc,0xfd,0xd9,0x9c,0x76,0x9b,0x46,0x56,0x0c,0x25,0x91,0x01,0xe4,0x0b},
+    {0x16,0x4b,0x45,0x87,0xfc,0x66,0x80,0x56,0x19,0xe9,0x9f,0xa2,0x5b,0x83,0xd5,0x83,0x91,0xb4,0xcc,0x77,0xff,0x82,0x5a,0x98,0x96,0xd8,0x8b,0x49,0xb6,0x37,0x3e,0x1c},
+    {0x16,0x4f,0x73,0x05,0x88,0x8a,0xca,0xb6,0xba,0x29,0xc1,0x05,0x55,0x99,0xdd,0x9e,0x90,0xb4,0x43,0xa2,0xe5,0x66,0x72,0x2f,0xdf,0x1c,0x06,0x85,0x14,0xac,0x6a,0xb1},
+    {0x16,0xaf,0x73,0x6a,0x2a,0x3a,0x6c,0x3d,0xe4,0x07,0xed,0xaf,0x85,0x41,0x4d,0x5e,0xae,0xa0,0x6c,0x61,0x80,0x46,0xe0,0xbe,0x97,0x59,0x84,0xf5,0x28,0x98,0xcb,0xfa},
+    {0x16,0xb6,0xf2,0xce,0x13,0x03,0x02,0x4f,0x67,0x1a,0xbd,0x78,0x01,0xdd,0x11,0xdc,0x1b,0x86,0x24,0x4e,0x54,0x72,0xdb,0x60,0xa6,0x9b,0x10,0x76,0xe2,0x9a,0x56,0x2e},
+    {0x16,0xd7,0x7d,0xae,0xa8,0x1d,0x52,0x0a,0xa0,0xd0,0x2f,0xe5,0xc4,0xc7,0x4a,0x00,0x1b,0x86,0x69,0x50,0x3a,0x55,0x45,0x3f,0xb3,0xc9,0x65,0xe9,0x38,0xc5,0x6c,0xf1},
+    {0x18,0x28,0x7c,0x37,0x31,0x62,0xb7,0xb0,0xd8,0x97,0x80,0x16,0x09,0x72,0xb9,0xcd,0x32,0x63,0xa2,0xdf,0xfa,0xaf,0x3c,0x3d,0xdf,0x7a,0x51,0x7e,0xc7,0xe3,0xaa,0x84},
+    {0x18,0x89,0x12,0xa3,0x67,0x48,0x71,0x0d,0xbd,0x56,0x27,0xbb,0xed,0xa7,0xb3,0x6e,0x5d,0x9c,0x68,0xa5,0x68,0xb8,0x57,0xd8,0x7e,0xff,0xf6,0x5f,0x53,0xdf,0x71,0x5a},
+    {0x18,0xbe,0x2f,0xe4,0x5c,0x8b,0xc5,0xce,0x7c,0x83,0x98,0xdd,0x8d,0xbe,0x32,0x35,0x23,0xbe,0xc5,0xc5,0xa3,0xb8,0x43,0x81,0x61,0x20,0x21,0xb6,0xa5,0x4d,0x41,0x9f},
+    {0x18,0xe8,0xaf,0x09,0xef,0x0c,0x05,0x5b,0xdc,0x23,0x45,0x6c,0x80,0xbe,0x37,0x52,0x78,0xe2,0xab,0xaa,0x5c,0x1e,0xa4,0x9d,0x33,0xf3,0x15,0x70,0xa4,0x65,0x5c,0xda},
+    {0x19,0x45,0x8c,0xa6,0xec,0x30,0x18,0x1d,0x33,0xfb,0x88,0x6b,0x6e,0x87,0x77,0x6d,0x49,0xe4,0x9e,0x4b,0x2a,0x8c,0xf8,0x71,0xab,0xbe,0x21,0xb4,0x99,0x1b,0xcd,0x2f},
+    {0x19,0x80,0xe8,0xee,0x6b,0xfe,0x1e,0xaa,0x8c,0x17,0x38,0x9f,0x5a,0x80,0x50,0x0d,0xba,0x52,0x95,0x9f,0xac,0x5e,0x31,0x07,0x34,0x9e,0x54,0x6c,0x66,0xa2,0x2b,0xf6},
+    {0x19,0x92,0x4a,0x73,0x02,0x0b,0xe7,0xe5,0x7d,0xfe,0xfc,0x37,0x02,0xcf,0x42,0x00,0x65,0xe3,0x68,0xa8,0xff,0x67,0x2e,0xcd,0x99,0xd6,0x33,0x8a,0x02,0x53,0x06,0xbd},
+    {0x19,0xa5,0x81,0x3e,0xcf,0xff,0x66,0x8c,0x46,0xb1,0xd4,0x32,0x2e,0xf6,0xb4,0x3a,0x3b,0x98,0xd1,0x7d,0x80,0xa4,0xfa,0x0b,0xd5,0x6a,0x68,0xa3,0x85,0x76,0x1f,0xd6},
+    {0x19,0xb1,0xe4,0x1d,0xc9,0x96,0x54,0xf0,0xeb,0x4f,0xbe,0xf4,0x96,0x07,0xa7,0x52,0x14,0x35,0x81,0xad,0x49,0xcb,0xae,0xf9,0xd1,0x22,0xa1,0xb5,0xe2,0x76,0x2d,0x2c},
+    {0x19,0xda,0x3f,0xb3,0x51,0x07,0x4d,0xa2,0xc9,0x9e,0xfc,0x63,0x54,0xeb,0xdb,0x0d,0x59,0x66,0xc4,0xb2,0xb4,0x28,0x31,0x1b,0xad,0xf1,0xd1,0x3d,0x65,0x40,0x2b,0x00},
+    {0x1a,0x58,0xe8,0x8c,0xb9,0xa2,0x16,0xa3,0xba,0x9f,0xc7,0xbe,0xa6,0x7c,0xf8,0x9d,0x14,0x5d,0x45,0x6b,0x7a,0x72,0x6d,0x2b,0x43,0x52,0x27,0xcf,0xde,0xc9,0x45,0xaa},
+    {0x1a,0xd5,0xbb,0xd3,0x43,0x7c,0x31,0xef,0xa2,0xf2,0x07,0x1e,0xa3,0x6f,0x99,0xb5,0x45,0x98,0x55,0xdf,0xcf,0x02,0xf0,0xda,0x7e,0x10,0x8b,0x9e,0x22,0x02,0x62,0x50},
+    {0x1a,0xe9,0x29,0x1c,0x11,0x77,0xd7,0x29,0x0c,0xca,0x3e,0xf0,0x6b,0xc3,0xc0,0x46,0x8c,0x2a,0xa2,0x68,0x77,0x77,0xb1,0x55,0x45,0xae,0xa9,0xd5,0x39,0xed,0xa1,0xa1},
+    {0x1b,0x16,0xcf,0xbe,0xa8,0x2f,0xfa,0x61,0x8d,0x46,0x05,0xcd,0x1e,0x29,0xd5,0x2e,0x7d,0x06,0xe3,0xd0,0x31,0x8c,0xe6,0x97,0x5f,0x32,0x21,0x07,0x9b,0x6a,0xef,0xd4},
+    {0x1b,0xcb,0x9d,0x75,0xb4,0x3c,0x62,0xb8,0x48,0x3d,0x22,0x36,0x0f,0xc1,0xe4,0x1b,0x7b,0xa4,0x6c,0xdc,0x0b,0x7e,0x68,0xc1,0x17,0x0b,0xdf,0xb6,0x2a,0xaa,0x14,0xd0},
+    {0x1b,0xd2,0x8c,0x07,0x54,0x0e,0xe2,0x86,0x9b,0x1c,0x0c,0xa1,0x53,0xb8,0xd3,0x72,0x38,0x1e,0xbb,0x52,0xa4,0x8e,0x0d,0xf0,0x31,0xb7,0xef,0xc5,0xad,0x31,0xde,0x67},
+    {0x1b,0xf6,0x95,0xd1,0x75,0x48,0x4f,0x7d,0xd2,0x12,0x96,0x95,0xb6,0xa4,0xef,0x03,0x04,0x58,0xd1,0x8b,0x43,0xa1,0x67,0x7a,0x32,0xb6,0x48,0xff,0xc5,0x09,0xb1,0xac},
+    {0x1c,0x07,0xfb,0xe8,0xf7,0x88,0x02,0x72,0x47,0x28,0xa8,0xf9,0xc4,0x7c,0x29,0x55,0x58,0x1d,0x10,0x77,0x37,0x98,0x4c,0xe7,0x51,0x98,0x5d,0xbb,0xf0,0x35,0x3f,0xde},
+    {0x1c,0x1a,0xca,0x0b,0x27,0xd3,0x79,0x40,0x9d,0xb5,0x1a,0x3d,0xea,0xfc,0x52,0x65,0x78,0x7f,0x79,0xe2,0xcf,0x43,0xdc,0x01,0x4c,0x06,0x51,0xe0,0xce,0xbf,0x23,0x75},
+    {0x1c,0x5c,0xa1,0xe7,0x14,0x6e,0x79,0xe8,0xf2,0x84,0xd4,0x22,0xb4,0xeb,0x97,0xf8,0xde,0xe4,0xb0,0x78,0x00,0xea,0x19,0x9b,0xbf,0x42,0x4c,0xb0,0xb4,0xa2,0x53,0xd5},
+    {0x1c,0x9d,0xc8,0x58,0x43,0xcf,0x52,0x46,0xcc,0x35,0x0d,0xe9,0x0a,0x6e,0x72,0x2d,0x80,0xe2,0xa2,0xfb,0xcc,0x26,0xda,0x1d,0xb1,0x39,0x87,0x4a,0xeb,0x6a,0x95,0xd2},
+    {0x1d,0x28,0xe9,0x56,0x3d,0xa9,0x5a,0xe3,0x37,0xc7,0xf0,0xdb,0x9a,0xa9,0x1b,0xa6,0x4a,0x98,0x05,0x60,0x60,0xd8,0x9f,0x71,0xe1,0x6a,0xaf,0x7b,0x5b,0xbe,0x95,0x51},
+    {0x1e,0xe9,0x25,0xa0,0x4b,0x84,0x37,0xf1,0x35,0x6c,0x35,0x3c,0x22,0xb4,0x01,0x63,0x0c,0x9f,0x1b,0xa0,0x1d,0xf0,0x31,0xce,0xbd,0x37,0xb4,0xf5,0xa5,0x89,0x20,0xcd},
+    {0x1f,0x7c,0x39,0x42,0xce,0x84,0xbc,0xe1,0x78,0x24,0xd0,0xa2,0x84,0xe1,0x23,0xe7,0x45,0x9c,0xcd,0xb6,0x76,0x9e,0xe1,0x71,0x4e,0xf5,0xe6,0x81,0xf5,0x5e,0x1a,0x6a},
+    {0x21,0x23,0xa1,0xad,0x89,0x7c,0x37,0x86,0x4e,0xc2,0x5c,0x69,0x39,0xcb,0x0b,0x05,0x52,0xa5,0xcf,0x94,0xef,0x44,0xbe,0xec,0x1b,0x79,0x4d,0x1d,0x8e,0x88,0x2e,0x1a},
+    {0x21,0x41,0xae,0x82,0x9c,0x78,0x7e,0x60,0x10,0xaa,0x47,0x0f,0x47,0xf7,0xcd,0xfd,0x05,0xb5,0xfe,0x83,0x9e,0xa6,0xc1,0xeb,0xdc,0x42,0xf8,0xb2,0xc2,0x16,0x9b,0x4f},
+    {0x21,0xa8,0x47,0x27,0x74,0x29,0xf7,0x92,0x3b,0x76,0xcb,0x20,0x59,0x01,0x59,0x12,0x9a,0xc6,0xe8,0x83,0x55,0x47,0xf7,0x2b,0xba,0x55,0xf5,0x42,0x76,0x98,0x21,0x75},
+    {0x21,0xf5,0xab,0x6f,0xc4,0xcd,0xb6,0x4c,0x1d,0xd6,0xd7,0x38,0x39,0xfc,0xe6,0xa8,0x41,0x0e,0xf7,0x2d,0x8a,0xd3,0xb1,0x5e,0x80,0x6f,0x32,0x35,0xea,0xa9,0xd6,0xbb},
+    {0x22,0xbf,0xdf,0xa3,0x13,0xd0,0xe5,0x95,0xb7,0x94,0xaa,0xcb,0x04,0x0c,0x45,0x1f,0xd7,0x79,0x10,0x2a,0xee,0xd9,0xd5,0x93,0x15,0xbb,0x5c,0xbb,0x0f,0xc2,0x9c,0x91},
+    {0x22,0xce,0xca,0x3c,0xc8,0x2d,0xc0,0x73,0xfb,0x61,0xb6,0x9c,0xea,0x28,0x02,0x04,0xab,0x6f,0x7f,0x3d,0x8f,0xc7,0xb3,0xd3,0x04,0xd9,0x97,0x98,0x3b,0x51,0x51,0xd3},
+    {0x23,0x1b,0xad,0xb6,0x08,0xf1,0x8b,0xda,0x45,0x03,0xa9,0x0a,0xbf,0x7c,0xb3,0xd8,0x5c,0x14,0x4c,0x86,0xe0,0xdd,0x8b,0x59,0x5a,0x48,0x20,0x8d,0xf6,0x38,0xef,0x83},
+    {0x23,0x5e,0xbb,0x07,0x24,0xce,0x5b,0x7d,0xdd,0xb8,0x1f,0x33,0x68,0xf1,0xe7,0x3e,0x27,0x63,0x3c,0xd5,0xbb,0x30,0x8b,0xb4,0x60,0x6f,0xa5,0x65,0x05,0xca,0x13,0xb7},
+    {0x23,0x71,0xd3,0x72,0x15,0x10,0x5e,0x8a,0xb3,0x91,0x83,0x5b,0x71,0x35,0xb6,0x2e,0xf7,0xb3,0x0c,0x38,0xca,0x36,0x09,0xc1,0x5e,0xe6,0x8f,0xa2,0xaf,0x6c,0xf2,0xd3},
+    {0x23,0xbb,0x08,0xac,0xb1,0xe7,0xf0,0xb2,0xc7,0xed,0x17,0xdc,0xf9,0x0d,0xac,0x32,0x83,0xbe,0x51,0xd2,0x86,0xe5,0x0d,0xa7,0x4c,0xc5,0xdc,0xda,0xa3,0xad,0x75,0xc3},
+    {0x23,0xda,0x94,0x78,0x19,0x23,0xb9,0x4b,0x20,0xd4,0xb1,0x80,0x79,0x3d,0x36,0xcd,0xc5,0x22,0xa6,0x57,0x78,0x8a,0xc5,0x69,0x1d,0xa3,0xbd,0xbd,0x2e,0xe1,0xf2,0xe9},
+    {0x24,0x45,0xb8,0xad,0xbe,0xca,0xc8,0x24,0x3f,0x06,0x78,0x46,0xae,0x10,0x95,0xb0,0x95,0xbc,0x6b,0x1e,0x30,0xee,0x6e,0xad,0x90,0x47,0x8f,0x83,0xba,0x78,0xd9,0x2d},
+    {0x24,0x7c,0xc8,0xfe,0xdd,0x94,0x32,0x93,0x91,0xe1,0x96,0x66,0x8d,0x0d,0x11,0x37,0x07,0x1f,0x23,0x1f,0x47,0xf1,0xf6,0xc9,0xf9,0x31,0x4d,0x20,0x84,0x91,0x2d,0xd9},
+    {0x24,0xe0,0x6f,0xe7,0xed,0x7e,0x15,0x04,0xf4,0x0a,0x04,0x58,0xb4,0x09,0xfc,0x7b,0xae,0x0b,0xc8,0x6f,0x63,0xe3,0x31,0x64,0x71,0xa0,0x00,0x3a,0x55,0x0b,0x1e,0x1c},
+    {0x25,0x29,0xf5,0x98,0xd1,0xad,0x23,0x63,0x99,0x12,0xb3,0xe3,0xe1,0x88,0x38,0x5b,0x08,0x95,0x08,0xd0,0x0b,0x6e,0x91,0xde,0xaf,0xfd,0x95,0x98,0x25,0x04,0x36,0xde},
+    {0x25,0x78,0x41,0x1c,0xee,0x43,0x3d,0xc9,0x75,0xd8,0x1d,0xd1,0x6e,0x3d,0xd9,0x3f,0x14,0xae,0x99,0xe4,0xa9,0xef,0x46,0xb6,0x8c,0x51,0x97,0xdf,0x3c,0x1f,0xa1,0x97},
+    {0x25,0x7f,0xc8,0xfd,0x07,0xc4,0x45,0x22,0xa8,0xca,0xc4,0x9f,0xb2,0x28,0x3c,0xea,0x7b,0xe2,0xce,0xa7,0xb9,0x87,0x20,0xca,0x6d,0x41,0x85,0xf3,0x9b,0xe3,0x98,0xd2},
+    {0x27,0x3c,0xbe,0xe8,0xd0,0x0b,0x16,0x07,0xcd,0x89,0x78,0x6c,0x59,0x3b,0x5e,0x28,0x35,0x80,0x71,0x03,0x79,0xcb,0xfd,0xa3,0x91,0xf6,0x86,0x79,0x6a,0xec,0x5a,0x93},
+    {0x27,0x5f,0x09,0xba,0x5e,0xf5,0x83,0x24,0x22,0x25,0x60,0x0a,0xb1,0x12,0x25,0x1d,0x7c,0x45,0xa2,0xd7,0x30,0x67,0xd7,0xd7,0x08,0x37,0xf7,0x68,0x60,0xea,0x6f,0x3e},
+    {0x27,0x6b,0x3f,0xf3,0x01,0xc9,0x6d,0x52,0x0e,0x25,0xb1,0x4a,0x42,0xf5,0x56,0xb6,0x98,0x1b,0x6a,0xc4,0x6d,0xe1,0x9f,0xaf,0xd7,0x57,0x42,0xa5,0x58,0x42,0x07,0x44},
+    {0x27,0x73,0x04,0x6b,0xfb,0x2a,0x02,0x1b,0x66,0x12,0x2d,0xad,0xae,0xa0,0x18,0x9e,0x28,0x0b,0xe9,0xbf,0x04,0x91,0xdb,0x80,0xad,0xa5,0x5b,0x82,0x12,0xd7,0x3a,0xe3},
+    {0x28,0x46,0x4e,0x0a,0x24,0x16,0x35,0x06,0x29,0xdb,0x8a,0x96,0xe5,0xb5,0x99,0xee,0x57,0x78,0x0f,0x0a,0x37,0x1b,0xa8,0x31,0x8f,0xa7,0xd4,0x0b,0xc1,0xab,0xe9,0xaa},
+    {0x28,0x80,0x0e,0xa3,0x06,0xe0,0x56,0x8a,0x0b,0xb0,0x14,0xe6,0x6c,0xdf,0x21,0xce,0xf8,0xec,0x8f,0x33,0x26,0xe3,0xa2,0x31,0x69,0x4e,0x7c,0xa9,0xcd,0xc4,0xd5,0xdc},
+    {0x28,0x90,0x81,0x4d,0xb5,0xca,0x81,0x88,0x3d,0x65,0x48,0xaf,0xf3,0x52,0x38,0x4b,0x60,0x45,0x04,0xe5,0xc1,0x0e,0xc5,0x2d,0xbf,0xf8,0x58,0x25,0xb4,0x74,0x2a,0x75},
+    {0x28,0xd0,0x82,0xc8,0x1b,0x18,0x1e,0x8c,0x85,0xf3,0x68,0x5c,0x2f,0x08,0xc8,0x09,0x50,0x0d,0x17,0xed,0x43,0xd7,0x1e,0xaf,0xa6,0x69,0xc9,0xf4,0xa4,0xdf,0x6d,0xc1},
+    {0x28,0xfe,0x63,0xbc,0x6c,0x59,0x2b,0xb9,0x29,0xf3,0xb6,0x93,0x83,0xef,0x8e,0xf8,0xd1,0x30,0x5e,0x9e,0xed,0x27,0x86,0x41,0x8d,0xfd,0xbb,0x40,0xc0,0x37,0x12,0xc8},
+    {0x29,0x16,0x51,0x1f,0x25,0x37,0x78,0x65,0x93,0x2e,0xd9,0x22,0x15,0x37,0x01,0xf1,0x98,0x0e,0x2e,0x06,0x91,0x9e,0x3a,0x7f,0x92,0x8a,0xbe,0x4e,0xf9,0x0f,0xca,0x3f},
+    {0x29,0x3c,0xb8,0x53,0x4d,0xd5,0xfd,0x55,0xde,0x77,0xd2,0x5e,0x62,0x06,0x55,0x69,0x48,0x49,0x1e,0x61,0xbd,0x79,0x26,0x39,0xbf,0x56,0x5e,0xb2,0x55,0xd3,0xdc,0xf0},
+    {0x29,0xcc,0x98,0xf4,0xb0,0xfb,0x3e,0x5d,0xd6,0x71,0x41,0x5b,0x87,0xd9,0x3c,0xa8,0xe7,0x43,0x82,0xde,0x24,0x85,0xc1,0x52,0xe3,0xc6,0x35,0x78,0x87,0x99,0x4e,0x31},
+    {0x29,0xe1,0x93,0xb1,0xc0,0xb3,0x38,0xe2,0x33,0x78,0xf7,0x6b,0x33,0xc3,0xc0,0x76,0x00,0xa1,0x42,0x61,0x92,0x70,0x6d,0x88,0x25,0x11,0x6a,0x98,0xf9,0xe9,0xf1,0x30},
+    {0x2a,0x3d,0x0e,0x7d,0x4e,0xe7,0xa9,0x5f,0x4a,0xef,0x3d,0xd7,0x4c,0x08,0x14,0xb0,0xcd,0x69,0x99,0x97,0x69,0x1a,0xd5,0x0a,0x36,0x7f,0x33,0xf5,0xbb,0x6a,0x86,0xea},
+    {0x2a,0x95,0x73,0x42,0xed,0xa6,0x75,0x0e,0xb3,0xe9,0xa6,0xfc,0x55,0xe5,0x96,0x92,0x57,0x8e,0x9d,0x34,0x1b,0x30,0x74,0x40,0x6d,0x90,0xf4,0x3c,0x07,0xf9,0x42,0xee},
+    {0x2a,0x9e,0x0c,0x79,0x1f,0x5c,0xaa,0x01,0x9f,0x08,0x56,0xe2,0x3a,0x62,0x86,0xeb,0x2a,0xa1,0xb1,0x19,0xee,0x87,0xaa,0x8c,0x0f,0xc9,0x41,0xfc,0xf0,0xff,0x6b,0xb1},
+    {0x2a,0xde,0x3b,0x4e,0x26,0x6f,0xb1,0x32,0x69,0x6f,0x7a,0x61,0xc8,0x8a,0x4c,0xd4,0xfb,0xdd,0x4c,0xb2,0x0f,0xd7,0x41,0x09,0x5c,0xce,0x6a,0x68,0xda,0x27,0x19,0x44},
+    {0x2b,0x75,0x36,0x62,0x27,0x4e,0xdc,0x99,0x29,0x93,0x3b,0x68,0x68,0x25,0xe4,0x8a,0x2b,0x40,0x62,0x9c,0x82,0x99,0xa6,0x80,0xf6,0x0c,0x47,0x53,0x92,0xfb,0xfa,0x53},
+    {0x2b,0x8c,0xe0,0xed,0x56,0x38,0x89,0xa6,0x1f,0x5a,0x25,0xc6,0x8d,0x21,0xe6,0x28,0x09,0x8f,0xdb,0x57,0xb5,0x5c,0x94,0x0e,0x09,0xd6,0x3d,0x1b,0xb7,0xe8,0xc9,0x20},
+    {0x2b,0xd4,0xbb,0x8e,0x72,0x81,0x27,0x53,0x10,0xb7,0x3e,0x01,0xa5,0xc1,0xdf,0x48,0xba,0x64,0x65,0xa8,0xac,0x15,0x25,0x55,0x7e,0x08,0x9e,0xc8,0xb7,0xcd,0xf9,0x22},
+    {0x2b,0xe3,0x13,0xec,0x17,0xc6,0xb3,0xdd,0x21,0xf0,0xab,0xba,0xef,0x62,0x3d,0xcc,0x8f,0x8a,0x69,0x2a,0xe9,0xc0,0x84,0x3f,0xe0,0x22,0x00,0x32,0x02,0xd6,0xdd,0x67},
+    {0x2c,0x37,0x42,0x0f,0x32,0x01,0x5a,0x51,0x01,0x2e,0xf8,0x72,0xf6,0xf6,0x35,0x80,0xf7,0xd0,0x02,0x36,0x77,0xe7,0x4a,0x45,0x07,0x0b,0xb8,0x68,0xe5,0x6f,0x8d,0xe1},
+    {0x2c,0x37,0x53,0x6e,0x7a,0xe2,0x99,0x15,0x5c,0x5f,0xde,0xb3,0x73,0x13,0x4b,0x66,0xa8,0x90,0x8c,0xde,0xc3,0x12,0x95,0x04,0x4a,0x8f,0xce,0xf0,0xcd,0x74,0x57,0x40},
+    {0x2c,0xd6,0x08,0xdd,0x71,0xd0,0x41,0xf5,0x39,0xb7,0xd8,0x19,0x83,0x1c,0x3d,0xe5,0x87,0x19,0xc2,0x46,0x32,0x23,0x08,0xa0,0x1e,0xf5,0x65,0x9e,0x6a,0x45,0x23,0xf0},
+    {0x2d,0x7d,0x66,0x83,0x2b,0x04,0x70,0x8f,0x56,0x60,0x19,0x57,0x9a,0x6a,0x88,0x0b,0xc7,0x12,0x20,0xfc,0xaf,0x39,0x0c,0x40,0x05,0xf9,0x84,0x91,0x41,0x10,0x73,0x29},
+    {0x2d,0xdb,0xce,0x64,0x99,0x1f,0x54,0x05,0xf6,0x83,0x1e,0xa9,0xc8,0xfa,0x14,0xd0,0x5a,0x5c,0x56,0x5e,0xff,0xd4,0x7c,0x29,0xb9,0x7a,0x2a,0x9f,0x6d,0x5b,0x73,0xff},
+    {0x2e,0x68,0xc7,0x2f,0x9a,0xf2,0xc7,0xdb,0x30,0xa4,0x4d,0x36,0x0a,0x83,0x2b,0x05,0xc7,0xe0,0xcd,0x1b,0x14,0x44,0x24,0x3c,0x32,0x7c,0x94,0xcd,0x0e,0xf3,0x79,0xe0},
+    {0x2e,0xb0,0x16,0x01,0xb7,0x51,0x4a,0x44,0x78,0x70,0x01,0x6f,0x17,0xee,0x3f,0x53,0xeb,0xa8,0x9c,0xa3,0x08,0x9a,0x03,0xae,0x62,0x98,0x87,0x94,0x6d,0x42,0x9d,0xb8},
+    {0x2e,0xe4,0xc8,0x6e,0xb2,0xcf,0x87,0x04,0xd9,0x7b,0x0f,0xae,0x33,0xdf,0xa9,0xff,0x09,0x04,0x1f,0xd9,0x59,0x30,0x96,0xd5,0x87,0x81,0x84,0x49,0xb4,0xdd,0xde,0x02},
+    {0x2f,0x0e,0x1a,0xd9,0xff,0xa7,0x04,0xff,0x3a,0x14,0x79,0x69,0x58,0x15,0xe1,0xc5,0xbd,0x0f,0x32,0xf3,0x2d,0x9a,0x69,0x5c,0xad,0xf2,0x58,0x00,0xc0,0x70,0x81,0x59},
+    {0x2f,0x10,0xa2,0xfb,0x21,0xf5,0xe5,0x55,0x6a,0xf9,0x55,0x11,0x22,0x67,0x7e,0xaf,0x79,0xaf,0x63,0x5f,0x96,0x0b,0xf5,0xc1,0xc1,0xa2,0x9a,0xb6,0xf6,0xbb,0xcf,0xa9},
+    {0x2f,0x7f,0x96,0x02,0x70,0x94,0x9b,0xf3,0x22,0x14,0xe4,0xa8,0x83,0x5d,0x49,0xa2,0x89,0x23,0xb3,0x34,0xd7,0x13,0x7f,0x99,0xc1,0x37,0xb1,0xde,0xe7,0x63,0x68,0x4d},
+    {0x30,0x4e,0xb3,0xc5,0x90,0x49,0x95,0xfd,0x2e,0xff,0xd2,0x14,0x68,0x59,0x06,0xb2,0x59,0x67,0x35,0x78,0xae,0xf0,0xac,0x84,0x01,0xb0,0xd5,0xde,0xaf,0xf9,0xc6,0xf5},
+    {0x30,0x6f,0x70,0x21,0xc2,0x83,0x73,0xd5,0x29,0xba,0xfe,0xc1,0x50,0x17,0x1b,0x1a,0xd4,0x61,0x43,0x67,0xe5,0x86,0x0e,0xde,0x9d,0x96,0xea,0xca,0x9b,0xd4,0x2e,0xf5},
+    {0x31,0x4a,0xb8,0xfe,0xc5,0x53,0x84,0xfc,0x75,0x57,0x4d,0xf7,0x40,0xa4,0x8a,0x1d,0x94,0x43,0x8f,0x72,0xf5,0xe2,0x56,0x77,0xa0,0x69,0x5b,0x49,0x3e,0x62,0x1f,0xc8},
+    {0x31,0x5e,0x28,0x5c,0x07,0x79,0x17,0x9e,0xee,0x67,0x74,0x5c,0xbe,0xf9,0x33,0x15,0x67,0x62,0x69,0x8b,0xd9,0x16,0xb3,0x10,0x8a,0xe1,0x6e,0x7b,0x4b,0x54,0x66,0x9a},
+    {0x32,0x2c,0xbc,0x10,0x07,0x4f,0x41,0x22,0xfa,0xc0,0xf7,0x90,0x35,0x43,0x33,0x2d,0xd1,0x33,0x6e,0x9e,0xc6,0x98,0x9b,0x34,0xa8,0x03,0x26,0xac,0x1d,0x78,0xe0,0x86},
+    {0x32,0x32,0x37,0x27,0xa9,0xcf,0xb1,0x87,0x91,0x3a,0x39,0x38,0x50,0x92,0x33,0x10,0x05,0xb6,0xa3,0x91,0x57,0x3e,0xc3,0x7b,0x29,0x0c,0x49,0x4f,0x66,0xd9,0xb3,0x5c},
+    {0x32,0x60,0xd6,0xa4,0xfd,0x6f,0x6a,0x49,0xfc,0x03,0xcd,0xfb,0xaa,0xc9,0x15,0x3c,0x2a,0x6d,0x7f,0x37,0xc5,0xb3,0xaf,0x2f,0xa7,0x8a,0xb2,0x13,0x21,0x6c,0x50,0xc1},
+    {0x32,0xea,0x98,0x5d,0x00,0x15,0xdb,0xed,0x2d,0x62,0xbd,0x5b,0x8b,0x72,0x25,0x9d,0x36,0x64,0x6f,0xd3,0x6f,0x15,0xbf,0x57,0x7d,0x15,0x03,0xb1,0x9b,0x2a,0x67,0x3d},
+    {0x33,0x43,0xe1,0xe8,0x1f,0x3c,0xdc,0x54,0x90,0x1e,0x9b,0x07,0x5a,0x5c,0x54,0x7c,0x8b,0xf5,0x4d,0x00,0x09,0xf5,0x4f,0x73,0x30,0x7a,0xff,0x89,0xc7,0xb9,0xdd,0x6c},
+    {0x33,0xab,0x4d,0xe3,0x8f,0x8c,0xa3,0x1c,0xd1,0xa2,0x0d,0xcd,0xb1,0x41,0xf3,0xca,0x94,0xc3,0x22,0x25,0x43,0x34,0x1e,0x0b,0x4f,0xcc,0xa6,0xa7,0xb7,0xce,0xd2,0x0a},
+    {0x33,0xb0,0x97,0xa2,0x1e,0x3b,0xa6,0xe8,0xb3,0x13,0x31,0x25,0x71,0x68,0xf8,0x24,0x31,0x5d,0xbf,0x41,0xc4,0xee,0xb9,0x0a,0x53,0xd5,0x05,0x11,0xc7,0xf6,0xcc,0xeb},
+    {0x33,0xc3,0xc7,0xd6,0xe4,0xf1,0xe2,0x61,0xfb,0x1b,0xd6,0xe5,0xc5,0xfa,0x63,0x69,0x8c,0xf0,0xbc,0x26,0xe4,0x2b,0x36,0x22,0x23,0x0c,0x51,0xda,0x29,0x96,0x5f,0x2f},
+    {0x33,0xce,0xdf,0x8b,0x61,0xd2,0x05,0x74,0x6c,0x43,0xb8,0xba,0x0d,0x1f,0x3b,0x96,0xdd,0x47,0x28,0xb1,0x98,0xff,0xf1,0x0f,0x14,0xa6,0xb2,0xb1,0xae,0x6b,0xef,0x6e},
+    {0x33,0xd5,0xe3,0xc8,0xc7,0x2f,0x87,0xc2,0x64,0xd6,0x85,0xc7,0x41,0x69,0x55,0x90,0x35,0x99,0xa1,0x5c,0x94,0xc6,0xe4,0xcb,0x12,0x84,0x8b,0x1f,0xf1,0x5f,0xe6,0x5b},
+    {0x34,0xad,0xff,0xc9,0xcb,0x54,0x4e,0xb5,0xbc,0x45,0x62,0xd0,0xa9,0xa4,0x3b,0xbe,0x94,0xa6,0x3f,0xeb,0x02,0x5c,0xab,0x8a,0xf2,0x0b,0x79,0xd9,0x47,0xe2,0xfe,0x80},
+    {0x34,0xb7,0x2b,0x4b,0xec,0x99,0x16,0xd9,0xe1,0x74,0xae,0x5c,0x40,0xd7,0xe5,0xaa,0x7f,0x0d,0x44,0x9d,0x56,0xb9,0x36,0xf8,0x1f,0xd5,0xfa,0x15,0xff,0x0a,0x3f,0x3e},
+    {0x34,0xb8,0x28,0xb5,0xbe,0x4c,0xd7,0x3e,0xf9,0x52,0xe2,0x37,0xfc,0x13,0xa9,0xb1,0xb3,0xec,0x6b,0x51,0xe4,0x7f,0xee,0x0e,0x52,0x59,0x36,0xe7,0xe0,0xf1,0x53,0xec},
+    {0x34,0xe1,0x0e,0x8b,0x6e,0x61,0xd1,0xee,0xef,0x27,0xe5,0xcd,0xbd,0x8c,0xc0,0xaf,0xc1,0x8a,0xd4,0xf6,0x89,0x7d,0x43,0x75,0x0e,0x6b,0x7a,0x49,0x44,0x32,0x90,0x01},
+    {0x35,0x86,0x2f,0xc0,0x7c,0x1f,0x2f,0x80,0x32,0x8f,0xf1,0xa6,0xa8,0x71,0x11,0x1a,0xe1,0xf2,0x34,0x0b,0x49,0x75,0xf8,0x2f,0x5e,0xfb,0xc6,0x86,0x73,0x0a,0x21,0xcb},
+    {0x35,0x88,0x6f,0x23,0x70,0x95,0x16,0x02,0xe2,0xe3,0x20,0x94,0x82,0xe8,0xf8,0x1a,0x40,0xe8,0x75,0x15,0x43,0x0b,0x71,0xf2,0x3f,0x1a,0x21,0xc5,0xb3,0x0a,0xa8,0x87},
+    {0x36,0x0f,0xf4,0x7b,0x08,0x04,0x09,0x24,0x4e,0xd9,0xc8,0xac,0x50,0x49,0x4d,0x7e,0x4c,0xfa,0xde,0xc8,0x39,0x12,0x41,0xbb,0xd4,0x13,0xfb,0x30,0x9a,0x1e,0x5b,0x20},
+    {0x36,0x21,0x6e,0xab,0xdf,0xab,0x24,0xda,0xe1,0x36,0xa4,0x08,0x4a,0x7e,0x93,0x2f,0xa0,0x02,0xf1,0x73,0x15,0x22,0x53,0x77,0x64,0x10,0x96,0x65,0x10,0xe6,0xf4,0x1e},
+    {0x36,0x23,0x26,0xb4,0xad,0x30,0x3f,0x36,0x8e,0x7b,0xdb,0xfa,0x1a,0x74,0xba,0x1b,0x9f,0x07,0x8e,0x82,0x83,0xf4,0x24,0x2b,0x37,0xfd,0x4b,0xe0,0x14,0x89,0x8b,0xc6},
+    {0x36,0x3b,0x9d,0x05,0x93,0x8b,0x52,0xc5,0x32,0x56,0x19,0xc8,0xa1,0x35,0x3b,0x13,0xe2,0x4d,0x69,0x19,0x9f,0xab,0x26,0x8c,0xce,0x8c,0x20,0x91,0xcf,0xc2,0xc4,0xfe},
+    {0x36,0x95,0x0f,0x4a,0xd5,0x7c,0x5f,0x23,0xca,0x41,0x45,0x0a,0x90,0xd4,0x61,0xf3,0xd7,0x3b,0x76,0x5f,0x61,0x9c,0x53,0x07,0x56,0x5c,0x1d,0x64,0xe7,0x72,0xc3,0x12},
+    {0x36,0xc7,0x5a,0xb8,0x5f,0xcb,0x71,0x2a,0xf8,0xc5,0x8d,0xc7,0x9e,0xaa,0x71,0x2d,0xad,0x9d,0x4b,0x3f,0xc5,0x5e,0x01,0xdb,0xcb,0xf0,0xfc,0x08,0xb2,0x43,0xef,0x58},
+    {0x37,0x1f,0xe7,0x04,0xd7,0x7f,0x3a,0x9e,0xc6,0xc1,0x80,0x32,0x2a,0x95,0x82,0x9f,0xfb,0xb6,0xe6,0xda,0xa4,0x48,0x86,0x7d,0x78,0x4f,0x0d,0x49,0xcf,0x9a,0x08,0x12},
+    {0x37,0x90,0xf4,0x78,0x81,0x83,0xb3,0x09,0x03,0x07,0x2c,0x61,0xd1,0xa3,0x33,0x28,0xfb,0xfd,0x61,0x8a,0x3b,0x3d,0x9e,0x88,0xa6,0xa5,0x4f,0xd7,0x3b,0x1a,0xf5,0x44},
+    {0x37,0x99,0xd5,0x13,0x12,0xbc,0xe2,0xa9,0xc1,0xa1,0x23,0x25,0xd9,0x41,0xab,0x27,0x8a,0x7b,0x44,0x98,0xbd,0x60,0xd0,0xf7,0xeb,0xce,0x51,0x05,0x38,0xc1,0x96,0x9d},
+    {0x37,0xcc,0x59,0x0e,0xcf,0xfa,0x39,0x08,0x7f,0x4c,0xcb,0xc0,0xef,0x9e,0xd3,0x66,0x1f,0x4f,0x4c,0x0c,0x15,0x18,0xbf,0xe0,0x2c,0xd4,0x24,0x6b,0xa5,0x6c,0xdb,0xa5},
+    {0x37,0xd3,0xe7,0x79,0x41,0x5b,0xd6,0xf3,0xfb,0xe2,0x95,0x54,0x18,0x3e,0x51,0x49,0x9b,0x4c,0x04,0xbe,0xd9,0x18,0x20,0x61,0xa5,0xae,0x88,0x19,0x27,0xf9,0xd5,0x76},
+    {0x37,0xd4,0x00,0xd5,0x72,0x75,0xff,0x87,0xb3,0x6d,0x5d,0x81,0x8c,0x2f,0x58,0xec,0x7b,0x33,0x47,0x8c,0xfa,0x62,0xea,0xe8,0xb4,0x59,0x3f,0x57,0x96,0xe3,0x10,0x09},
+    {0x38,0x67,0x52,0xde,0x4a,0xa5,0x31,0x5d,0x0b,0x54,0xd7,0x1c,0x98,0x23,0x99,0x2f,0xdd,0x9a,0x1f,0xb4,0x2d,0x3e,0x34,0x2a,0xce,0x78,0x0c,0x8d,0x61,0x52,0x14,0xb2},
+    {0x38,0x73,0x69,0x4b,0xa4,0x97,0xe9,0x08,0x44,0x4f,0xae,0x72,0xb0,0x8c,0x8a,0xba,0x67,0xab,0x45,0x2c,0x98,0xa8,0x32,0x90,0x4f,0x79,0x4e,0x69,0x65,0xa3,0x40,0x2b},
+    {0x38,0xd4,0x9b,0xc0,0xd2,0xb4,0xe7,0x9e,0xce,0x29,0x9b,0xad,0x09,0x64,0x03,0x38,0x4c,0xdf,0xcc,0x0e,0xe3,0x19,0xd5,0xa3,0x8c,0xc2,0x33,0x63,0x90,0x73,0x4f,0x11},
+    {0x38,0xd4,0xe2,0x5e,0xf9,0x48,0xa5,0xbf,0x75,0x81,0xde,0x9b,0xee,0x81,0xd6,0x24,0x0d,0xdd,0x26,0x08,0x9e,0x46,0x53,0xd5,0x45,0x67,0x55,0x2d,0xba,0xa2,0x5f,0x90},
+    {0x38,0xfe,0xa3,0xe1,0xca,0xd6,0x1c,0x7b,0x6d,0x63,0x40,0xf5,0x40,0xc1,0x27,0x0f,0xf6,0xee,0xe1,0xf5,0x1f,0x4f,0xf0,0x56,0x0f,0x94,0x81,0xa8,0xa1,0xf6,0xcc,0x21},
+    {0x39,0xc2,0x5e,0xce,0x56,0xa7,0xfe,0x11,0x01,0x7c,0x62,0xd8,0x1a,0x11,0x5c,0xeb,0xf0,0xf5,0x3a,0x33,0xe5,0xf5,0xf5,0xc4,0xf9,0x2d,0x16,0xbf,0xcc,0x21,0x2f,0x51},
+    {0x39,0xfb,0x31,0x6e,0x39,0xee,0xbc,0x15,0x1d,0x1a,0xa3,0xf6,0x0b,0x85,0xfe,0xd1,0x41,0x79,0xbe,0xed,0xe6,0x09,0xed,0xdb,0x13,0xc6,0xb8,0xd7,0x54,0xd1,0x10,0x8a},
+    {0x3b,0xe8,0xf3,0x06,0x23,0x0a,0xba,0x8b,0x3e,0xef,0x35,0x3c,0xb0,0xe4,0xce,0x6f,0x93,0x32,0x89,0x1d,0x38,0xa3,0xd8,0x98,0x1e,0x86,0x69,0x24,0x78,0x1c,0xc0,0x5a},
+    {0x3c,0x15,0x60,0x96,0x9e,0xf6,0x81,0x2c,0xba,0x48,0x31,0x74,0xb9,0x66,0xf1,0xaa,0x2a,0x4d,0x0b,0x6d,0xb0,0xee,0x9a,0x27,0x13,0x20,0xfb,0xfd,0xac,0x0a,0x5b,0x2e},
+    {0x3c,0x3a,0xc7,0x1f,0x7d,0xd0,0x8c,0xbb,0x99,0x63,0x73,0xbe,0x08,0x4b,0x77,0x18,0x0b,0x0d,0x2a,0x05,0xbd,0x75,0x68,0x61,0x4c,0x9b,0x11,0x72,0xdd,0x93,0x13,0x72},
+    {0x3c,0xc1,0x71,0x5e,0xf6,0x58,0x83,0xab,0x77,0x85,0x31,0x95,0xd9,0xf2,0x1e,0xbd,0x3a,0x1d,0x84,0x3a,0x3c,0x97,0x15,0xf8,0xda,0x3b,0xbc,0x09,0xaa,0x0c,0x9c,0x3e},
+    {0x3c,0xef,0x2f,0x1d,0x65,0x4a,0xf4,0x4d,0xa7,0x71,0xa9,0xa2,0x41,0x47,0xbf,0x85,0xb6,0x37,0xf5,0x6c,0x84,0xe4,0x51,0x49,0x97,0x66,0xef,0xc8,0x86,0x96,0xe8,0x2f},
+    {0x3e,0x55,0x37,0x79,0xcf,0x5f,0xda,0xbe,0x9a,0x5b,0x79,0x2f,0x8e,0x56,0x49,0x2b,0x32,0xf3,0xc1,0xeb,0x3a,0x85,0x6e,0xa9,0xe5,0x44,0x38,0xcc,0xb0,0xf8,0xd2,0xe7},
+    {0x3e,0xee,0x09,0x0e,0x9a,0x14,0xc1,0xfb,0x0d,0xcb,0x98,0xec,0xee,0x9d,0x7b,0xef,0x6a,0x47,0x28,0x1d,0x4c,0x37,0x55,0x9c,0xf0,0xe8,0x18,0x75,0xfd,0x45,0x18,0x71},
+    {0x3f,0x44,0x57,0xae,0x4d,0x9d,0x1b,0x28,0x0b,0x55,0x67,0x7f,0x74,0x2e,0xd9,0x1e,0x1a,0xd8,0xc0,0x67,0x9e,0x8a,0x4b,0x1e,0x2f,0x9b,0xed,0x3d,0xb9,0xd8,0x59,0x88},
+    {0x40,0x1d,0xeb,0x02,0x4c,0x88,0xae,0xed,0xcf,0x12,0x6b,0xfd,0xbc,0xe3,0x23,0xad,0x17,0x31,0xd3,0x8e,0xad,0x40,0xd9,0x47,0xb1,0x61,0x1b,0xdb,0xf2,0x96,0xd9,0x93},
+    {0x40,0xaa,0x2f,0x50,0x5c,0xd0,0xc1,0x1b,0x3f,0xf2,0x9f,0x2f,0x04,0x1a,0x0d,0x42,0x77,0x52,0x0f,0x28,0xf7,0x97,0xe8,0x91,0xc4,0xd6,0x7b,0xe3,0x28,0x32,0x8f,0x43},
+    {0x40,0xb8,0xe9,0x30,0xbe,0xee,0x2c,0x95,0xff,0x23,0xd6,0xd9,0x83,0xed,0xdd,0xfd,0x98,0x82,0x48,0xa7,0x89,0x9a,0x56,0x19,0xd3,0x4b,0x3b,0x3d,0x31,0xed,0x96,0x51},
+    {0x42,0x1a,0x5b,0x05,0x08,0x44,0x48,0x21,0xe8,0x39,0x56,0x30,0x71,0x7f,0x23,0x80,0x6d,0x2d,0xd1,0x84,0x12,0x94,0x26,0xf4,0x53,0x21,0xf7,0x32,0x82,0x21,0x18,0x0e},
+    {0x42,0xb7,0xed,0x8e,0x2f,0x1e,0x45,0x73,0x5c,0xff,0x98,0x3d,0xf7,0xb3,0x8b,0x67,0x06,0x18,0x6a,0x73,0x63,0x97,0x80,0xf8,0xa7,0xce,0x34,0xeb,0x9c,0x0c,0x2e,0x51},
+    {0x43,0x23,0x5a,0x39,0x79,0x88,0xd0,0xb2,0xcc,0x97,0x9c,0x1e,0x50,0x35,0x1c,0x7f,0x2c,0xba,0x9c,0x93,0x93,0x41,0xcc,0x81,0xda,0x5c,0x35,0x2f,0x83,0x74,0x90,0x62},
+    {0x44,0x10,0xe2,0x42,0xbe,0x50,0x92,0x01,0xac,0xea,0x79,0x70,0x7d,0xb6,0x95,0x8f,0x96,0xf9,0x32,0x8f,0xa0,0x99,0x19,0x51,0xfc,0x0c,0x27,0x8e,0x5a,0x6f,0x7b,0x29},
+    {0x44,0x3e,0x28,0x71,0xc0,0xfd,0x1f,0x75,0x1c,0x5a,0xeb,0xb0,0x74,0x51,0x81,0x00,0xb5,0xbe,0xf6,0x17,0x27,0x32,0xf8,0x54,0x75,0x66,0x97,0xe5,0xc7,0x8c,0xa6,0x28},
+    {0x44,0x46,0x62,0xb9,0x0a,0xa0,0xc0,0x0c,0x63,0x3b,0x28,0x90,0x4a,0xc1,0x99,0xf4,0x8f,0x61,0xe4,0xc9,0xa1,0x39,0xf6,0x05,0x63,0x15,0xca,0x60,0xe0,0xeb,0x7b,0x4d},
+    {0x45,0x22,0x38,0x5a,0xb2,0x81,0x92,0x28,0x7a,0x2d,0x74,0xda,0x8b,0x44,0x0b,0x16,0x65,0x04,0x75,0x2a,0xae,0x9a,0x98,0x9f,0xd7,0xf7,0x1d,0xce,0xdb,0x65,0xc5,0x36},
+    {0x45,0x61,0x9a,0xfb,0x47,0x05,0x2d,0x59,0x9e,0x30,0xc4,0x56,0xe4,0xff,0x64,0xdf,0x57,0xdd,0xde,0x30,0xe7,0x98,0xd3,0xc6,0xde,0xe3,0x87,0xc6,0x41,0xf3,0xc7,0x9f},
+    {0x46,0x22,0x37,0x60,0xbd,0xd2,0xe9,0xe1,0xac,0xd5,0x99,0xeb,0x32,0x5c,0xe7,0xc0,0x02,0x2a,0x73,0x69,0x7f,0x05,0x4b,0x95,0xe8,0x8b,0xef,0x91,0x89,0xff,0x29,0x5e},
+    {0x46,0x9c,0x23,0x18,0xa2,0x86,0x04,0xa7,0xeb,0x13,0x1c,0x87,0x3d,0x7f,0x34,0x60,0x23,0x62,0xce,0x27,0xe4,0xbd,0x9d,0x96,0xf8,0xa3,0x2f,0xf5,0xff,0x09,0x11,0x01},
+    {0x47,0x3e,0xbb,0x53,0x9d,0x95,0x8e,0x2e,0x77,0x22,0x5d,0x9e,0x7f,0x90,0xcc,0x7b,0x7e,0x09,0xbb,0x87,0xc9,0x3f,0x60,0x97,0x1e,0xa0,0x1b,0x33,0x94,0xed,0x1c,0x1b},
+    {0x47,0x6e,0xdc,0x8c,0x7d,0x39,0x33,0x02,0x00,0x6e,0x4e,0x51,0x40,0x6a,0xf1,0x4e,0xb1,0x67,0x3c,0x96,0x5d,0x36,0x08,0xfe,0x42,0x4f,0x21,0x20,0x3a,0xbd,0xab,0xb3},
+    {0x47,0xed,0x7f,0x9e,0x66,0xc2,0xd7,0xc7,0x97,0x63,0x67,0x6f,0xf7,0x6b,0xf6,0x90,0x64,0x93,0x0e,0xdc,0xcf,0x87,0x87,0x7f,0xf7,0xd3,0x9d,0x04,0x83,0x16,0x43,0x27},
+    {0x48,0xad,0x3b,0x0d,0xc4,0x06,0x47,0x80,0x35,0xde,0xee,0x5d,0xfc,0xcf,0x01,0x67,0x96,0x87,0x0a,0x29,0xd1,0x27,0xb9,0xa9,0xae,0x52,0x79,0xa7,0xaf,0xbb,0xb8,0xc5},
+    {0x48,0xf2,0x9f,0x2d,0xc6,0xb7,0xa6,0x14,0x03,0x3d,0x27,0x1d,0xc1,0x82,0x2f,0x5c,0x20,0xe2,0xd7,0x9a,0x6a,0xc1,0x82,0x01,0x77,0x1b,0xd1,0xdf,0x7c,0x63,0x1f,0x5b},
+    {0x49,0xcc,0x2b,0xab,0xe8,0xdb,0x71,0x7c,0x57,0xb2,0xec,0x3a,0x57,0x4d,0x3b,0xc0,0x3f,0x07,0x91,0x9a,0xa5,0x04,0x48,0xd3,0x6e,0xc1,0xfe,0xa9,0x07,0xf0,0x20,0x3c},
+    {0x49,0xf2,0x31,0x7d,0x31,0xba,0x18,0xf4,0x1b,0x53,0xa6,0x2c,0x0c,0xf4,0xd9,0xe5,0x8e,0xb6,0xbd,0x2c,0xf6,0x1c,0x46,0x44,0x54,0x7d,0xf5,0xd7,0x3d,0x10,0x24,0xec},
+    {0x49,0xf8,0x44,0xfd,0xe5,0x2b,0xbd,0x19,0x66,0xbb,0xb4,0x59,0x89,0xe9,0xd0,0x4e,0x56,0xf3,0x11,0xeb,0x1a,0x43,0x81,0x83,0x90,0x4a,0x31,0x48,0x33,0x8e,0x2b,0x1a},
+    {0x4a,0x14,0x70,0x1d,0x9b,0x52,0x80,0xa2,0xff,0xeb,0x60,0xa7,0x63,0x5d,0xa1,0x18,0x4b,0xae,0x34,0x70,0x8c,0x33,0xd2,0xd6,0xd8,0x77,0xa9,0x97,0x30,0x42,0x08,0x53},
+    {0x4a,0x21,0x2b,0x5b,0x4d,0x53,0xea,0xc5,0x94,0xaf,0xc8,0xc2,0xac,0x5d,0x4f,0x54,0x19,0x66,0x11,0xe5,0xa4,0xb1,0x31,0xa1,0x23,0xc8,0x93,0x3c,0x9e,0x34,0x5a,0x64},
+    {0x4b,0x35,0x62,0xf4,0x79,0xf8,0x9c,0x78,0x46,0xc8,0x9f,0xa6,0x43,0xa0,0x47,0x5d,0xff,0xf4,0x73,0x94,0x5b,0xf0,0xb6,0xfa,0x0f,0x60,0xdf,0x19,0x06,0xab,0xcd,0x3c},
+    {0x4b,0x6d,0xd3,0x64,0x99,0xb7,0x98,0xb9,0x25,0x14,0x75,0xbd,0x16,0x98,0xed,0x17,0xd2,0xe0,0x06,0xaa,0xe0,0x73,0xd5,0x08,0x4c,0x01,0x27,0x26,0x93,0xc3,0xb1,0x5f},
+    {0x4c,0x4b,0x89,0x82,0x31,0x07,0xed,0x3e,0xe0,0x10,0xd7,0x5f,0x3e,0x10,0x0d,0xa6,0xa6,0x59,0x44,0x72,0x9d,0x22,0x97,0xfa,0xd5,0xa6,0x1d,0x4e,0x34,0xa0,0xf5,0xe3},
+    {0x4c,0x7b,0x98,0x56,0xbf,0x51,0x6b,0x8c,0x53,0x3b,0x5e,0x44,0xd7,0xb9,0xf0,0x1c,0xf1,0x12,0x45,0xe9,0x8c,0xd4,0x0c,0x14,0x35,0x9c,0xbc,0x38,0x14,0xc2,0x3e,0x79},
+    {0x4c,0xb1,0xb8,0x96,0x8c,0xb6,0xc1,0x7b,0xe4,0x57,0xcd,0x8f,0xa4,0x33,0xdf,0x82,0x3f,0xaf,0xee,0x8a,0x9e,0xcf,0xbe,0xd3,0xa0,0xc6,0x9d,0xb0,0xb1,0xe7,0x25,0xd2},
+    {0x4c,0xe5,0xbd,0xf8,0x74,0xcd,0xfe,0x63,0x27,0xf3,0x5e,0xc1,0xfe,0x61,0x9c,0xfd,0xbc,0x1f,0xe8,0x75,0x02,0x35,0x15,0xcb,0x4b,0x3c,0x9a,0x73,0xbb,0x01,0x52,0x76},
+    {0x4c,0xf5,0xea,0x39,0x26,0xfd,0x36,0x31,0x92,0xaa,0xec,0x42,0x8e,0x1a,0xf6,0xb8,0x3c,0x75,0x78,0xbe,0x82,0xa5,0x3f,0x58,0x6e,0x93,0x3a,0x45,0xac,0x5d,0xc2,0x08},
+    {0x4d,0x45,0x31,0xcb,0xf1,0xda,0xdb,0x58,0x58,0x99,0x3a,0x8e,0x43,0x35,0x2d,0x32,0xf9,0x6d,0x6b,0xc4,0xba,0x50,0x95,0xc5,0xe7,0x16,0xef,0x6f,0x65,0xbb,0x0e,0xf5},
+    {0x4d,0x76,0x0d,0xb1,0x9e,0xeb,0xcc,0xf9,0x63,0xe5,0x4f,0x82,0xd2,0x2b,0x0d,0xae,0xe4,0xb1,0x14,0xa2,0x10,0x96,0x1c,0xe3,0x54,0x9c,0xf9,0x96,0x2f,0xbe,0x81,0x59},
+    {0x4e,0x46,0xce,0x9a,0xba,0x7c,0x13,0xe9,0x30,0xd9,0x6e,0xa6,0x6e,0x3f,0xf9,0x2d,0x21,0x3e,0xff,0xfa,0x2e,0x43,0x23,0x73,0xa2,0xa3,0xfa,0x04,0xfb,0xff,0xab,0x36},
+    {0x4f,0x30,0x16,0x87,0x6a,0x25,0x2b,0x66,0x48,0xb8,0x9f,0xb7,0x4e,0xcc,0xd9,0x87,0x4c,0xea,0xd1,0xef,0x98,0xfb,0xcb,0xa5,0xe4,0xcf,0x19,0xac,0xf0,0xc3,0x61,0x69},
+    {0x4f,0xae,0x4b,0xa2,0x96,0x3d,0x02,0x0d,0xd4,0x8b,0x0e,0xaf,0x66,0xdf,0x6c,0x70,0xdf,0xf3,0x82,0x28,0xfe,0x82,0x0e,0x01,0x50,0x54,0x2c,0x83,0x1c,0x6c,0x64,0x05},
+    {0x50,0xd8,0xcb,0x5c,0xb8,0xda,0x89,0x52,0xdd,0x8e,0x9c,0x96,0xb4,0x22,0xa9,0xa6,0x66,0xe3,0xd9,0x12,0xba,0xf9,0x26,0xc0,0x43,0x74,0x69,0x11,0xcb,0x29,0x8b,0x75},
+    {0x51,0x0b,0x74,0x45,0x70,0xb3,0x00,0x32,0xa4,0x7d,0xb3,0xcd,0x9e,0x05,0x57,0xac,0x68,0x97,0x98,0x5c,0xac,0x9c,0x72,0x9c,0x4c,0x39,0xa5,0x25,0xe6,0xaa,0xae,0x82},
+    {0x51,0x40,0x9a,0xdc,0xc9,0x41,0x47,0x9f,0x7e,0x82,0xd3,0x67,0x36,0x40,0xbb,0x9c,0xb6,0xf3,0xcb,0x1b,0x05,0xef,0xb9,0x17,0x8a,0xd0,0xf3,0x5e,0x7a,0x49,0x96,0xc8},
+    {0x51,0x58,0x04,0x7d,0x57,0x98,0x83,0xbe,0xa8,0xe1,0xfe,0xff,0x5c,0xe8,0xa8,0xee,0xd6,0x2f,0xaf,0xd2,0xd7,0x1e,0x46,0x4b,0x3a,0x1e,0xd7,0x48,0x33,0xde,0xa7,0x83},
+    {0x51,0x80,0xeb,0xa1,0x0e,0x4d,0xe4,0x7c,0x74,0xa9,0x70,0x95,0x02,0xe2,0x47,0x07,0x47,0x68,0xc6,0xfe,0x95,0x5f,0xdd,0xd9,0x8e,0x3a,0xf8,0xa8,0x54,0x5e,0xed,0xb2},
+    {0x51,0xd0,0x79,0x63,0x79,0xbf,0xca,0x69,0xc7,0x1a,0x19,0xf3,0xe6,0xd2,0xad,0x69,0x75,0xd1,0x22,0x8e,0x3d,0x6b,0x60,0xdc,0xa2,0x04,0xcd,0x8d,0x06,0x38,0xb2,0xb7},
+    {0x51,0xf7,0xb6,0xef,0x1d,0x5f,0x9a,0xf0,0x28,0x83,0x88,0x29,0x20,0xd1,0xb7,0x85,0x09,0x42,0xe9,0x40,0x59,0x38,0x3b,0x81,0x9c,0x96,0x59,0x0a,0xf1,0x73,0x4f,0x1a},
+    {0x52,0x00,0xf9,0x0b,0x52,0x60,0xda,0xc8,0xd0,0xb0,0xe3,0x80,0x4b,0x46,0x0d,0xc4,0x91,0x54,0x75,0x5b,0x52,0xc0,0x23,0xf0,0xb3,0x7f,0x60,0x6c,0x3f,0x6a,0xcf,0x8b},
+    {0x52,0x91,0xf8,0xff,0xfb,0xc5,0x79,0x1a,0x49,0x35,0x83,0xdb,0x97,0x1a,0x51,0x35,0x2e,0x6d,0xec,0x2b,0x64,0x61,0x3d,0xf2,0x46,0xa6,0x28,0xbe,0x48,0xb7,0xab,0x95},
+    {0x53,0x05,0x17,0xed,0xe5,0xaf,0x95,0x93,0x66,0xee,0x1b,0xd3,0x45,0xf0,0xae,0xb5,0xe8,0xfa,0xc3,0x99,0x78,0x2d,0xe3,0xae,0x8f,0xe1,0x22,0x42,0x4f,0x3e,0x67,0x96},
+    {0x53,0x47,0xd4,0xae,0x2b,0x01,0x47,0x3e,0x6e,0x2e,0x16,0x2b,0x65,0x4f,0xf7,0x8a,0xe9,0xa5,0x33,0x01,0xe9,0xe3,0xfe,0xa8,0x44,0xb6,0xe0,0xb0,0xde,0xba,0x15,0x96},
+    {0x53,0xb4,0x62,0x9f,0xc4,0x58,0xd8,0x10,0x78,0xcf,0xc3,0xf6,0xa3,0x05,0xca,0x80,0xee,0x8d,0x27,0x54,0x63,0x11,0xb2,0xb1,0x19,0x38,0x0e,0x6b,0xa0,0x4c,0xb2,0xc1},
+    {0x53,0xbb,0x84,0x44,0x92,0x62,0x93,0x9b,0x1c,0xb3,0x53,0x88,0x0b,0x60,0xfa,0xc9,0x2c,0x29,0x02,0x21,0xc3,0x36,0xf1,0x49,0x20,0xd8,0x64,0xf0,0xdf,0xfb,0xd2,0xa1},
+    {0x54,0x00,0x84,0x0f,0x27,0x08,0x99,0x5c,0x82,0xbe,0x14,0xd8,0x27,0x01,0x6f,0xfc,0xb3,0x5b,0x2a,0xc6,0x83,0x84,0xa4,0xf6,0xe0,0xf0,0x4b,0x99,0x9a,0x30,0x39,0xe0},
+    {0x54,0x0d,0x37,0x2d,0xd2,0x99,0x4e,0xdb,0x28,0xde,0x9d,0x16,0xf8,0xfa,0xd3,0xa8,0x3d,0x3e,0xe2,0x4b,0xb1,0x99,0x63,0x49,0xaf,0x86,0x50,0xe2,0x32,0x45,0xa3,0x8d},
+    {0x54,0x72,0xc3,0xcb,0x2f,0x4e,0x1f,0x42,0x96,0x00,0xf2,0xe0,0xb1,0x27,0x91,0x59,0xb5,0x04,0xbe,0xf4,0x4d,0x91,0x12,0x56,0xfc,0x30,0xd7,0xc0,0x08,0x69,0x71,0xd0},
+    {0x55,0xad,0x2a,0x7f,0xa1,0xb0,0x20,0x46,0x8c,0x78,0xb2,0xf5,0xb5,0x3c,0xa3,0x87,0xd6,0x50,0xee,0xf3,0xaf,0xaa,0xcf,0x88,0x00,0x3c,0x52,0x4c,0x4e,0x27,0x3f,0x8c},
+    {0x56,0x16,0x22,0x44,0xf1,0xa4,0x8a,0x8d,0x59,0xb6,0x52,0xa6,0xbe,0xe2,0x2f,0x7d,0xbc,0x54,0x28,0x96,0x9a,0xdf,0xe4,0xc5,0x66,0x0c,0x90,0x5a,0x97,0xd3,0x0d,0xdd},
+    {0x56,0x74,0x6d,0xd0,0xe3,0xad,0x35,0x9a,0x6f,0x20,0xab,0x00,0xda,0xcd,0xf8,0x12,0x27,0xa5,0x7c,0xf7,0x1f,0xae,0x68,0xe0,0xdc,0xb5,0x0c,0xad,0x55,0x3f,0x02,0x40},
+    {0x56,0x76,0x41,0x95,0x3f,0x39,0x00,0x8d,0x24,0x64,0xbf,0x41,0xfa,0xd2,0x3d,0x38,0x45,0x99,0xee,0xe4,0x39,0x62,0x93,0xdd,0xd4,0x91,0x4b,0x39,0xf1,0x15,0xc2,0x8f},
+    {0x56,0xf8,0x63,0xbb,0x15,0x1d,0x11,0xfe,0xf5,0x37,0x26,0x6c,0x52,0x12,0xbd,0x5f,0xd4,0xfa,0x5d,0x0e,0x50,0xf5,0x5f,0x99,0x9b,0x5b,0xb1,0xc8,0xb4,0x3b,0x9b,0xa2},
+    {0x56,0xfa,0x4e,0xa1,0xdc,0xec,0xc1,0x49,0xd7,0x53,0x6d,0x17,0xf0,0xd2,0xe1,0x62,0x5b,0x5d,0x5f,0x50,0xfb,0x32,0x54,0x4e,0xef,0x67,0xdb,0x91,0x6e,0x17,0x0d,0xe5},
+    {0x57,0x82,0x40,0xa7,0x34,0x42,0x6c,0xb4,0x79,0x46,0xef,0x89,0x9a,0x57,0x35,0x98,0x63,0xf3,0x8e,0xc1,0x23,0xdb,0x1b,0x6d,0x1d,0x18,0x8b,0x7d,0x2f,0x06,0xad,0xef},
+    {0x57,0xdd,0x0a,0xf9,0x3e,0xa3,0xcf,0xe6,0x07,0xee,0x4b,0x6d,0xc0,0xfb,0x6f,0x4e,0xf2,0x07,0x23,0x87,0x7d,0x09,0xfc,0x6d,0x88,0x29,0xf7,0x83,0x31,0xf8,0x65,0x00},
+    {0x59,0x5c,0x54,0x7c,0x31,0x81,0xb2,0x66,0x70,0x2a,0xab,0x44,0x97,0xe4,0xea,0x8e,0xa8,0xaf,0x6e,0x74,0x3e,0xc2,0x8e,0xc7,0xfa,0x3c,0xf1,0x3f,0xb0,0x2e,0x17,0x4a},
+    {0x59,0x65,0xd0,0xfa,0x21,0xc8,0x43,0xbd,0xf9,0xcd,0x49,0x14,0x25,0x8e,0xb3,0x24,0x8c,0xb0,0x77,0xf5,0xcf,0x50,0xb1,0xf4,0x94,0x47,0x88,0x4a,0x49,0x70,0xc7,0xa7},
+    {0x5a,0x92,0x40,0xfe,0xaf,0x06,0xa3,0xda,0x8e,0xe6,0x61,0xc8,0x8b,0x53,0x5d,0x48,0x50,0x9a,0x56,0xf7,0xd4,0x56,0x25,0xa1,0xf7,0x4f,0x14,0x97,0x57,0x90,0x59,0x67},
+    {0x5a,0xd1,0xfc,0x19,0x2b,0xd4,0x9f,0xcc,0xdc,0x79,0xd5,0xd8,0x3d,0xbb,0xf2,0x28,0x6e,0x9e,0x1f,0xad,0x2a,0x15,0x5d,0xf4,0xe1,0x92,0xe6,0x27,0x55,0xe8,0x23,0x3c},
+    {0x5c,0x56,0xe8,0xad,0xee,0xd1,0xc6,0xb1,0x68,0x42,0x7b,0x2e,0xb9,0x97,0xc1,0x7e,0x14,0xf2,0xba,0x08,0x7f,0xdd,0xe5,0xb7,0x64,0xff,0xaf,0x1b,0xe4,0x6c,0x0c,0x93},
+    {0x5c,0x74,0x32,0xd8,0x81,0x8b,0x96,0x6e,0xee,0x82,0xcf,0xd5,0x59,0xba,0x1e,0xb1,0xf2,0xb0,0x45,0x3c,0x12,0xaf,0x8e,0xa6,0xce,0xcb,0x26,0xa2,0x85,0x32,0x81,0x67},
+    {0x5c,0x86,0x09,0xcb,0xa7,0x18,0x8d,0xa8,0xe0,0x5e,0xf6,0x0d,0xaf,0xc2,0x4e,0x4c,0xa6,0xef,0x90,0xb3,0xa7,0xe6,0xb0,0xb3,0xa7,0x98,0x57,0x44,0x82,0x61,0x60,0x10},
+    {0x5c,0xa8,0xe7,0x93,0xf4,0xbb,0x2a,0x3f,0xb2,0x5b,0x1f,0x89,0x61,0xb9,0xcf,0x17,0xd4,0x04,0x70,0xd7,0x44,0x62,0x89,0x0a,0x6c,0x72,0xb2,0xae,0x79,0x64,0x33,0x67},
+    {0x5d,0x1b,0xc5,0x6e,0x4b,0xdb,0x3b,0x19,0x32,0xcc,0xa3,0x3e,0x45,0xe4,0x83,0x56,0x58,0x41,0xf8,0x87,0x09,0x78,0xbc,0x8e,0x7a,0x62,0x35,0x9a,0xe4,0x8b,0xf5,0x0c},
+    {0x5e,0x6e,0x5c,0x48,0xb9,0x55,0x7d,0xf3,0x8e,0x1d,0xd7,0x8b,0x3d,0xb2,0xd8,0xa3,0x41,0xdc,0xd1,0xd4,0x74,0xe6,0x61,0x3f,0xf6,0x7f,0x24,0x9f,0x37,0x02,0x31,0xd6},
+    {0x5f,0xb1,0xe0,0xa3,0xd5,0x7f,0x4b,0xaa,0xec,0xba,0xfc,0x9a,0xa4,0xab,0x6c,0xe3,0x8f,0xca,0x10,0x92,0x18,0x08,0xf9,0xe0,0x67,0x3b,0xb8,0x59,0x12,0x30,0xb9,0x59},
+    {0x5f,0xba,0x0a,0xb3,0x76,0x08,0x14,0x04,0x8c,0x89,0x4d,0xad,0x12,0xf4,0xec,0xe1,0x8c,0x8d,0x2b,0xcc,0xdd,0xb9,0xf9,0xf1,0xdf,0xfa,0xbf,0xb1,0x49,0x7d,0x9b,0x30},
+    {0x61,0x24,0x66,0x0e,0x75,0x68,0xe8,0xf1,0x77,0xbd,0x2d,0x5a,0x4b,0x97,0xef,0xa5,0x40,0x24,0xf8,0xb8,0x46,0xa3,0x00,0x02,0x7b,0x43,0x5c,0xdb,0x75,0x91,0x31,0xae},
+    {0x61,0xa3,0x72,0x12,0xc6,0x3f,0x86,0xfd,0xd0,0xf9,0x63,0xb1,0xd6,0xd4,0x47,0x1f,0xad,0x17,0x05,0x59,0x05,0x43,0x4a,0xa3,0xb5,0xd0,0x4e,0x7e,0x77,0xca,0x2a,0x0d},
+    {0x61,0xe2,0x5d,0xf0,0xd3,0xfb,0x27,0x06,0x4d,0xf6,0x93,0x6c,0xea,0xaa,0xde,0x12,0xed,0xd8,0xbc,0x16,0x56,0x32,0xf1,0x79,0xf0,0xf1,0xd9,0x0c,0x24,0x26,0xe6,0x51},
+    {0x62,0x05,0x56,0xac,0xbb,0x9d,0xc7,0x4d,0xfc,0xbd,0x9b,0x9f,0x71,0x94,0xfd,0x70,0xb5,0x3e,0xaa,0x11,0xb5,0x08,0xe2,0x60,0x42,0xfe,0x2b,0x3f,0x39,0x62,0x1c,0x33},
+    {0x62,0x15,0xb8,0x47,0x89,0x57,0xed,0x02,0x46,0xf7,0x88,0xb5,0x09,0x6c,0xd7,0x28,0xc1,0xe1,0x16,0x11,0xb0,0xe5,0xef,0x6c,0x53,0x85,0xb8,0x54,0x23,0x2a,0x74,0x55},
+    {0x62,0xd5,0x7a,0xb5,0x2c,0xf0,0x10,0xdb,0x6a,0xa6,0x6b,0x00,0x51,0x48,0x3f,0x6f,0x7c,0x3b,0x2b,0x40,0x6a,0x0e,0x73,0x2a,0xf3,0x4b,0x24,0xcf,0x20,0x5f,0xc9,0xc7},
+    {0x63,0x74,0x2a,0xc9,0x93,0x46,0xf6,0x9d,0xc2,0xaa,0x12,0x98,0x33,0x20,0xfd,0xb4,0xf4,0xa4,0xa0,0x69,0x13,0x77,0x81,0xa2,0xce,0xe2,0x7b,0xf3,0x55,0x24,0x15,0x41},
+    {0x64,0x25,0x7e,0x99,0x0d,0x18,0xc5,0x67,0x82,0xd6,0xd0,0x10,0x5d,0xe3,0x08,0x15,0xb5,0x74,0x50,0xd3,0xfe,0x79,0xdf,0x84,0x11,0x79,0x83,0x50,0xfa,0x30,0xbc,0x4a},
+    {0x64,0xad,0x93,0x27,0xfc,0x64,0x96,0x3f,0x09,0xff,0xe1,0x6e,0xc3,0x70,0xa4,0xc2,0x4b,0x89,0x6f,0xde,0xfa,0x20,0x9b,0x14,0x3d,0x28,0x74,0xe1,0x8d,0xf2,0xff,0x6f},
+    {0x64,0xf2,0xe0,0x6b,0xe4,0xc4,0x5f,0xd6,0x7e,0x83,0xad,0x5a,0x35,0xa9,0x5e,0x71,0x9b,0x95,0x72,0x85,0xdc,0x14,0xf9,0x9d,0x45,0xa6,0x48,0x97,0x4f,0xdc,0xd1,0x99},
+    {0x65,0x50,0xf9,0x9b,0x88,0xb7,0xf3,0x50,0x86,0x00,0xc8,0x7c,0x76,0x39,0x5e,0x34,0xbe,0x52,0xc6,0x1e,0x8b,0x6c,0x9c,0x88,0xc0,0x5b,0x3b,0x44,0x0e,0x3b,0x5e,0x57},
+    {0x65,0xb2,0xcf,0xe6,0xef,0xab,0x6a,0x4d,0xe7,0x81,0x59,0x3f,0x77,0xe1,0x76,0xcd,0xc8,0x6e,0x99,0x64,0x41,0x84,0xab,0x9d,0x12,0xa2,0x04,0x11,0x8d,0xde,0xb6,0xbe},
+    {0x65,0xc6,0xac,0x98,0x7b,0x69,0x18,0x96,0x61,0x6c,0x30,0xe8,0x1f,0x04,0x24,0x06,0x9f,0xe0,0x64,0x7e,0x72,0x75,0xa1,0xa3,0xd7,0xe9,0xc8,0x4e,0xc5,0x7e,0xfb,0x2a},
+    {0x66,0x51,0x76,0xc3,0x6d,0x2a,0xae,0xa3,0x59,0x4f,0xc1,0xa5,0xd4,0xe1,0x71,0xc0,0xf3,0x14,0xc8,0x87,0x4f,0x6a,0xaf,0xe2,0x76,0xc3,0x58,0x37,0x7b,0x18,0x12,0xb6},
+    {0x66,0x70,0xba,0x0c,0xbd,0xf4,0x03,0x67,0x82,0x54,0xee,0x55,0x0b,0x5a,0xb7,0x15,0xfa,0xe6,0x60,0xe4,0x38,0xf4,0x58,0xdd,0xeb,0xcd,0xf6,0xc1,0x9a,0xc7,0x34,0xe4},
+    {0x67,0xcf,0x99,0xa2,0xa9,0x0d,0x2e,0x1e,0xed,0x90,0xea,0x9e,0x10,0x82,0x1e,0x4a,0x1c,0x48,0x93,0x53,0x3e,0xea,0x81,0x90,0xb7,0xa0,0x5d,0xfc,0x9f,0xc8,0x98,0xbf},
+    {0x68,0x42,0x59,0x04,0xac,0x26,0x1b,0xeb,0x1a,0x56,0xbd,0x34,0x18,0x3a,0x23,0xe4,0x18,0x45,0x97,0xbf,0xee,0xf1,0x02,0x7f,0x3f,0x33,0x3c,0x48,0x56,0x34,0x0d,0x8c},
+    {0x68,0x6e,0xa5,0x92,0x63,0x24,0xe6,0x11,0xc4,0x64,0x0b,0x6a,0x0c,0xa4,0x75,0x2c,0x2e,0xb0,0xf9,0x00,0xce,0xf6,0xb4,0xe7,0x07,0xcb,0xb8,0x1f,0x19,0x31,0xc4,0xe8},
+    {0x68,0x6f,0x8d,0x46,0x80,0xfd,0xfd,0x87,0xfe,0xbc,0x20,0x54,0x03,0x1b,0x96,0x35,0x3c,0x0d,0x22,0x34,0xea,0xa2,0x02,0x70,0xcb,0x5d,0x0a,0xd5,0xc2,0x02,0xe8,0x59},
+    {0x68,0xe3,0xce,0xf4,0xec,0x50,0xd0,0xce,0x3a,0x93,0xd9,0x3f,0x44,0xc9,0x88,0x84,0x65,0xf2,0xaf,0xb5,0x2c,0xd6,0xf0,0x11,0xec,0xdf,0xa1,0xa4,0x44,0x1e,0x3b,0x86},
+    {0x69,0x0d,0xbe,0xfb,0x5b,0x3a,0x6f,0x05,0xc0,0x30,0x58,0x78,0x7b,0x82,0xce,0x15,0xd5,0x56,0x27,0xe4,0xac,0xef,0x9a,0x2b,0x25,0x51,0xaf,0x73,0x35,0xda,0x60,0x84},
+    {0x69,0x54,0x17,0x49,0x85,0xc0,0x66,0x53,0x82,0xf4,0x30,0x3f,0x31,0x42,0x19,0x88,0x1e,0xd4,0x64,0x1e,0x53,0x6a,0x10,0x44,0xde,0xbc,0xcc,0x58,0x9e,0x66,0xbc,0xc1},
+    {0x69,0x94,0x2d,0xcb,0xbc,0x68,0x9f,0x89,0x35,0x44,0x51,0xad,0xee,0xaa,0xf6,0x13,0xc9,0xfe,0x9b,0xee,0x33,0x1a,0xb1,0x6a,0x84,0xb9,0xdb,0x21,0x43,0xf6,0x62,0xcb},
+    {0x6a,0x45,0xa6,0xb2,0x1e,0x1c,0x1f,0x88,0x74,0x39,0x6c,0x43,0xba,0x9c,0x67,0x0d,0x85,0x5a,0xdc,0x42,0xa0,0x84,0xdb,0x8f,0xed,0x2a,0x0e,0x62,0x65,0x66,0x31,0x6c},
+    {0x6a,0x75,0x53,0x0b,0xe1,0x22,0x4a,0x09,0xfd,0x85,0x42,0x76,0xeb,0x0a,0x44,0x96,0x1a,0xd5,0x30,0xa8,0xda,0x6f,0xd5,0xce,0xc6,0x21,0xe0,0x2a,0x5b,0xb3,0x6a,0x1e},
+    {0x6a,0xea,0x94,0xc4,0xb9,0xb4,0xd7,0xca,0x3a,0x22,0xed,0x9c,0xb6,0xd9,0xba,0x0c,0x51,0x6a,0xc5,0xb3,0xd4,0x53,0x36,0x01,0xd3,0x56,0xf4,0x1b,0xc1,0x79,0xb0,0xdd},
+    {0x6b,0x86,0xa0,0x31,0xd5,0x32,0x51,0xd7,0x26,0x3d,0x9a,0x5b,0x1f,0x15,0x6a,0x08,0x49,0x99,0x4a,0x18,0xe2,0x91,0xf8,0xcb,0x24,0x25,0x5b,0x4b,0xbc,0xae,0x23,0xb0},
+    {0x6b,0x8b,0x27,0x40,0xab,0x3f,0xe2,0x9e,0x12,0x7a,0x3f,0xb3,0x47,0x51,0xdc,0xc9,0x77,0x44,0x86,0xf5,0x7e,0x4f,0x86,0x60,0x23,0x35,0x02,0x19,0x43,0x90,0x79,0xab},
+    {0x6b,0xaa,0x05,0xa4,0x25,0xb1,0x15,0xf5,0x34,0xfe,0x52,0xc1,0xea,0xa6,0x56,0x0d,0xf9,0xd1,0xc0,0xd5,0x99,0x0d,0x0b,0x5f,0x2b,0xce,0x52,0x26,0x52,0x5f,0x02,0x0b},
+    {0x6c,0x76,0x5b,0x96,0xad,0x80,0x59,0x58,0x24,0xc7,0xfd,0xd6,0x80,0xc2,0x5f,0xe2,0xe2,0xc5,0x42,0x67,0x45,0x3f,0x7c,0xbe,0xa7,0xcc,0xf9,0x5a,0xfe,0xea,0x74,0x9d},
+    {0x6c,0x8c,0xc7,0x35,0xad,0x51,0x20,0x2b,0x27,0x3b,0xd5,0x71,0x62,0x8c,0x0b,0xa4,0x5c,0x30,0x27,0x4d,0xe8,0xa3,0x7e,0x42,0x34,0x79,0x8e,0x3b,0x29,0x04,0xb6,0xdb},
+    {0x6d,0x51,0x18,0x16,0x87,0x3d,0xd1,0xbb,0x9f,0xf2,0x9b,0xc2,0x8d,0x97,0xb5,0xcf,0x98,0x26,0xd4,0x29,0xf0,0x35,0xde,0x91,0x18,0xa2,0xee,0x70,0x79,0x1c,0xcc,0xc6},
+    {0x6e,0x40,0x16,0xea,0x6a,0x22,0x98,0x45,0x98,0x19,0x9a,0x21,0xe3,0x56,0xe5,0xe6,0xd7,0x0d,0x64,0x5d,0xc2,0xe8,0xa1,0x19,0x61,0x23,0x84,0xc1,0x91,0xd7,0x71,0x45},
+    {0x6e,0x5b,0x0a,0x21,0xe8,0x18,0x69,0x9d,0xf3,0x5e,0x5d,0xfa,0x18,0xc3,0xaa,0xe5,0x75,0xfe,0xe9,0x9c,0x65,0xd6,0xf8,0x03,0x99,0x89,0xf6,0x43,0x85,0x2f,0xd5,0xb2},
+    {0x6e,0x99,0xf9,0xf0,0x04,0x89,0x78,0x90,0xa6,0xce,0x8b,0x43,0xd4,0xe2,0xce,0x14,0xb2,0x18,0x71,0xc7,0xba,0x86,0xc2,0xd3,0xa8,0xaf,0x42,0xc1,0x9d,0x8c,0xa5,0x19},
+    {0x6e,0xab,0x9a,0x79,0x0e,0xb6,0x65,0x50,0xb1,0x04,0xfb,0xb4,0x08,0xe7,0xe3,0x4b,0x4e,0x8d,0xfb,0xe6,0xfa,0x8c,0xbb,0x66,0x69,0x66,0xee,0x19,0x1b,0x9f,0x2f,0x75},
+    {0x6e,0xfd,0xc0,0x7a,0x86,0x85,0x3b,0x30,0xd1,0x65,0xcb,0xab,0xff,0x41,0xea,0xdc,0x72,0xa1,0x6b,0x36,0x14,0xd4,0x87,0x9a,0x36,0x37,0x06,0x23,0x12,0xdb,0xae,0x0c},
+    {0x6f,0x5a,0xa3,0x9a,0x6b,0x61,0x14,0x45,0x4b,0x9a,0xb4,0xef,0x37,0x5a,0xc1,0x06,0x9b,0xb6,0x5f,0x16,0x6b,0x18,0xbd,0xdf,0x98,0x16,0xa7,0x4d,0x83,0x07,0x61,0x20},
+    {0x6f,0x6f,0x3d,0xc9,0x96,0x76,0xf9,0xc9,0x4d,0x8f,0x85,0x11,0x37,0x57,0x66,0xec,0x2a,0x27,0x5e,0x5b,0xef,0xf2,0x2b,0xe0,0xcb,0xa7,0xe1,0x48,0xfa,0x6b,0x47,0xdb},
+    {0x6f,0xba,0x39,0xec,0x69,0x5f,0x9d,0xe5,0x39,0x2d,0x5c,0x30,0x9d,0xb1,0x1e,0x02,0xd5,0x9c,0x0d,0xcf,0xfa,0x65,0xee,0x3d,0x61,0xc9,0xc6,0x3e,0x2b,0x97,0xaf,0xa1},
+    {0x6f,0xea,0xb8,0x30,0xc8,0x48,0x08,0x8c,0xe9,0xc4,0x9b,0x01,0xaf,0x42,0x3e,0x22,0x4d,0xc4,0xb3,0x4c,0x09,0x18,0x5a,0x3d,0xbd,0x4d,0x5b,0xf0,0x33,0xbd,0x1f,0x06},
+    {0x70,0x6a,0x4f,0xef,0xfd,0x6c,0x4f,0xb5,0xcf,0x17,0xc7,0xd0,0x21,0x0f,0x1a,0x82,0x06,0x08,0x7b,0x32,0x84,0x22,0xb6,0xdc,0x0c,0xae,0xd8,0x2b,0xa0,0x5d,0x63,0xfc},
+    {0x71,0x23,0xb6,0x1a,0xdf,0xe0,0x67,0x06,0xcf,0xcc,0x4e,0xf3,0xb3,0x76,0x9e,0x42,0x03,0x97,0x5b,0xde,0x56,0x13,0x5c,0xea,0x89,0x1b,0x93,0x70,0x15,0x32,0xcc,0x90},
+    {0x71,0x47,0x52,0x4f,0x06,0xfa,0x53,0x5c,0x40,0x2b,0x71,0xdc,0x4d,0xa2,0x5e,0x22,0x27,0x25,0x68,0xcf,0xa9,0xd2,0x8e,0x4b,0x4d,0x79,0xbc,0x35,0x4c,0x9e,0x90,0x5b},
+    {0x71,0x8f,0xd6,0x30,0xe2,0x82,0xf6,0x77,0xd6,0x5a,0x4b,0x7c,0x4c,0xab,0xe2,0xf9,0x76,0x58,0xd1,0x4b,0x6e,0xa1,0xab,0x8a,0xa7,0x1d,0xd1,0x5c,0xb9,0x1d,0xbf,0xcd},
+    {0x71,0xa9,0x5e,0x64,0x17,0xf5,0xc2,0x89,0xc7,0xbf,0x61,0x9f,0xa8,0x26,0x22,0x29,0x0f,0xca,0x8f,0xc6,0x40,0x2d,0x5d,0x3c,0x62,0x03,0xed,0x8a,0xdf,0x8e,0x52,0x46},
+    {0x71,0xc5,0x48,0xdb,0x85,0xe2,0x04,0x95,0x09,0xb7,0x38,0x00,0x13,0x08,0x51,0xae,0x2f,0x8d,0xc9,0x9e,0x03,0x51,0xa4,0x5a,0x1a,0x32,0xa6,0xda,0xbc,0x8c,0x42,0x22},
+    {0x72,0xaa,0xd3,0x3d,0xe0,0xcb,0xfd,0xa1,0x2b,0xfc,0x77,0xf1,0xf2,0x07,0xae,0x0e,0x1f,0x87,0xc4,0x93,0xdf,0xa3,0xa3,0x7b,0x0f,0xea,0xf1,0x3a,0x04,0x08,0x5d,0x22},
+    {0x73,0x5a,0x32,0x51,0x00,0x08,0xeb,0xa7,0x46,0x39,0xea,0x4d,0x36,0x21,0x5b,0x4c,0xc7,0xa8,0x6b,0x26,0x9f,0xab,0xf3,0x07,0x96,0xa5,0xbf,0xb8,0xae,0xb7,0x9c,0xca},
+    {0x73,0x84,0x47,0x3f,0x3c,0x99,0x1c,0x74,0x39,0x93,0x93,0x6b,0x30,0x87,0xb7,0x3e,0x6c,0xc1,0x2e,0x9b,0xdb,0x43,0x2d,0x4e,0x0a,0xc9,0x73,0x78,0x62,0x7f,0x30,0xe7},
+    {0x74,0x5b,0x53,0x67,0xea,0x42,0xf1,0x9d,0x00,0x82,0xb0,0x35,0x21,0xf0,0x64,0xe7,0xff,0x75,0x02,0xf2,0x63,0x44,0xf2,0xf5,0x2c,0xe2,0xd8,0x72,0x10,0xed,0xf9,0x55},
+    {0x74,0x67,0xa9,0x03,0xa1,0x1a,0x00,0xa4,0x68,0xac,0xeb,0xa6,0x23,0x78,0xff,0xe8,0x4a,0x23,0x12,0xc0,0x3b,0x3b,0x2f,0x4b,0x46,0xb0,0x87,0xda,0x21,0xfd,0xd2,0xe2},
+    {0x74,0x6e,0x64,0xc6,0xce,0xb1,0x8e,0x0f,0xb7,0x4e,0xc1,0x2d,0x21,0x1f,0xe3,0x87,0x8f,0xb3,0x70,0x88,0x3f,0x2f,0x92,0x18,0xdf,0xa8,0xe0,0x37,0xa7,0x27,0xed,0xce},
+    {0x74,0x87,0x01,0x4a,0x59,0xe7,0xa4,0x2d,0x05,0xa2,0xaa,0x06,0x51,0x8d,0x81,0xb6,0xb2,0x2c,0x61,0xbb,0x6f,0xf9,0x5c,0xd4,0xd3,0x26,0xbc,0x08,0x48,0x91,0xf4,0xec},
+    {0x74,0xa8,0xf3,0x60,0x22,0x77,0x9f,0x22,0xd7,0x5b,0xea,0x1d,0xfe,0x37,0xba,0x24,0xd6,0xf6,0xd3,0x4b,0x10,0x25,0xf9,0x84,0x9d,0x11,0xd5,0xf4,0x19,0x89,0x2d,0x29},
+    {0x74,0xb2,0xcb,0xff,0xa1,0x6b,0x73,0x55,0xfb,0x57,0x18,0x95,0x97,0xc7,0xde,0x6d,0x96,0x2f,0x05,0x9f,0xe0,0x4a,0x6e,0x16,0xab,0xa7,0x45,0x6e,0x35,0x85,0x47,0x19},
+    {0x75,0x9e,0x5a,0x49,0xec,0x0f,0xc6,0x26,0x4e,0xf0,0x0d,0xb9,0x5f,0xa0,0x4d,0xea,0xee,0xe2,0x41,0xd1,0x2a,0x51,0xf6,0xd3,0x4f,0x2c,0x7c,0x05,0x07,0xae,0x18,0x6e},
+    {0x75,0xb7,0xbf,0xd2,0xa0,0xf4,0x49,0xc1,0xd0,0x13,0x5d,0x7c,0x46,0x85,0x56,0xdd,0x72,0x08,0x35,0xb7,0xb5,0x68,0x3e,0xbb,0x99,0x0b,0x3c,0xbd,0x93,0xaf,0x4d,0x04},
+    {0x76,0x07,0xe1,0x10,0xc4,0x36,0xa1,0xcc,0x98,0x86,0xe2,0x84,0x13,0xcb,0xcb,0x23,0x02,0x56,0x35,0xb1,0x5c,0x86,0x14,0x30,0xf4,0xb2,0x10,0xdc,0x59,0x94,0xf0,0x85},
+    {0x76,0x61,0xf1,0x42,0xce,0x25,0xe1,0x13,0x39,0xe9,0x7d,0x45,0x0d,0x3e,0xd8,0x33,0x7b,0xed,0x0a,0x29,0x60,0xcc,0x43,0x96,0x79,0xe2,0x8e,0x0f,0x5c,0x22,0xbf,0x41},
+    {0x76,0x71,0xf4,0x61,0x7f,0x91,0x83,0x66,0xbe,0x6e,0x54,0xe5,0x10,0x9b,0x91,0xf7,0xe0,0x65,0x59,0x38,0xdd,0xfb,0x15,0x72,0x59,0x6f,0x67,0x22,0xf0,0xb6,0x59,0xac},
+    {0x77,0x19,0x17,0xd8,0x87,0xbb,0x73,0xa0,0x54,0x82,0xb1,0x48,0x3d,0xb1,0x2d,0x24,0x01,0x98,0xd4,0x1d,0xa6,0x85,0x42,0x21,0x0c,0x70,0xce,0x21,0x9a,0x6a,0xfa,0x6b},
+    {0x78,0x1c,0x47,0xc3,0x86,0xf5,0x0c,0xbc,0x20,0xbb,0x94,0x11,0xb7,0xc5,0x3b,0xf8,0x0b,0xf2,0x10,0x53,0xa1,0x39,0xa3,0x0a,0xe6,0x90,0x72,0x1e,0xcc,0xf8,0x46,0x2d},
+    {0x7a,0x41,0x0f,0xb0,0x85,0x55,0x4e,0x32,0x1d,0xcd,0xf3,0x66,0xc5,0xb5,0x97,0x40,0xf2,0x50,0xc5,0x3e,0x86,0xc2,0x45,0x1d,0x53,0xcf,0x68,0x5f,0x52,0xe9,0x49,0x5b},
+    {0x7a,0x71,0x19,0x27,0x44,0x51,0x89,0xbe,0x24,0x7c,0xc8,0x91,0x84,0x85,0xc6,0x23,0xbb,0xb8,0xa5,0x71,0x24,0xe7,0xf8,0x75,0x7f,0x90,0xf4,0x5d,0xfe,0x7e,0x9c,0xd6},
+    {0x7a,0xb3,0xa5,0x8a,0x17,0x93,0xad,0x41,0x93,0x0c,0x19,0x44,0x82,0x2f,0xf5,0xf8,0x7f,0xdf,0x63,0x0a,0x42,0x99,0x63,0x40,0x4c,0x2a,0x93,0x5d,0xf0,0x5f,0x3b,0x75},
+    {0x7b,0x3a,0x67,0xe8,0x56,0x47,0x3f,0x80,0x19,0xb7,0x16,0x32,0x44,0xfd,0xf3,0x8e,0xf1,0x0a,0xed,0x5b,0xaf,0x86,0x8a,0x52,0x5b,0x58,0x2a,0x2f,0x9e,0x8a,0x09,0xea},
+    {0x7c,0x43,0x62,0xef,0xc6,0x89,0xcc,0xa3,0xa0,0xe0,0xd4,0xf8,0x01,0xaa,0x57,0xbf,0x8f,0xf5,0x67,0xfc,0xc6,0xdd,0x08,0x22,0x8b,0x82,0x87,0x2f,0x2b,0xaf,0x24,0xe3},
+    {0x7c,0x4f,0xee,0x92,0x37,0xa9,0xdf,0x01,0x5f,0xec,0x8a,0xb5,0x87,0x1e,0xb6,0x77,0xd4,0x70,0x77,0xa9,0xb6,0x45,0xc7,0x39,0xc5,0x5a,0x85,0xa4,0x7f,0x6d,0x95,0x1f},
+    {0x7c,0xe9,0x84,0x7c,0xe4,0x1b,0x17,0xcc,0x85,0xb5,0x2d,0xe8,0x1b,0xc4,0x71,0x1b,0xe2,0x4a,0xb2,0xdf,0xc8,0x40,0xad,0xc2,0xb7,0xb7,0xd5,0xf4,0x65,0x8a,0x78,0xac},
+    {0x7f,0x1e,0x4c,0x36,0x05,0xcd,0x33,0xc2,0x77,0x24,0x50,0x09,0x85,0xbf,0x37,0x7b,0x16,0xbf,0xf4,0x31,0x44,0x3b,0x72,0x56,0x93,0xce,0xde,0x25,0xdb,0x80,0x00,0xe1},
+    {0x80,0x50,0x3d,0xdb,0x1f,0xb0,0xa2,0xb8,0x00,0x5d,0xc5,0x15,0x37,0x4b,0xeb,0xac,0x86,0x88,0xb2,0xef,0x80,0xc5,0xf0,0x64,0xf9,0x68,0xa9,0xe4,0xd3,0x22,0x36,0x59},
+    {0x81,0x2c,0x7e,0x03,0x6b,0xd9,0x6d,0xaa,0xaa,0xda,0x34,0x87,0xe9,0xec,0xfe,0xd2,0x14,0xf3,0x74,0x95,0xa6,0x74,0xe0,0xf8,0x3e,0x34,0x2a,0xbc,0x40,0xb0,0x25,0x2c},
+    {0x81,0x65,0x8a,0xb1,0x82,0xee,0x7f,0x49,0x1c,0x85,0x28,0x32,0xe2,0xc1,0x99,0xa8,0x58,0xb0,0x14,0xd7,0xed,0xa2,0xbf,0xf6,0x66,0x20,0x3a,0x77,0xde,0x79,0x75,0x24},
+    {0x81,0x7e,0xbd,0x47,0xef,0x99,0x1a,0xba,0x19,0x4d,0x53,0x27,0xbf,0x05,0x1b,0xb6,0x69,0xd3,0xb3,0x80,0xbc,0x98,0x20,0xc0,0xdd,0xa2,0x48,0x64,0x52,0x1d,0x55,0x8c},
+    {0x82,0xf3,0xce,0xa5,0x21,0xda,0xb1,0x27,0xc0,0x74,0x74,0xfa,0x88,0x42,0x68,0x0e,0x26,0xa1,0xe1,0x02,0x4b,0x21,0x57,0x8e,0xfa,0x6c,0x2e,0x0e,0xf4,0x65,0x90,0x8b},
+    {0x83,0x2e,0xf0,0xac,0xbf,0xc4,0xb4,0x05,0x4d,0x36,0xeb,0xc3,0x95,0xd5,0x34,0x8c,0xa3,0xa4,0x96,0x51,0x3a,0xfc,0x9c,0xf7,0x34,0xc4,0xd2,0xf8,0xc4,0x39,0x3e,0x96},
+    {0x83,0x44,0x6a,0x39,0x74,0x80,0x02,0xd4,0x15,0xe6,0xee,0x42,0xec,0xb1,0x09,0xc9,0xef,0xa1,0x97,0xfc,0x54,0xf9,0x19,0x27,0x33,0xea,0x83,0x34,0x6d,0x28,0x66,0x5c},
+    {0x83,0xd6,0x7e,0xdc,0xa1,0xfe,0xa5,0xc2,0xf8,0xa6,0x78,0x86,0xa7,0x21,0xe5,0xdc,0x2d,0x2c,0x78,0xdf,0x84,0xae,0x52,0x6e,0xa2,0x6f,0x6a,0x96,0xe6,0x5e,0xa6,0x8d},
+    {0x84,0x3d,0x15,0xbc,0xc9,0x71,0x1a,0xc1,0x43,0x16,0xe2,0xc2,0x32,0x58,0xa1,0x46,0x47,0x59,0x79,0xd5,0xeb,0xb1,0x94,0x3e,0x99,0x4f,0xb9,0x4a,0x42,0xd9,0x97,0x63},
+    {0x84,0xa3,0xf8,0xea,0x5a,0xb7,0xdb,0x8b,0x72,0x51,0x97,0xba,0x22,0x32,0xe9,0x2e,0xc1,0xc6,0xdd,0x21,0xd1,0x36,0xce,0x60,0xc5,0xf1,0x66,0x00,0x0b,0xbe,0xa0,0x87},
+    {0x85,0x5c,0xe2,0x3f,0x32,0x26,0x2e,0x6e,0x47,0xbd,0x68,0xf6,0xf3,0xb0,0x0c,0xfc,0xee,0x7b,0x64,0x10,0xc1,0x0b,0x22,0x87,0x6e,0xb6,0x2f,0x4b,0xcf,0xfb,0xac,0x6b},
+    {0x85,0x7c,0xf8,0xe3,0xa3,0x2b,0x5f,0x4f,0x01,0xef,0x18,0xba,0x57,0x6a,0xa9,0xd7,0xfc,0x34,0x82,0xa6,0x0a,0xf3,0x99,0x00,0xd6,0x0e,0x8b,0xdb,0xa7,0xf1,0xbb,0xe9},
+    {0x86,0x50,0xc1,0x07,0x84,0x46,0xec,0x77,0x2b,0xcd,0x59,0xb7,0x7d,0x4b,0x1f,0x2d,0x1a,0x00,0x69,0xca,0x54,0xc6,0x49,0x4d,0xf6,0x5c,0xec,0x1f,0x20,0x1c,0x2b,0x84},
+    {0x86,0x8a,0xa4,0x25,0x12,0xda,0xff,0xa7,0xbe,0x20,0x8e,0x71,0xb0,0xe2,0xa9,0xf4,0x4f,0x60,0x38,0xc1,0x80,0x9a,0x94,0x7d,0x1a,0x73,0xfd,0xb9,0x03,0x57,0x10,0xcb},
+    {0x86,0xfa,0x78,0x5c,0x1e,0xd5,0x02,0x7a,0xae,0x62,0x87,0x7d,0xed,0xed,0xb2,0x1c,0xec,0x1f,0x8b,0x9e,0x9f,0x77,0x94,0xe5,0x59,0x3c,0xd6,0x21,0xaf,0xa8,0x4a,0xa2},
+    {0x87,0x64,0xfb,0xb3,0xc6,0x6f,0xfb,0x27,0xa2,0xdd,0xf3,0x27,0x60,0x20,0xb6,0x5b,0x6f,0x0b,0xf9,0x1d,0x1d,0x2b,0x9a,0xa2,0xa5,0x81,0x45,0xb4,0x95,0xb7,0x22,0xd3},
+    {0x87,0xb2,0x72,0x09,0x54,0xb5,0x1a,0x09,0xe9,0xf6,0xc0,0xe8,0xcf,0x36,0x01,0x31,0xa5,0xcb,0x5b,0x7d,0x57,0xa2,0x9a,0x69,0x16,0xa8,0x5b,0x33,0xb8,0x69,0x0c,0xe7},
+    {0x87,0xc8,0xdd,0x0b,0xf0,0xf8,0xc1,0xee,0x55,0x40,0xb5,0x50,0x48,0x0c,0x9e,0xd0,0xc7,0x8b,0x1a,0x1a,0x68,0x35,0xac,0xc9,0xc6,0x7f,0x1c,0x0a,0xb5,0x23,0x4a,0x17},
+    {0x88,0x02,0x24,0x26,0x38,0x36,0x68,0x3b,0x0a,0xc4,0xee,0x30,0x21,0x4c,0x38,0x30,0xff,0x92,0xf6,0x98,0xa3,0x23,0xd6,0x4c,0xb1,0x98,0x11,0x8b,0xf4,0xdc,0x74,0x79},
+    {0x88,0x8f,0x18,0x4f,0xf3,0xe4,0x14,0xe7,0xab,0xd6,0x49,0xbc,0x3e,0xac,0xb0,0x35,0x17,0x84,0x32,0xa6,0x33,0x87,0x33,0xb6,0xac,0xca,0xf1,0x4a,0xce,0x35,0xed,0x6c},
+    {0x88,0xa4,0x72,0xa1,0x2d,0xdb,0x17,0x64,0xa0,0x96,0xc1,0xe1,0xcb,0xf5,0x89,0x44,0x91,0x7f,0xf7,0x1d,0x83,0xe4,0x92,0x54,0xef,0x92,0x75,0x44,0xb4,0x4f,0x12,0x4a},
+    {0x88,0xa9,0xae,0x97,0xe7,0xb6,0xc5,0x3b,0x5b,0x7a,0x4f,0x40,0x0f,0x9a,0xd6,0xd3,0x39,0x1a,0xf0,0xe8,0xae,0xe2,0xca,0x60,0xda,0xd6,0xec,0x6c,0x92,0x73,0x5f,0xc0},
+    {0x89,0x04,0x96,0x88,0x64,0x35,0x3b,0xbd,0xc4,0x7b,0x2e,0xde,0xe8,0x0c,0x46,0x7d,0xf7,0x99,0x29,0x6b,0xc4,0x8d,0xc0,0x30,0x0e,0x1c,0xf0,0x7e,0x93,0x5c,0xe6,0xcb},
+    {0x89,0x7d,0x28,0xc7,0xa3,0xd5,0x80,0x1e,0x87,0xe0,0x51,0xd3,0xd4,0x38,0x8e,0x7e,0x00,0x90,0x1e,0x63,0xb4,0xa9,0xb1,0x8b,0x52,0x18,0xb5,0xb3,0x84,0xe6,0x72,0xc1},
+    {0x89,0x92,0x0f,0x3c,0x8d,0xc5,0x2f,0xc2,0x83,0x62,0x8c,0x24,0xcb,0x9d,0xa3,0xc4,0x77,0xd2,0xee,0x38,0x36,0x54,0x80,0x4b,0xe5,0xd2,0x08,0xfb,0x17,0x84,0x75,0xdb},
+    {0x89,0xd9,0xc8,0x24,0xd8,0x0b,0x9b,0x05,0x97,0x55,0xcb,0xc0,0x0f,0x14,0x62,0xcb,0xd1,0x36,0x45,0x0c,0xfd,0x16,0x22,0x5a,0xba,0xcd,0x8c,0x93,0x36,0x29,0xbc,0x66},
+    {0x89,0xec,0xfe,0x10,0xa4,0xfd,0xa4,0x47,0x0c,0x0b,0xc8,0x14,0x4f,0x20,0x93,0x26,0x4e,0x63,0x5f,0x7e,0x5d,0x52,0x29,0xe8,0xe6,0x97,0xae,0x97,0x4e,0x77,0xe2,0x93},
+    {0x8a,0x26,0x47,0x0e,0xf7,0x91,0x25,0xb8,0xeb,0x0b,0xf9,0x0d,0xb7,0x28,0x02,0xed,0xba,0xe0,0xd5,0x37,0xf1,0x1a,0x2b,0xd7,0x23,0x9f,0x1e,0x64,0x9b,0x16,0x56,0x53},
+    {0x8a,0x87,0xe9,0x86,0xc4,0xc4,0xb5,0x31,0xca,0x0e,0x26,0x45,0xf5,0xb1,0x8e,0x0d,0x83,0x3c,0x0e,0xdd,0x0a,0x8e,0xa0,0x57,0x16,0xcf,0x7f,0xfd,0x41,0x1f,0x31,0xd6},
+    {0x8b,0x70,0x8c,0x93,0x4e,0x39,0x99,0xf0,0xa6,0xdf,0xe0,0x64,0x21,0x09,0xef,0x0d,0xda,0x66,0x3e,0x3d,0x04,0x91,0x66,0xae,0x9c,0xaf,0xa6,0xb7,0x8e,0x41,0x23,0xa2},
+    {0x8b,0xb6,0xc6,0x1a,0xd2,0xd8,0x6f,0x55,0xcc,0x7c,0x41,0x1b,0xaa,0x2a,0x35,0xfc,0xc7,0x0c,0x73,0x10,0x9b,0x32,0xa3,0x42,0x18,0xa2,0x59,0x2c,0xfc,0x01,0x01,0xf7},
+    {0x8c,0x6b,0xfc,0xd6,0x28,0xb4,0xa4,0xf3,0xc0,0x01,0x9b,0x64,0x3b,0xe3,0x9e,0xf2,0x33,0x0c,0x2e,0x99,0x23,0xfa,0xba,0x20,0xc0,0x65,0x15,0x5a,0xa5,0x00,0x89,0x67},
+    {0x8c,0x6d,0x2c,0xe1,0x7e,0x17,0xd8,0x59,0xd0,0x04,0x47,0xff,0x62,0xfa,0x8d,0x47,0x63,0x39,0x76,0x3a,0xa0,0x06,0x80,0x5b,0xa6,0x87,0xa0,0x15,0x22,0x76,0xf5,0x00},
+    {0x8c,0x90,0x12,0x55,0x59,0xf0,0x85,0x95,0xc3,0xa5,0x2f,0x5e,0x03,0x6d,0x7f,0xb7,0x5d,0xa8,0x46,0x8f,0xd9,0x44,0x9c,0xb5,0x3b,0x94,0x41,0xed,0x4f,0xf8,0xe3,0x19},
+    {0x8c,0xcc,0x89,0x69,0x6e,0x2f,0x82,0x84,0x5a,0xc7,0x54,0x08,0xba,0xb4,0x43,0x3c,0x5e,0xf3,0x62,0x5b,0xab,0x7d,0xcf,0x7d,0x71,0x88,0x11,0x8f,0x7e,0x09,0x22,0x14},
+    {0x8c,0xcf,0x92,0x0d,0x3b,0x36,0x31,0xc2,0x1e,0x4c,0xa3,0x68,0xe8,0x44,0x27,0x19,0x0f,0xb4,0x06,0xff,0x42,0x33,0x16,0xeb,0xc2,0xaa,0xd5,0x65,0x32,0x42,0x11,0x95},
+    {0x8c,0xd2,0x55,0x58,0xb9,0x4e,0xbe,0xeb,0xcc,0x77,0xcc,0x9b,0x53,0x2b,0x2e,0x1b,0xb2,0x56,0xce,0xa3,0xa7,0x8e,0xd3,0x23,0xff,0x59,0x8e,0x50,0x9d,0xa2,0x6b,0xb6},
+    {0x8c,0xef,0xe6,0x81,0xd9,0xa7,0xa5,0x7d,0xc9,0x98,0xd3,0xfe,0xc9,0xbc,0x49,0x59,0xda,0xef,0x48,0x1b,0x88,0x91,0xf7,0x05,0x07,0xac,0xb5,0x41,0xb7,0x42,0x1d,0xb3},
+    {0x8d,0x54,0xc8,0x12,0xa6,0x9a,0x8c,0x7c,0x60,0x99,0xa8,0x6c,0x2e,0x6d,0x8c,0xb8,0xe6,0x28,0x9e,0xcc,0x7d,0xf4,0x13,0x34,0x5b,0x1f,0xd8,0x26,0x70,0xda,0x15,0xff},
+    {0x8d,0xeb,0xed,0xd6,0xf2,0x7f,0xd2,0x25,0xbf,0xc2,0x55,0xf9,0x83,0x9b,0x46,0x8a,0xdd,0x9b,0x13,0xb8,0xa6,0x45,0x16,0x1f,0xba,0x07,0x52,0x73,0xe5,0xc6,0xd7,0x7a},
+    {0x8e,0x25,0xa7,0x1d,0x4e,0xa8,0x0f,0xfb,0x20,0x26,0x0b,0xc5,0x84,0xfd,0x85,0xb5,0x2b,0xda,0x31,0x79,0x0a,0xa4,0x1f,0x76,0x0e,0xca,0x4e,0x32,0x75,0x6e,0x2a,0x9c},
+    {0x8e,0x97,0x83,0x63,0xbd,0x6a,0x06,0x84,0xdf,0xe1,0x82,0x1e,0x06,0x0e,0xa8,0x78,0xd5,0xd8,0xf2,0x1b,0xce,0x5f,0x8c,0x3f,0xf2,0xb5,0x1e,0x7e,0x12,0xb9,0xb3,0x52},
+    {0x8e,0xa8,0x91,0x71,0x01,0xde,0x42,0x89,0xdc,0x61,0x2e,0x77,0x8f,0xa3,0x5e,0xf1,0xc4,0x1c,0x7c,0x34,0x9d,0x36,0xf3,0x90,0xdf,0x91,0x9d,0xd7,0x82,0x70,0x7d,0xc4},
+    {0x8e,0xb5,0xbc,0xfd,0x50,0xd4,0x02,0xd1,0x6d,0x2b,0x8f,0x7a,0x2a,0xde,0xa5,0xeb,0xf7,0x86,0xfc,0xbf,0x1f,0xed,0x3b,0x6e,0xf3,0x53,0x83,0x1c,0x88,0x20,0x42,0xa4},
+    {0x8e,0xcb,0x66,0xfb,0x5e,0x16,0xc6,0xdd,0x13,0xb4,0x66,0xd2,0x82,0x95,0x94,0xe0,0x0a,0x1e,0x90,0x6d,0xe6,0x85,0xe3,0x15,0xe8,0x51,0x8f,0x6a,0xfa,0xd9,0xc1,0x0a},
+    {0x8f,0x33,0x79,0x97,0xfa,0x88,0x9d,0xbe,0x16,0x23,0x00,0x3c,0x6a,0xbb,0x0c,0xd2,0xcb,0x97,0x26,0x6f,0x9a,0x90,0x88,0x92,0x94,0xe9,0xfb,0x4b,0xe4,0xb2,0xfb,0xd4},
+    {0x8f,0x39,0xaf,0x32,0x66,0x8d,0xdc,0x7b,0xb2,0x72,0x82,0xbb,0x09,0xb7,0x26,0xe0,0x43,0x64,0x0b,0x70,0x52,0xba,0x97,0x2c,0x68,0xa5,0x0b,0x87,0xb1,0x39,0xb7,0xf3},
+    {0x8f,0x66,0x79,0xd3,0x8a,0xdb,0x0a,0x28,0xbd,0x22,0x04,0xf0,0x7b,0xd9,0x1f,0x45,0xe7,0x59,0x64,0x5e,0x1c,0xf4,0x55,0xe4,0x5c,0xff,0x84,0x38,0x0e,0x71,0x5f,0x80},
+    {0x8f,0x80,0x3c,0x04,0x45,0x96,0xa6,0x95,0x2d,0x39,0x15,0xe3,0xd9,0xae,0xf1,0x01,0xa8,0x3c,0x0f,0xdd,0x77,0x90,0x56,0xc5,0x7a,0x45,0x8e,0x21,0x97,0x04,0x97,0xae},
+    {0x8f,0xe0,0xc4,0x8f,0xdf,0x05,0x8a,0x65,0x02,0xc8,0x67,0x1f,0x40,0x60,0x57,0x56,0xcb,0x12,0xad,0x28,0x0a,0xfd,0x3c,0x88,0x5a,0xeb,0xda,0x54,0x53,0x4b,0x67,0x1a},
+    {0x90,0x75,0x75,0x6d,0x1b,0xe9,0x04,0xdb,0x89,0x78,0x62,0x1c,0xf6,0x68,0xf7,0x74,0x16,0xb5,0x18,0x7c,0x6b,0xb7,0xfc,0x21,0x7a,0x21,0x99,0xe2,0x12,0x04,0x31,0xa7},
+    {0x90,0xcd,0x54,0x88,0x02,0x19,0x9a,0x77,0x9c,0x3a,0xad,0x5e,0x37,0xa5,0x6a,0x9d,0x73,0x20,0x8f,0xe0,0x91,0x70,0xfb,0x34,0x81,0x35,0x63,0xcb,0x39,0xa8,0xc4,0x07},
+    {0x91,0xfd,0x22,0xda,0x5e,0x95,0x72,0xea,0xc5,0x59,0x08,0xff,0x38,0xd7,0x40,0xb1,0xf6,0xab,0x11,0x12,0x14,0x66,0xa4,0x37,0x6a,0x46,0xfd,0x55,0xa1,0xca,0x5f,0xad},
+    {0x92,0x36,0x97,0x3e,0x23,0xb5,0x39,0x9b,0x61,0xaf,0x91,0xa9,0x25,0xa9,0x91,0x5c,0xa1,0x80,0x43,0x57,0x84,0x67,0x96,0x38,0x12,0x90,0xe3,0x94,0xe5,0xc4,0x62,0xa6},
+    {0x92,0x4e,0x30,0x6a,0x1c,0x5b,0x8d,0x98,0x49,0xb9,0x37,0x6d,0x68,0xc8,0x4e,0x03,0x9b,0x00,0xb9,0xb3,0x80,0x6a,0x50,0xd0,0x80,0xc8,0x38,0x72,0x26,0x8d,0x84,0xd4},
+    {0x93,0x15,0x8f,0xc8,0xfb,0x83,0x57,0x84,0x51,0xfd,0xbb,0x89,0x30,0xc8,0xd3,0xc9,0xc9,0x99,0x63,0xfd,0xf2,0x67,0xa0,0x54,0x02,0xc0,0x54,0x16,0xed,0x3c,0x34,0x7e},
+    {0x93,0x43,0x30,0x10,0x16,0x5d,0xf0,0x6b,0xa6,0x69,0x1f,0xb1,0xac,0xf5,0xa3,0xb3,0xae,0x68,0x17,0x9e,0xe6,0x36,0x72,0x3c,0x2c,0xf3,0xd2,0xd0,0xa5,0xcc,0x2b,0xdb},
+    {0x93,0x55,0xbb,0x6e,0x92,0x4e,0xae,0x56,0xa6,0x53,0xfa,0xf9,0x50,0x8d,0x8f,0x7f,0xa1,0x54,0x92,0xcb,0xe8,0xf0,0xcf,0x5e,0xfc,0xd9,0x2f,0xaf,0x55,0x12,0xb1,0xd1},
+    {0x93,0x59,0x3c,0x2c,0xe7,0x27,0x8c,0xa5,0x50,0xc7,0x9c,0xe5,0x76,0xa3,0x67,0x59,0x84,0x05,0x0a,0xb4,0x54,0x7b,0x70,0xaf,0x2a,0x3f,0xa7,0xc4,0x1e,0x8a,0xf0,0xb7},
+    {0x93,0x92,0xd1,0xd3,0x0f,0x6f,0x4c,0x0e,0x24,0xdb,0x54,0xbf,0x4c,0x12,0xe3,0xd7,0x78,0x61,0xbe,0x84,0x54,0xea,0x90,0x13,0x6a,0xdf,0xd0,0x11,0x1d,0x29,0xa1,0x39},
+    {0x93,0xb5,0x48,0xf9,0x2f,0xb9,0xa6,0x03,0x37,0xe6,0xbc,0xf0,0xbd,0x7f,0x8c,0x8b,0xae,0xdd,0x12,0x34,0x83,0x5e,0xc4,0xaa,0xdd,0xe9,0x68,0x39,0xc5,0x34,0x1e,0x28},
+    {0x93,0xbc,0x5f,0x9b,0x0a,0xe9,0x13,0xc7,0x41,0x27,0xcc,0xb1,0xb2,0x9d,0x40,0x79,0x5a,0xa0,0x19,0x4d,0x0d,0x2d,0x00,0x0b,0xff,0x93,0x4b,0xb9,0x96,0x1b,0x80,0xb0},
+    {0x93,0xf5,0x2d,0x95,0x29,0xdd,0x82,0xbe,0x3a,0xa9,0x71,0xb0,0xe3,0x3b,0xb5,0x56,0xe4,0x6c,0x8f,0xde,0x02,0xe7,0x12,0x07,0x26,0xff,0xc6,0xe2,0x75,0xc4,0xb0,0x6f},
+    {0x94,0x37,0xe1,0x9b,0xcd,0xf4,0x58,0x7e,0x80,0xe9,0xb7,0x11,0x17,0x20,0x28,0x44,0xc6,0x42,0x18,0xc4,0x88,0xd0,0x7e,0x61,0xa9,0xbf,0xd9,0xcf,0x1d,0xe4,0xd2,0x59},
+    {0x94,0xe2,0x6f,0x68,0x9b,0xcb,0x00,0xf4,0xf7,0x6f,0x6b,0x81,0xbc,0x5a,0x71,0x8c,0xf8,0x0f,0x54,0x32,0xe6,0x31,0x50,0x31,0x69,0x28,0xc8,0xe7,0x76,0xff,0xf7,0xaa},
+    {0x95,0x25,0x8a,0xd6,0xdb,0xed,0x2b,0xb8,0x50,0x7c,0xd4,0xf6,0x5e,0x5a,0xf3,0xd2,0xd4,0xb1,0xc5,0xeb,0xbe,0x41,0x9a,0x9b,0x0b,0xd6,0xdd,0xb4,0xff,0x61,0x94,0x25},
+    {0x95,0x74,0x39,0x23,0x46,0xca,0x7a,0xcf,0xa7,0x43,0xdb,0x39,0xcf,0x79,0x91,0x56,0xab,0x3f,0x1e,0x07,0x3d,0x9b,0x20,0xc9,0x27,0xdf,0x44,0xa2,0x50,0xf9,0xe0,0xf6},
+    {0x96,0x1e,0xc5,0x4e,0x72,0x23,0x92,0x3d,0xa2,0xae,0x6b,0x1e,0xde,0x0c,0x9e,0xd2,0xbb,0x81,0xd0,0x6f,0xd3,0xda,0x06,0x8b,0x2e,0x0d,0xea,0xff,0x6e,0x2e,0x9b,0xc1},
+    {0x96,0x4d,0xe0,0x88,0x9f,0x53,0xbb,0x1c,0x8b,0xec,0x41,0xd4,0xe4,0xfb,0x51,0xfa,0x18,0xa7,0x62,0x5d,0x06,0x29,0x80,0x32,0x1b,0xd2,0x9a,0xeb,0xee,0xe7,0x2e,0xc4},
+    {0x97,0xaa,0x7f,0x6e,0xa9,0x75,0xc2,0xbe,0x42,0x53,0x3b,0x32,0xb8,0x5f,0xce,0x89,0xbc,0x01,0xda,0xf0,0xd7,0x69,0x00,0x2f,0x99,0x45,0xb4,0xe8,0x3a,0x9a,0x69,0x5c},
+    {0x97,0xed,0xa8,0x77,0x33,0xd5,0xd8,0xa0,0x92,0xec,0xb6,0xd5,0xa1,0xb8,0xdf,0xd0,0xf5,0xe0,0x5f,0x8b,0xe5,0xac,0x9a,0xc0,0xe2,0x83,0x33,0xac,0x30,0x68,0x74,0xcc},
+    {0x98,0x6a,0x78,0xb4,0xc4,0x87,0x66,0x8f,0x81,0x00,0x01,0x5f,0xee,0xae,0x7e,0xc2,0x97,0xe0,0x51,0xb6,0x9f,0xa9,0x40,0x52,0x44,0xe7,0xd2,0xba,0x19,0xc1,0x5c,0x8e},
+    {0x98,0x6b,0x46,0x7b,0xa7,0x1a,0x29,0x70,0x67,0xa6,0x7b,0x4a,0x5a,0x01,0xdc,0x4e,0x77,0xed,0x5d,0x78,0xdf,0x9b,0x08,0x55,0x06,0xd4,0x4d,0x41,0x30,0x49,0x72,0xba},
+    {0x98,0xb3,0xcb,0x24,0x83,0x5c,0xb7,0x9f,0x3b,0x50,0xc0,0x79,0xf8,0xeb,0x16,0x97,0x03,0x4a,0xfc,0x58,0xdd,0x60,0x5d,0xa0,0x6f,0x23,0x73,0x6d,0x5e,0xc0,0x3d,0x89},
+    {0x99,0x06,0xfc,0xcb,0x4a,0x5f,0x0b,0x80,0x9e,0x24,0x84,0x96,0x69,0xb3,0xf7,0x6e,0xc5,0x30,0x77,0x7b,0x57,0xda,0xce,0x7d,0xf2,0x41,0xc6,0x9d,0xee,0x4c,0x6a,0xee},
+    {0x99,0x1a,0x68,0xc4,0x16,0x38,0x58,0x3e,0xed,0xaa,0x26,0x77,0x58,0x91,0x48,0x10,0x4f,0xb2,0x56,0x40,0xef,0x6a,0x40,0x42,0xd1,0xa2,0x91,0x96,0xb3,0xdf,0x10,0xaf},
+    {0x99,0x59,0xad,0xf8,0x8f,0x9f,0xd7,0xc1,0xcf,0xd7,0x13,0x42,0xa3,0xf7,0x39,0x97,0x4b,0x28,0x9d,0xfa,0xcc,0xee,0xec,0x47,0x79,0xf0,0x0b,0x2a,0x3f,0x06,0x52,0xbc},
+    {0x99,0x77,0x20,0xa8,0xdf,0x38,0xb2,0xd5,0x11,0x35,0x61,0x58,0xa6,0x8f,0xf0,0x71,0x11,0xc1,0x64,0x04,0xbd,0x71,0x2e,0x9c,0x27,0x86,0x5e,0x82,0x8c,0xb7,0xed,0x88},
+    {0x9a,0x2a,0x51,0xfa,0x83,0x6d,0x19,0x00,0xc4,0x9d,0x41,0xa2,0x48,0xee,0x96,0xe2,0xdf,0xab,0x96,0xfa,0x73,0x10,0x8c,0xb6,0x8a,0xab,0xa0,0xb3,0x02,0xc7,0xb7,0x34},
+    {0x9a,0xc2,0x7b,0xfb,0x0f,0x61,0xf6,0x6c,0x81,0x48,0x25,0x4f,0x4d,0x91,0x90,0x11,0xc6,0x2a,0xad,0x78,0x67,0x7c,0x2c,0xd8,0x6e,0x5c,0x81,0x3c,0xa3,0x2a,0xab,0xcc},
+    {0x9b,0x2e,0xa8,0xe4,0x22,0xf0,0x39,0x69,0xd6,0x13,0xa1,0x6f,0xbf,0x80,0xd2,0x9e,0xd1,0x22,0x9e,0x09,0xac,0x02,0x96,0x5d,0xf4,0x37,0x68,0xef,0x9f,0xc7,0xcf,0x88},
+    {0x9c,0x0a,0x51,0x42,0xb0,0x73,0xc4,0xac,0x54,0x7b,0x02,0xd8,0xb2,0x50,0x0a,0x05,0x2d,0x41,0x9a,0x09,0x41,0x11,0x45,0x9a,0x84,0x26,0x5f,0xa4,0x04,0xd8,0xef,0x1e},
+    {0x9c,0x2b,0x18,0x3d,0x73,0x5a,0xfd,0x3f,0x8a,0x4a,0x8e,0xe6,0xd8,0x6d,0x43,0x1e,0xbc,0x43,0x35,0x70,0xac,0xdf,0xc8,0x30,0xb1,0x74,0x8b,0x26,0xf3,0xa3,0xc1,0xa8},
+    {0x9c,0x79,0xa5,0x53,0x71,0x8a,0x8b,0x7d,0x44,0x12,0xeb,0x02,0xd4,0x3f,0x09,0xb8,0x19,0x8b,0xd1,0x00,0xe7,0x93,0xed,0xbb,0x25,0x2e,0xc9,0x62,0x7f,0x5b,0x12,0xf3},
+    {0x9d,0x02,0xf0,0x50,0x59,0xac,0x7e,0x0d,0xa2,0xfd,0x37,0x0b,0x27,0x87,0x16,0xb3,0xfa,0x00,0x83,0x52,0xb9,0x92,0x19,0xa6,0x0a,0x40,0x49,0x57,0x2c,0x29,0x8c,0x93},
+    {0x9d,0x13,0xfc,0x3c,0x8b,0xb4,0x23,0xb2,0x0f,0x72,0x13,0x27,0x68,0xea,0x82,0xdd,0x28,0x9f,0x03,0x90,0x6e,0x1f,0x7b,0x78,0x3d,0x42,0xa3,0xb5,0x78,0xb3,0x15,0x99},
+    {0x9d,0x3c,0x0f,0xc8,0x4b,0xb6,0x66,0x3b,0xb1,0x00,0xc0,0xfa,0x32,0x7b,0x70,0xec,0x6d,0x17,0x78,0x66,0xe7,0x25,0xa0,0x57,0xd0,0xd2,0xef,0xea,0x4c,0xfb,0x06,0xd6},
+    {0x9d,0xee,0x8e,0xea,0xca,0xb1,0x56,0x39,0x4c,0x8f,0x43,0xdb,0xde,0x29,0x03,0x9e,0x0e,0xbd,0x53,0x21,0x6a,0x96,0xa2,0x03,0xf0,0x41,0x20,0x5d,0x24,0xe4,0x93,0xf0},
+    {0x9e,0x66,0x32,0xf5,0x25,0x77,0x20,0x27,0x1c,0x3c,0x30,0x18,0xc6,0xb8,0x38,0x94,0xf0,0x4a,0x4a,0x64,0x66,0x3d,0x54,0x79,0x05,0xaa,0x3b,0x47,0xd4,0x3a,0x7f,0x70},
+    {0x9f,0x01,0xd1,0x3e,0x5b,0x15,0x2c,0x6e,0x41,0x1b,0xfc,0x3b,0xff,0x54,0x2e,0x15,0x1b,0x34,0x1a,0x8d,0x37,0xfa,0xb4,0xd2,0xe7,0x39,0x13,0xb5,0x59,0xad,0xc4,0x8a},
+    {0x9f,0x52,0x54,0x2e,0xb3,0xc1,0x40,0xc8,0x44,0x8b,0x8f,0x69,0xaf,0xdd,0xf1,0x62,0xda,0x5e,0x0d,0xef,0x35,0xf1,0x28,0x10,0x29,0x3c,0xb0,0xd4,0x55,0xf7,0xc1,0x24},
+    {0x9f,0x9c,0x97,0x23,0x7a,0xee,0x96,0x08,0x8e,0x0a,0x04,0x54,0x8d,0xc4,0x80,0xba,0x93,0x89,0x83,0x2d,0x16,0x79,0xe3,0xb6,0x83,0xc0,0x3a,0xf3,0x4a,0x90,0xd1,0x9c},
+    {0x9f,0xd1,0x21,0xa1,0x41,0xad,0xae,0x5a,0x8b,0xe1,0xd6,0xce,0x7a,0x3e,0x9e,0x19,0x44,0x32,0x5a,0x73,0x7b,0xab,0x89,0xe6,0xda,0x8e,0x23,0x83,0x30,0x1f,0x35,0xe2},
+    {0xa0,0x27,0x3a,0x41,0x72,0xe1,0x57,0x24,0xab,0x97,0x8d,0x4d,0xd9,0x37,0x02,0x22,0x99,0xd6,0xcf,0xed,0x82,0x51,0x16,0xaf,0x91,0xb9,0xf8,0x04,0x88,0xf9,0xfc,0x18},
+    {0xa0,0x45,0x34,0x5f,0xb7,0x7b,0x5a,0x0c,0xc1,0x74,0x7d,0x42,0x05,0x5e,0xee,0x39,0xb9,0x5d,0xdc,0xdc,0x06,0x17,0x5b,0x17,0x5f,0xf8,0x81,0xb8,0xed,0xad,0x24,0xc3},
+    {0xa0,0x5a,0x0a,0x1c,0xc8,0x2a,0xe3,0x92,0x9c,0x7c,0x7f,0xe7,0x6e,0xc6,0x12,0x50,0x53,0x44,0xd1,0xbe,0xf6,0xe3,0x68,0x67,0x9b,0xd6,0x33,0xda,0x4f,0xae,0xcd,0x50},
+    {0xa0,0x93,0x38,0x92,0x0d,0xa0,0x78,0xda,0x38,0x4c,0x5f,0x5a,0x4c,0x45,0x52,0x5d,0x03,0xa5,0xf0,0xcd,0x2c,0x2d,0x2a,0x75,0x7f,0xa7,0x89,0x9d,0xf2,0x98,0x1d,0xf8},
+    {0xa0,0xac,0x08,0xe1,0x5d,0x81,0xb1,0xe6,0x39,0xde,0xb6,0x54,0xff,0x41,0x81,0x26,0xa3,0xf9,0xc3,0x5f,0x16,0x0f,0x65,0xe2,0xaf,0x52,0xff,0x15,0x8f,0x00,0xe4,0x7b},
+    {0xa1,0x4a,0x76,0x2c,0xf9,0xc4,0x74,0xae,0x22,0xd0,0xc8,0x71,0xed,0x58,0xaf,0x76,0x09,0x41,0xd9,0xb9,0x17,0xc1,0x4a,0xd9,0x7f,0x22,0xf1,0xd9,0x1c,0xec,0x5c,0x6d},
+    {0xa2,0xdb,0xf6,0x1b,0x7a,0x6c,0xc5,0x9b,0x6c,0xdf,0x35,0x76,0xcc,0x16,0x3f,0xee,0x6f,0xe0,0xcc,0xd0,0xac,0xe0,0xc4,0xc8,0x22,0x4e,0x07,0x4e,0x47,0x7a,0x3b,0x8d},
+    {0xa3,0x9d,0x64,0x9f,0x3c,0x0e,0xfe,0x21,0xab,0x23,0xc0,0xad,0x60,0xbe,0xf4,0xb5,0x69,0x00,0x2d,0x6f,0x56,0xcb,0xd2,0xa6,0x00,0x5e,0xd9,0x18,0x7c,0x7e,0xc8,0xee},
+    {0xa3,0xb1,0x8e,0x76,0x0a,0x51,0x6d,0x0d,0xa1,0x55,0x28,0x46,0xc1,0x45,0xde,0x94,0x90,0xac,0x03,0xcc,0x49,0x55,0x8e,0x76,0x4b,0x10,0x70,0xb3,0xe7,0x8a,0x83,0xc1},
+    {0xa3,0xc1,0xaa,0x01,0xc7,0xb4,0x96,0x49,0x4d,0x07,0x5b,0x53,0xd1,0x4a,0xb6,0x90,0x8c,0xaa,0x30,0x08,0xae,0xc2,0xed,0xa9,0xee,0xd7,0xe0,0x5c,0x7e,0x47,0x8b,0xf5},
+    {0xa3,0xf2,0x67,0x33,0x1f,0x88,0xb2,0xbf,0x64,0x1f,0x39,0xeb,0x6c,0xfc,0x19,0xcd,0x10,0xe5,0x39,0x44,0xc4,0x7a,0xaa,0xe4,0x03,0x16,0xa5,0xbe,0x2e,0x39,0x71,0xfa},
+    {0xa4,0xad,0x5e,0xc0,0x6d,0xa0,0x8e,0x16,0x83,0x00,0xeb,0xde,0xb2,0x20,0x74,0xd0,0xda,0x90,0x80,0x61,0x71,0xa5,0x2b,0x74,0xf9,0x7f,0x01,0x2b,0x61,0xd8,0xfc,0x12},
+    {0xa4,0xc8,0xa6,0x8f,0x74,0xa7,0x22,0x0c,0x78,0x36,0x78,0xaa,0x50,0x8b,0xbd,0x0c,0x3c,0x78,0x29,0x3f,0x92,0x76,0x83,0x8d,0x91,0xfc,0x64,0x2e,0x41,0x3b,0x84,0xb6},
+    {0xa4,0xfb,0x78,0xed,0x1c,0x86,0xf2,0xe2,0x8c,0x7a,0xe7,0x0f,0xc5,0x44,0xbc,0x76,0x3f,0xd7,0xdd,0x84,0xb6,0x6e,0x37,0x7c,0x8f,0xf0,0xa9,0xc6,0xb9,0xae,0xb4,0xf8},
+    {0xa5,0x1f,0x57,0x54,0x47,0x0a,0x70,0xed,0x3a,0x5d,0x63,0x50,0xf1,0x21,0x8d,0x07,0x6a,0xbc,0x32,0x60,0xd3,0xee,0xaf,0x35,0x38,0xef,0x44,0xbd,0x0e,0x72,0x07,0x5e},
+    {0xa5,0x71,0xb9,0x8d,0x65,0xc9,0x37,0x94,0x26,0xe4,0x2a,0x9d,0x44,0x6d,0xd3,0xa2,0xd8,0xb9,0xa2,0x15,0x55,0x87,0x82,0x45,0x4f,0x23,0xc6,0x8b,0x4f,0xb2,0xf8,0xec},
+    {0xa6,0x89,0xd4,0xdb,0x8d,0x37,0x26,0x9d,0xe6,0x69,0xd9,0xd5,0x67,0xdf,0x0d,0xe2,0xbe,0x23,0x0a,0xe4,0xb8,0x51,0xa7,0xdb,0xad,0xd8,0x58,0x64,0x4a,0x1c,0x52,0xe4},
+    {0xa6,0xd2,0x71,0x59,0xa3,0x7e,0x8b,0x9b,0xd2,0x08,0x4f,0xb7,0x09,0x9e,0xbf,0x38,0xa6,0x93,0xcf,0x87,0xce,0x8e,0x9d,0xde,0x0d,0x4a,0x87,0xab,0x51,0xaa,0x81,0x4f},
+    {0xa7,0xb1,0xbf,0x35,0x55,0x85,0x9b,0x15,0x02,0x27,0x15,0xf1,0x9d,0x1b,0xdc,0x94,0x65,0x83,0x4a,0xc6,0x37,0x8d,0x78,0x12,0xd7,0x45,0xb5,0x75,0x2d,0x0d,0xe6,0x4c},
+    {0xa8,0x4f,0xbd,0xe7,0x30,0x69,0x48,0x3d,0x3f,0xaf,0x88,0xf1,0xca,0x3d,0xbf,0x7b,0xd8,0x8a,0xa3,0xaa,0xf3,0x66,0xdc,0xd8,0x56,0x34,0x1b,0xde,0xcb,0x5b,0x7b,0x9a},
+    {0xa8,0x76,0x1e,0x08,0x2b,0xb4,0xab,0xcd,0x2b,0xf1,0xd3,0x11,0xc3,0x3d,0x00,0xd2,0x01,0x13,0x17,0x88,0xae,0x97,0x2c,0x14,0x00,0xe4,0xf3,0xa1,0xc8,0x05,0x0b,0xfd},
+    {0xa8,0xb8,0x28,0x0d,0xda,0x7f,0xad,0x49,0xe5,0xe8,0xea,0x1d,0xf3,0x94,0x9d,0xac,0x4a,0x5f,0xb5,0x63,0xd3,0x58,0xf0,0x86,0xe0,0xae,0x53,0xf2,0x81,0xd7,0x7e,0x76},
+    {0xa9,0x1d,0x2d,0x5f,0xeb,0x21,0xac,0xe7,0xbf,0xfe,0xc1,0x88,0xf1,0x9b,0x45,0xc7,0x56,0x79,0x88,0xbc,0xc3,0x87,0x7a,0xf2,0x9a,0x89,0xeb,0xe6,0x25,0x1f,0x2c,0x24},
+    {0xa9,0x95,0xd0,0x8b,0xb5,0xf5,0x30,0xd3,0xa6,0xde,0x6c,0x2e,0xa9,0x84,0x8c,0x82,0xfd,0x62,0xcf,0x1d,0x58,0xf8,0x83,0x0f,0x74,0x94,0x80,0xd2,0x3d,0xb9,0x75,0x7f},
+    {0xa9,0xc6,0x91,0xe2,0x70,0x11,0xf5,0xb0,0x10,0xbf,0xdf,0xcd,0x9a,0x94,0xcc,0x56,0x4d,0x36,0x2a,0x47,0x4b,0x50,0x5e,0xb6,0xbe,0xbc,0x2b,0xb1,0x13,0x6d,0x01,0x18},
+    {0xa9,0xca,0x4a,0x49,0x31,0xf9,0x11,0x29,0xf0,0xae,0xe4,0xb4,0xce,0x5e,0x46,0x6e,0x3b,0xec,0x4f,0x6d,0x50,0x3a,0x71,0x1d,0x24,0xd8,0xe5,0xc8,0x89,0xd6,0x3a,0x34},
+    {0xa9,0xed,0xe6,0x75,0x4a,0x0a,0x7b,0xf1,0xb6,0xef,0xd4,0x8e,0x6c,0xcf,0x1b,0x26,0x14,0x7d,0x60,0x4f,0xea,0x08,0xa8,0x4c,0x11,0xb7,0x1f,0xe3,0x03,0x50,0x16,0x58},
+    {0xa9,0xf9,0x0f,0x8c,0xd6,0x99,0x2d,0x4b,0x2b,0x99,0xb2,0x27,0x73,0x33,0x0f,0xc4,0xcf,0xd9,0x3c,0xe2,0xad,0x37,0x06,0x41,0x72,0x90,0x3f,0xba,0x47,0x83,0x71,0xec},
+    {0xaa,0x17,0x31,0x77,0x66,0x6e,0x3a,0x3f,0x37,0x7f,0x55,0x15,0xbf,0x02,0x37,0x8a,0x4c,0x6f,0x98,0xa1,0x66,0x40,0x26,0x5f,0x11,0x9e,0xd3,0xfa,0x84,0xdc,0x7f,0x9e},
+    {0xaa,0x7d,0xc3,0x31,0xad,0x57,0xc1,0x0e,0x5c,0xf6,0x38,0x24,0xd8,0x15,0x98,0xe7,0x11,0xcb,0x33,0x02,0x27,0x1c,0x9e,0x66,0x57,0xfa,0x91,0x58,0x71,0x19,0xb5,0x0c},
+    {0xab,0x27,0xbe,0x24,0x4e,0xa5,0xf7,0x90,0xef,0xc1,0x23,0x34,0xcf,0xc1,0x9a,0x62,0x4b,0x75,0x52,0x0a,0xc5,0xe7,0x4b,0x1e,0x4a,0xe6,0x8a,0x33,0x9c,0xf1,0x40,0x25},
+    {0xab,0xf7,0xc5,0x18,0x57,0xe3,0xa6,0x7b,0xcc,0xdc,0x47,0x69,0x54,0xfd,0xb2,0x0a,0x98,0x47,0xff,0x02,0x26,0x63,0xb2,0x13,0xb0,0x21,0xe3,0x01,0xba,0x00,0xc9,0x2d},
+    {0xac,0x2c,0x5b,0xb1,0x12,0x94,0x8c,0xfb,0xb2,0x6a,0xb0,0x57,0x4d,0xfe,0x6b,0x21,0xb8,0x54,0x41,0x52,0xab,0xcf,0x43,0x1f,0x49,0x1f,0x88,0x6e,0x60,0x96,0xa4,0x66},
+    {0xac,0x2f,0x1e,0x1c,0x72,0x7f,0x96,0x12,0xb0,0x92,0xf2,0x76,0x7d,0x64,0x83,0x10,0x57,0x37,0x25,0x73,0xa7,0xa6,0x84,0x49,0x83,0xdd,0xe6,0x2a,0x44,0xea,0x67,0x86},
+    {0xad,0x80,0x6f,0x48,0x16,0x33,0x8b,0xe9,0xc6,0xc7,0x9e,0x8e,0xe7,0xba,0x19,0x38,0x5a,0x31,0xa3,0x82,0x56,0x5c,0x9f,0x45,0x27,0xce,0xbb,0x30,0xc1,0x8e,0x4c,0x27},
+    {0xae,0xdf,0xb3,0x43,0x18,0x2d,0xfb,0xda,0x74,0x1b,0x95,0x77,0xa9,0x8c,0x92,0xcc,0xb8,0xa3,0xef,0x85,0x7c,0x54,0xaf,0x27,0x5a,0xf4,0xe9,0x83,0x98,0xf6,0xd7,0x03},
+    {0xaf,0x50,0xc1,0x7b,0xea,0x73,0xd6,0xed,0xc0,0x71,0xd7,0x5a,0x5e,0x28,0x88,0x9b,0x26,0xf0,0xa1,0xd7,0x16,0x28,0x43,0x18,0xe6,0xfd,0xde,0x19,0x89,0x05,0xfc,0xfd},
+    {0xaf,0x96,0xba,0x71,0x3d,0x44,0xd2,0x1b,0x22,0xd5,0xcc,0xd4,0x0b,0x0e,0xb6,0xaf,0x8e,0xed,0xb0,0x05,0x18,0x67,0x65,0xd2,0xe5,0xaf,0xe1,0xaf,0x36,0xcb,0x06,0xbd},
+    {0xb0,0x02,0xa5,0xb0,0x00,0x67,0x92,0x40,0x94,0x7a,0x35,0xc1,0x4f,0xc6,0x3e,0x6d,0x49,0x1e,0x09,0x00,0xb9,0xea,0x2d,0x4b,0x60,0xca,0xf1,0xa7,0xa2,0xff,0xfa,0xbd},
+    {0xb0,0x9d,0x80,0x61,0xf2,0x1b,0x15,0x1e,0xea,0xc8,0xa0,0xf7,0xe1,0xa5,0x9d,0x82,0x83,0xcc,0x5c,0x9a,0xeb,0xf8,0x8f,0xd9,0x30,0x19,0x95,0xda,0x2b,0x8a,0x71,0x2a},
+    {0xb0,0xa5,0x84,0xb3,0xe6,0x98,0xc5,0x42,0x83,0x79,0xca,0x24,0x89,0x2d,0xd0,0x01,0x96,0x47,0x16,0x02,0x02,0xba,0x6a,0xf9,0xe5,0xc0,0x12,0x10,0x9e,0x6f,0xdb,0x12},
+    {0xb1,0x50,0xe7,0x5b,0xc1,0x2e,0x9d,0xf1,0xf2,0xeb,0xda,0x1a,0x50,0x4f,0xd0,0xe0,0x3e,0xd8,0x6c,0x60,0x18,0x9b,0x58,0xf5,0x16,0x05,0x7a,0x32,0xe1,0xb6,0x1f,0x2a},
+    {0xb1,0x69,0xd2,0xdd,0xf3,0x26,0x82,0x0e,0x6a,0x95,0xb8,0x45,0xfb,0x85,0xcf,0x12,0x1e,0xe5,0xfd,0x3a,0xb5,0xdf,0x01,0x11,0x8d,0x70,0xbb,0x93,0x4f,0x0e,0x8c,0xb2},
+    {0xb1,0xcd,0xf9,0xd1,0xec,0x42,0xc2,0xfc,0x4f,0x4b,0xe1,0x0b,0xf4,0x93,0x0d,0xb0,0x46,0x0e,0xa2,0x82,0x84,0xe1,0x6e,0x60,0xeb,0x52,0x34,0x43,0xfd,0xc1,0x78,0x79},
+    {0xb2,0x2e,0x05,0x50,0x01,0x62,0x9c,0xc6,0xa1,0x34,0xb9,0x20,0x02,0xb0,0xd0,0x29,0x1b,0xf0,0x19,0x3e,0xfa,0x40,0x43,0x3b,0xce,0xf7,0x55,0x5c,0xe5,0x96,0xb9,0x2b},
+    {0xb2,0x2e,0xa0,0x9f,0x63,0x9d,0x45,0x4c,0x95,0xed,0xf4,0x43,0x29,0x0d,0x72,0x46,0x44,0x2b,0x85,0xe8,0xf7,0xfa,0x1a,0x1c,0x5d,0x13,0xc4,0x10,0x2d,0xbc,0xb9,0x46},
+    {0xb3,0x0f,0xf6,0x9e,0x69,0x9a,0xce,0xc6,0x0e,0x16,0x51,0xef,0xd3,0x10,0xe3,0x53,0xb2,0x1d,0x32,0xb8,0x95,0xc2,0x9c,0x0b,0x08,0xee,0x0f,0x78,0xaa,0x39,0xba,0x13},
+    {0xb3,0xb8,0x1c,0xfc,0xeb,0xd7,0xf3,0x10,0x7d,0x68,0x43,0x9f,0x8e,0x58,0x73,0xbd,0x3b,0xfc,0x4b,0xd1,0x7a,0x40,0x29,0xf8,0x91,0xf0,0xfc,0x95,0x1b,0x4e,0x73,0x3f},
+    {0xb4,0xf5,0x05,0x72,0x1a,0x78,0xb5,0x3e,0xb4,0x3a,0xb7,0xec,0xc2,0xb2,0xef,0x54,0x60,0x6b,0x9c,0x03,0xd1,0x8f,0x8d,0x57,0x89,0x51,0x85,0x0a,0x9b,0x36,0x84,0xb8},
+    {0xb5,0x1c,0x45,0x9a,0xe8,0x3c,0x7d,0xfd,0x27,0x18,0x07,0x7b,0x8d,0x08,0xd0,0x87,0x50,0x41,0xfa,0xb8,0x53,0x5e,0x98,0x3e,0x9b,0x19,0xce,0xa1,0x21,0x53,0x44,0xbe},
+    {0xb5,0xd4,0x30,0xb2,0x82,0xf4,0x1d,0xec,0xce,0xfd,0xab,0xeb,0x19,0x93,0xae,0xc0,0x09,0x58,0xbc,0x0c,0xc2,0x47,0x47,0x3e,0xaf,0x0a,0xb7,0xb3,0xfd,0xea,0xa8,0x18},
+    {0xb5,0xdb,0x29,0x1d,0x9c,0xec,0xa5,0x19,0xb3,0x3e,0x88,0xe4,0xdb,0xb9,0x6f,0xde,0x7a,0x21,0xeb,0xb7,0xf9,0x16,0x24,0x41,0xcf,0x4b,0xe1,0xf2,0x54,0xcd,0x5f,0x89},
+    {0xb5,0xed,0xef,0x39,0x6e,0x3b,0x54,0x6a,0xbd,0x31,0xfb,0x84,0xaf,0xe8,0x70,0xa7,0x5b,0xb1,0x92,0x35,0x8b,0x43,0xef,0x8a,0x75,0xf7,0x9c,0xc9,0x53,0xbf,0xc8,0xb4},
+    {0xb6,0x3e,0x51,0x36,0x4b,0xa0,0xac,0x4e,0x5e,0x5d,0x02,0xc4,0x89,0x3c,0x98,0x34,0x78,0x61,0x4c,0x6e,0xaf,0x8f,0x5e,0x58,0xc5,0x4a,0xcf,0x0c,0x42,0x96,0x9f,0xaf},
+    {0xb6,0xb0,0x2b,0xf5,0x5f,0xa2,0xc3,0x49,0xc5,0x0a,0x31,0x06,0x8e,0x18,0x2e,0xc7,0xe2,0xdb,0x2a,0xcd,0x24,0xb7,0x9e,0xc3,0x97,0x6b,0xfe,0xce,0x24,0x9d,0x14,0x40},
+    {0xb6,0xe7,0x49,0xb6,0x08,0x10,0xb2,0x20,0x25,0x95,0xc4,0x18,0xed,0x27,0x16,0xaa,0xc5,0xc1,0x92,0xd0,0x46,0x1b,0xa2,0xa6,0x3e,0xfc,0x56,0x9e,0x7d,0x96,0x71,0x88},
+    {0xb7,0x1e,0x38,0x70,0x0b,0x5c,0x52,0xd5,0x78,0x65,0x1f,0x93,0x0f,0x16,0xb8,0x97,0x8c,0x78,0x29,0xb2,0x84,0x72,0xd9,0x2c,0x49,0xdf,0xba,0xe2,0x56,0x84,0x13,0x2f},
+    {0xb8,0x2a,0xcd,0x4c,0x24,0x68,0xa7,0xfc,0xb4,0x21,0xe4,0x89,0xc9,0x48,0x12,0xa8,0x5d,0x5e,0x6a,0x09,0x3b,0x1e,0x9e,0x60,0xb8,0x18,0xff,0x5e,0xd4,0xa1,0xf2,0x8f},
+    {0xb8,0x73,0x01,0x5d,0x75,0xe6,0x9e,0x18,0xcd,0x20,0x32,0x67,0xfd,0xd1,0x7f,0xa9,0xa3,0xd0,0x72,0xac,0xe2,0xb2,0xcb,0xdd,0x40,0xd7,0x2c,0x18,0x1c,0x70,0xb2,0x20},
+    {0xb9,0xec,0x2b,0x05,0x60,0xe7,0x3e,0x1b,0x65,0xca,0x3d,0x2a,0x2c,0xca,0xe4,0xbd,0xba,0x61,0xd9,0x5f,0x46,0x0c,0x72,0x01,0xe3,0x74,0x4f,0xbf,0x2b,0x6a,0x84,0x00},
+    {0xba,0xbb,0x16,0xe3,0x56,0x93,0xfa,0x82,0xd0,0x78,0xcd,0x9a,0xc2,0xa4,0xaf,0x99,0xee,0x21,0x50,0x88,0x6c,0xec,0x80,0xf4,0x8f,0xdd,0x9a,0xc8,0xdd,0xea,0x03,0x49},
+    {0xbb,0x0c,0x94,0xa6,0x4c,0x87,0x80,0x1f,0x88,0x79,0x23,0x8f,0x60,0x17,0xda,0x24,0xb0,0x15,0x3c,0x9c,0xd9,0xd8,0xc4,0x17,0x82,0xdd,0x53,0x23,0xab,0xd0,0xa3,0xe4},
+    {0xbb,0x74,0x82,0xba,0x69,0x1f,0xa1,0x86,0x92,0x51,0x9f,0x82,0x96,0x1e,0xc8,0x8a,0x46,0xac,0x23,0x5f,0x08,0x88,0x86,0xeb,0xa0,0xdf,0x48,0x2e,0x6c,0x6a,0xc6,0x2e},
+    {0xbb,0xb4,0x8a,0x5e,0x96,0xcb,0xb6,0x6c,0x36,0x5b,0x32,0xae,0x59,0x16,0xb2,0x55,0x79,0xfc,0x04,0xde,0xce,0x21,0x7a,0x2f,0x3b,0x2e,0xba,0x98,0x33,0x09,0xf7,0xb8},
+    {0xbc,0xd6,0xa2,0xae,0x16,0x26,0xeb,0x27,0xe9,0xa3,0x5f,0x32,0x54,0xfa,0x60,0xc8,0x5c,0x76,0x58,0x18,0xa4,0xbb,0x40,0xd0,0x9d,0x6d,0xb6,0x58,0x70,0xde,0x21,0xad},
+    {0xbc,0xde,0x3e,0x6c,0x2d,0x79,0x18,0x28,0x72,0xe8,0x26,0x6e,0xf3,0xa0,0x53,0x84,0xd4,0x47,0x03,0x88,0xa7,0x53,0x24,0xdd,0x3c,0x9a,0xeb,0x80,0xcd,0x86,0x8c,0xfd},
+    {0xbc,0xdf,0x98,0x58,0xf5,0x68,0x85,0x33,0x79,0xd0,0x60,0xd8,0xea,0x86,0x9e,0x8e,0x97,0xd9,0xe1,0x19,0xe6,0x35,0x1d,0xb7,0x71,0xea,0x4c,0x3f,0x23,0x86,0x22,0x49},
+    {0xbd,0x2e,0x13,0x9a,0x94,0x25,0xc2,0xf4,0x52,0x98,0x7f,0x65,0xb1,0x78,0xe4,0x51,0xc8,0x6d,0x26,0x10,0xab,0x21,0x40,0x89,0x90,0x88,0x27,0x62,0x84,0xd8,0x78,0x31},
+    {0xbd,0x9d,0x0c,0x99,0xb4,0xd8,0xe1,0x33,0x98,0xbd,0xf7,0x15,0xc8,0xb7,0x4e,0x8c,0x54,0xff,0x1d,0xb9,0x9a,0xf9,0x59,0x9c,0xbf,0x10,0x04,0xe4,0xca,0xc4,0x43,0xed},
+    {0xbd,0xcf,0x58,0x89,0x92,0xf7,0xd5,0x82,0xd9,0x74,0x36,0x8c,0x40,0x78,0x72,0x1f,0x3a,0xe4,0x8f,0x39,0xae,0xd8,0x62,0x50,0x87,0x4d,0xc3,0x60,0x41,0xaa,0x4c,0xdb},
+    {0xbe,0x12,0xd8,0x81,0x30,0x6d,0xc5,0x8e,0x78,0xdb,0xa4,0xd6,0xbb,0xcc,0xd4,0x45,0xd6,0x9a,0x73,0x38,0x5a,0x5b,0x87,0x56,0x0a,0x75,0x92,0x0a,0xdf,0x27,0x5e,0x3a},
+    {0xbe,0x4a,0x3d,0xc4,0x6e,0x81,0x64,0x3d,0x65,0xf0,0x7a,0x44,0x54,0xe3,0xcf,0x15,0x5b,0x33,0xdf,0xc5,0xc9,0x30,0x31,0x95,0x3a,0xfc,0xf8,0x3e,0x9c,0x44,0x54,0x2c},
+    {0xbe,0x6b,0x93,0xc0,0x3e,0x6e,0x5e,0xfe,0x95,0xdb,0x4f,0xe3,0xf0,0xd8,0x57,0xd5,0x14,0x35,0xb7,0x5e,0x6a,0xd5,0x27,0x79,0xb6,0xc0,0x1a,0xa7,0x9c,0x92,0x9c,0x28},
+    {0xbe,0x70,0xe8,0xae,0xa7,0x06,0x07,0xa8,0x7a,0xb5,0x73,0x27,0x02,0xda,0x5b,0xf9,0xcc,0x2a,0x7a,0x3e,0x5b,0x43,0x7f,0xe8,0x4f,0xb1,0xac,0x4e,0xe7,0x86,0x72,0x5d},
+    {0xbf,0x44,0x15,0x77,0xd9,0xb4,0x14,0x89,0xd2,0xd3,0x92,0x74,0xfe,0x94,0x2f,0x76,0x23,0x49,0x5c,0x56,0xe8,0x7c,0x4a,0xb7,0x9b,0xfc,0x6b,0xe7,0x84,0xa8,0xef,0x75},
+    {0xbf,0x4b,0xc1,0xb2,0x2b,0x7c,0x0a,0xd7,0x19,0x41,0x18,0x26,0xe1,0xed,0x0d,0x29,0x97,0xb9,0x25,0x63,0x32,0x45,0xed,0x73,0x5d,0x37,0xc8,0x32,0xb3,0xc9,0x25,0x0a},
+    {0xbf,0x94,0xc0,0xab,0x38,0xcd,0x4c,0xc8,0x7b,0xb0,0x5b,0x27,0xcc,0x36,0x3f,0x26,0x30,0xea,0xeb,0xc9,0x98,0xc1,0x3e,0xf1,0xd3,0x85,0xff,0xe5,0x9a,0x82,0x3c,0x08},
+    {0xbf,0xd7,0xbb,0x3d,0x24,0x18,0xe3,0x2c,0xad,0x7e,0x5c,0x95,0x54,0xa9,0x1e,0xe3,0x43,0xc0,0xef,0x8e,0x46,0xa0,0xe7,0x4d,0x97,0xb4,0x3a,0x03,0xf8,0x8d,0xba,0x97},
+    {0xbf,0xe9,0xe4,0x80,0x97,0x19,0x02,0xd4,0x03,0xee,0xd2,0x3f,0xf8,0xdf,0x77,0xfd,0x8e,0xd1,0x64,0xc2,0xee,0x27,0xe9,0xee,0x5d,0x51,0x13,0x0d,0x0a,0xbc,0x02,0x16},
+    {0xc0,0x49,0xa1,0x1a,0x8d,0xe3,0xd1,0xa0,0x5a,0x4e,0xdb,0x2a,0x4e,0xd1,0x65,0x6b,0x0c,0x4d,0xf8,0xc8,0x66,0x2f,0x2f,0x9f,0x76,0xa2,0x37,0xef,0x90,0xe7,0x3a,0x9e},
+    {0xc0,0xb0,0x1d,0xbf,0x23,0x11,0x17,0x13,0xdf,0xaf,0xd8,0xd1,0x82,0x76,0xbc,0x92,0x97,0x5c,0x0b,0x41,0xcb,0x5f,0x44,0x25,0x2f,0x11,0xdb,0xf1,0x3e,0xea,0x96,0xa3},
+    {0xc0,0xb6,0x47,0x9c,0x0f,0x0c,0xde,0x63,0x96,0x5d,0xb8,0xd1,0x13,0x83,0x98,0x9e,0x94,0x64,0xd0,0x2b,0x77,0x9d,0xdb,0x4f,0xed,0xa6,0x30,0x6a,0x65,0x3d,0x49,0x43},
+    {0xc1,0x9e,0xd9,0x48,0x4b,0xed,0x4e,0xf2,0xb0,0xa0,0x5d,0xde,0xda,0x35,0xbb,0x0d,0x6c,0xb0,0x2b,0x58,0x37,0xd7,0x25,0xb5,0xf9,0x29,0x93,0x5a,0x78,0x10,0x15,0x7f},
+    {0xc1,0xb6,0xfa,0x19,0x31,0xc2,0xae,0xde,0x5e,0x94,0xf5,0xdb,0xbc,0x40,0x87,0xad,0x59,0xf4,0x63,0x73,0x5a,0xdd,0xd3,0x6a,0x35,0xed,0x8d,0x18,0x7d,0xbc,0x95,0x82},
+    {0xc1,0xd8,0x93,0xf1,0x61,0x68,0x64,0x35,0x1c,0x54,0x18,0xd8,0x9a,0xdd,0xab,0x85,0x8d,0x44,0xb9,0xb7,0x3f,0x58,0x98,0x8f,0xc4,0xdf,0xdd,0x02,0x9b,0xaf,0xb4,0x57},
+    {0xc3,0x19,0xb1,0xda,0xdb,0x4c,0x8a,0xfc,0xb3,0xcd,0x7f,0x9c,0x20,0x54,0x97,0x63,0x00,0x5a,0x77,0x59,0x16,0xb6,0xe8,0x8d,0x7e,0xde,0xc5,0x8a,0x02,0x3e,0x39,0x6c},
+    {0xc3,0x8c,0x33,0xe5,0xf6,0xe4,0xca,0x60,0x68,0x34,0x75,0xb5,0xb4,0x95,0xda,0xea,0x35,0x2c,0x4e,0x12,0x6c,0xf6,0x37,0xf7,0xa2,0x07,0xcc,0x57,0xbc,0xde,0xc7,0x83},
+    {0xc3,0x98,0x8e,0x81,0x9f,0xea,0xf8,0x52,0x9b,0x2c,0xee,0xb8,0x1f,0xa7,0xab,0xd9,0x73,0xa7,0x8d,0x4f,0xec,0xa3,0x2a,0x1a,0x22,0xca,0x32,0xd1,0x68,0xd1,0xfb,0x7d},
+    {0xc3,0x9d,0x9e,0xea,0x4f,0x5f,0x8e,0x49,0x41,0x3a,0x48,0xc2,0x36,0xde,0x6e,0xea,0xd3,0x28,0xdf,0x54,0x01,0xb3,0xce,0x2f,0xc0,0x59,0x54,0x6e,0xa8,0xfe,0xde,0x38},
+    {0xc3,0xa4,0x79,0x5c,0xcc,0xd2,0x1b,0xef,0x2a,0x26,0x38,0x26,0xcd,0xa3,0x77,0xdb,0xaf,0xa4,0x31,0x39,0x84,0xdb,0xf7,0x66,0x80,0xd1,0xcc,0xf4,0xf3,0x15,0x8c,0x35},
+    {0xc3,0xa7,0xdd,0x1b,0x3c,0x61,0x92,0x18,0xad,0xa3,0x35,0x1c,0xb3,0xb4,0x40,0x82,0xce,0x7a,0x3e,0x50,0xa1,0x01,0x1a,0x3b,0x65,0x13,0x59,0xb3,0xca,0xf9,0x7f,0xec},
+    {0xc3,0xd8,0x74,0xb5,0x8d,0x92,0x6b,0x82,0x28,0x65,0x8c,0xcd,0xf4,0x2b,0xe7,0x53,0x9e,0xee,0x66,0xda,0xe6,0xea,0xf3,0x9a,0x7a,0x0a,0xc6,0x99,0x0f,0x2b,0xb9,0x46},
+    {0xc4,0x01,0x8a,0xa5,0xaa,0x4e,0xd1,0x10,0x60,0xf7,0x55,0x6f,0x3c,0x0b,0x77,0x6a,0xc9,0x67,0x12,0x5e,0x65,0xd2,0x52,0xae,0xf2,0x86,0xe5,0x7c,0x36,0x32,0xe0,0x0f},
+    {0xc4,0x66,0x2d,0xf1,0x58,0x58,0x1a,0x94,0x51,0xee,0x4d,0x7b,0xf3,0x43,0x87,0x40,0xbe,0x3e,0x88,0xa6,0xe7,0x2e,0xdf,0x18,0xbd,0x27,0x38,0xd7,0xe0,0x90,0x03,0x7f},
+    {0xc4,0x84,0x56,0x38,0x52,0xcd,0x1b,0x8d,0x0d,0x9f,0x5a,0x5a,0xde,0xc7,0x0b,0x54,0x2d,0xbd,0x3c,0xfb,0xb9,0x3d,0x41,0x56,0xfa,0xcf,0x6c,0x9c,0x89,0xa9,0x65,0x82},
+    {0xc4,0x8c,0x02,0x8a,0x87,0xd8,0x32,0xde,0x78,0x20,0x96,0x16,0xec,0xe7,0x6c,0xaf,0xdf,0x75,0x1e,0xda,0x9e,0x8d,0xc8,0x92,0x60,0xf1,0xdd,0x64,0x0c,0xdd,0xa6,0xde},
+    {0xc4,0x9f,0x50,0xbc,0x7d,0x16,0x05,0xc8,0xe2,0x02,0x42,0x85,0x02,0x02,0x68,0x96,0x15,0x8f,0x96,0x53,0x2e,0x6a,0x8f,0x61,0x14,0xf3,0x93,0xdf,0xa5,0x47,0x8a,0x4d},
+    {0xc4,0xab,0x7b,0x6a,0xcb,0x16,0x3a,0xcf,0x38,0xda,0xcf,0x2f,0xd3,0xe5,0x64,0xdb,0x51,0xef,0x3e,0x3b,0x80,0x24,0x3b,0xb1,0x0c,0x6c,0xc7,0x7b,0x7a,0xdc,0xa6,0x58},
+    {0xc5,0x58,0xf8,0x7a,0xb1,0x35,0x8d,0xfe,0xca,0xe5,0x10,0x93,0x56,0x23,0x30,0x04,0x7e,0x44,0x86,0xfa,0x37,0xf6,0x5e,0x2d,0x32,0xfd,0xc6,0xd7,0x3a,0x65,0x5e,0xde},
+    {0xc5,0xaa,0xca,0xca,0x2d,0x02,0x9c,0x7d,0x6c,0xea,0x2b,0xbc,0x70,0x04,0xbe,0x3e,0x43,0x43,0x58,0xa8,0x3e,0xac,0xa9,0x7a,0xd5,0xc7,0x77,0xc4,0xf6,0xcd,0x9b,0x5b},
+    {0xc5,0xf3,0xaa,0xd6,0x68,0x35,0xeb,0x4c,0xa0,0x96,0x1b,0x37,0xaf,0xf4,0x12,0xcb,0x9e,0x6c,0x95,0xb1,0x9f,0x3d,0x01,0x46,0x45,0xe1,0x0d,0x3b,0x4e,0x4c,0x46,0x70},
+    {0xc6,0x0b,0x90,0x09,0x18,0xfd,0xe7,0xb2,0xa2,0x90,0x0a,0x88,0xb2,0xa9,0x1c,0x3c,0x9e,0x8b,0x03,0x8d,0xfe,0x2b,0x1b,0x8e,0xee,0xa1,0x8a,0x55,0xb4,0x39,0xe2,0x39},
+    {0xc6,0x70,0xa5,0x9f,0xac,0x3a,0x2a,0x24,0x5f,0xdb,0x6f,0x02,0x09,0xd1,0x77,0x67,0xe0,0xd9,0xd3,0x3c,0x9f,0xff,0x0b,0xe7,0x51,0x0e,0x99,0xff,0x33,0x73,0x48,0x13},
+    {0xc6,0x76,0xbd,0x9d,0x31,0xfb,0xb9,0xfb,0x31,0x95,0xf9,0xc5,0x86,0x3c,0x63,0x4e,0x05,0x73,0x0e,0xbd,0x16,0x2f,0xe6,0x7e,0x2a,0xe0,0xe5,0x9c,0x92,0x47,0x73,0x7a},
+    {0xc6,0x81,0x4b,0xf6,0xdc,0x21,0x80,0xc6,0xc1,0xcd,0x8d,0x6e,0x7c,0x84,0x93,0x10,0xd5,0x45,0xe1,0xa3,0x41,0x85,0xf8,0x9d,0x49,0x12,0xcd,0x92,0x5c,0x2b,0x29,0xc1},
+    {0xc6,0xd3,0xdb,0x74,0xae,0x00,0x8a,0x45,0x07,0xfa,0x82,0x90,0x10,0x54,0x14,0x50,0x0f,0x12,0xc0,0x02,0xf9,0x19,0xf2,0x2d,0x91,0x8f,0xd9,0x76,0xa6,0xe7,0xa5,0xa9},
+    {0xc7,0x3b,0x74,0x05,0xc9,0xd5,0x19,0x20,0x79,0x54,0xbb,0x38,0xd1,0xd3,0xab,0x4b,0x3d,0xff,0x96,0xf5,0x09,0x68,0xba,0x7a,0xfd,0x20,0x83,0x57,0x5b,0x7e,0x10,0xb4},
+    {0xc7,0x3b,0xa5,0x32,0x4d,0x8a,0x16,0xb9,0x96,0xc4,0x50,0xe5,0x24,0xf8,0xdc,0xe7,0xa2,0xa3,0x02,0xce,0x19,0xcb,0x8c,0xbb,0x3d,0xf4,0x3b,0x52,0x75,0xc7,0xd7,0x10},
+    {0xc8,0x04,0x6d,0x29,0x42,0xb0,0x7f,0x0b,0xe7,0x4d,0x83,0x5c,0x95,0x91,0x08,0x9d,0x8d,0x0d,0x3a,0x2c,0x7a,0xe1,0xfa,0xd5,0x41,0x1f,0x83,0x2b,0xfc,0x0d,0x93,0x2e},
+    {0xc8,0x2b,0xf6,0xf2,0x33,0xfe,0xb4,0x18,0x91,0x29,0xa6,0x8c,0xa4,0x16,0x97,0x2a,0xa6,0x29,0xf9,0x8c,0x5f,0x71,0x97,0xfe,0x76,0xb7,0x37,0xbf,0x11,0x20,0xf9,0x0c},
+    {0xc8,0x7b,0x3d,0x93,0xb2,0x20,0x9d,0x68,0xce,0xd4,0x47,0x0d,0x22,0xc9,0x76,0x42,0x73,0x2e,0x6c,0xb2,0x67,0x14,0x4b,0xd1,0x4c,0xbd,0xbd,0xf5,0x31,0xc0,0x0a,0x36},
+    {0xc8,0x87,0xc1,0xca,0x57,0xc8,0xa5,0x68,0xe1,0x9f,0xc1,0xca,0x3f,0xe7,0xb9,0x34,0xde,0xc2,0x4b,0xc5,0xf5,0x2a,0x31,0x9e,0x11,0x5a,0xfc,0xcd,0x68,0x0d,0x14,0x07},
+    {0xc8,0xb6,0x8a,0x06,0xcb,0x28,0x40,0x0b,0x26,0xc7,0x23,0x58,0x43,0x7c,0xef,0x59,0x8e,0xfd,0x11,0x0c,0x21,0xdf,0xcf,0xa7,0xdd,0x22,0x4d,0x44,0x62,0xc8,0x41,0x43},
+    {0xc9,0x35,0x65,0x51,0xf6,0xe8,0x74,0x2d,0x1a,0x3c,0x54,0x9b,0x74,0x09,0x6f,0xb5,0xe9,0x71,0x9d,0x7d,0x94,0x36,0xab,0x72,0x02,0xeb,0x1c,0xdf,0x21,0x2a,0x98,0x9c},
+    {0xc9,0x65,0x82,0x5c,0x16,0x30,0x7e,0x58,0xda,0x6c,0x6e,0x8e,0x0e,0xb5,0x1a,0x60,0x69,0x20,0x10,0xbb,0x9e,0xb7,0x92,0x6c,0xf9,0x80,0x49,0x17,0x97,0xf5,0xfc,0x84},
+    {0xc9,0xe2,0xb4,0x81,0x87,0x55,0xd5,0xd0,0x01,0x90,0x2d,0x39,0xab,0x89,0xe8,0x6d,0x98,0x24,0xc8,0x35,0x73,0x58,0xfb,0x81,0x4c,0xed,0xff,0x19,0xe2,0x4a,0x82,0x6e},
+    {0xc9,0xf6,0x78,0xaa,0x8e,0xec,0x56,0x2c,0x9d,0xa2,0x59,0x49,0xfb,0x70,0x89,0x71,0x35,0x74,0xbb,0x7a,0x18,0xbf,0xc8,0xc8,0xa4,0xd5,0x0a,0xaa,0x3e,0x74,0x82,0xa9},
+    {0xca,0x09,0x6b,0xe7,0xf8,0x6b,0x8d,0x40,0x17,0x96,0xe6,0x5a,0x58,0xc6,0xc5,0x19,0x30,0x00,0xec,0x67,0xfc,0xf4,0x94,0x7a,0x93,0xfa,0xbf,0x5f,0x1d,0xc1,0xa6,0xc2},
+    {0xca,0x0d,0x94,0x26,0x80,0xb4,0x8e,0x3e,0x76,0xc3,0xb0,0x85,0x56,0xd1,0x35,0x17,0xf3,0x41,0x73,0xc9,0x14,0x90,0x68,0xb8,0x31,0x6b,0xe5,0x86,0x2e,0x4e,0xb1,0x76},
+    {0xca,0x71,0x3f,0xc9,0xe4,0x5e,0x6f,0xe3,0x36,0x27,0x96,0x2a,0xb9,0x12,0x86,0x2e,0x0b,0xeb,0xde,0x3f,0x1c,0x6e,0xbb,0x31,0xed,0x38,0xe0,0x4f,0x4b,0x5f,0x52,0xd9},
+    {0xca,0x89,0xf8,0xc8,0x35,0x44,0xde,0x3c,0xef,0x9d,0xa3,0xf5,0x82,0x99,0x2e,0x94,0xe7,0x38,0xf0,0x06,0x98,0x4c,0xba,0xd4,0x0f,0x96,0xf4,0x93,0xf3,0x18,0x6c,0x3f},
+    {0xca,0x92,0xd7,0x2b,0x0d,0xc8,0x73,0x0e,0x2e,0xf4,0xc4,0xab,0x53,0x53,0x12,0x63,0x62,0xd7,0x44,0x4d,0x4f,0xc0,0x5f,0x25,0x14,0x45,0x3a,0xd6,0x16,0x2c,0xa4,0xd8},
+    {0xca,0xd9,0x85,0x58,0xdc,0x44,0x37,0xcb,0xdc,0x05,0x2f,0x1a,0x6b,0x52,0x98,0x3a,0xcb,0x4b,0xf5,0x5f,0xff,0x15,0x33,0x28,0x72,0x8e,0xd6,0x24,0x7f,0xda,0x12,0xbe},
+    {0xcb,0x37,0x9f,0xfb,0xfd,0xf7,0x02,0x0e,0xaa,0x14,0x68,0x00,0x38,0x73,0x1b,0xc6,0xab,0x38,0x39,0xfb,0xf7,0x0c,0x90,0xe2,0x54,0x3b,0xac,0x46,0xca,0x02,0x83,0x95},
+    {0xcb,0x8f,0x68,0xa8,0x82,0xd2,0x23,0xea,0xc8,0x14,0xe9,0xe5,0x81,0x40,0xf9,0x01,0xd7,0x4c,0xc5,0x08,0x7c,0x30,0x65,0xe3,0xf5,0x19,0xc2,0xc9,0x54,0x32,0x39,0x86},
+    {0xcc,0x48,0xde,0x5e,0x0c,0x27,0xc6,0x63,0xde,0xa3,0x83,0x6b,0xd2,0x1a,0x01,0xd3,0xd2,0x2f,0x0c,0xb3,0xc8,0xaf,0xdd,0x35,0x4f,0x49,0xab,0x51,0x04,0xc1,0x0e,0x11},
+    {0xcc,0x89,0x33,0x38,0xf6,0x2f,0x1a,0x87,0x0f,0x42,0xe3,0x5c,0x94,0x3a,0x3a,0x10,0x82,0x8c,0x82,0x30,0x8a,0x0e,0x51,0x75,0x3b,0xd0,0xa1,0x2a,0x84,0xbb,0xa2,0x64},
+    {0xcc,0xc0,0x91,0x74,0x43,0x6e,0xdd,0x9d,0x4e,0xc4,0x07,0x8e,0x94,0xff,0xd7,0xab,0x7a,0x7b,0x8c,0x3d,0x03,0x12,0x20,0xa9,0x49,0x41,0xf6,0x42,0x14,0x3a,0xa5,0xad},
+    {0xcd,0x99,0xbc,0x63,0x8e,0x66,0xf9,0x53,0xc3,0x14,0xf4,0x32,0x4e,0xc4,0x57,0x94,0xef,0xeb,0xa5,0xb1,0xce,0xe4,0xb3,0x3b,0xb4,0x84,0xd6,0x47,0x48,0xf6,0x6e,0x90},
+    {0xcd,0xf4,0xcb,0xc7,0x7a,0xe7,0x96,0xbd,0x51,0x6f,0x71,0xcd,0x6e,0x5b,0x5f,0x1a,0xad,0x52,0x69,0xb4,0x73,0x01,0x61,0x6f,0xbc,0x53,0x0f,0xdf,0x5c,0x9f,0x4a,0x6b},
+    {0xce,0x1c,0xa0,0x58,0x14,0xc5,0xdd,0x03,0x3f,0x3b,0x73,0x26,0x5e,0xde,0x4e,0x97,0x23,0x55,0xba,0x1d,0x1f,0xaa,0x13,0xf8,0xd2,0x94,0xac,0x23,0x41,0xa3,0x40,0xcf},
+    {0xce,0x38,0xd1,0x0d,0xb2,0x81,0x36,0x3f,0xd4,0x7b,0x6f,0xcf,0x20,0x59,0x2f,0x7f,0x2e,0xee,0xdc,0xa5,0x29,0x53,0xa7,0x98,0x68,0x91,0x84,0xb6,0x1d,0x30,0xa9,0x4e},
+    {0xce,0x46,0xc6,0xba,0xc1,0xff,0xe0,0x8b,0x87,0xd1,0xb1,0xfb,0x61,0xc8,0x55,0x68,0x26,0xc9,0xf8,0xa1,0x8a,0x9c,0x06,0x6a,0x7c,0xe1,0xaf,0x59,0x83,0x21,0x37,0x30},
+    {0xce,0xa1,0xdc,0x5d,0x70,0x4b,0x77,0x6f,0x7f,0x4e,0x9a,0x47,0xde,0x40,0x6d,0x39,0x91,0x96,0x5a,0x2b,0x16,0x3a,0x2b,0xbe,0xb4,0xcd,0xe4,0x9e,0x7a,0xb3,0xfc,0xe7},
+    {0xce,0xc5,0x0d,0x9d,0x33,0xbb,0xae,0x82,0x84,0xf8,0xb8,0x6c,0x29,0xbd,0x79,0xab,0x0c,0x1a,0xcd,0xf5,0x68,0x5a,0x5a,0x50,0x3f,0x03,0xca,0x7d,0x63,0x45,0x0b,0x02},
+    {0xcf,0xc1,0x11,0x88,0x5c,0xb6,0x83,0x49,0x89,0xec,0xeb,0x26,0xc0,0x60,0xd8,0x01,0x12,0x4e,0x8a,0xe6,0xe6,0xe9,0x35,0xff,0xc6,0x60,0xd5,0x1a,0xbc,0xe7,0xac,0x1b},
+    {0xd0,0x62,0x8d,0xb7,0x85,0x49,0x63,0x9e,0x54,0x91,0x10,0xb1,0xd4,0xd9,0xcd,0x37,0x1d,0xc0,0x38,0xbc,0x9d,0xbc,0xc2,0x37,0x51,0x4f,0x8d,0x23,0xc1,0x66,0x44,0x36},
+    {0xd0,0x70,0x05,0x16,0x63,0xa7,0x87,0xd8,0x5c,0x38,0xb9,0x78,0xcf,0x3d,0x48,0x4d,0x42,0x53,0x99,0x07,0x8c,0x45,0x3b,0x9e,0x39,0x2a,0xed,0x77,0x61,0xf8,0xf9,0x4d},
+    {0xd0,0xc8,0x1d,0x06,0xb5,0x10,0x39,0xd4,0x33,0x45,0x13,0xc0,0xd4,0x1a,0x8e,0x64,0x60,0x3f,0xd7,0x96,0xe0,0x54,0x5c,0x87,0x11,0xd7,0x26,0x25,0xe0,0xac,0x78,0x34},
+    {0xd0,0xf2,0xa6,0xc3,0xde,0xb1,0x24,0xb0,0xc3,0xdf,0x63,0xf3,0xb6,0xf0,0x5c,0x8c,0xad,0x27,0x93,0xfa,0x84,0x17,0x4b,0xc3,0x09,0x2d,0x94,0x49,0x55,0x89,0x06,0xdd},
+    {0xd1,0x33,0xa2,0x2a,0xa3,0x1d,0x44,0x1f,0xed,0x35,0x73,0x52,0x39,0xf5,0x26,0x74,0x15,0x92,0x23,0x47,0x6b,0x5c,0x09,0xd4,0x15,0xb3,0xce,0x48,0x2c,0xb9,0x13,0x1b},
+    {0xd1,0x89,0x2e,0x66,0x28,0xc4,0xf1,0xcd,0x7a,0x71,0x9a,0xff,0xdf,0x03,0x80,0x1c,0x67,0x70,0xc6,0x35,0x13,0x59,0xfc,0xd4,0xcb,0x84,0x65,0xef,0xca,0xf7,0x19,0x5b},
+    {0xd1,0x96,0x7b,0x54,0xfd,0x3d,0x2f,0xe7,0xf7,0x55,0x71,0x9c,0x4a,0xdf,0x4f,0xb7,0xf8,0xb4,0xce,0xcf,0xf5,0x22,0xf8,0xca,0x4b,0x0b,0xf1,0xf7,0x6a,0x7d,0xd5,0xcf},
+    {0xd1,0xd0,0x42,0x44,0x00,0x5b,0xe9,0x3c,0xef,0xf2,0x2f,0xab,0x72,0x63,0xb5,0x34,0x6f,0xb9,0xea,0x48,0x89,0x00,0xc5,0x9d,0x35,0xc9,0xad,0xe9,0xe0,0x1f,0x98,0xe0},
+    {0xd2,0x02,0x6f,0x49,0xc3,0xc8,0x1d,0xc6,0xca,0x03,0x51,0x00,0x5e,0xbb,0x4f,0xbf,0x21,0x9e,0xf9,0x23,0x9d,0x1a,0xa3,0x6a,0x7c,0x5d,0x31,0x30,0x48,0x47,0x35,0xb2},
+    {0xd2,0x73,0xb0,0xff,0xaa,0xd4,0x54,0x68,0x0e,0x46,0xff,0xa0,0xb1,0x76,0x31,0xea,0xad,0x6c,0x30,0x14,0xa4,0x48,0x9c,0xa0,0xde,0xff,0x1b,0x5a,0xd5,0x4f,0x0e,0x13},
+    {0xd2,0xa5,0x01,0xb9,0x82,0x44,0x34,0x56,0x81,0xcc,0x7f,0x06,0x25,0xcd,0xfd,0x4c,0x24,0xed,0x86,0xa5,0xbd,0xf7,0xed,0xe9,0x96,0x1c,0x67,0xea,0xac,0x63,0x6d,0xf0},
+    {0xd2,0xac,0x72,0x58,0xf9,0x69,0x99,0x08,0xfb,0x81,0xcf,0x14,0xf1,0x1f,0x6c,0x8d,0xb1,0x06,0x40,0x36,0x94,0x0f,0x9d,0x0a,0xf5,0xe6,0xbb,0xdd,0x01,0x1a,0xa8,0xfa},
+    {0xd3,0x27,0x9c,0x43,0xd7,0x47,0x72,0x21,0xe1,0x76,0x58,0x50,0x99,0xfe,0xe0,0xdc,0xb0,0xf9,0xa6,0x96,0xa4,0x8e,0xa8,0x7c,0x0e,0x85,0x00,0x25,0xae,0x95,0x50,0x8a},
+    {0xd3,0x71,0x9d,0x78,0xe9,0xde,0x40,0xf4,0x65,0x1f,0xf1,0x5e,0xda,0x68,0xac,0x1c,0x85,0x07,0xa5,0x8e,0xa0,0x34,0x53,0x89,0x3a,0x1a,0xfc,0x1e,0x30,0x4e,0x19,0x3e},
+    {0xd3,0x90,0xe8,0x46,0xb2,0xbc,0x45,0xa8,0xd6,0xe9,0x74,0x99,0xaa,0x3e,0x68,0x3d,0xd3,0x8f,0x71,0xd8,0x10,0xc3,0x23,0x7f,0x5b,0x13,0x2a,0x9c,0x31,0xb8,0x60,0xaf},
+    {0xd4,0x31,0x92,0x25,0x0b,0xe0,0x61,0x69,0xb1,0x6a,0xc3,0xfc,0x35,0x44,0x81,0x0e,0x9b,0x43,0x4c,0xc2,0xca,0xa5,0xc9,0x5a,0x45,0x49,0x8c,0x5a,0xae,0xef,0xd9,0xe6},
+    {0xd4,0xf0,0x4c,0x03,0xdb,0xf7,0x92,0x0a,0x7b,0x40,0xb3,0xd6,0x8a,0xe3,0x74,0x84,0xd0,0x56,0x17,0xf8,0x5e,0xcc,0x53,0x02,0xd2,0xb9,0x47,0xe4,0x13,0x9d,0x40,0x60},
+    {0xd4,0xfc,0xb3,0x89,0x19,0xa4,0x46,0x96,0x5a,0xdd,0x33,0x49,0xc9,0x06,0xe3,0xc2,0x50,0x6d,0x37,0x08,0xbe,0x10,0x4f,0x9c,0xeb,0x49,0xba,0x9d,0xd9,0xe6,0x19,0x9f},
+    {0xd5,0x67,0xbe,0xd9,0x55,0x5f,0xd2,0x7d,0x0a,0xe9,0xfc,0xaf,0x3d,0xb7,0x0e,0x2a,0xdb,0x95,0x08,0x31,0xfd,0xe8,0x3a,0x07,0x1e,0xb3,0xc7,0xa9,0x37,0xd8,0x80,0xef},
+    {0xd6,0xb7,0x2e,0x10,0xc4,0x45,0xfc,0x5c,0xa4,0x00,0xb5,0x78,0xfe,0x65,0xd6,0x77,0x2c,0x92,0x83,0x1b,0xe9,0xb6,0x40,0x97,0x38,0x11,0x74,0xdb,0x49,0xff,0x0e,0x0e},
+    {0xd6,0xdf,0x4e,0x7a,0xe1,0xd7,0xa9,0x5e,0x03,0xe9,0xe9,0x54,0xad,0x0b,0x41,0x30,0x68,0x7e,0xe2,0xf7,0x23,0x73,0xc8,0x2e,0xee,0x1f,0x6e,0x3b,0x22,0xfc,0xdd,0x42},
+    {0xd6,0xf9,0x4d,0x9c,0xc5,0x89,0xc9,0x15,0x75,0x3a,0xc0,0x2d,0x24,0x3e,0x16,0x83,0x52,0x1d,0x01,0x29,0x0e,0x3e,0x6f,0xef,0xb1,0x52,0x93,0xa0,0xa3,0x73,0xfc,0x3b},
+    {0xd7,0x5b,0x30,0x9c,0x0b,0x6c,0x1b,0x6c,0xcc,0x99,0xee,0xdb,0x54,0x0a,0xd3,0x8c,0xfe,0x46,0x87,0xd8,0x0d,0x92,0xce,0xbd,0xa2,0xe9,0x34,0x98,0x42,0x95,0x08,0x5f},
+    {0xd7,0x5d,0xcc,0xd1,0x1c,0x17,0x77,0xa2,0x3d,0xeb,0x8d,0x54,0x1d,0x73,0x06,0x59,0xd7,0x5c,0x67,0x6e,0x64,0xe7,0x13,0xb8,0xd4,0xc5,0xfb,0xd6,0xa5,0x50,0x3c,0x5b},
+    {0xd7,0xbd,0x30,0xce,0xc6,0x52,0xb6,0x8a,0xe5,0x85,0x79,0x42,0x77,0x2c,0xf0,0xb3,0x01,0x31,0x61,0xa5,0x8a,0x66,0xbf,0x17,0xf9,0xfb,0xcc,0x24,0xa4,0x14,0x61,0xe0},
+    {0xd8,0x7e,0x88,0x99,0x9a,0xdd,0xaf,0x2d,0x4f,0x28,0x33,0xea,0x12,0x62,0x50,0x1c,0x48,0x1b,0x47,0x10,0xb3,0x58,0xc9,0xc9,0xd7,0xdc,0x2a,0x52,0x4f,0xc6,0xce,0x56},
+    {0xd8,0xc1,0x7a,0x98,0xcb,0xc4,0x5a,0x24,0x1d,0x0b,0x61,0x7b,0xe2,0x0b,0x4a,0x2a,0x05,0xe0,0x32,0xca,0xb3,0x70,0xb8,0xc4,0x00,0x98,0xd1,0x9e,0x6f,0x27,0x82,0xac},
+    {0xd9,0x5b,0xd7,0xd0,0xb6,0xff,0xa5,0x5c,0x27,0xa2,0x0a,0x0f,0x78,0x91,0x45,0x90,0x81,0x61,0x16,0x76,0x1f,0x02,0x2d,0x53,0x93,0xda,0x74,0x90,0x26,0xf5,0x91,0x02},
+    {0xd9,0xcf,0xad,0x07,0x88,0x10,0xda,0x0b,0x21,0x95,0x38,0x24,0x9e,0x24,0xd1,0x02,0xf8,0xd2,0xdc,0xb7,0xd0,0x54,0xfc,0xb9,0xc9,0xed,0x4a,0x9e,0xd1,0x56,0x8c,0x24},
+    {0xd9,0xfa,0x52,0x3f,0x7c,0xb0,0x63,0xcb,0x4e,0x89,0x5c,0x34,0x46,0xc4,0x62,0xaa,0x85,0xcf,0xe9,0x8b,0xc3,0xa0,0xae,0x01,0xed,0x84,0x72,0x74,0x2c,0xeb,0xc2,0x28},
+    {0xda,0x8c,0x0e,0x94,0x71,0xe2,0x4d,0xb8,0x2e,0x18,0x6e,0x83,0x26,0x94,0x36,0x30,0x0e,0x2c,0xd1,0x67,0x0b,0x69,0x54,0x50,0x59,0x10,0xd1,0xff,0x21,0x48,0xc0,0x3a},
+    {0xda,0xa7,0x77,0x39,0x2d,0x9b,0xe1,0x53,0xdc,0x5f,0x5c,0x08,0x55,0x5a,0x92,0x1a,0xd4,0xa3,0x46,0xb5,0xe9,0xa4,0x27,0x41,0xc2,0x4d,0x34,0x8a,0x20,0xbb,0x28,0x64},
+    {0xda,0xdb,0xf9,0x36,0x32,0x49,0x51,0x5a,0xb8,0x42,0x4d,0x0d,0xfb,0x64,0x7f,0x90,0x07,0x2f,0x38,0xfa,0xc9,0xb3,0x39,0xd7,0x75,0x99,0xdd,0x72,0x00,0x1d,0x79,0x96},
+    {0xdb,0x4c,0x11,0xdf,0x45,0x84,0x21,0xc4,0x83,0x14,0xf9,0x7e,0x46,0xe2,0x63,0x62,0x54,0x19,0x46,0xc6,0x64,0xf4,0xd1,0x32,0xc8,0x9c,0x2a,0xfd,0xbe,0xab,0xd8,0x9c},
+    {0xdb,0x58,0x51,0x82,0x66,0xb6,0x96,0x82,0x4c,0x2b,0xbb,0x37,0xf7,0x84,0xb0,0x55,0xc5,0x76,0x39,0xc3,0xd2,0xc3,0xc0,0x48,0xb9,0x9f,0x66,0x50,0x76,0x81,0x9c,0xac},
+    {0xdc,0x14,0x8a,0x8a,0xec,0xce,0xbf,0x08,0x31,0x04,0x54,0x5a,0xf8,0xf3,0x10,0x25,0x5d,0x47,0x5e,0xae,0xb9,0x7c,0xfd,0x23,0xf1,0x29,0x06,0x65,0xb0,0x80,0x49,0x85},
+    {0xdc,0x3a,0x78,0xd5,0x29,0xcc,0xc9,0x62,0xef,0x5e,0xaf,0x17,0x1a,0x38,0xbc,0x2a,0x5e,0x07,0x69,0x08,0x5d,0x00,0x8a,0xb0,0x26,0x25,0x51,0xa6,0x35,0xd2,0x54,0xc8},
+    {0xdc,0x54,0x62,0x53,0xc2,0xbd,0x16,0x9b,0x25,0xf6,0x86,0xde,0xe4,0xf2,0xc9,0x01,0x8b,0x33,0xf4,0x03,0x0a,0xb1,0x6d,0x75,0x7e,0x05,0x47,0x5d,0x28,0xc0,0x56,0xcf},
+    {0xdc,0xb7,0x94,0x3a,0x4c,0x13,0x6f,0x35,0xf5,0xba,0xc5,0x0d,0xdf,0xe0,0x7b,0x25,0x34,0xa9,0x70,0x27,0x58,0xe8,0x10,0xa9,0x4a,0x97,0x16,0x20,0xfb,0x0b,0x70,0x33},
+    {0xdc,0xd9,0x63,0x75,0xa9,0x26,0x50,0xeb,0xe3,0x36,0x91,0x04,0x84,0x97,0x13,0xda,0x45,0x85,0x60,0x62,0xb4,0x70,0xd1,0x31,0x7a,0x73,0x87,0xde,0xf6,0x36,0xba,0x98},
+    {0xdc,0xfd,0x8f,0x94,0x86,0x3b,0xb2,0xe3,0xc1,0x4f,0xbb,0xb4,0x99,0x33,0xe6,0x3b,0xfe,0xa2,0x3f,0x37,0xc9,0xbf,0x10,0xbe,0xea,0x20,0x3e,0x6c,0x6f,0x48,0xba,0x21},
+    {0xdd,0x43,0x1f,0x57,0x46,0x9d,0x66,0xc2,0x63,0xf0,0x93,0x16,0x29,0x26,0xc0,0x48,0xd9,0xf6,0x81,0x10,0x74,0x7b,0x55,0x01,0xcb,0x06,0x12,0xdc,0x9d,0x9f,0xaf,0xff},
+    {0xdd,0x47,0x00,0x41,0x20,0x98,0x79,0x42,0xad,0x35,0x9e,0xd4,0xfc,0x03,0x45,0xb5,0xcd,0x7c,0xfe,0x6a,0x05,0x94,0x37,0x65,0x35,0xd2,0xbd,0x0c,0x76,0xb1,0x86,0xf7},
+    {0xdd,0xe6,0x0f,0x96,0x1c,0x5a,0xc5,0x6c,0x35,0x91,0x54,0x25,0xd4,0x4f,0x50,0x2a,0x5c,0x8d,0x04,0xd9,0xab,0x88,0xa7,0x3d,0x74,0x84,0xdb,0x0b,0x8b,0x64,0xde,0xb3},
+    {0xde,0x4a,0x43,0x99,0x92,0xd6,0x2a,0x27,0x01,0x54,0x52,0xdd,0x68,0x13,0x0d,0x34,0x1c,0x5d,0x34,0xae,0xb9,0x93,0x55,0xec,0xf4,0x1f,0x4c,0xb4,0x4a,0x67,0xee,0x06},
+    {0xde,0x6f,0x5f,0xc9,0x0e,0x73,0xcc,0x46,0x08,0x1b,0xcc,0xe9,0xe9,0x50,0x4c,0x4f,0x82,0xaf,0x02,0x70,0x8a,0x49,0x5d,0xf9,0x0b,0xcc,0x20,0x47,0xe2,0xaf,0xa0,0x71},
+    {0xde,0x9a,0x20,0x68,0x56,0x4e,0xc3,0x8f,0x6c,0x3f,0x29,0xe7,0x8d,0x44,0x62,0x1c,0x73,0xf9,0x46,0xfd,0xc5,0x9a,0x1c,0xbe,0x06,0x95,0xf5,0x1e,0xde,0x4a,0xc1,0x5f},
+    {0xde,0xd9,0x1b,0x9d,0x68,0x16,0x0f,0xc8,0x6e,0x59,0x93,0x97,0x78,0xe5,0xae,0xdf,0x38,0x73,0x35,0xea,0xc6,0xfa,0x6d,0xc8,0x01,0x06,0x93,0xe7,0x5e,0xd7,0x7d,0x1a},
+    {0xdf,0x12,0xb6,0xcb,0x34,0x35,0x1e,0xdf,0x97,0x99,0x12,0xd7,0x8f,0x00,0x9b,0xaa,0xf9,0x45,0xac,0x7f,0x06,0xef,0x03,0xf6,0xd3,0x10,0xd9,0x45,0x8c,0x50,0x22,0x67},
+    {0xdf,0x9a,0x77,0xa0,0x42,0x4c,0x27,0x30,0xde,0xca,0x23,0x54,0xa8,0x14,0xec,0xdc,0xb6,0x9b,0x98,0xdd,0x38,0x6d,0xe2,0x5d,0x4f,0xa7,0xf6,0x77,0x37,0xba,0xdd,0x06},
+    {0xdf,0xba,0xcd,0x92,0xb5,0x71,0xf0,0xdd,0xcb,0xc2,0xb0,0xd1,0xda,0x54,0x50,0x20,0xd3,0x96,0x21,0xe1,0x86,0xac,0xf0,0xbe,0x26,0x91,0xcc,0x87,0xd6,0xc0,0xa8,0xbe},
+    {0xdf,0xf5,0xc1,0xdd,0x23,0x62,0x84,0xee,0x8d,0x12,0x81,0x23,0x3f,0x4e,0x58,0x6e,0xb3,0x6d,0xf6,0xe4,0x18,0xa9,0xa9,0x65,0x45,0x61,0xcf,0xa8,0x47,0x77,0xcd,0x47},
+    {0xe1,0x93,0x54,0xd1,0x60,0x08,0x18,0xcb,0x98,0x4c,0x86,0xfd,0xb2,0xc8,0x7e,0xa9,0x99,0x94,0x72,0x0c,0x6c,0xc8,0xa1,0x25,0xe3,0x0c,0x35,0xec,0xe4,0x44,0x32,0x0c},
+    {0xe2,0x26,0x4d,0xd0,0x92,0x04,0x7f,0x09,0x67,0x6e,0xf0,0x95,0x1b,0x9f,0x07,0x7f,0x03,0x3b,0xa9,0x0c,0x50,0x3d,0x8c,0xbb,0x41,0x99,0xc8,0x17,0xaf,0x1c,0xf5,0xda},
+    {0xe2,0x6e,0x3a,0x90,0xe8,0x01,0x1a,0x27,0xc0,0x05,0x76,0x4b,0xc3,0xf4,0x3f,0xb4,0xb9,0x1d,0xd0,0xa8,0xb8,0x2a,0xed,0xe1,0x06,0x66,0x4a,0x47,0x9f,0x00,0x3e,0xeb},
+    {0xe2,0xa4,0x1d,0x29,0x3b,0x03,0x46,0x79,0x69,0x06,0xf9,0xdf,0x55,0x5b,0x66,0x07,0x43,0x28,0x16,0x00,0x4e,0x18,0xb9,0x31,0x2d,0x0e,0xa6,0x94,0x2b,0x1a,0xa7,0xa8},
+    {0xe2,0xd3,0x58,0xbc,0xfa,0xc3,0xe0,0xd1,0x6b,0xcc,0xcb,0x68,0x32,0x83,0x02,0x36,0x3b,0x3c,0x7b,0x2c,0xfd,0xa3,0x08,0xff,0x18,0x5a,0x15,0x6a,0xf2,0x4c,0xfd,0x53},
+    {0xe2,0xec,0x1d,0x9a,0xfd,0x0d,0xa9,0x83,0x0f,0x11,0xdf,0x9f,0x3d,0x05,0x5a,0xd7,0x36,0xda,0x8e,0xcc,0xfe,0x9f,0x33,0x8d,0x15,0x11,0xae,0xd2,0x5a,0x16,0xa4,0xd5},
+    {0xe3,0x4a,0xc9,0xf9,0x9b,0x9c,0x32,0xdf,0x29,0x37,0x5d,0x00,0xd3,0x41,0x49,0xfc,0x96,0xd9,0x98,0xfe,0x63,0xb9,0x32,0x9f,0xbc,0xa2,0xea,0x41,0x9f,0x42,0x20,0x6a},
+    {0xe4,0x02,0x6d,0xd9,0xb9,0xad,0xb5,0xa0,0xb1,0xee,0xdf,0x29,0x26,0x90,0xb2,0x47,0x23,0x70,0xba,0xfe,0xde,0x92,0x16,0x4f,0x3b,0x3f,0xc4,0x7d,0x13,0x42,0x0c,0xef},
+    {0xe4,0x5d,0xd4,0xe1,0x6f,0xcc,0x02,0xe1,0x38,0xb0,0xfa,0x1a,0x0f,0x0e,0xfb,0x06,0x5e,0x66,0x0a,0xff,0x3d,0xda,0xdf,0xbd,0x4c,0x7e,0x0f,0x82,0x45,0x38,0x7a,0x4d},
+    {0xe4,0xb5,0x76,0x74,0xcc,0x10,0x02,0xde,0x43,0x9a,0xf1,0x09,0xa5,0x12,0x29,0xd8,0xf4,0x4a,0x63,0x3f,0x08,0x52,0xbd,0x7a,0x8c,0xa1,0xc9,0x36,0x91,0x6a,0x23,0xa2},
+    {0xe6,0x06,0xa5,0xd7,0xda,0x17,0x19,0x50,0xa6,0xa3,0xe3,0x68,0x37,0xd8,0xf8,0xbc,0x5e,0xf8,0xfc,0xca,0x93,0x14,0xc6,0x74,0xd6,0x70,0x32,0x02,0xc4,0x71,0x12,0xda},
+    {0xe6,0x20,0x17,0x74,0xfc,0x5e,0x48,0x28,0x61,0xab,0x10,0x45,0x31,0xf5,0xed,0x73,0x9d,0xe2,0xa6,0x0c,0xae,0x19,0x29,0x55,0x30,0x73,0xb3,0x1a,0x86,0xf3,0xcf,0xbf},
+    {0xe6,0x20,0xdf,0x77,0x84,0x2f,0xa3,0x21,0xbf,0x9b,0xf1,0x86,0x5d,0x6e,0xf4,0xb1,0xc9,0xf8,0x12,0x12,0xd1,0x0d,0xe0,0xcb,0xbb,0x2b,0xa1,0x37,0x19,0x09,0x1a,0x1b},
+    {0xe6,0x2c,0x56,0x83,0x0d,0xd7,0x68,0x27,0x14,0xcb,0x76,0x70,0xd4,0xe9,0x9b,0xe1,0xd7,0x5f,0xb8,0x06,0xd9,0x5b,0x96,0x7f,0x8d,0xf2,0xe6,0x42,0x22,0x47,0x91,0x79},
+    {0xe7,0xa3,0x52,0x32,0xe9,0xee,0x6e,0x3f,0xb6,0xf6,0x80,0x8a,0x9b,0x9e,0xc1,0x2e,0x0f,0x0d,0x73,0x24,0xb4,0xa1,0x0c,0x7d,0xd2,0x0f,0xda,0x2b,0xf0,0x31,0x7d,0x28},
+    {0xe8,0x2a,0x15,0x59,0x87,0x5d,0x7e,0xd3,0x4b,0x87,0xf6,0x0e,0xb2,0xcc,0x4a,0x76,0x1d,0xd2,0x99,0x99,0x3e,0xbb,0x95,0xc6,0xe1,0x62,0x24,0xe4,0x88,0x45,0x7d,0xcb},
+    {0xe8,0x7f,0x14,0xee,0xe7,0x08,0xef,0x74,0xeb,0xa9,0x00,0x34,0xa9,0x92,0x6a,0x97,0xb1,0x8a,0xe1,0x66,0x1e,0x34,0x15,0xcd,0xb7,0x6b,0x75,0x60,0x15,0x4e,0x99,0x49},
+    {0xe8,0xa2,0xa2,0xf0,0xa7,0x94,0x2c,0x41,0x71,0x42,0x85,0xc0,0xc5,0x59,0xee,0x1b,0x7c,0x77,0x3b,0x37,0x72,0x56,0x44,0x46,0x88,0x8f,0x56,0x89,0xad,0x3a,0x53,0x0d},
+    {0xe8,0xc4,0x2d,0x42,0xd7,0x62,0x7c,0x73,0x6a,0x89,0xd3,0xfe,0x79,0x13,0xda,0x2e,0x7a,0x0a,0x87,0x73,0xfb,0x76,0x7b,0xd7,0xe3,0x74,0x44,0x98,0xeb,0x6c,0x18,0xf4},
+    {0xe8,0xe3,0x97,0x43,0x2c,0x5b,0xbf,0xc4,0xfe,0xc9,0xf5,0xb6,0x67,0xe5,0xed,0xbf,0xc5,0x3d,0x17,0x0a,0x5e,0x43,0xd3,0xcf,0x07,0xea,0xd5,0xbf,0x79,0xa5,0xd5,0x78},
+    {0xe8,0xee,0x26,0x9e,0xdb,0x37,0xec,0xf8,0xbd,0xf4,0xf8,0x25,0x2a,0x5a,0xe8,0x5d,0xd1,0xb1,0xc8,0x5e,0x32,0x61,0x01,0x3b,0x97,0xe5,0x3a,0xac,0xf3,0xc1,0xb3,0xb1},
+    {0xe8,0xf1,0xc5,0x37,0xd9,0x16,0xa3,0xcd,0x5a,0x81,0xe4,0x22,0x21,0x88,0x19,0x45,0xfd,0xfc,0x79,0x93,0xf2,0xa1,0xfd,0xd3,0x81,0xa8,0x66,0x78,0x70,0x33,0xae,0x0b},
+    {0xe9,0x4d,0xd4,0x85,0x81,0x21,0xd1,0x48,0xc0,0x92,0xb7,0x0c,0x77,0xf0,0x4a,0x13,0xc5,0xc6,0xa1,0xdc,0xbd,0xec,0xe7,0xf2,0x41,0x57,0x0c,0xc6,0x98,0x9c,0xfd,0xc2},
+    {0xe9,0x68,0x42,0x82,0x36,0x7e,0x0e,0x58,0x7f,0x62,0xe8,0x87,0x23,0x9d,0xd7,0xc1,0x56,0x40,0x04,0x85,0xaa,0x86,0xe5,0xc7,0xa3,0x0f,0x28,0x3a,0x00,0x7c,0x56,0x76},
+    {0xe9,0xeb,0x9e,0x56,0x0e,0x11,0x89,0x95,0x4b,0xb9,0x06,0xa1,0xbf,0x77,0xb7,0x25,0x65,0x86,0x47,0xae,0xfa,0x7a,0xbc,0x13,0x6b,0xa8,0x47,0xbe,0x5d,0x8e,0x7b,0x71},
+    {0xea,0x9b,0xee,0x59,0xa0,0xa2,0x4d,0x60,0xd2,0xc3,0xe1,0xff,0x99,0xb3,0xe2,0x81,0x12,0x0d,0x8e,0x54,0xb9,0xa8,0x60,0x20,0xdc,0xc5,0x8e,0x81,0x8d,0x3e,0xfd,0x34},
+    {0xea,0xdf,0x7e,0x54,0xca,0x02,0x09,0x5c,0x93,0x5e,0x77,0xfd,0x0e,0x5f,0xc3,0xcd,0x71,0xf1,0x82,0xda,0x96,0x2f,0xfc,0xe6,0x0a,0x26,0x63,0x62,0xe9,0xb9,0xfd,0x12},
+    {0xeb,0x56,0xce,0x3e,0xc2,0xfd,0x7c,0x06,0x8b,0xf4,0x7b,0x5d,0x35,0x35,0xa4,0xff,0x6d,0x9b,0x31,0x2e,0x8c,0xd4,0x52,0xf0,0xf3,0x1d,0xf3,0x37,0x88,0xff,0x5b,0x08},
+    {0xec,0x0c,0x0b,0x76,0x85,0x23,0x12,0x2c,0x04,0xc2,0x25,0x3f,0x37,0xa4,0x27,0xba,0x2d,0x5d,0xab,0x23,0x57,0xb9,0x08,0x99,0x42,0xa0,0x12,0xfc,0xde,0x87,0xf2,0xe1},
+    {0xec,0x3e,0x01,0xab,0xfc,0x89,0x5e,0x73,0xeb,0x9b,0x77,0xac,0x07,0x05,0xe4,0xb0,0x25,0x4d,0xf5,0x0e,0xb3,0x0e,0xef,0x90,0xc6,0x46,0x09,0x57,0x82,0xdb,0xcb,0xb7},
+    {0xec,0x93,0x02,0xff,0xee,0x78,0x08,0xc4,0x04,0xb5,0xef,0x77,0x1a,0x98,0xd7,0x7a,0xad,0xcc,0x63,0xf3,0x17,0x41,0x92,0x88,0x09,0x5f,0xf6,0x28,0x20,0x09,0x26,0x85},
+    {0xed,0x7b,0xef,0x3d,0xa7,0xfb,0xcc,0x25,0x18,0xf2,0x02,0x97,0xbb,0x04,0x56,0x89,0xbc,0x02,0xa8,0x7b,0xc3,0xbf,0xb1,0x72,0x09,0x3e,0xd1,0x76,0xcc,0x84,0x35,0xf4},
+    {0xed,0x93,0x98,0x36,0x22,0x47,0x7c,0xbe,0xaa,0x1a,0xce,0x6a,0xb9,0xfe,0x1d,0x6e,0x61,0x88,0x05,0xc8,0xa4,0x9e,0x9c,0x2e,0xcb,0x04,0xf3,0x18,0x0d,0xc2,0xe5,0xf0},
+    {0xee,0x29,0xb9,0xb4,0xe0,0x2c,0xd9,0x68,0x40,0x14,0x84,0x85,0x4c,0xbd,0x54,0x61,0x41,0xbd,0xdb,0x79,0x6c,0x59,0xdd,0x28,0x0d,0xcf,0x17,0x4e,0x9e,0x94,0xc9,0x8d},
+    {0xee,0x46,0xaf,0x62,0x4c,0x4c,0xac,0x9a,0x70,0x03,0xad,0xd8,0x46,0x1a,0x35,0x3a,0x36,0xb6,0x31,0x94,0x24,0x11,0x31,0x17,0x0c,0xfa,0xb4,0x4a,0x9c,0x5d,0x31,0x03},
+    {0xee,0x57,0x3d,0x55,0x4b,0x1d,0xf2,0x10,0x3f,0xa3,0x76,0xce,0x45,0x3c,0x36,0x2b,0x79,0xf6,0xbb,0x74,0xe0,0xf4,0xbc,0x63,0xa8,0x5a,0x2f,0x1b,0x45,0x4f,0xa4,0x69},
+    {0xee,0x71,0x92,0x5b,0x88,0x32,0x85,0xbc,0xa2,0xa1,0x13,0x6c,0xa8,0xbe,0x0b,0xb6,0x8e,0x6a,0x86,0x67,0x82,0x79,0x4a,0x92,0xd1,0x3c,0x09,0x17,0x88,0x0b,0x42,0x75},
+    {0xee,0x7d,0x37,0x5c,0xd6,0x8c,0x20,0xb6,0x42,0x39,0x62,0xfd,0x09,0x80,0xf1,0x9d,0x2c,0x04,0x48,0xeb,0x12,0x5f,0xed,0x2d,0xf2,0x0b,0x33,0x9e,0xa5,0xb9,0xf6,0x72},
+    {0xef,0x58,0x7b,0xb7,0x6c,0xed,0xaa,0xb3,0xad,0x63,0x14,0xbf,0x54,0x67,0xca,0xaa,0x12,0x6b,0xa4,0x84,0x12,0x26,0x5a,0xe7,0xe6,0xec,0x98,0x98,0x9a,0xfd,0xcc,0x6d},
+    {0xef,0x79,0xaf,0x5b,0x02,0x76,0x92,0xdb,0x14,0x33,0x56,0x0c,0x2c,0xc3,0xb4,0x4a,0x85,0x39,0x84,0xeb,0x5a,0xa3,0xfb,0x4f,0x63,0x8c,0x3a,0x30,0x6f,0x8c,0x0b,0x15},
+    {0xef,0x99,0x61,0x4d,0x32,0x96,0x75,0xc1,0xf4,0xc2,0x34,0x8e,0xa4,0x7b,0x6c,0x5d,0x6a,0xe7,0xa7,0xe0,0x9a,0x2b,0xd3,0xaf,0xd6,0xd4,0x4b,0x0d,0x5f,0xed,0x87,0xd0},
+    {0xef,0xdb,0x19,0x86,0xfb,0x60,0xb6,0x17,0x6b,0x42,0x73,0x57,0x50,0x40,0x57,0x59,0xea,0x47,0xce,0xc6,0x77,0xac,0xca,0xcd,0xb7,0xcc,0x16,0x4c,0xb2,0xa2,0x26,0xc7},
+    {0xf0,0x22,0x33,0xdc,0xfc,0x65,0xd5,0xb4,0x38,0xee,0xef,0x83,0x1a,0x79,0x03,0x78,0x0e,0x26,0x3a,0xec,0x4f,0x58,0x35,0x79,0xf6,0xe3,0xfc,0x62,0xd2,0x31,0x18,0x27},
+    {0xf0,0x88,0x34,0xc3,0xf7,0x46,0x93,0x6b,0xd0,0x68,0x8c,0x6f,0x32,0x67,0x89,0xf3,0x52,0x99,0xa7,0x97,0x8a,0x1a,0x45,0xd6,0x9c,0x85,0xbb,0x40,0xea,0xcc,0x08,0x19},
+    {0xf0,0xef,0xcb,0xb8,0xdd,0xdf,0x13,0x14,0x09,0xc9,0x18,0x7c,0x7c,0xbe,0xb8,0xb6,0x2e,0x5a,0x4a,0x2a,0x45,0xdc,0x0a,0x1a,0xbb,0xdd,0x9f,0x6c,0xcd,0xd3,0x5c,0x1f},
+    {0xf1,0x86,0x9e,0xb5,0x11,0x24,0x8a,0xde,0x61,0x34,0x9c,0xda,0xab,0xed,0x24,0x6b,0x0c,0x3c,0x0c,0x33,0x70,0x87,0x76,0x22,0xe5,0x83,0x1b,0x5d,0x8a,0xf2,0x0c,0xee},
+    {0xf2,0x36,0xaa,0xad,0xce,0x7b,0xd4,0xf9,0x96,0xd3,0xd9,0xa1,0x1d,0xd5,0x27,0x04,0x25,0x62,0xde,0xca,0xe4,0xfb,0xd4,0x7a,0xe9,0x4f,0x75,0x4f,0xc6,0x08,0x3d,0x9d},
+    {0xf2,0x4d,0xdd,0xcc,0x14,0x5a,0x10,0xe1,0x67,0x5b,0xf4,0x66,0x58,0xcd,0x48,0x83,0xd5,0x48,0x68,0x72,0x55,0x4b,0x84,0xb5,0xf5,0x50,0xca,0xb4,0x79,0x63,0xe0,0x5a},
+    {0xf2,0x62,0xa4,0x16,0xc3,0xbd,0xb5,0xc9,0x91,0x2e,0x9c,0x9c,0xe5,0xff,0x4a,0x33,0x5f,0x8d,0x19,0xc3,0x90,0x13,0x1b,0x7d,0xf4,0xa3,0xde,0xaa,0x96,0x98,0xc8,0x6e},
+    {0xf2,0x74,0x15,0xe3,0xef,0x8d,0x8c,0x7d,0x07,0x76,0x7d,0x1d,0xa0,0x9d,0x15,0x48,0x63,0x37,0x2f,0x9f,0x57,0x8c,0x96,0xf5,0x1f,0x8e,0x0e,0x20,0xd6,0xa2,0xf5,0x71},
+    {0xf2,0x91,0xfa,0x43,0xad,0x0f,0x71,0xaf,0x91,0x10,0xbf,0xe8,0xd2,0x8d,0xbd,0x5f,0x51,0x3b,0x47,0x7a,0x71,0xca,0x92,0xa7,0x59,0x8d,0x54,0x40,0x77,0x35,0x1e,0xa3},
+    {0xf3,0x17,0x30,0xce,0xa7,0x70,0xab,0x5d,0xb8,0x5b,0x71,0x0b,0xf2,0x22,0x8f,0x24,0x34,0xa2,0x39,0x82,0x86,0x3b,0x85,0xb7,0x3b,0x3d,0x56,0x03,0xc0,0x74,0xe7,0xc5},
+    {0xf3,0x18,0x8c,0x3c,0x44,0x44,0xd4,0xdb,0xb6,0xa7,0xe4,0xaa,0xc2,0xae,0x2f,0xeb,0xa3,0x4f,0x28,0xcf,0x0d,0xc7,0x9f,0xbe,0x3d,0x9a,0x96,0x70,0xb6,0x1b,0x0a,0xe5},
+    {0xf3,0x63,0x19,0x71,0x5d,0xcc,0xb9,0xae,0x15,0xfe,0x2d,0x66,0xab,0xa4,0x09,0x47,0x12,0x20,0x6e,0x8e,0x01,0x67,0xc4,0x55,0xaa,0xc1,0xe7,0x0c,0xb4,0x57,0xc2,0x45},
+    {0xf3,0xac,0x93,0x1e,0x7f,0xa2,0xac,0x0f,0x8f,0x85,0xef,0xd2,0x2d,0x82,0x8e,0xe1,0x00,0x2a,0xd9,0x77,0x7d,0x81,0x75,0x60,0x1b,0xf7,0xeb,0xe4,0x4d,0xbb,0xb1,0xbf},
+    {0xf4,0xfb,0x98,0xe2,0x7b,0xde,0x08,0x86,0xe7,0xd5,0xad,0x8c,0x3e,0x76,0x74,0x4d,0x21,0x6e,0x71,0xbc,0xd9,0xde,0xf2,0x36,0x26,0x9a,0x5e,0x7a,0xf7,0xcb,0x1d,0xe4},
+    {0xf5,0x00,0x23,0xfb,0xbf,0x2f,0x00,0x93,0x01,0xec,0x0c,0xfe,0x1b,0xca,0x6d,0xea,0xe6,0xee,0xcb,0xf3,0x47,0x0d,0x12,0x7d,0xe4,0x9d,0xab,0x58,0xd1,0x01,0xb4,0x77},
+    {0xf5,0x4f,0x11,0xd4,0xcb,0x77,0xf0,0x44,0xe3,0xff,0x68,0xf2,0x0a,0xe7,0x66,0x2f,0x89,0x1c,0x73,0xaf,0x97,0xb2,0x32,0xe8,0xac,0xae,0xfe,0x1a,0x61,0x08,0x8b,0x45},
+    {0xf5,0xad,0x00,0xeb,0x4f,0x93,0x69,0x7f,0xf6,0x48,0x67,0x94,0x57,0x97,0x6f,0x88,0x4f,0x0d,0x18,0xfb,0x33,0x1b,0x32,0xaf,0xb7,0xf8,0xd2,0xc9,0xde,0x56,0x02,0x01},
+    {0xf6,0x31,0xab,0x19,0xb4,0x1a,0x07,0x67,0xb0,0xe3,0x0a,0x20,0x5e,0xb6,0x0c,0xb7,0x7e,0xad,0x39,0x67,0x3d,0x84,0xf7,0x3f,0xb4,0x61,0xb8,0xe8,0x79,0xe2,0x6d,0x61},
+    {0xf6,0x3e,0x38,0xd3,0x27,0xfc,0x82,0xa1,0x54,0xcb,0x5b,0x99,0xf1,0x73,0x44,0x99,0x8d,0x51,0xbf,0xf3,0x6d,0xad,0x33,0x49,0xe3,0x2e,0x83,0x7d,0x07,0xb2,0xf3,0xf5},
+    {0xf6,0x7b,0x79,0x28,0xcc,0x3b,0xc4,0x75,0xe2,0xc1,0x2d,0x40,0x4c,0x42,0x49,0xfb,0xcb,0x30,0x44,0xec,0x47,0x3d,0x12,0xea,0xb5,0xce,0x57,0xe3,0xfb,0x04,0x1f,0x9d},
+    {0xf6,0xe7,0xac,0xac,0xe8,0x8e,0x43,0x7d,0x87,0xbe,0x09,0xba,0x08,0x58,0x2a,0xbf,0xbd,0x44,0xa8,0x4f,0x8f,0x14,0x5c,0x72,0xad,0x19,0x48,0x32,0x55,0x48,0x01,0xd5},
+    {0xf7,0x05,0xc8,0xb4,0xeb,0x9b,0xc1,0xad,0x3a,0xad,0x2d,0x49,0x19,0x6b,0x23,0x83,0x04,0xc4,0x76,0xb2,0xaa,0xa0,0x33,0x5f,0xf9,0x62,0x94,0x16,0x41,0x0c,0x64,0xd0},
+    {0xf7,0x6a,0x00,0x10,0x0f,0x4d,0xe0,0x24,0xc2,0x1b,0xb4,0x69,0xdb,0x99,0xb3,0x16,0x77,0x38,0xea,0x41,0xbc,0x23,0xab,0xcb,0xa1,0x0b,0xc5,0xe2,0x4d,0x39,0xe6,0x6b},
+    {0xf7,0x92,0x90,0x00,0x47,0x2a,0xe6,0x50,0xca,0x5f,0x40,0xf2,0x43,0x0f,0x3a,0x08,0x09,0x04,0x85,0x05,0x90,0x4a,0x03,0xf0,0x02,0x6f,0x04,0x41,0xce,0xd9,0x50,0x2f},
+    {0xf8,0x06,0xbc,0xd5,0xc3,0x8d,0x72,0x66,0x3a,0x43,0x29,0x9e,0xc0,0x59,0x51,0xcc,0x6f,0x93,0xc8,0xf2,0x4e,0x8c,0x1d,0xa9,0x26,0xb2,0xea,0xc3,0x94,0x62,0x8d,0x54},
+    {0xf9,0x3a,0xf4,0xd7,0x98,0xff,0xe3,0x78,0xbf,0x2f,0x46,0xe6,0x7d,0x52,0xc7,0x8c,0x36,0x5b,0x7a,0xb9,0xde,0x69,0x71,0xbc,0x6f,0x34,0x79,0x3e,0x4a,0x92,0xb5,0x7b},
+    {0xf9,0x3c,0x22,0x81,0x7e,0xe9,0x28,0xb4,0x64,0xb7,0x37,0x10,0x5c,0x3c,0xa3,0x86,0x3d,0x1b,0x20,0x46,0x46,0xb9,0x56,0x75,0xbf,0x9e,0x25,0x9f,0x03,0xab,0x00,0xa1},
+    {0xf9,0x4d,0x30,0xd0,0x52,0x57,0x2c,0xf7,0x3c,0xa0,0xd6,0xf2,0x27,0x92,0xac,0xa6,0xef,0xf1,0xed,0x9d,0xad,0x8b,0x5e,0x3a,0x87,0xcb,0xa9,0x1f,0x9b,0x58,0x24,0x9f},
+    {0xf9,0x63,0x07,0x9f,0x80,0x44,0xcc,0x53,0x65,0xcf,0x2b,0xe6,0x2e,0xb8,0x6b,0xf2,0xe5,0xbd,0x97,0xcb,0xcd,0x8a,0x20,0xe0,0x58,0x0d,0x61,0xdc,0x5e,0xba,0x0a,0x51},
+    {0xf9,0x6c,0xc1,0x4f,0xa7,0x07,0x9c,0x21,0x8a,0xaa,0x33,0xa6,0x89,0x85,0x23,0x53,0xc0,0x69,0xe7,0x5c,0x11,0x4a,0x4e,0x9a,0xcb,0xf8,0x0c,0x32,0xb2,0x1c,0xc1,0x7b},
+    {0xf9,0x76,0x1d,0x6d,0x1f,0xd5,0xb5,0x2c,0xac,0x67,0xb6,0x22,0x03,0xc8,0x8c,0xf4,0x83,0x0f,0xf8,0x12,0x1a,0x87,0x15,0x49,0x81,0x60,0x50,0x17,0x39,0x98,0xba,0x24},
+    {0xf9,0x7a,0x80,0xa8,0x6d,0xb4,0x6e,0xd4,0xf0,0x5f,0x2b,0xf1,0x43,0xe5,0xd8,0xbd,0xbb,0x93,0x2e,0x54,0x7a,0xde,0xfd,0xe3,0xe4,0xd5,0x4c,0xc9,0x0a,0xd2,0x7b,0xc5},
+    {0xf9,0x84,0x8a,0x4e,0x1b,0x90,0xdb,0x1f,0xce,0x04,0x5c,0x85,0xb2,0xd1,0x08,0xa7,0x8e,0xe7,0x8b,0xad,0x30,0x85,0x3a,0x7d,0xac,0x97,0xfe,0x99,0xb4,0xa3,0x8a,0x98},
+    {0xf9,0xab,0x72,0x54,0x0b,0x38,0xef,0xef,0x4d,0xa3,0x73,0x71,0xa2,0xf1,0x6f,0xec,0x84,0xd0,0x2d,0xc7,0x36,0x13,0x74,0x63,0xc2,0xd6,0x2e,0x73,0x8b,0x77,0x04,0x31},
+    {0xf9,0xcd,0x3d,0x72,0x2f,0x0c,0xfb,0x9d,0x55,0x3f,0x69,0x16,0x0c,0xbe,0xaf,0xc8,0x77,0x02,0xa7,0x42,0x75,0xe6,0x6c,0x0d,0x9a,0xf4,0x52,0x94,0x2f,0xa8,0x0a,0xac},
+    {0xf9,0xe5,0xd3,0x63,0xdb,0xec,0xcd,0xbe,0x68,0x4e,0x75,0x79,0x09,0xcc,0x46,0xd8,0x5d,0xa5,0x33,0x6f,0x7d,0x0c,0xbf,0x43,0xfd,0x1b,0x5e,0x6c,0xd5,0xeb,0x28,0x1c},
+    {0xfa,0x41,0xf4,0xcf,0x7c,0xca,0x93,0x5f,0x4a,0xbb,0x8e,0x69,0x15,0x0f,0xd4,0x01,0x39,0xb8,0x65,0x6d,0x6d,0xbe,0x9f,0xe3,0xe5,0x8e,0x60,0x5e,0x03,0xaf,0x96,0x89},
+    {0xfa,0x6b,0x8c,0x3b,0xf4,0x90,0x6c,0x49,0xfa,0xad,0xb6,0x1f,0x02,0xcc,0xe6,0xce,0xf9,0x97,0x1b,0xaf,0x35,0x1b,0x13,0xef,0xa6,0x2e,0x2c,0x1b,0xad,0x43,0x78,0x49},
+    {0xfa,0x77,0xc7,0x1d,0x38,0x77,0x81,0xf8,0x5f,0x65,0xd7,0x2a,0x49,0x9a,0x6d,0xed,0xd1,0x8f,0x54,0xcd,0x5f,0x47,0x6a,0x6e,0x7c,0xe0,0x8d,0x51,0x83,0xe7,0x78,0xa6},
+    {0xfa,0xd1,0xae,0x17,0xb1,0xc6,0x41,0x69,0xde,0x01,0x2f,0xff,0x4a,0x9f,0x60,0x92,0x02,0xee,0x65,0x55,0x82,0x2e,0x63,0x84,0x70,0x72,0x5a,0x3d,0x3c,0x45,0x64,0xd7},
+    {0xfa,0xfd,0x62,0x82,0xd8,0x44,0x13,0x27,0xd6,0x58,0xac,0x5b,0x69,0x3b,0x9c,0x80,0x76,0xd5,0xc7,0x3d,0x6b,0xd1,0x72,0x55,0x0b,0x14,0xc3,0x7c,0x63,0xb3,0x97,0x74},
+    {0xfb,0x0e,0xb2,0xe5,0xd0,0x2c,0x03,0x3c,0x75,0xb7,0xc9,0x07,0x2e,0x9b,0x38,0x5c,0x7c,0xd4,0x0c,0xc9,0x01,0xc0,0xbf,0x86,0x91,0x66,0xcd,0x6c,0x35,0x42,0x18,0xb9},
+    {0xfb,0x60,0xf9,0x8d,0xa1,0x68,0x70,0xb7,0x11,0x2d,0x3f,0x29,0xce,0x99,0xb3,0x26,0x58,0xd6,0x14,0x6c,0x93,0xe0,0xe0,0x65,0x54,0xaa,0xe7,0xe5,0x52,0xdb,0xd0,0x81},
+    {0xfb,0x76,0x8e,0xbf,0x58,0x71,0x13,0x04,0xe5,0xc3,0x8a,0x49,0xa0,0x5a,0xd0,0x7c,0xfe,0x5d,0x2d,0x53,0x98,0xcc,0x19,0xff,0x0c,0xc1,0x3c,0x6d,0x6e,0x64,0x52,0x17},
+    {0xfc,0x48,0xbd,0xed,0x07,0x1a,0xc1,0xf9,0xfb,0x64,0x0f,0x87,0xde,0xa7,0x02,0xdf,0xfb,0xa0,0x3a,0xd5,0x5e,0x02,0x64,0xcf,0xfa,0x12,0x9c,0x94,0x0e,0x5d,0xde,0x30},
+    {0xfd,0x63,0x25,0x07,0x72,0x80,0xfa,0x69,0x41,0x5d,0x5e,0xa8,0xbc,0x9d,0xef,0x7b,0x82,0xf0,0xe5,0xb3,0xe5,0x05,0x38,0xab,0xa2,0x64,0x6e,0x55,0x41,0x11,0xdd,0xb8},
+    {0xfe,0x06,0x7a,0x30,0x16,0x7e,0xb5,0x8c,0x98,0x1b,0x5d,0xa3,0x57,0x2d,0x06,0x05,0x12,0x03,0xc3,0x02,0x39,0x49,0xff,0x5d,0x10,0xa0,0x8c,0x62,0xd3,0x46,0xe7,0x9f},
+    {0xfe,0x6a,0x56,0x05,0xd3,0xba,0x50,0x5f,0xa1,0x2d,0x81,0x99,0x59,0x67,0x00,0xa7,0x96,0x27,0x3d,0x28,0xfb,0x1d,0x25,0xf9,0xc3,0xc1,0xc7,0x4f,0x18,0x19,0x2e,0x53},
+    {0xfe,0x9e,0x28,0xf6,0xed,0xea,0x1d,0x30,0x88,0xca,0x0a,0x86,0xc0,0xe9,0x83,0x17,0xf3,0xce,0x2b,0x0f,0xbf,0xb4,0x53,0xaa,0x3e,0xed,0x72,0x74,0x50,0x47,0xd1,0xb5},
+    {0xfe,0xa7,0xa7,0xfe,0x92,0x71,0xd5,0xbb,0x39,0xda,0xa4,0xa4,0x21,0x7f,0xb1,0x5d,0xb5,0xad,0xbd,0x22,0xe1,0xf9,0x67,0xa6,0x41,0x38,0x36,0xec,0xaf,0x2d,0x47,0xe0},
+    {0xff,0xa4,0x42,0xdc,0x99,0x73,0x3b,0xee,0x81,0xea,0xd2,0x6a,0x8e,0x1b,0x3f,0x5f,0x2b,0xc6,0x1f,0xbb,0xb7,0x6e,0x92,0x0c,0xbe,0xfd,0xa8,0x92,0x84,0xb6,0x91,0x56},
 };
 
+const size_t sigmaRemintBlacklistSize = sizeof(sigmaRemintBlacklist) / sizeof(sigmaRemintBlacklist[0]);
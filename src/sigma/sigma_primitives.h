@@ -4,6 +4,7 @@
 #include "../secp256k1/include/MultiExponent.h"
 #include "../secp256k1/include/GroupElement.h"
 #include "../secp256k1/include/Scalar.h"
+#include "../taskpool.h"
 
 #include <algorithm>
 #include <vector>
@@ -34,6 +35,11 @@ public:
      */
     static void new_factor(const Exponent& x, const Exponent& a, std::vector<Exponent>& coefficients);
 
+    /** \brief Computes the sum of generators[i] * powers[i]. Large sets are split into
+     *  parts which are multiplied on the shared task pool and then added up.
+     */
+    static GroupElement multi_exponent(const std::vector<GroupElement>& generators, const std::vector<Exponent>& powers);
+
     };
 
 } // namespace sigma
@@ -92,4 +92,33 @@ void SigmaPrimitives<Exponent, GroupElement>::new_factor(
     coefficients[0] *= a;
 }
 
+template<class Exponent, class GroupElement>
+GroupElement SigmaPrimitives<Exponent, GroupElement>::multi_exponent(
+        const std::vector<GroupElement>& generators,
+        const std::vector<Exponent>& powers) {
+    // Bucket methods get cheaper per point as the set grows, so only split when every part stays large
+    static const std::size_t min_part_size = 2048;
+    std::size_t parts = std::min<std::size_t>(CTaskPool::Shared().Concurrency(), generators.size() / min_part_size);
+    if (parts <= 1) {
+        secp_primitives::MultiExponent mult(generators, powers);
+        return mult.get_multiple();
+    }
+
+    std::size_t part_size = (generators.size() + parts - 1) / parts;
+    std::vector<GroupElement> partial(parts);
+    ParallelFor(0, parts, [&](std::size_t k) {
+        std::size_t begin = k * part_size;
+        std::size_t end = std::min(generators.size(), begin + part_size);
+        std::vector<GroupElement> part_generators(generators.begin() + begin, generators.begin() + end);
+        std::vector<Exponent> part_powers(powers.begin() + begin, powers.begin() + end);
+        secp_primitives::MultiExponent mult(part_generators, part_powers);
+        partial[k] = mult.get_multiple();
+    });
+
+    GroupElement result;
+    for (const GroupElement& p : partial)
+        result += p;
+    return result;
+}
+
 } // namespace sigma
@@ -47,7 +47,7 @@ void SigmaPlusProver<Exponent, GroupElement>::proof(
     P_i_k.resize(N);
 
     // last polynomial is special case if fPadding is true
-    for (std::size_t i = 0; i < (fPadding ? N-1 : N); ++i) {
+    ParallelFor(0, fPadding ? N-1 : N, [&](std::size_t i) {
         std::vector<Exponent>& coefficients = P_i_k[i];
         std::vector<uint64_t> I = SigmaPrimitives<Exponent, GroupElement>::convert_to_nal(i, n_, m_);
         coefficients.push_back(a[I[0]]);
@@ -55,7 +55,7 @@ void SigmaPlusProver<Exponent, GroupElement>::proof(
         for (int j = 1; j < m_; ++j) {
             SigmaPrimitives<Exponent, GroupElement>::new_factor(sigma[j * n_ + I[j]], a[j * n_ + I[j]], coefficients);
         }
-    }
+    }, 256);
 
     if (fPadding) {
         /*
@@ -108,10 +108,9 @@ void SigmaPlusProver<Exponent, GroupElement>::proof(
         P_i_k[N-1] = p_i_sum;
     }
 
-    //computing G_k`s;
-    std::vector <GroupElement> Gk;
-    Gk.reserve(m_);
-    for (int k = 0; k < m_; ++k) {
+    //computing G_k`s, the m_ multi-exponentiations are independent of each other
+    std::vector <GroupElement> Gk(m_);
+    ParallelFor(0, m_, [&](std::size_t k) {
         std::vector <Exponent> P_i;
         P_i.reserve(N);
         for (size_t i = 0; i < N; ++i) {
@@ -120,8 +119,8 @@ void SigmaPlusProver<Exponent, GroupElement>::proof(
         secp_primitives::MultiExponent mult(commits, P_i);
         GroupElement c_k = mult.get_multiple();
         c_k += SigmaPrimitives<Exponent, GroupElement>::commit(g_, Exponent(uint64_t(0)), h_[0], Pk[k]);
-        Gk.emplace_back(c_k);
-    }
+        Gk[k] = c_k;
+    });
     proof_out.Gk_ = Gk;
 
     // Compute value of challenge X, then continue R1 proof and sigma final response proof.
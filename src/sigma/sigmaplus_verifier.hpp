@@ -64,18 +64,17 @@ bool SigmaPlusVerifier<Exponent, GroupElement>::verify(
     }
 
     std::size_t N = commits.size();
-    std::vector<Exponent> f_i_;
-    f_i_.reserve(N);
+    std::vector<Exponent> f_i_(N);
 
     // if fPadding is true last index is special
-    for (std::size_t i = 0; i < (fPadding ? N-1 : N); ++i) {
+    ParallelFor(0, fPadding ? N-1 : N, [&](std::size_t i) {
         std::vector<uint64_t> I = SigmaPrimitives<Exponent, GroupElement>::convert_to_nal(i, n, m);
         Exponent f_i(uint64_t(1));
         for(int j = 0; j < m; ++j){
             f_i *= f[j*n + I[j]];
         }
-        f_i_.emplace_back(f_i);
-    }
+        f_i_[i] = f_i;
+    }, 512);
 
     if (fPadding) {
         /*
@@ -109,11 +108,10 @@ bool SigmaPlusVerifier<Exponent, GroupElement>::verify(
             pow += fi_sum * xj * f_part_product[m - j - 1];
             xj *= challenge_x;
         }
-        f_i_.emplace_back(pow);
+        f_i_[N - 1] = pow;
     }
 
-    secp_primitives::MultiExponent mult(commits, f_i_);
-    GroupElement t1 = mult.get_multiple();
+    GroupElement t1 = SigmaPrimitives<Exponent, GroupElement>::multi_exponent(commits, f_i_);
 
     GroupElement t2;
     Exponent x_k(uint64_t(1));
@@ -190,4 +190,33 @@ BOOST_AUTO_TEST_CASE(verify_test_with_accumulatorBlockHash)
     BOOST_CHECK(spend_coin.Verify(anonymity_set, metaData, true));
 }
 
+BOOST_AUTO_TEST_CASE(serialized_size_test)
+{
+    auto params = sigma::Params::get_default();
+
+    const sigma::PrivateCoin privcoin(params, sigma::CoinDenomination::SIGMA_DENOM_1);
+    sigma::PublicCoin pubcoin;
+    pubcoin = privcoin.getPublicCoin();
+
+    std::vector<sigma::PublicCoin> anonymity_set;
+    anonymity_set.push_back(pubcoin);
+
+    sigma::SpendMetaData metaData(0, uint256S("120"), uint256S("120"));
+
+    // Neither the anonymity set nor padding changes the size
+    for (int i = 0; i < 2; i++) {
+        const sigma::PrivateCoin other(params, sigma::CoinDenomination::SIGMA_DENOM_1);
+        anonymity_set.push_back(other.getPublicCoin());
+
+        for (bool fPadding : {false, true}) {
+            sigma::CoinSpend coin(params, privcoin, anonymity_set, metaData, fPadding);
+
+            CDataStream serialized(SER_NETWORK, PROTOCOL_VERSION);
+            serialized << coin;
+
+            BOOST_CHECK_EQUAL(serialized.size(), sigma::CoinSpend::SerializedSize(params));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
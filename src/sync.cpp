@@ -7,7 +7,10 @@
 #include "util.h"
 #include "utilstrencodings.h"
 
+#include <chrono>
+#include <set>
 #include <stdio.h>
+#include <tuple>
 
 #include <boost/foreach.hpp>
 #include <boost/thread.hpp>
@@ -20,6 +23,140 @@ void PrintLockContention(const char* pszName, const char* pszFile, int nLine)
 }
 #endif /* DEBUG_LOCKCONTENTION */
 
+std::atomic<bool> fLockProfile(false);
+
+void CLockTimeHistogram::Add(int64_t nMicros)
+{
+    int nBucket = 0;
+    while (nBucket < BUCKETS - 1 && nMicros >= (int64_t(1) << nBucket))
+        nBucket++;
+    vCount[nBucket]++;
+    nCount++;
+    nTotal += nMicros;
+    nMax = std::max(nMax, nMicros);
+}
+
+void CLockTimeHistogram::Merge(const CLockTimeHistogram& other)
+{
+    for (int i = 0; i < BUCKETS; i++)
+        vCount[i] += other.vCount[i];
+    nCount += other.nCount;
+    nTotal += other.nTotal;
+    nMax = std::max(nMax, other.nMax);
+}
+
+void CLockSiteProfile::Add(int64_t nWaitMicros, int64_t nHoldMicros, bool fContended)
+{
+    if (fContended)
+        nContended++;
+    wait.Add(nWaitMicros);
+    hold.Add(nHoldMicros);
+}
+
+void CLockSiteProfile::Merge(const CLockSiteProfile& other)
+{
+    nContended += other.nContended;
+    wait.Merge(other.wait);
+    hold.Merge(other.hold);
+}
+
+// Keyed by the string literals of the lock macros, so recording doesn't need to copy names
+typedef std::map<std::tuple<const char*, const char*, int>, CLockSiteProfile> LockSiteProfiles;
+
+static void MergeLockSiteProfiles(LockSiteProfiles& sites, const LockSiteProfiles& other)
+{
+    for (const auto& site : other)
+        sites[site.first].Merge(site.second);
+}
+
+// Profiles recorded by one thread. Its mutex is only contended while the profiles are read or reset.
+struct LockThreadProfiles {
+    boost::mutex mutex;
+    LockSiteProfiles sites;
+};
+
+struct LockProfileData {
+    //! Guards the set of threads and the profiles of exited threads, taken before the mutex of a thread
+    boost::mutex mutex;
+    std::set<LockThreadProfiles*> threads;
+    LockSiteProfiles exited;
+};
+
+static LockProfileData& GetLockProfileData()
+{
+    // Never destroyed, locks may still be released during static destruction
+    static LockProfileData* data = new LockProfileData();
+    return *data;
+}
+
+static void ReleaseLockThreadProfiles(LockThreadProfiles* profiles)
+{
+    LockProfileData& data = GetLockProfileData();
+    boost::unique_lock<boost::mutex> lock(data.mutex);
+    MergeLockSiteProfiles(data.exited, profiles->sites);
+    data.threads.erase(profiles);
+    delete profiles;
+}
+
+static LockThreadProfiles& GetLockThreadProfiles()
+{
+    static boost::thread_specific_ptr<LockThreadProfiles>* ptr = new boost::thread_specific_ptr<LockThreadProfiles>(ReleaseLockThreadProfiles);
+    LockThreadProfiles* profiles = ptr->get();
+    if (!profiles) {
+        profiles = new LockThreadProfiles();
+        ptr->reset(profiles);
+        LockProfileData& data = GetLockProfileData();
+        boost::unique_lock<boost::mutex> lock(data.mutex);
+        data.threads.insert(profiles);
+    }
+    return *profiles;
+}
+
+int64_t LockProfileTime()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void LockProfileRecord(const char* pszName, const char* pszFile, int nLine, int64_t nWaitMicros, int64_t nHoldMicros, bool fContended)
+{
+    LockThreadProfiles& profiles = GetLockThreadProfiles();
+    boost::unique_lock<boost::mutex> lock(profiles.mutex);
+    profiles.sites[std::make_tuple(pszName, pszFile, nLine)].Add(nWaitMicros, nHoldMicros, fContended);
+}
+
+std::map<std::string, CLockProfile> GetLockProfile()
+{
+    LockSiteProfiles sites;
+    {
+        LockProfileData& data = GetLockProfileData();
+        boost::unique_lock<boost::mutex> lock(data.mutex);
+        sites = data.exited;
+        for (LockThreadProfiles* profiles : data.threads) {
+            boost::unique_lock<boost::mutex> lockThread(profiles->mutex);
+            MergeLockSiteProfiles(sites, profiles->sites);
+        }
+    }
+
+    std::map<std::string, CLockProfile> result;
+    for (const auto& site : sites) {
+        CLockProfile& profile = result[std::get<0>(site.first)];
+        profile.Merge(site.second);
+        profile.mapSites[strprintf("%s:%d", std::get<1>(site.first), std::get<2>(site.first))].Merge(site.second);
+    }
+    return result;
+}
+
+void ResetLockProfile()
+{
+    LockProfileData& data = GetLockProfileData();
+    boost::unique_lock<boost::mutex> lock(data.mutex);
+    data.exited.clear();
+    for (LockThreadProfiles* profiles : data.threads) {
+        boost::unique_lock<boost::mutex> lockThread(profiles->mutex);
+        profiles->sites.clear();
+    }
+}
+
 #ifdef DEBUG_LOCKORDER
 //
 // Early deadlock detection.
@@ -8,6 +8,11 @@
 
 #include "threadsafety.h"
 
+#include <atomic>
+#include <map>
+#include <stdint.h>
+#include <string>
+
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
@@ -108,6 +113,53 @@ typedef boost::condition_variable CConditionVariable;
 void PrintLockContention(const char* pszName, const char* pszFile, int nLine);
 #endif
 
+/**
+ * Runtime lock profiling of LOCK, LOCK2 and TRY_LOCK, enabled with -lockprofile or the
+ * setlockprofile RPC. Costs a relaxed atomic load per lock while disabled.
+ */
+extern std::atomic<bool> fLockProfile;
+static const bool DEFAULT_LOCKPROFILE = false;
+
+/** Log2 histogram of durations: bucket i counts durations of less than 2^i microseconds, the last one the rest */
+struct CLockTimeHistogram
+{
+    static const int BUCKETS = 24;
+
+    uint64_t vCount[BUCKETS];
+    uint64_t nCount;
+    int64_t nTotal;
+    int64_t nMax;
+
+    CLockTimeHistogram() : vCount(), nCount(0), nTotal(0), nMax(0) {}
+    void Add(int64_t nMicros);
+    void Merge(const CLockTimeHistogram& other);
+};
+
+/** Wait and hold times of one lock, or of one call site of it */
+struct CLockSiteProfile
+{
+    uint64_t nContended;
+    CLockTimeHistogram wait;
+    CLockTimeHistogram hold;
+
+    CLockSiteProfile() : nContended(0) {}
+    void Add(int64_t nWaitMicros, int64_t nHoldMicros, bool fContended);
+    void Merge(const CLockSiteProfile& other);
+};
+
+struct CLockProfile : public CLockSiteProfile
+{
+    //! Profiles of the call sites holding the lock, by "file:line"
+    std::map<std::string, CLockSiteProfile> mapSites;
+};
+
+int64_t LockProfileTime();
+/** Records into profiles of the calling thread, which are only merged when read */
+void LockProfileRecord(const char* pszName, const char* pszFile, int nLine, int64_t nWaitMicros, int64_t nHoldMicros, bool fContended);
+/** Profiles recorded so far by lock name. Re-entering a recursive lock counts as an uncontended acquisition. */
+std::map<std::string, CLockProfile> GetLockProfile();
+void ResetLockProfile();
+
 /** Wrapper around boost::unique_lock<Mutex> */
 template <typename Mutex>
 class SCOPED_LOCKABLE CMutexLock
@@ -115,17 +167,37 @@ class SCOPED_LOCKABLE CMutexLock
 private:
     boost::unique_lock<Mutex> lock;
 
+    //! Set while the lock profiler records this acquisition
+    const char* pszProfileName = nullptr;
+    const char* pszProfileFile = nullptr;
+    int nProfileLine = 0;
+    bool fProfileContended = false;
+    int64_t nProfileWait = 0;
+    int64_t nProfileStart = 0;
+
     void Enter(const char* pszName, const char* pszFile, int nLine)
     {
         EnterCritical(pszName, pszFile, nLine, (void*)(lock.mutex()));
-#ifdef DEBUG_LOCKCONTENTION
+        bool fProfile = fLockProfile.load(std::memory_order_relaxed);
+#ifndef DEBUG_LOCKCONTENTION
+        if (!fProfile) {
+            lock.lock();
+            return;
+        }
+#endif
         if (!lock.try_lock()) {
+#ifdef DEBUG_LOCKCONTENTION
             PrintLockContention(pszName, pszFile, nLine);
 #endif
+            int64_t nWaitStart = fProfile ? LockProfileTime() : 0;
             lock.lock();
-#ifdef DEBUG_LOCKCONTENTION
+            if (fProfile) {
+                fProfileContended = true;
+                nProfileWait = LockProfileTime() - nWaitStart;
+            }
         }
-#endif
+        if (fProfile)
+            ProfileStart(pszName, pszFile, nLine);
     }
 
     bool TryEnter(const char* pszName, const char* pszFile, int nLine)
@@ -134,9 +206,19 @@ private:
         lock.try_lock();
         if (!lock.owns_lock())
             LeaveCritical();
+        else if (fLockProfile.load(std::memory_order_relaxed))
+            ProfileStart(pszName, pszFile, nLine);
         return lock.owns_lock();
     }
 
+    void ProfileStart(const char* pszName, const char* pszFile, int nLine)
+    {
+        pszProfileName = pszName;
+        pszProfileFile = pszFile;
+        nProfileLine = nLine;
+        nProfileStart = LockProfileTime();
+    }
+
 public:
     CMutexLock(Mutex& mutexIn, const char* pszName, const char* pszFile, int nLine, bool fTry = false) EXCLUSIVE_LOCK_FUNCTION(mutexIn) : lock(mutexIn, boost::defer_lock)
     {
@@ -159,8 +241,14 @@ public:
 
     ~CMutexLock() UNLOCK_FUNCTION()
     {
-        if (lock.owns_lock())
+        if (lock.owns_lock()) {
+            int64_t nProfileHold = pszProfileName ? LockProfileTime() - nProfileStart : 0;
             LeaveCritical();
+            // Record once released, so the profiler doesn't add to the hold time of the lock
+            lock.unlock();
+            if (pszProfileName)
+                LockProfileRecord(pszProfileName, pszProfileFile, nProfileLine, nProfileWait, nProfileHold, fProfileContended);
+        }
     }
 
     operator bool()
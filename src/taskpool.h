@@ -0,0 +1,284 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_TASKPOOL_H
+#define BITCOIN_TASKPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <boost/chrono/chrono.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+/**
+ * Work-stealing pool for CPU bound proof generation and verification.
+ *
+ * Every worker owns a deque of tasks. Tasks posted by a worker go to the back
+ * of its own deque and are taken from there (LIFO, which keeps nested work
+ * cache-hot), tasks posted by other threads go to a shared injection deque,
+ * and a worker which runs dry steals from the front of the others. Threads
+ * waiting on a CTaskGroup run queued tasks instead of blocking, so parallel
+ * sections may nest, and on a single core everything simply runs on the
+ * waiting thread.
+ */
+class CTaskPool
+{
+public:
+    typedef std::function<void()> Task;
+
+private:
+    struct TaskQueue {
+        boost::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    //! queues[0] receives tasks from non-worker threads, queues[i + 1] belongs to worker i
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<boost::thread::id> workerIds;
+    boost::thread_group threads;
+
+    //! Number of queued tasks; may briefly go negative while a push races with a steal
+    std::atomic<int> nQueued;
+    boost::mutex mutexSleep;
+    boost::condition_variable condSleep;
+    bool fQuit;
+
+    //! Index of the calling thread's own queue, 0 for threads which are not workers
+    size_t OwnQueue() const
+    {
+        boost::thread::id id = boost::this_thread::get_id();
+        for (size_t i = 0; i < workerIds.size(); i++)
+            if (workerIds[i] == id)
+                return i + 1;
+        return 0;
+    }
+
+    bool Pop(size_t nQueue, bool fBack, Task& task)
+    {
+        TaskQueue& queue = *queues[nQueue];
+        boost::unique_lock<boost::mutex> lock(queue.mutex);
+        if (queue.tasks.empty())
+            return false;
+        if (fBack) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        nQueued--;
+        return true;
+    }
+
+    bool Take(Task& task)
+    {
+        if (nQueued <= 0)
+            return false;
+        size_t nOwn = OwnQueue();
+        // Newest first from our own deque, oldest first from the shared one or anyone else's
+        if (Pop(nOwn, nOwn != 0, task))
+            return true;
+        for (size_t i = 1; i < queues.size(); i++) {
+            if (Pop((nOwn + i) % queues.size(), false, task))
+                return true;
+        }
+        return false;
+    }
+
+    void ThreadProc()
+    {
+        while (true) {
+            {
+                boost::unique_lock<boost::mutex> lock(mutexSleep);
+                while (!fQuit && nQueued <= 0)
+                    condSleep.wait(lock);
+                if (fQuit)
+                    return;
+            }
+            Task task;
+            if (Take(task))
+                task();
+        }
+    }
+
+public:
+    //! Start nWorkers background threads. With zero workers tasks run on the threads waiting for them.
+    explicit CTaskPool(unsigned int nWorkers) : nQueued(0), fQuit(false)
+    {
+        for (unsigned int i = 0; i <= nWorkers; i++)
+            queues.emplace_back(new TaskQueue());
+        std::vector<boost::thread*> vThreads;
+        {
+            // Workers must not look themselves up before every id is known
+            boost::unique_lock<boost::mutex> lock(mutexSleep);
+            for (unsigned int i = 0; i < nWorkers; i++) {
+                vThreads.push_back(threads.create_thread(std::bind(&CTaskPool::ThreadProc, this)));
+                workerIds.push_back(vThreads.back()->get_id());
+            }
+        }
+    }
+
+    ~CTaskPool()
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(mutexSleep);
+            fQuit = true;
+        }
+        condSleep.notify_all();
+        threads.join_all();
+    }
+
+    /** Process-wide pool, started on first use with one worker less than the number of cores. */
+    static CTaskPool& Shared()
+    {
+        static CTaskPool pool(std::max(1u, boost::thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+
+    //! Number of threads which can run tasks at the same time, including one waiting thread
+    size_t Concurrency() const { return workerIds.size() + 1; }
+
+    void Post(Task task)
+    {
+        TaskQueue& queue = *queues[OwnQueue()];
+        {
+            boost::unique_lock<boost::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        {
+            boost::unique_lock<boost::mutex> lock(mutexSleep);
+            nQueued++;
+        }
+        condSleep.notify_one();
+    }
+
+    //! Run one queued task on the calling thread. Returns false if there was nothing to run.
+    bool RunPending()
+    {
+        Task task;
+        if (!Take(task))
+            return false;
+        task();
+        return true;
+    }
+};
+
+/**
+ * Wait group over a CTaskPool: Run() posts tasks, Wait() returns once all of
+ * them have finished, helping with queued work meanwhile. The first exception
+ * thrown by a task is rethrown from Wait(). A group may be reused after Wait().
+ */
+class CTaskGroup
+{
+private:
+    CTaskPool& pool;
+    std::atomic<size_t> nPending;
+    boost::mutex mutex;
+    boost::condition_variable cond;
+    std::exception_ptr error;
+
+    void Finished()
+    {
+        // Decrement under the lock, so a waiter cannot return and destroy the group while we notify
+        boost::unique_lock<boost::mutex> lock(mutex);
+        if (--nPending == 0)
+            cond.notify_all();
+    }
+
+    void WaitNoThrow()
+    {
+        // Tasks reference the caller's stack, so waiting must not be cut short by thread interruption
+        boost::this_thread::disable_interruption di;
+        while (nPending != 0) {
+            if (pool.RunPending())
+                continue;
+            boost::unique_lock<boost::mutex> lock(mutex);
+            // Everything of ours has been taken; wake up when it is done or when more work
+            // shows up that we could help with (tasks posted by our own tasks, for instance)
+            if (nPending != 0)
+                cond.wait_for(lock, boost::chrono::milliseconds(1));
+        }
+        // The last task may still be inside Finished()
+        boost::unique_lock<boost::mutex> lock(mutex);
+    }
+
+public:
+    explicit CTaskGroup(CTaskPool& poolIn = CTaskPool::Shared()) : pool(poolIn), nPending(0) {}
+    CTaskGroup(const CTaskGroup&) = delete;
+    CTaskGroup& operator=(const CTaskGroup&) = delete;
+
+    ~CTaskGroup() { WaitNoThrow(); }
+
+    CTaskPool& Pool() { return pool; }
+
+    void Run(CTaskPool::Task task)
+    {
+        nPending++;
+        pool.Post([this, task]() {
+            try {
+                task();
+            } catch (...) {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+            Finished();
+        });
+    }
+
+    void Wait()
+    {
+        WaitNoThrow();
+        std::exception_ptr e;
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            std::swap(e, error);
+        }
+        if (e)
+            std::rethrow_exception(e);
+    }
+};
+
+/**
+ * Call fn(i) for every i in [nBegin, nEnd) on the pool, in chunks of at least
+ * nGrain indexes, and return when all calls have finished. Small ranges and
+ * single-threaded pools run inline without allocating any task.
+ */
+template <typename F>
+void ParallelFor(size_t nBegin, size_t nEnd, F fn, size_t nGrain = 1, CTaskPool& pool = CTaskPool::Shared())
+{
+    if (nEnd <= nBegin)
+        return;
+    size_t nCount = nEnd - nBegin;
+    // A few chunks per thread lets the stealing even out chunks of uneven cost
+    size_t nChunk = std::max(std::max<size_t>(nGrain, 1), (nCount + 4 * pool.Concurrency() - 1) / (4 * pool.Concurrency()));
+    if (pool.Concurrency() == 1 || nChunk >= nCount) {
+        for (size_t i = nBegin; i < nEnd; i++)
+            fn(i);
+        return;
+    }
+    CTaskGroup group(pool);
+    // Keep the first chunk for the calling thread
+    for (size_t nStart = nBegin + nChunk; nStart < nEnd; nStart += nChunk) {
+        size_t nStop = std::min(nEnd, nStart + nChunk);
+        group.Run([&fn, nStart, nStop]() {
+            for (size_t i = nStart; i < nStop; i++)
+                fn(i);
+        });
+    }
+    // If this throws, the group's destructor waits for the other chunks before fn goes away
+    for (size_t i = nBegin; i < nBegin + nChunk; i++)
+        fn(i);
+    group.Wait();
+}
+
+#endif // BITCOIN_TASKPOOL_H
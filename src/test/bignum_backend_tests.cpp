@@ -0,0 +1,145 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "libzerocoin/Zerocoin.h"
+#include "libzerocoin/bitcoin_bignum/bignum_backend.h"
+#include "zerocoin.h"
+
+#include "test/test_bitcoin.h"
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+/** Selects an engine for the lifetime of the object */
+class EngineScope
+{
+    bignum_backend::Engine prev;
+
+public:
+    explicit EngineScope(bignum_backend::Engine engine) : prev(bignum_backend::GetEngine())
+    {
+        BOOST_REQUIRE(bignum_backend::SetEngine(engine));
+    }
+    ~EngineScope() { bignum_backend::SetEngine(prev); }
+};
+
+std::vector<bignum_backend::Engine> BuiltEngines()
+{
+    std::vector<bignum_backend::Engine> engines = {bignum_backend::ENGINE_OPENSSL};
+    if (bignum_backend::HaveGMP())
+        engines.push_back(bignum_backend::ENGINE_GMP);
+    return engines;
+}
+
+// Reference results straight from OpenSSL, with a fresh context and no cached moduli
+
+bool RefPowMod(CBigNum& r, const CBigNum& a, const CBigNum& e, const CBigNum& m)
+{
+    BN_CTX* ctx = BN_CTX_new();
+    bool ret = BN_mod_exp(&r, &a, &e, &m, ctx);
+    BN_CTX_free(ctx);
+    return ret;
+}
+
+bool RefMulMod(CBigNum& r, const CBigNum& a, const CBigNum& b, const CBigNum& m)
+{
+    BN_CTX* ctx = BN_CTX_new();
+    bool ret = BN_mod_mul(&r, &a, &b, &m, ctx);
+    BN_CTX_free(ctx);
+    return ret;
+}
+
+bool RefInverse(CBigNum& r, const CBigNum& a, const CBigNum& m)
+{
+    BN_CTX* ctx = BN_CTX_new();
+    bool ret = BN_mod_inverse(&r, &a, &m, ctx) != NULL;
+    BN_CTX_free(ctx);
+    return ret;
+}
+
+void CheckAgainstReference(const CBigNum& a, const CBigNum& b, const CBigNum& m)
+{
+    CBigNum expected;
+    if (RefPowMod(expected, a, b, m))
+        BOOST_CHECK_EQUAL(a.pow_mod(b, m), expected);
+    if (RefMulMod(expected, a, b, m))
+        BOOST_CHECK_EQUAL(a.mul_mod(b, m), expected);
+    if (RefInverse(expected, a, m))
+        BOOST_CHECK_EQUAL(a.inverse(m), expected);
+    else
+        BOOST_CHECK_THROW(a.inverse(m), bignum_error);
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(bignum_backend_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(engines_match_openssl)
+{
+    const libzerocoin::Params* params = ZCParamsV2;
+    std::vector<CBigNum> moduli = {
+        params->accumulatorParams.accumulatorModulus,
+        params->coinCommitmentGroup.modulus,
+        params->coinCommitmentGroup.groupOrder,
+        CBigNum::RandKBitBigum(1024) << 1,  // even
+        CBigNum(65537),
+        CBigNum(2),
+    };
+
+    for (bignum_backend::Engine engine : BuiltEngines()) {
+        EngineScope scope(engine);
+        for (const CBigNum& m : moduli) {
+            // Edge values, then random ones including negative and unreduced bases
+            std::vector<CBigNum> values = {0, 1, 2, m - 1, m, m + 1, -1, -m};
+            for (int i = 0; i < 8; i++) {
+                values.push_back(CBigNum::randBignum(m));
+                values.push_back(CBigNum::randBignum(m * m));
+                values.push_back(-CBigNum::randBignum(m));
+            }
+            for (const CBigNum& a : values) {
+                CheckAgainstReference(a, CBigNum(0), m);
+                CheckAgainstReference(a, CBigNum(1), m);
+                CheckAgainstReference(a, CBigNum::RandKBitBigum(256), m);
+                CheckAgainstReference(a, CBigNum::randBignum(m), m);
+            }
+            // Negative exponents go through the inverse
+            CBigNum a = CBigNum::randBignum(m - 2) + 2;
+            CBigNum e = CBigNum::RandKBitBigum(160);
+            if (a.gcd(m).isOne())
+                BOOST_CHECK_EQUAL(a.pow_mod(-e, m), a.inverse(m).pow_mod(e, m));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(engines_accumulate_identically)
+{
+    const libzerocoin::Params* params = ZCParamsV2;
+    std::vector<libzerocoin::PublicCoin> coins;
+    for (int i = 0; i < 20; i++)
+        coins.emplace_back(params, CBigNum::RandKBitBigum(256));
+
+    std::vector<CBigNum> values;
+    for (bignum_backend::Engine engine : BuiltEngines()) {
+        EngineScope scope(engine);
+        libzerocoin::Accumulator accumulator(params);
+        for (const libzerocoin::PublicCoin& coin : coins)
+            accumulator += coin;
+        values.push_back(accumulator.getValue());
+    }
+    for (const CBigNum& value : values)
+        BOOST_CHECK_EQUAL(value, values[0]);
+}
+
+BOOST_AUTO_TEST_CASE(engine_selection)
+{
+    EngineScope scope(bignum_backend::ENGINE_OPENSSL);
+    BOOST_CHECK_EQUAL(bignum_backend::GetEngine(), bignum_backend::ENGINE_OPENSSL);
+    BOOST_CHECK_EQUAL(bignum_backend::SetEngine(bignum_backend::ENGINE_GMP), bignum_backend::HaveGMP());
+    BOOST_CHECK_EQUAL(bignum_backend::GetEngine(), bignum_backend::HaveGMP() ? bignum_backend::ENGINE_GMP : bignum_backend::ENGINE_OPENSSL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
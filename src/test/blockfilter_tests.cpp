@@ -0,0 +1,239 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockfilter.h"
+#include "blockfilterindex.h"
+#include "chainparams.h"
+#include "hash.h"
+#include "main.h"
+#include "random.h"
+#include "script/script.h"
+#include "streams.h"
+#include "txmempool.h"
+#include "undo.h"
+#include "utilstrencodings.h"
+
+#include "test/fixtures.h"
+#include "test/test_bitcoin.h"
+
+#include "wallet/wallet.h"
+
+#include <boost/test/unit_test.hpp>
+
+static GCSFilter::Element RandomElement()
+{
+    GCSFilter::Element element(32);
+    GetRandBytes(element.data(), element.size());
+    return element;
+}
+
+BOOST_FIXTURE_TEST_SUITE(blockfilter_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(gcsfilter_test)
+{
+    GCSFilter::ElementSet included, excluded;
+    for (int i = 0; i < 100; i++) {
+        included.insert(RandomElement());
+        excluded.insert(RandomElement());
+    }
+
+    GCSFilter filter(GCSFilter::Params(0, 0, 10, 1 << 10), included);
+    BOOST_CHECK_EQUAL(filter.GetN(), included.size());
+    for (const GCSFilter::Element& element : included) {
+        BOOST_CHECK(filter.Match(element));
+
+        GCSFilter::ElementSet query = excluded;
+        query.insert(element);
+        BOOST_CHECK(filter.MatchAny(query));
+    }
+
+    // A decoded filter matches the same
+    GCSFilter decoded(filter.GetParams(), filter.GetEncoded());
+    BOOST_CHECK(decoded.GetEncoded() == filter.GetEncoded());
+    BOOST_CHECK_EQUAL(decoded.GetN(), filter.GetN());
+    BOOST_CHECK(decoded.MatchAny(included));
+
+    // An empty filter matches nothing
+    GCSFilter empty;
+    BOOST_CHECK_EQUAL(empty.GetN(), 0);
+    BOOST_CHECK(!empty.Match(*included.begin()));
+    BOOST_CHECK(!empty.MatchAny(included));
+}
+
+BOOST_AUTO_TEST_CASE(gcsfilter_bip158_vector)
+{
+    // Basic filter of the genesis block of the Bitcoin testnet, from the BIP 158 test vectors
+    uint256 blockHash = uint256S("000000000933ea01ad0ee984209779baaec3ced90fa3f408719526f8d77f4943");
+    GCSFilter::Params params(blockHash.GetUint64(0), blockHash.GetUint64(1), 19, 784931);
+
+    GCSFilter::ElementSet elements;
+    elements.insert(ParseHex("4104678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5fac"));
+
+    BOOST_CHECK_EQUAL(HexStr(GCSFilter(params, elements).GetEncoded()), "019dfca8");
+}
+
+BOOST_AUTO_TEST_CASE(gcsfilter_malformed)
+{
+    GCSFilter::ElementSet elements;
+    for (int i = 0; i < 10; i++)
+        elements.insert(RandomElement());
+
+    GCSFilter filter(GCSFilter::Params(1, 2, 19, 784931), elements);
+
+    std::vector<unsigned char> vExcess = filter.GetEncoded();
+    vExcess.push_back(0);
+    BOOST_CHECK_THROW(GCSFilter(filter.GetParams(), vExcess), std::ios_base::failure);
+
+    std::vector<unsigned char> vTruncated = filter.GetEncoded();
+    vTruncated.resize(vTruncated.size() / 2);
+    BOOST_CHECK_THROW(GCSFilter(filter.GetParams(), vTruncated), std::ios_base::failure);
+
+    BOOST_CHECK_THROW(GCSFilter(filter.GetParams(), std::vector<unsigned char>()), std::ios_base::failure);
+}
+
+BOOST_AUTO_TEST_CASE(blockfilter_basic_test)
+{
+    CScript included1 = CScript() << std::vector<unsigned char>(33, 1) << OP_CHECKSIG;
+    CScript included2 = CScript() << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 2) << OP_EQUALVERIFY << OP_CHECKSIG;
+    CScript sigmaMint = CScript() << OP_SIGMAMINT << std::vector<unsigned char>(34, 3);
+    CScript spent = CScript() << OP_HASH160 << std::vector<unsigned char>(20, 4) << OP_EQUAL;
+    CScript opReturn = CScript() << OP_RETURN << std::vector<unsigned char>(20, 5);
+    CScript excluded = CScript() << OP_HASH160 << std::vector<unsigned char>(20, 6) << OP_EQUAL;
+
+    CMutableTransaction coinbase;
+    coinbase.vin.resize(1);
+    coinbase.vout.push_back(CTxOut(50 * COIN, included1));
+
+    CMutableTransaction tx;
+    tx.vin.resize(2);
+    tx.vin[0].prevout = COutPoint(GetRandHash(), 0);
+    tx.vin[1].prevout = COutPoint(GetRandHash(), 1);
+    tx.vout.push_back(CTxOut(1 * COIN, included2));
+    tx.vout.push_back(CTxOut(1 * COIN, sigmaMint));
+    tx.vout.push_back(CTxOut(0, opReturn));
+    tx.vout.push_back(CTxOut(0, CScript()));
+
+    CBlock block;
+    block.vtx.push_back(MakeTransactionRef(coinbase));
+    block.vtx.push_back(MakeTransactionRef(tx));
+
+    CBlockUndo blockUndo;
+    blockUndo.vtxundo.resize(1);
+    blockUndo.vtxundo[0].vprevout.push_back(CTxInUndo(CTxOut(2 * COIN, spent)));
+    blockUndo.vtxundo[0].vprevout.push_back(CTxInUndo(CTxOut(1 * COIN, CScript())));
+
+    BlockFilter blockFilter(BLOCK_FILTER_BASIC, block, blockUndo);
+    const GCSFilter& filter = blockFilter.GetFilter();
+
+    BOOST_CHECK_EQUAL(filter.GetN(), 4);
+    BOOST_CHECK(filter.Match(GCSFilter::Element(included1.begin(), included1.end())));
+    BOOST_CHECK(filter.Match(GCSFilter::Element(included2.begin(), included2.end())));
+    BOOST_CHECK(filter.Match(GCSFilter::Element(sigmaMint.begin(), sigmaMint.end())));
+    BOOST_CHECK(filter.Match(GCSFilter::Element(spent.begin(), spent.end())));
+    BOOST_CHECK(!filter.Match(GCSFilter::Element(opReturn.begin(), opReturn.end())));
+    BOOST_CHECK(!filter.Match(GCSFilter::Element(excluded.begin(), excluded.end())));
+
+    // Reconstruct from the encoding, and from the wire format
+    BlockFilter decoded(BLOCK_FILTER_BASIC, block.GetHash(), blockFilter.GetEncodedFilter());
+    BOOST_CHECK(decoded.GetEncodedFilter() == blockFilter.GetEncodedFilter());
+
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << blockFilter;
+    BlockFilter received;
+    stream >> received;
+    BOOST_CHECK(received.GetFilterType() == BLOCK_FILTER_BASIC);
+    BOOST_CHECK(received.GetBlockHash() == block.GetHash());
+    BOOST_CHECK(received.GetEncodedFilter() == blockFilter.GetEncodedFilter());
+    BOOST_CHECK(received.GetFilter().Match(GCSFilter::Element(spent.begin(), spent.end())));
+
+    // Headers chain the filter hashes
+    uint256 prevHeader = GetRandHash();
+    uint256 filterHash = blockFilter.GetHash();
+    BOOST_CHECK(blockFilter.ComputeHeader(prevHeader) ==
+        Hash(filterHash.begin(), filterHash.end(), prevHeader.begin(), prevHeader.end()));
+
+    BOOST_CHECK_THROW(BlockFilter(BLOCK_FILTER_INVALID, block, blockUndo), std::invalid_argument);
+
+    BlockFilterType filterType;
+    BOOST_CHECK(BlockFilterTypeByName("basic", filterType));
+    BOOST_CHECK(filterType == BLOCK_FILTER_BASIC);
+    BOOST_CHECK(!BlockFilterTypeByName("extended", filterType));
+}
+
+BOOST_FIXTURE_TEST_CASE(blockfilterindex_sync, ZerocoinTestingSetup200)
+{
+    CBlockFilterIndex index(BLOCK_FILTER_BASIC, 1 << 20, true);
+    BOOST_REQUIRE(index.Init());
+    BOOST_CHECK(index.BestBlock() == NULL);
+
+    while (index.SyncNext() == CBlockFilterIndex::SYNC_BLOCK) {}
+    BOOST_CHECK(index.BestBlock() == chainActive.Tip());
+
+    // Every filter is the one of the block on disk, and every header chains to the previous one
+    uint256 prevHeader;
+    for (int nHeight = 0; nHeight <= chainActive.Height(); nHeight++) {
+        const CBlockIndex* pindex = chainActive[nHeight];
+
+        CBlock block;
+        BOOST_REQUIRE(ReadBlockFromDisk(block, pindex, Params().GetConsensus()));
+        CBlockUndo blockUndo;
+        if (pindex->pprev)
+            BOOST_REQUIRE(ReadBlockUndoFromDisk(blockUndo, pindex));
+        BlockFilter expected(BLOCK_FILTER_BASIC, block, blockUndo);
+
+        BlockFilter filter;
+        uint256 header;
+        BOOST_REQUIRE(index.LookupFilter(pindex, filter));
+        BOOST_REQUIRE(index.LookupFilterHeader(pindex, header));
+        BOOST_CHECK(filter.GetEncodedFilter() == expected.GetEncodedFilter());
+        BOOST_CHECK(header == expected.ComputeHeader(prevHeader));
+        prevHeader = header;
+    }
+
+    // The index follows the chain as it grows; Sigma mints are allowed from block 400 on regtest
+    CreateAndProcessEmptyBlocks(201, scriptPubKey);
+    while (index.SyncNext() == CBlockFilterIndex::SYNC_BLOCK) {}
+    BOOST_CHECK(index.BestBlock() == chainActive.Tip());
+
+    // A block with a Sigma mint; its filter matches the mint script
+    string stringError;
+    vector<pair<std::string, int>> denominationPairs = {std::make_pair("1", 1)};
+    BOOST_CHECK_MESSAGE(pwalletMain->CreateZerocoinMintModel(
+        stringError, denominationPairs, SIGMA), stringError + " - Create Mint failed");
+    BOOST_REQUIRE(mempool.size() == 1);
+    CBlock block = CreateAndProcessBlock({}, scriptPubKey);
+    BOOST_REQUIRE(block.vtx.size() == 2);
+
+    BOOST_CHECK(!index.LookupFilterHeader(chainActive.Tip(), prevHeader));
+    BOOST_CHECK(index.SyncNext() == CBlockFilterIndex::SYNC_BLOCK);
+    BOOST_CHECK(index.SyncNext() == CBlockFilterIndex::SYNC_CAUGHT_UP);
+    BOOST_CHECK(index.BestBlock() == chainActive.Tip());
+
+    BlockFilter filter;
+    BOOST_REQUIRE(index.LookupFilter(chainActive.Tip(), filter));
+    bool fFoundMint = false;
+    for (const CTxOut& txout : block.vtx[1]->vout) {
+        if (txout.scriptPubKey.IsSigmaMint()) {
+            fFoundMint = true;
+            BOOST_CHECK(filter.GetFilter().Match(GCSFilter::Element(txout.scriptPubKey.begin(), txout.scriptPubKey.end())));
+        }
+    }
+    BOOST_CHECK(fFoundMint);
+
+    // Ranges agree with single lookups
+    std::vector<BlockFilter> filters;
+    std::vector<uint256> hashes;
+    int nStartHeight = chainActive.Height() - 9;
+    BOOST_REQUIRE(index.LookupFilterRange(nStartHeight, chainActive.Tip(), filters));
+    BOOST_REQUIRE(index.LookupFilterHashRange(nStartHeight, chainActive.Tip(), hashes));
+    BOOST_REQUIRE_EQUAL(filters.size(), 10);
+    BOOST_REQUIRE_EQUAL(hashes.size(), 10);
+    for (size_t i = 0; i < filters.size(); i++) {
+        BOOST_CHECK(filters[i].GetBlockHash() == chainActive[nStartHeight + i]->GetBlockHash());
+        BOOST_CHECK(hashes[i] == filters[i].GetHash());
+    }
+    BOOST_CHECK(!index.LookupFilterRange(chainActive.Height() + 1, chainActive.Tip(), filters));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
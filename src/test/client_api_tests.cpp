@@ -56,11 +56,11 @@ struct ClientApiTestingSetup : public TestingSetup {
         {
             std::vector<CMutableTransaction> noTxns;
             CBlock b = CreateAndProcessBlock(noTxns, script);
-            coinbaseTxns.push_back(b.vtx[0]);
+            coinbaseTxns.push_back(*b.vtx[0]);
             LOCK(cs_main);
             {
                 LOCK(pwalletMain->cs_wallet);
-                pwalletMain->AddToWalletIfInvolvingMe(b.vtx[0], &b, true);
+                pwalletMain->AddToWalletIfInvolvingMe(*b.vtx[0], &b, true);
             }
         }
         sendZcoin();
@@ -70,7 +70,7 @@ struct ClientApiTestingSetup : public TestingSetup {
         {
             LOCK(pwalletMain->cs_wallet);
             for(int i=0;i<b.vtx.size();i++)
-                pwalletMain->AddToWalletIfInvolvingMe(b.vtx[i], &b, true);
+                pwalletMain->AddToWalletIfInvolvingMe(*b.vtx[i], &b, true);
         }
 
         printf("Balance after 300 blocks: %ld\n", pwalletMain->GetBalance());
@@ -86,7 +86,7 @@ struct ClientApiTestingSetup : public TestingSetup {
         if(txns.size() > 0) {
             block.vtx.resize(1);
             BOOST_FOREACH(const CMutableTransaction& tx, txns)
-                block.vtx.push_back(tx);
+                block.vtx.push_back(MakeTransactionRef(tx));
         }
         // IncrementExtraNonce creates a valid coinbase and merkleRoot
         unsigned int extraNonce = 0;
@@ -221,7 +221,7 @@ BOOST_AUTO_TEST_CASE(transaction_test)
 
     CBlock block;
     ReadBlockFromDisk(block, chainActive.Tip(), Params().GetConsensus());
-    const CWalletTx *coinbaseTx = pwalletMain->GetWalletTx(block.vtx[0].GetHash());
+    const CWalletTx *coinbaseTx = pwalletMain->GetWalletTx(block.vtx[0]->GetHash());
     data.push_back(Pair("txRaw",EncodeHexTx(*coinbaseTx)));
 
     valRequest.push_back(Pair("type","initial"));
@@ -9,6 +9,7 @@
 #include "crypto/sha512.h"
 #include "crypto/hmac_sha256.h"
 #include "crypto/hmac_sha512.h"
+#include "hash.h"
 #include "random.h"
 #include "utilstrencodings.h"
 #include "test/test_bitcoin.h"
@@ -255,6 +256,50 @@ BOOST_AUTO_TEST_CASE(sha256_testvectors) {
     TestSHA256(test1, "a316d55510b49662420f49d145d42fb83f31ef8dc016aa4e32df049991a91e26");
 }
 
+BOOST_AUTO_TEST_CASE(sha256d64)
+{
+    for (int i = 0; i <= 32; ++i) {
+        unsigned char in[64 * 32];
+        unsigned char out1[32 * 32], out2[32 * 32];
+        for (int j = 0; j < 64 * i; ++j) {
+            in[j] = insecure_rand();
+        }
+        for (int j = 0; j < i; ++j) {
+            CHash256().Write(in + 64 * j, 64).Finalize(out1 + 32 * j);
+        }
+        SHA256D64(out2, in, i);
+        BOOST_CHECK(memcmp(out1, out2, 32 * i) == 0);
+        // Merkle tree building hashes a level in place.
+        SHA256D64(in, in, i);
+        BOOST_CHECK(memcmp(out1, in, 32 * i) == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_implementations)
+{
+    // Every implementation the CPU supports must agree with the portable one.
+    const int implementations[] = {SHA256_STANDARD, SHA256_SSE41, SHA256_AVX2, SHA256_SHANI, SHA256_ALL};
+    unsigned char in[64 * 19];
+    unsigned char expected[32 * 19], out[32 * 19];
+    for (size_t j = 0; j < sizeof(in); ++j) {
+        in[j] = insecure_rand();
+    }
+    SHA256AutoDetect(SHA256_STANDARD);
+    for (int j = 0; j < 19; ++j) {
+        CHash256().Write(in + 64 * j, 64).Finalize(expected + 32 * j);
+    }
+    for (size_t i = 0; i < sizeof(implementations) / sizeof(implementations[0]); ++i) {
+        BOOST_TEST_MESSAGE("Using the " << SHA256AutoDetect(implementations[i]) << " SHA256 implementation");
+        TestSHA256("abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+        TestSHA256(std::string(1000000, 'a'),
+                   "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+        TestSHA256(test1, "a316d55510b49662420f49d145d42fb83f31ef8dc016aa4e32df049991a91e26");
+        SHA256D64(out, in, 19);
+        BOOST_CHECK(memcmp(out, expected, sizeof(out)) == 0);
+    }
+    SHA256AutoDetect();
+}
+
 BOOST_AUTO_TEST_CASE(sha512_testvectors) {
     TestSHA512("",
                "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
@@ -0,0 +1,80 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "darksend.h"
+#include "key.h"
+#include "random.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(darksend_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(recovered_key_cache)
+{
+    CRecoveredKeyCache cache(64);
+    std::vector<unsigned char> vchSig(65, 1);
+
+    std::vector<uint256> entries;
+    for (int i = 0; i < 32; i++) {
+        entries.push_back(cache.ComputeEntry(GetRandHash(), vchSig));
+        CKeyID keyID;
+        BOOST_CHECK(!cache.Get(entries.back(), keyID));
+        cache.Insert(entries.back(), CKeyID(uint160(std::vector<unsigned char>(20, i))));
+    }
+
+    // Entries are salted: the same message and signature map to the same entry, another signature does not
+    uint256 hashMessage = GetRandHash();
+    BOOST_CHECK(cache.ComputeEntry(hashMessage, vchSig) == cache.ComputeEntry(hashMessage, vchSig));
+    BOOST_CHECK(cache.ComputeEntry(hashMessage, vchSig) != cache.ComputeEntry(hashMessage, std::vector<unsigned char>(65, 2)));
+    BOOST_CHECK(CRecoveredKeyCache(64).ComputeEntry(hashMessage, vchSig) != cache.ComputeEntry(hashMessage, vchSig));
+
+    // At half load displacement keeps nearly everything, and a lookup never returns a wrong key
+    int nFound = 0;
+    for (int i = 0; i < 32; i++) {
+        CKeyID keyID;
+        if (cache.Get(entries[i], keyID)) {
+            BOOST_CHECK(keyID == CKeyID(uint160(std::vector<unsigned char>(20, i))));
+            nFound++;
+        }
+    }
+    BOOST_CHECK(nFound >= 24);
+
+    // The table stays bounded however much is inserted
+    for (int i = 0; i < 1000; i++)
+        cache.Insert(cache.ComputeEntry(GetRandHash(), vchSig), CKeyID());
+    nFound = 0;
+    for (int i = 0; i < 32; i++) {
+        CKeyID keyID;
+        nFound += cache.Get(entries[i], keyID);
+    }
+    BOOST_CHECK(nFound < 32);
+}
+
+BOOST_AUTO_TEST_CASE(verify_message_cached)
+{
+    CKey key, otherKey;
+    key.MakeNewKey(true);
+    otherKey.MakeNewKey(true);
+
+    CDarkSendSigner signer;
+    std::vector<unsigned char> vchSig;
+    std::string strError;
+    BOOST_REQUIRE(signer.SignMessage("indexnode ping", vchSig, key));
+
+    // The second round is served from the cache and must give the same answers
+    for (int i = 0; i < 2; i++) {
+        BOOST_CHECK(signer.VerifyMessage(key.GetPubKey(), vchSig, "indexnode ping", strError));
+        BOOST_CHECK(!signer.VerifyMessage(otherKey.GetPubKey(), vchSig, "indexnode ping", strError));
+        BOOST_CHECK(!signer.VerifyMessage(key.GetPubKey(), vchSig, "indexnode pong", strError));
+    }
+
+    std::vector<unsigned char> vchBadSig(vchSig);
+    vchBadSig[0] = 0;
+    BOOST_CHECK(!signer.VerifyMessage(key.GetPubKey(), vchBadSig, "indexnode ping", strError));
+    BOOST_CHECK_EQUAL(strError, "Error recovering public key.");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -124,11 +124,11 @@ ZerocoinTestingSetupBase::~ZerocoinTestingSetupBase() {
         for (int i = 0; i < 200; i++)
         {
             CBlock b = CreateAndProcessBlock({}, scriptPubKey);
-            coinbaseTxns.push_back(b.vtx[0]);
+            coinbaseTxns.push_back(*b.vtx[0]);
             LOCK(cs_main);
             {
                 LOCK(pwalletMain->cs_wallet);
-                pwalletMain->AddToWalletIfInvolvingMe(b.vtx[0], &b, true);
+                pwalletMain->AddToWalletIfInvolvingMe(*b.vtx[0], &b, true);
             }
         }
 
@@ -150,11 +150,11 @@ ZerocoinTestingSetupBase::~ZerocoinTestingSetupBase() {
         for (int i = 0; i < 109; i++)
         {
             CBlock b = CreateAndProcessBlock({}, scriptPubKey);
-            coinbaseTxns.push_back(b.vtx[0]);
+            coinbaseTxns.push_back(*b.vtx[0]);
             LOCK(cs_main);
             {
                 LOCK(pwalletMain->cs_wallet);
-                pwalletMain->AddToWalletIfInvolvingMe(b.vtx[0], &b, true);
+                pwalletMain->AddToWalletIfInvolvingMe(*b.vtx[0], &b, true);
             }
         }
 
@@ -177,11 +177,11 @@ MtpMalformedTestingSetup::MtpMalformedTestingSetup()
         for (int i = 0; i < 150; i++)
         {
             b = CreateAndProcessBlock({}, scriptPubKey, mtp);
-            coinbaseTxns.push_back(b.vtx[0]);
+            coinbaseTxns.push_back(*b.vtx[0]);
             LOCK(cs_main);
             {
                 LOCK(pwalletMain->cs_wallet);
-                pwalletMain->AddToWalletIfInvolvingMe(b.vtx[0], &b, true);
+                pwalletMain->AddToWalletIfInvolvingMe(*b.vtx[0], &b, true);
             }
         }
         printf("Balance after 150 blocks: %ld\n", pwalletMain->GetBalance());
@@ -63,11 +63,11 @@ struct IndexnodeTestingSetup : public TestingSetup {
         {
             std::vector<CMutableTransaction> noTxns;
             b = CreateAndProcessBlock(noTxns, scriptPubKeyIndexnode, mtp);
-            coinbaseTxns.push_back(b.vtx[0]);
+            coinbaseTxns.push_back(*b.vtx[0]);
             LOCK(cs_main);
             {
                 LOCK(pwalletMain->cs_wallet);
-                pwalletMain->AddToWalletIfInvolvingMe(b.vtx[0], &b, true);
+                pwalletMain->AddToWalletIfInvolvingMe(*b.vtx[0], &b, true);
             }   
         }
         printf("Balance after 150 blocks: %ld\n", pwalletMain->GetBalance());
@@ -84,7 +84,7 @@ struct IndexnodeTestingSetup : public TestingSetup {
         if(txns.size() > 0) {
             block.vtx.resize(1);
             BOOST_FOREACH(const CMutableTransaction& tx, txns)
-                block.vtx.push_back(tx);
+                block.vtx.push_back(MakeTransactionRef(tx));
         }
         // IncrementExtraNonce creates a valid coinbase and merkleRoot
         unsigned int extraNonce = 0;
@@ -126,7 +126,7 @@ BOOST_AUTO_TEST_CASE(Test_EnforceIndexnodePayment)
     CBlock b = CreateAndProcessBlock(noTxns, scriptPubKeyIndexnode, false);
     const CChainParams& chainparams = Params();
 
-    CTransaction& tx = b.vtx[0];
+    CMutableTransaction tx(*b.vtx[0]);
     bool mutated;
     b.fChecked = false;
     b.hashMerkleRoot = BlockMerkleRoot(b, &mutated);
@@ -134,7 +134,7 @@ BOOST_AUTO_TEST_CASE(Test_EnforceIndexnodePayment)
         ++b.nNonce;
     }
 
-    BOOST_CHECK(tx.IsCoinBase());
+    BOOST_CHECK(b.vtx[0]->IsCoinBase());
 
     CValidationState state;
     BOOST_CHECK(true == CheckBlock(b, state, chainparams.GetConsensus()));
@@ -171,6 +171,7 @@ BOOST_AUTO_TEST_CASE(Test_EnforceIndexnodePayment)
     ///////////////////////////////////////////////////////////////////////////
     // Paying to a completely wrong payee
     tx.vout[1].scriptPubKey = tx.vout[0].scriptPubKey;
+    b.vtx[0] = MakeTransactionRef(tx);
     b.fChecked = false;
     b.hashMerkleRoot = BlockMerkleRoot(b, &mutated);
     while (!CheckProofOfWork(b.GetPoWHash(), b.nBits, chainparams.GetConsensus())){
@@ -204,6 +205,7 @@ BOOST_AUTO_TEST_CASE(Test_EnforceIndexnodePayment)
     mnpayments.mapIndexnodeBlocks[after_block].vecPayees.insert(mnpayments.mapIndexnodeBlocks[after_block].vecPayees.begin(), payee2);
 
     tx.vout[1].scriptPubKey = payee1.GetPayee();
+    b.vtx[0] = MakeTransactionRef(tx);
     b.fChecked = false;
     b.hashMerkleRoot = BlockMerkleRoot(b, &mutated);
     while (!CheckProofOfWork(b.GetPoWHash(), b.nBits, chainparams.GetConsensus())){
@@ -216,6 +218,7 @@ BOOST_AUTO_TEST_CASE(Test_EnforceIndexnodePayment)
     ///////////////////////////////////////////////////////////////////////////
     // Checking the functionality is disabled for previous blocks
     tx.vout[1].scriptPubKey = tx.vout[2].scriptPubKey;
+    b.vtx[0] = MakeTransactionRef(tx);
     b.fChecked = false;
     b.hashMerkleRoot = BlockMerkleRoot(b, &mutated);
     while (!CheckProofOfWork(b.GetPoWHash(), b.nBits, chainparams.GetConsensus())){
@@ -103,6 +103,64 @@ BOOST_AUTO_TEST_CASE(MempoolRemoveTest)
     removed.clear();
 }
 
+BOOST_AUTO_TEST_CASE(MempoolAddFromPoolTest)
+{
+    // Test CTxMemPool::addFromPool, used to mirror the mempool into the Dandelion stempool
+
+    TestMemPoolEntryHelper entry;
+    CMutableTransaction txParent;
+    txParent.vin.resize(1);
+    txParent.vin[0].scriptSig = CScript() << OP_11;
+    txParent.vout.resize(1);
+    txParent.vout[0].scriptPubKey = CScript() << OP_11 << OP_EQUAL;
+    txParent.vout[0].nValue = 33000LL;
+
+    CMutableTransaction txChild;
+    txChild.vin.resize(1);
+    txChild.vin[0].scriptSig = CScript() << OP_11;
+    txChild.vin[0].prevout.hash = txParent.GetHash();
+    txChild.vin[0].prevout.n = 0;
+    txChild.vout.resize(1);
+    txChild.vout[0].scriptPubKey = CScript() << OP_11 << OP_EQUAL;
+    txChild.vout[0].nValue = 11000LL;
+
+    // Spends the same output as txChild
+    CMutableTransaction txDoubleSpend = txChild;
+    txDoubleSpend.vout[0].nValue = 10000LL;
+
+    CTxMemPool sourcePool(CFeeRate(0));
+    CTxMemPool targetPool(CFeeRate(0));
+
+    // Unknown to the source pool:
+    BOOST_CHECK(!targetPool.addFromPool(sourcePool, txParent.GetHash()));
+
+    sourcePool.addUnchecked(txParent.GetHash(), entry.Fee(10000LL).FromTx(txParent));
+    sourcePool.addUnchecked(txChild.GetHash(), entry.Fee(1000LL).FromTx(txChild));
+
+    BOOST_CHECK(targetPool.addFromPool(sourcePool, txParent.GetHash()));
+    BOOST_CHECK(targetPool.addFromPool(sourcePool, txChild.GetHash()));
+    BOOST_CHECK_EQUAL(targetPool.size(), 2);
+
+    // Already present:
+    BOOST_CHECK(!targetPool.addFromPool(sourcePool, txChild.GetHash()));
+
+    // Both pools share the transaction and agree on the package state
+    BOOST_CHECK(targetPool.get(txChild.GetHash()) == sourcePool.get(txChild.GetHash()));
+    CTxMemPool::txiter sourceParent = sourcePool.mapTx.find(txParent.GetHash());
+    CTxMemPool::txiter targetParent = targetPool.mapTx.find(txParent.GetHash());
+    BOOST_CHECK_EQUAL(targetParent->GetCountWithDescendants(), sourceParent->GetCountWithDescendants());
+    BOOST_CHECK_EQUAL(targetParent->GetModFeesWithDescendants(), sourceParent->GetModFeesWithDescendants());
+    CTxMemPool::txiter targetChild = targetPool.mapTx.find(txChild.GetHash());
+    BOOST_CHECK_EQUAL(targetChild->GetCountWithAncestors(), 2);
+    BOOST_CHECK(!targetChild->WasClearAtEntry());
+
+    // A conflicting transaction is not mirrored
+    CTxMemPool otherPool(CFeeRate(0));
+    otherPool.addUnchecked(txDoubleSpend.GetHash(), entry.FromTx(txDoubleSpend));
+    BOOST_CHECK(!targetPool.addFromPool(otherPool, txDoubleSpend.GetHash()));
+    BOOST_CHECK_EQUAL(targetPool.size(), 2);
+}
+
 template<typename name>
 void CheckSort(CTxMemPool &pool, std::vector<std::string> &sortedOrder)
 {
@@ -411,8 +469,8 @@ BOOST_AUTO_TEST_CASE(MempoolAncestorIndexingTest)
     CheckSort<ancestor_score>(pool, sortedOrder);
 
     /* after tx6 is mined, tx7 should move up in the sort */
-    std::vector<CTransaction> vtx;
-    vtx.push_back(tx6);
+    std::vector<CTransactionRef> vtx;
+    vtx.push_back(MakeTransactionRef(tx6));
     std::list<CTransaction> dummy;
     pool.removeForBlock(vtx, 1, dummy, false);
 
@@ -548,7 +606,7 @@ BOOST_AUTO_TEST_CASE(MempoolSizeLimitTest)
     pool.addUnchecked(tx5.GetHash(), entry.Fee(1000LL).FromTx(tx5, &pool));
     pool.addUnchecked(tx7.GetHash(), entry.Fee(9000LL).FromTx(tx7, &pool));
 
-    std::vector<CTransaction> vtx;
+    std::vector<CTransactionRef> vtx;
     std::list<CTransaction> conflicts;
     SetMockTime(42);
     SetMockTime(42 + CTxMemPool::ROLLING_FEE_HALFLIFE);
@@ -2,8 +2,11 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include "clientversion.h"
 #include "policy/policy.h"
 #include "policy/fees.h"
+#include "random.h"
+#include "streams.h"
 #include "txmempool.h"
 #include "uint256.h"
 #include "util.h"
@@ -54,7 +57,7 @@ BOOST_AUTO_TEST_CASE(BlockPolicyEstimates)
     CFeeRate baseRate(basefee, GetVirtualTransactionSize(tx));
 
     // Create a fake block
-    std::vector<CTransaction> block;
+    std::vector<CTransactionRef> block;
     int blocknum = 0;
 
     // Loop through 200 blocks
@@ -77,7 +80,7 @@ BOOST_AUTO_TEST_CASE(BlockPolicyEstimates)
             while (txHashes[9-h].size()) {
                 std::shared_ptr<const CTransaction> ptx = mpool.get(txHashes[9-h].back());
                 if (ptx)
-                    block.push_back(*ptx);
+                    block.push_back(ptx);
                 txHashes[9-h].pop_back();
             }
         }
@@ -176,7 +179,7 @@ BOOST_AUTO_TEST_CASE(BlockPolicyEstimates)
         while(txHashes[j].size()) {
             std::shared_ptr<const CTransaction> ptx = mpool.get(txHashes[j].back());
             if (ptx)
-                block.push_back(*ptx);
+                block.push_back(ptx);
             txHashes[j].pop_back();
         }
     }
@@ -199,7 +202,7 @@ BOOST_AUTO_TEST_CASE(BlockPolicyEstimates)
                 mpool.addUnchecked(hash, entry.Fee(feeV[k/4][j]).Time(GetTime()).Priority(priV[k/4][j]).Height(blocknum).FromTx(tx, &mpool));
                 std::shared_ptr<const CTransaction> ptx = mpool.get(hash);
                 if (ptx)
-                    block.push_back(*ptx);
+                    block.push_back(ptx);
             }
         }
         mpool.removeForBlock(block, ++blocknum, dummyConflicted);
@@ -226,4 +229,68 @@ BOOST_AUTO_TEST_CASE(BlockPolicyEstimates)
     }
 }
 
+BOOST_AUTO_TEST_CASE(SigmaSpendEstimates)
+{
+    CTxMemPool mpool(CFeeRate(1000));
+    CBlockPolicyEstimator estimator(CFeeRate(1000));
+    TestMemPoolEntryHelper entry;
+    entry.HadNoDependencies(true);
+    CAmount transparentFee(2000), sigmaFee(50000);
+
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vout.resize(1);
+    tx.vout[0].nValue = 0LL;
+
+    // Sigma spends pay a lot more and get in the next block, transparent transactions
+    // pay little and take a few blocks
+    std::vector<CTxMemPoolEntry> mempoolEntries;
+    for (unsigned int blocknum = 1; blocknum <= 200; blocknum++) {
+        for (int k = 0; k < 10; k++) {
+            bool fSigma = k % 2;
+            tx.vin[0].prevout = COutPoint(fSigma ? uint256() : GetRandHash(), 1 + k);
+            tx.vin[0].scriptSig = fSigma ? CScript() << OP_SIGMASPEND << std::vector<unsigned char>(100, 'X') : CScript();
+            CTxMemPoolEntry txEntry = entry.Fee(fSigma ? sigmaFee : transparentFee).Height(blocknum).FromTx(tx);
+            BOOST_CHECK(txEntry.GetTx().IsSigmaSpend() == fSigma);
+            estimator.processTransaction(txEntry, true);
+            mempoolEntries.push_back(txEntry);
+        }
+
+        std::vector<CTxMemPoolEntry> blockEntries;
+        std::vector<CTxMemPoolEntry> remaining;
+        for (const CTxMemPoolEntry& txEntry : mempoolEntries) {
+            bool fSigma = txEntry.GetTx().IsSigmaSpend();
+            if (fSigma || blocknum - txEntry.GetHeight() >= 3) {
+                estimator.removeTx(txEntry.GetTx().GetHash());
+                blockEntries.push_back(txEntry);
+            } else {
+                remaining.push_back(txEntry);
+            }
+        }
+        mempoolEntries.swap(remaining);
+        estimator.processBlock(blocknum + 1, blockEntries, true);
+    }
+
+    CFeeRate sigmaRate = estimator.estimateFee(2, FeeEstimateClass::SIGMA);
+    CFeeRate transparentRate = estimator.estimateFee(5, FeeEstimateClass::TRANSPARENT);
+    BOOST_CHECK(sigmaRate > CFeeRate(0));
+    BOOST_CHECK(transparentRate > CFeeRate(0));
+    BOOST_CHECK(sigmaRate > transparentRate);
+    // Transparent transactions never get in within two blocks
+    BOOST_CHECK(estimator.estimateFee(2) == CFeeRate(0));
+
+    int answerFound;
+    BOOST_CHECK(estimator.estimateSmartFee(1, &answerFound, mpool, FeeEstimateClass::SIGMA) == sigmaRate);
+    BOOST_CHECK_EQUAL(answerFound, 2);
+
+    // Both classes survive a write and read of the estimates file
+    CAutoFile file(tmpfile(), SER_DISK, CLIENT_VERSION);
+    estimator.Write(file);
+    rewind(file.Get());
+    CBlockPolicyEstimator estimatorRead(CFeeRate(1000));
+    estimatorRead.Read(file);
+    BOOST_CHECK(std::abs(estimatorRead.estimateFee(2, FeeEstimateClass::SIGMA).GetFeePerK() - sigmaRate.GetFeePerK()) <= 1);
+    BOOST_CHECK(std::abs(estimatorRead.estimateFee(5).GetFeePerK() - transparentRate.GetFeePerK()) <= 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,7 @@
 #include "chain.h"
 #include "chainparams.h"
 #include "pow.h"
+#include "primitives/block.h"
 #include "random.h"
 #include "util.h"
 #include "test/test_bitcoin.h"
@@ -95,4 +96,111 @@ BOOST_AUTO_TEST_CASE(GetBlockProofEquivalentTime_test)
     }
 }
 
+BOOST_AUTO_TEST_CASE(pow_hasher_matches_header)
+{
+    // Keep drawing previous block hashes until every algorithm has been the
+    // first X16Rv2 stage, which is the one resumed from the midstate.
+    std::set<int> firstStages;
+    for (int i = 0; i < 1000 && firstStages.size() < 16; i++) {
+        CBlockHeader header;
+        header.hashPrevBlock = GetRandHash();
+        header.hashMerkleRoot = GetRandHash();
+        header.nTime = 1269211443 + i;
+        header.nBits = 0x1c387f6f;
+        firstStages.insert(header.hashPrevBlock.GetNibble(48));
+
+        CBlockHeaderPoWHasher hasher(header);
+        for (uint32_t nNonce = 0; nNonce < 3; nNonce++) {
+            header.nNonce = nNonce * 0x01010101;
+            BOOST_CHECK(hasher.GetPoWHash(header.nNonce) == header.GetPoWHash());
+        }
+    }
+    BOOST_CHECK_EQUAL(firstStages.size(), 16U);
+}
+
+/* Dark Gravity Wave as it was computed before the proof type links: a plain walk over pprev */
+static unsigned int DarkGravityWaveWalk(const CBlockIndex* pindexLast, const Consensus::Params& params, bool fProofOfStake)
+{
+    const arith_uint256 bnPowLimit = UintToArith256(params.powLimit);
+    if (!pindexLast || pindexLast->nHeight < params.nDgwPastBlocks)
+        return bnPowLimit.GetCompact();
+
+    const CBlockIndex *pindex = pindexLast;
+    arith_uint256 bnPastTargetAvg = 0;
+    unsigned int nCountBlocks = 0;
+    while (nCountBlocks < (unsigned int)params.nDgwPastBlocks) {
+        if (!pindex)
+            return bnPowLimit.GetCompact();
+        if (pindex->IsProofOfStake() != fProofOfStake) {
+            pindex = pindex->pprev;
+            continue;
+        }
+        arith_uint256 bnTarget = arith_uint256().SetCompact(pindex->nBits);
+        bnPastTargetAvg = (bnPastTargetAvg * nCountBlocks + bnTarget) / (nCountBlocks + 1);
+        if (++nCountBlocks != (unsigned int)params.nDgwPastBlocks)
+            pindex = pindex->pprev;
+    }
+
+    arith_uint256 bnNew(bnPastTargetAvg);
+    int64_t nActualTimespan = pindexLast->GetBlockTime() - pindex->GetBlockTime();
+    int64_t nTargetTimespan = params.nDgwPastBlocks * params.nPowTargetSpacing;
+    if (nActualTimespan < nTargetTimespan/3)
+        nActualTimespan = nTargetTimespan/3;
+    if (nActualTimespan > nTargetTimespan*3)
+        nActualTimespan = nTargetTimespan*3;
+    bnNew *= nActualTimespan;
+    bnNew /= nTargetTimespan;
+    if (bnNew > bnPowLimit)
+        bnNew = bnPowLimit;
+    return bnNew.GetCompact();
+}
+
+static const CBlockIndex* GetLastBlockIndexWalk(const CBlockIndex* pindex, bool fProofOfStake)
+{
+    while (pindex && pindex->pprev && (pindex->IsProofOfStake() != fProofOfStake))
+        pindex = pindex->pprev;
+    return pindex;
+}
+
+/* Difficulty computed through the proof type links matches the walk over a mixed PoW/PoS chain */
+BOOST_AUTO_TEST_CASE(dgw_proof_links)
+{
+    SelectParams(CBaseChainParams::MAIN);
+    const Consensus::Params& params = Params().GetConsensus();
+    const arith_uint256 bnPowLimit = UintToArith256(params.powLimit);
+
+    // Runs of random length of either type, some much longer than the averaging window
+    const int nBlocks = 3000;
+    std::vector<CBlockIndex> blocks(nBlocks);
+    std::vector<CBlockIndex> unlinked(nBlocks);
+    bool fProofOfStake = false;
+    int nRun = 0;
+    for (int i = 0; i < nBlocks; i++) {
+        if (nRun-- <= 0) {
+            fProofOfStake = insecure_rand() % 2;
+            nRun = insecure_rand() % 4 == 0 ? insecure_rand() % 200 : insecure_rand() % 5;
+        }
+        blocks[i].pprev = i ? &blocks[i - 1] : NULL;
+        blocks[i].nHeight = i;
+        blocks[i].nTime = 1269211443 + i * params.nPowTargetSpacing + insecure_rand() % 600;
+        blocks[i].nBits = arith_uint256(bnPowLimit >> (insecure_rand() % 24)).GetCompact();
+        blocks[i].nNonce = fProofOfStake ? 0 : 1 + insecure_rand() % 1000;
+        blocks[i].BuildProofLinks();
+
+        // The same chain without links takes the fallback walk
+        unlinked[i] = blocks[i];
+        unlinked[i].pprev = i ? &unlinked[i - 1] : NULL;
+        unlinked[i].pprevOtherProof = NULL;
+    }
+
+    for (int i = 0; i < nBlocks; i++) {
+        for (bool fPoS : {false, true}) {
+            unsigned int nExpected = DarkGravityWaveWalk(&blocks[i], params, fPoS);
+            BOOST_CHECK_EQUAL(GetNextWorkRequired(&blocks[i], NULL, params, fPoS), nExpected);
+            BOOST_CHECK_EQUAL(GetNextWorkRequired(&unlinked[i], NULL, params, fPoS), nExpected);
+            BOOST_CHECK(GetLastBlockIndex(&blocks[i], fPoS) == GetLastBlockIndexWalk(&blocks[i], fPoS));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
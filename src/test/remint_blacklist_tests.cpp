@@ -0,0 +1,59 @@
+#include "zerocoin.h"
+
+#include "data/remint_blacklist.json.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+#include <string.h>
+
+#include <univalue.h>
+
+extern UniValue read_json(const std::string& jsondata);
+
+extern const unsigned char sigmaRemintBlacklist[][32];
+extern const size_t sigmaRemintBlacklistSize;
+
+BOOST_FIXTURE_TEST_SUITE(remint_blacklist_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(remint_blacklist_matches_list)
+{
+    UniValue values = read_json(std::string(json_tests::remint_blacklist, json_tests::remint_blacklist + sizeof(json_tests::remint_blacklist)));
+
+    // The generated table is sorted and has exactly one entry per listed value
+    BOOST_CHECK_EQUAL(sigmaRemintBlacklistSize, values.size());
+    for (size_t i = 1; i < sigmaRemintBlacklistSize; i++)
+        BOOST_CHECK(memcmp(sigmaRemintBlacklist[i - 1], sigmaRemintBlacklist[i], 32) < 0);
+
+    std::set<uint256> digests;
+    for (size_t i = 0; i < values.size(); i++) {
+        CBigNum value;
+        value.SetHex(values[i].get_str());
+
+        BOOST_CHECK_MESSAGE(CZerocoinState::IsPublicCoinValueBlacklisted(value), values[i].get_str());
+        BOOST_CHECK(!CZerocoinState::IsPublicCoinValueBlacklisted(value + 1));
+        BOOST_CHECK(!CZerocoinState::IsPublicCoinValueBlacklisted(value - 1));
+
+        digests.insert(CZerocoinState::GetPublicCoinValueDigest(value));
+    }
+
+    for (size_t i = 0; i < sigmaRemintBlacklistSize; i++) {
+        uint256 digest;
+        memcpy(digest.begin(), sigmaRemintBlacklist[i], 32);
+        BOOST_CHECK(digests.count(digest) == 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(remint_blacklist_runtime_entries)
+{
+    CBigNum value;
+    value.SetHex("1234567890abcdef1234567890abcdef");
+
+    BOOST_CHECK(!CZerocoinState::IsPublicCoinValueBlacklisted(value));
+    CZerocoinState::BlacklistPublicCoinValue(value);
+    BOOST_CHECK(CZerocoinState::IsPublicCoinValueBlacklisted(value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -116,4 +116,53 @@ BOOST_AUTO_TEST_CASE(manythreads)
     BOOST_CHECK_EQUAL(counterSum, 200);
 }
 
+static void laneTask(boost::mutex& mutex, int& nRunning, int& nMaxRunning)
+{
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        nMaxRunning = std::max(nMaxRunning, ++nRunning);
+    }
+    MicroSleep(200);
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        --nRunning;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lanes)
+{
+    // Tasks in one lane never overlap, even with many threads servicing the queue,
+    // while tasks outside the lane keep running
+    CScheduler scheduler;
+    boost::mutex mutex;
+    int nRunning = 0, nMaxRunning = 0;
+    int nFree = 0;
+
+    boost::chrono::system_clock::time_point now = boost::chrono::system_clock::now();
+    for (int i = 0; i < 20; i++) {
+        scheduler.schedule(boost::bind(&laneTask, boost::ref(mutex), boost::ref(nRunning), boost::ref(nMaxRunning)), now, "lanetask", "lane");
+        scheduler.schedule([&mutex, &nFree]() {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            nFree++;
+        }, now, "freetask");
+    }
+
+    boost::thread_group threads;
+    for (int i = 0; i < 4; i++)
+        threads.create_thread(boost::bind(&CScheduler::serviceQueue, &scheduler));
+    scheduler.stop(true);
+    threads.join_all();
+
+    BOOST_CHECK_EQUAL(nMaxRunning, 1);
+    BOOST_CHECK_EQUAL(nFree, 20);
+
+    std::map<std::string, CScheduler::TaskStats> mapStats = scheduler.getTaskStats();
+    BOOST_CHECK_EQUAL(mapStats.size(), 2);
+    BOOST_CHECK_EQUAL(mapStats["lanetask"].nRuns, 20);
+    BOOST_CHECK_EQUAL(mapStats["freetask"].nRuns, 20);
+    BOOST_CHECK(mapStats["lanetask"].nMaxMicros >= 200);
+    BOOST_CHECK(mapStats["lanetask"].nTotalMicros >= 20 * 200);
+    BOOST_CHECK_EQUAL(mapStats["lanetask"].nOverruns, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+#include "chainparams.h"
+#include "main.h"
+#include "sigma.h"
+#include "txmempool.h"
+#include "zerocoin.h"
+
+#include "test/fixtures.h"
+#include "test/testutil.h"
+
+#include "wallet/wallet.h"
+
+#include <boost/test/unit_test.hpp>
+
+static void CheckSameMints(const sigma::mint_info_container& a, const sigma::mint_info_container& b)
+{
+    BOOST_CHECK_EQUAL(a.size(), b.size());
+    for (const auto& mint : a) {
+        auto it = b.find(mint.first);
+        BOOST_REQUIRE(it != b.end());
+        BOOST_CHECK(it->second.denomination == mint.second.denomination);
+        BOOST_CHECK_EQUAL(it->second.coinGroupId, mint.second.coinGroupId);
+        BOOST_CHECK_EQUAL(it->second.nHeight, mint.second.nHeight);
+    }
+}
+
+static void CheckSameSpends(const sigma::spend_info_container& a, const sigma::spend_info_container& b)
+{
+    BOOST_CHECK_EQUAL(a.size(), b.size());
+    for (const auto& spend : a) {
+        auto it = b.find(spend.first);
+        BOOST_REQUIRE(it != b.end());
+        BOOST_CHECK(it->second.denomination == spend.second.denomination);
+        BOOST_CHECK_EQUAL(it->second.coinGroupId, spend.second.coinGroupId);
+    }
+}
+
+static void CheckSameCoinGroup(const sigma::CSigmaState::SigmaCoinGroupInfo& a, const sigma::CSigmaState::SigmaCoinGroupInfo& b)
+{
+    BOOST_CHECK(a.firstBlock == b.firstBlock);
+    BOOST_CHECK(a.lastBlock == b.lastBlock);
+    BOOST_CHECK_EQUAL(a.nCoins, b.nCoins);
+}
+
+static void ReconnectAssumedValid(CBlockIndex *pindex)
+{
+    hashAssumeValidProofs = pindex->GetBlockHash();
+    CValidationState state;
+    {
+        LOCK(cs_main);
+        ReconsiderBlock(state, pindex);
+    }
+    BOOST_CHECK(ActivateBestChain(state, Params()));
+    hashAssumeValidProofs.SetNull();
+}
+
+BOOST_FIXTURE_TEST_SUITE(sigma_assumevalid_tests, ZerocoinTestingSetup200)
+
+BOOST_AUTO_TEST_CASE(assumevalid_proofs)
+{
+    sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
+    string stringError;
+
+    // consensus.nMintV3SigmaStartBlock = 400
+    CreateAndProcessEmptyBlocks(201, scriptPubKey);
+
+    pwalletMain->SetBroadcastTransactions(true);
+    vector<pair<std::string, int>> denominationPairs = {std::make_pair("1", 2)};
+    BOOST_CHECK_MESSAGE(pwalletMain->CreateZerocoinMintModel(
+        stringError, denominationPairs, SIGMA), stringError + " - Create Mint failed");
+    BOOST_CHECK(mempool.size() == 1);
+    CreateAndProcessBlock({}, scriptPubKey);
+    CreateAndProcessEmptyBlocks(6, scriptPubKey);
+
+    BOOST_CHECK_MESSAGE(pwalletMain->CreateZerocoinSpendModel(stringError, "", "1"), stringError + " - Spend failed");
+    BOOST_REQUIRE(mempool.size() == 1);
+
+    // A spend whose proof does not match its transaction any more
+    vector<uint256> vtxid;
+    mempool.queryHashes(vtxid);
+    CMutableTransaction forgedMutable(*mempool.get(vtxid[0]));
+    forgedMutable.nLockTime++;
+    CTransaction forged(forgedMutable);
+
+    {
+        LOCK(cs_main);
+        CValidationState state;
+        CZerocoinTxInfo zerocoinTxInfo;
+        sigma::CSigmaTxInfo sigmaTxInfo;
+        BOOST_CHECK(!CheckTransaction(forged, state, forged.GetHash(), false, chainActive.Height() + 1,
+                false, true, &zerocoinTxInfo, &sigmaTxInfo));
+        BOOST_CHECK(sigmaTxInfo.spentSerials.empty());
+
+        // Assumed valid, the proof is not looked at but the spend is still recorded
+        sigma::CSigmaTxInfo sigmaTxInfoAssumed;
+        sigmaTxInfoAssumed.fSkipProofVerification = true;
+        BOOST_CHECK(CheckTransaction(forged, state, forged.GetHash(), false, chainActive.Height() + 1,
+                false, true, &zerocoinTxInfo, &sigmaTxInfoAssumed));
+        BOOST_CHECK_EQUAL(sigmaTxInfoAssumed.spentSerials.size(), 1);
+    }
+
+    CAmount nFee = mempool.mapTx.find(vtxid[0])->GetFee();
+
+    // State after connecting the valid spend with its proof verified
+    CBlockIndex *pindexPrev = chainActive.Tip();
+    CBlock validBlock = CreateAndProcessBlock({}, scriptPubKey);
+    BOOST_REQUIRE(chainActive.Tip()->GetBlockHash() == validBlock.GetHash());
+    CBlockIndex *pindexValid = chainActive.Tip();
+    sigma::mint_info_container mints = sigmaState->GetMints();
+    sigma::spend_info_container spends = sigmaState->GetSpends();
+    BOOST_CHECK_EQUAL(spends.size(), 1);
+    int coinGroupId = sigmaState->GetLatestCoinID(sigma::CoinDenomination::SIGMA_DENOM_1);
+    sigma::CSigmaState::SigmaCoinGroupInfo coinGroup;
+    BOOST_REQUIRE(sigmaState->GetCoinGroupInfo(sigma::CoinDenomination::SIGMA_DENOM_1, coinGroupId, coinGroup));
+
+    // Connected again as an assumed-valid block, it gives the same state
+    {
+        LOCK(cs_main);
+        CValidationState state;
+        InvalidateBlock(state, Params(), pindexValid);
+    }
+    BOOST_CHECK(chainActive.Tip() == pindexPrev);
+    BOOST_CHECK(sigmaState->GetSpends().empty());
+    ReconnectAssumedValid(pindexValid);
+    BOOST_CHECK(chainActive.Tip() == pindexValid);
+    CheckSameMints(mints, sigmaState->GetMints());
+    CheckSameSpends(spends, sigmaState->GetSpends());
+    sigma::CSigmaState::SigmaCoinGroupInfo coinGroupAssumed;
+    BOOST_REQUIRE(sigmaState->GetCoinGroupInfo(sigma::CoinDenomination::SIGMA_DENOM_1, coinGroupId, coinGroupAssumed));
+    CheckSameCoinGroup(coinGroup, coinGroupAssumed);
+
+    // Take the valid spend off the chain and mine the forged one in its place
+    {
+        LOCK(cs_main);
+        CValidationState state;
+        InvalidateBlock(state, Params(), pindexValid);
+    }
+    BOOST_REQUIRE(chainActive.Tip() == pindexPrev);
+    mempool.clear();
+    mempool.addUnchecked(forged.GetHash(), TestMemPoolEntryHelper().Fee(nFee).FromTx(forged));
+
+    CBlock block = CreateBlock({}, scriptPubKey);
+    BOOST_REQUIRE_EQUAL(block.vtx.size(), 2);
+    BOOST_REQUIRE(block.vtx[1]->GetHash() == forged.GetHash());
+
+    // With its proof verified the block is rejected
+    ProcessBlock(block);
+    BOOST_CHECK(chainActive.Tip() == pindexPrev);
+    BOOST_CHECK(sigmaState->GetSpends().empty());
+    BOOST_REQUIRE(mapBlockIndex.count(block.GetHash()));
+    CBlockIndex *pindex = mapBlockIndex[block.GetHash()];
+
+    // Assumed valid, the same block is connected and its spend applied to the state
+    ReconnectAssumedValid(pindex);
+    BOOST_CHECK(chainActive.Tip() == pindex);
+    CheckSameSpends(spends, sigmaState->GetSpends());
+
+    mempool.clear();
+    sigmaState->Reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
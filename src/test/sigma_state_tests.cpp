@@ -1200,4 +1200,85 @@ BOOST_AUTO_TEST_CASE(sigma_surge_detection_failure_anywhere)
 }
 
 
+// GetCoinGroupSize has to agree with the size of the set GetCoinSetForSpend returns
+BOOST_AUTO_TEST_CASE(sigma_getcoingroupsize)
+{
+    sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
+    sigma::Params* params = sigma::Params::get_default();
+    std::vector<CBlockIndex> indexes;
+    indexes.resize(11);
+
+    indexes[0] = CreateBlockIndex(0);
+    chainActive.SetTip(&indexes[0]);
+
+    std::pair<sigma::CoinDenomination, int> denomination1Group1(sigma::CoinDenomination::SIGMA_DENOM_1, 1);
+
+    // blocks 1 to 10 mint 0, 1 or 2 coins each
+    for (int i = 1; i <= 10; i++) {
+        indexes[i] = CreateBlockIndex(i);
+        if (i % 3 != 0)
+            indexes[i].sigmaMintedPubCoins[denomination1Group1] = getPubcoins(generateCoins(params, i % 3, sigma::CoinDenomination::SIGMA_DENOM_1));
+        chainActive.SetTip(&indexes[i]);
+    }
+
+    sigma::BuildSigmaStateFromIndex(&chainActive);
+
+    for (int maxHeight = 0; maxHeight <= 12; maxHeight++) {
+        uint256 blockHash_out;
+        std::vector<sigma::PublicCoin> coins_out;
+        sigmaState->GetCoinSetForSpend(&chainActive, maxHeight,
+            sigma::CoinDenomination::SIGMA_DENOM_1, 1, blockHash_out, coins_out);
+
+        BOOST_CHECK_EQUAL(sigmaState->GetCoinGroupSize(sigma::CoinDenomination::SIGMA_DENOM_1, 1, maxHeight), (int)coins_out.size());
+    }
+
+    BOOST_CHECK_EQUAL(sigmaState->GetCoinGroupSize(sigma::CoinDenomination::SIGMA_DENOM_1, 2, 10), 0);
+    BOOST_CHECK_EQUAL(sigmaState->GetCoinGroupSize(sigma::CoinDenomination::SIGMA_DENOM_10, 1, 10), 0);
+
+    sigmaState->Reset();
+}
+
+// Outpoints of mints are recorded when their block is connected and dropped when it is disconnected
+BOOST_AUTO_TEST_CASE(sigma_mint_outpoint)
+{
+    LOCK(cs_main);
+    sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
+    auto params = sigma::Params::get_default();
+
+    const sigma::PrivateCoin privcoin(params, sigma::CoinDenomination::SIGMA_DENOM_1);
+    sigma::PublicCoin pubCoin = privcoin.getPublicCoin();
+
+    CScript mintScript;
+    mintScript << OP_SIGMAMINT;
+    std::vector<unsigned char> vch = pubCoin.getValue().getvch();
+    mintScript.insert(mintScript.end(), vch.begin(), vch.end());
+
+    CMutableTransaction tx;
+    tx.vout.resize(2);
+    tx.vout[0].scriptPubKey = CScript() << OP_TRUE;
+    tx.vout[0].nValue = COIN;
+    tx.vout[1].scriptPubKey = mintScript;
+    sigma::DenominationToInteger(sigma::CoinDenomination::SIGMA_DENOM_1, tx.vout[1].nValue);
+
+    CBlock block = CreateBlockWithMints({pubCoin});
+    block.vtx.push_back(MakeTransactionRef(tx));
+
+    CBlockIndex index = CreateBlockIndex(1);
+    sigmaState->AddMintsToStateAndBlockIndex(&index, &block);
+
+    COutPoint outPoint;
+    BOOST_CHECK(sigmaState->GetMintOutPoint(outPoint, pubCoin.getValue()));
+    BOOST_CHECK(outPoint == COutPoint(tx.GetHash(), 1));
+
+    // The lookup used by the wallet does not need to read the block any more
+    outPoint.SetNull();
+    BOOST_CHECK(sigma::GetOutPoint(outPoint, pubCoin));
+    BOOST_CHECK(outPoint == COutPoint(tx.GetHash(), 1));
+
+    sigmaState->RemoveBlock(&index);
+    BOOST_CHECK(!sigmaState->GetMintOutPoint(outPoint, pubCoin.getValue()));
+
+    sigmaState->Reset();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
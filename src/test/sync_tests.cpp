@@ -0,0 +1,99 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "sync.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/thread.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct LockProfileSetup : public BasicTestingSetup
+{
+    LockProfileSetup() { ResetLockProfile(); }
+    ~LockProfileSetup()
+    {
+        fLockProfile = false;
+        ResetLockProfile();
+    }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(sync_tests, LockProfileSetup)
+
+BOOST_AUTO_TEST_CASE(lockprofile_disabled)
+{
+    CCriticalSection cs_profiled;
+    {
+        LOCK(cs_profiled);
+    }
+    BOOST_CHECK(GetLockProfile().count("cs_profiled") == 0);
+}
+
+BOOST_AUTO_TEST_CASE(lockprofile_sites)
+{
+    CCriticalSection cs_profiled;
+    fLockProfile = true;
+    for (int i = 0; i < 3; i++) {
+        LOCK(cs_profiled);
+    }
+    {
+        TRY_LOCK(cs_profiled, lockProfiled);
+        BOOST_CHECK(bool(lockProfiled));
+    }
+
+    std::map<std::string, CLockProfile> mapProfiles = GetLockProfile();
+    BOOST_CHECK(mapProfiles.count("cs_profiled") == 1);
+    const CLockProfile& profile = mapProfiles["cs_profiled"];
+    BOOST_CHECK_EQUAL(profile.hold.nCount, 4);
+    BOOST_CHECK_EQUAL(profile.nContended, 0);
+    BOOST_CHECK_EQUAL(profile.mapSites.size(), 2);
+
+    uint64_t nBuckets = 0;
+    for (int i = 0; i < CLockTimeHistogram::BUCKETS; i++)
+        nBuckets += profile.hold.vCount[i];
+    BOOST_CHECK_EQUAL(nBuckets, 4);
+
+    ResetLockProfile();
+    BOOST_CHECK(GetLockProfile().empty());
+}
+
+BOOST_AUTO_TEST_CASE(lockprofile_contention)
+{
+    CCriticalSection cs_profiled;
+    boost::mutex mutex;
+    boost::condition_variable cond;
+    bool fHeld = false;
+
+    fLockProfile = true;
+    boost::thread holder([&]() {
+        LOCK(cs_profiled);
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            fHeld = true;
+        }
+        cond.notify_one();
+        MilliSleep(50);
+    });
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        while (!fHeld)
+            cond.wait(lock);
+    }
+    {
+        LOCK(cs_profiled);
+    }
+    holder.join();
+
+    const CLockProfile profile = GetLockProfile()["cs_profiled"];
+    BOOST_CHECK_EQUAL(profile.hold.nCount, 2);
+    BOOST_CHECK_EQUAL(profile.nContended, 1);
+    BOOST_CHECK(profile.wait.nMax > 0);
+    BOOST_CHECK(profile.hold.nMax >= profile.wait.nMax);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
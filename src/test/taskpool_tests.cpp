@@ -0,0 +1,91 @@
+// Copyright (c) 2020 The Index Core Developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "taskpool.h"
+
+#include "test/test_bitcoin.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(taskpool_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(parallel_for_covers_range)
+{
+    CTaskPool pool(3);
+    for (size_t nGrain : {1, 7, 1000}) {
+        std::vector<std::atomic<int>> vHits(1000);
+        for (auto& hit : vHits)
+            hit = 0;
+        ParallelFor(0, vHits.size(), [&](size_t i) { vHits[i]++; }, nGrain, pool);
+        for (auto& hit : vHits)
+            BOOST_CHECK_EQUAL(hit, 1);
+    }
+
+    // Empty and offset ranges
+    std::atomic<int> nCalls(0);
+    ParallelFor(5, 5, [&](size_t) { nCalls++; }, 1, pool);
+    BOOST_CHECK_EQUAL(nCalls, 0);
+    std::atomic<size_t> nSum(0);
+    ParallelFor(10, 20, [&](size_t i) { nCalls++; nSum += i; }, 1, pool);
+    BOOST_CHECK_EQUAL(nCalls, 10);
+    BOOST_CHECK_EQUAL(nSum, 145);
+}
+
+BOOST_AUTO_TEST_CASE(nested_groups)
+{
+    CTaskPool pool(2);
+    std::atomic<int> nSum(0);
+    // Every outer task waits on an inner group; waiters must help instead of blocking the workers
+    ParallelFor(0, 16, [&](size_t i) {
+        ParallelFor(0, 16, [&](size_t j) { nSum += i * 16 + j; }, 1, pool);
+    }, 1, pool);
+    BOOST_CHECK_EQUAL(nSum, 256 * 255 / 2);
+}
+
+BOOST_AUTO_TEST_CASE(group_exceptions)
+{
+    CTaskPool pool(2);
+    CTaskGroup group(pool);
+    std::atomic<int> nRun(0);
+    for (int i = 0; i < 20; i++) {
+        group.Run([&nRun, i]() {
+            nRun++;
+            if (i % 5 == 0)
+                throw std::runtime_error("task failed");
+        });
+    }
+    BOOST_CHECK_THROW(group.Wait(), std::runtime_error);
+    BOOST_CHECK_EQUAL(nRun, 20);
+
+    // The error is consumed by Wait(), the group can be reused
+    group.Run([&nRun]() { nRun++; });
+    group.Wait();
+    BOOST_CHECK_EQUAL(nRun, 21);
+
+    BOOST_CHECK_THROW(ParallelFor(0, 100, [](size_t i) { if (i == 99) throw std::runtime_error("last"); }, 1, pool), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(no_workers)
+{
+    // Without workers everything runs on the waiting thread
+    CTaskPool pool(0);
+    BOOST_CHECK_EQUAL(pool.Concurrency(), 1);
+    CTaskGroup group(pool);
+    boost::thread::id caller = boost::this_thread::get_id();
+    std::atomic<int> nRun(0);
+    for (int i = 0; i < 10; i++) {
+        group.Run([&]() {
+            BOOST_CHECK(boost::this_thread::get_id() == caller);
+            nRun++;
+        });
+    }
+    group.Wait();
+    BOOST_CHECK_EQUAL(nRun, 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
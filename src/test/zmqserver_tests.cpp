@@ -70,11 +70,11 @@ struct ZmqServerTestingSetup : public TestingSetup {
         {
             std::vector<CMutableTransaction> noTxns;
             b = CreateAndProcessBlock(noTxns, scriptPubKeyZmqServer, mtp);
-            coinbaseTxns.push_back(b.vtx[0]);
+            coinbaseTxns.push_back(*b.vtx[0]);
             LOCK(cs_main);
             {
                 LOCK(pwalletMain->cs_wallet);
-                pwalletMain->AddToWalletIfInvolvingMe(b.vtx[0], &b, true);
+                pwalletMain->AddToWalletIfInvolvingMe(*b.vtx[0], &b, true);
             }   
         }
         printf("Balance after 150 blocks: %ld\n", pwalletMain->GetBalance());
@@ -280,7 +280,7 @@ struct ZmqServerTestingSetup : public TestingSetup {
         if(txns.size() > 0) {
             block.vtx.resize(1);
             BOOST_FOREACH(const CMutableTransaction& tx, txns)
-                block.vtx.push_back(tx);
+                block.vtx.push_back(MakeTransactionRef(tx));
         }
         // IncrementExtraNonce creates a valid coinbase and merkleRoot
         unsigned int extraNonce = 0;
@@ -366,7 +366,7 @@ BOOST_AUTO_TEST_CASE(event_tests)
     CBlock block;
     ReadBlockFromDisk(block, chainActive.Tip(), Params().GetConsensus());
     cout << "Calling SyncWithWallets.." << endl;
-    SyncWithWallets(block.vtx[0], NULL, NULL);
+    SyncWithWallets(*block.vtx[0], NULL, NULL);
 
     // allow an extra bit of time for subscriber to finish
     boost::this_thread::sleep_for(boost::chrono::milliseconds(4000));
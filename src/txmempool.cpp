@@ -24,19 +24,26 @@ CTxMemPoolEntry::CTxMemPoolEntry(const CTransaction &_tx, const CAmount &_nFee,
                                  int64_t _nTime, double _entryPriority, unsigned int _entryHeight,
                                  bool poolHasNoInputsOf, CAmount _inChainInputValue,
                                  bool _spendsCoinbase, int64_t _sigOpsCost, LockPoints lp) :
-        tx(std::make_shared<CTransaction>(_tx)), nFee(_nFee), nTime(_nTime), entryPriority(_entryPriority),
+        CTxMemPoolEntry(MakeTransactionRef(_tx), _nFee, _nTime, _entryPriority, _entryHeight,
+                        poolHasNoInputsOf, _inChainInputValue, _spendsCoinbase, _sigOpsCost, lp) {}
+
+CTxMemPoolEntry::CTxMemPoolEntry(const CTransactionRef &_tx, const CAmount &_nFee,
+                                 int64_t _nTime, double _entryPriority, unsigned int _entryHeight,
+                                 bool poolHasNoInputsOf, CAmount _inChainInputValue,
+                                 bool _spendsCoinbase, int64_t _sigOpsCost, LockPoints lp) :
+        tx(_tx), nFee(_nFee), nTime(_nTime), entryPriority(_entryPriority),
         entryHeight(_entryHeight),
         hadNoDependencies(poolHasNoInputsOf), inChainInputValue(_inChainInputValue),
         spendsCoinbase(_spendsCoinbase), sigOpCost(_sigOpsCost), lockPoints(lp) {
-    nTxWeight = GetTransactionWeight(_tx);
-    nModSize = _tx.CalculateModifiedSize(GetTxSize());
+    nTxWeight = GetTransactionWeight(*tx);
+    nModSize = tx->CalculateModifiedSize(GetTxSize());
     nUsageSize = RecursiveDynamicUsage(*tx) + memusage::DynamicUsage(tx);
 
     nCountWithDescendants = 1;
     nSizeWithDescendants = GetTxSize();
     nModFeesWithDescendants = nFee;
-    CAmount nValueIn = _tx.GetValueOut() + nFee;
-    if (!_tx.IsZerocoinSpend() && !_tx.IsSigmaSpend() && !_tx.IsZerocoinRemint()) {
+    CAmount nValueIn = tx->GetValueOut() + nFee;
+    if (!tx->IsZerocoinSpend() && !tx->IsSigmaSpend() && !tx->IsZerocoinRemint()) {
         assert(inChainInputValue <= nValueIn);
     }
 
@@ -52,6 +59,21 @@ CTxMemPoolEntry::CTxMemPoolEntry(const CTxMemPoolEntry &other) {
     *this = other;
 }
 
+CTxMemPoolEntry::CTxMemPoolEntry(const CTxMemPoolEntry &other, bool poolHasNoInputsOf) {
+    *this = other;
+    hadNoDependencies = poolHasNoInputsOf;
+    feeDelta = 0;
+
+    nCountWithDescendants = 1;
+    nSizeWithDescendants = GetTxSize();
+    nModFeesWithDescendants = nFee;
+
+    nCountWithAncestors = 1;
+    nSizeWithAncestors = GetTxSize();
+    nModFeesWithAncestors = nFee;
+    nSigOpCostWithAncestors = sigOpCost;
+}
+
 double CTxMemPoolEntry::GetPriority(unsigned int currentHeight) const {
     double deltaPriority = ((double) (currentHeight - entryHeight) * inChainInputValue) / nModSize;
     double dResult = entryPriority + deltaPriority;
@@ -763,21 +785,22 @@ void CTxMemPool::removeConflicts(const CTransaction &tx, std::list <CTransaction
 /**
  * Called when a block is connected. Removes from mempool and updates the miner fee estimator.
  */
-void CTxMemPool::removeForBlock(const std::vector <CTransaction> &vtx, unsigned int nBlockHeight,
+void CTxMemPool::removeForBlock(const std::vector <CTransactionRef> &vtx, unsigned int nBlockHeight,
                                 std::list <CTransaction> &conflicts, bool fCurrentEstimate) {
     try {
         LOCK(cs);
         std::vector <CTxMemPoolEntry> entries;
-        BOOST_FOREACH(const CTransaction &tx, vtx)
+        for (const CTransactionRef &ptx : vtx)
         {
-            uint256 hash = tx.GetHash();
+            uint256 hash = ptx->GetHash();
 
             indexed_transaction_set::iterator i = mapTx.find(hash);
             if (i != mapTx.end())
                 entries.push_back(*i);
         }
-        BOOST_FOREACH(const CTransaction &tx, vtx)
+        for (const CTransactionRef &ptx : vtx)
         {
+            const CTransaction &tx = *ptx;
             txiter it = mapTx.find(tx.GetHash());
             if (it != mapTx.end()) {
                 setEntries stage;
@@ -1014,7 +1037,7 @@ std::vector <TxMempoolInfo> CTxMemPool::infoAll() const {
     return ret;
 }
 
-std::shared_ptr<const CTransaction> CTxMemPool::get(const uint256 &hash) const {
+CTransactionRef CTxMemPool::get(const uint256 &hash) const {
     LOCK(cs);
     indexed_transaction_set::const_iterator i = mapTx.find(hash);
     if (i == mapTx.end())
@@ -1030,14 +1053,14 @@ TxMempoolInfo CTxMemPool::info(const uint256 &hash) const {
     return TxMempoolInfo{i->GetSharedTx(), i->GetTime(), CFeeRate(i->GetFee(), i->GetTxSize())};
 }
 
-CFeeRate CTxMemPool::estimateFee(int nBlocks) const {
+CFeeRate CTxMemPool::estimateFee(int nBlocks, FeeEstimateClass feeClass) const {
     LOCK(cs);
-    return minerPolicyEstimator->estimateFee(nBlocks);
+    return minerPolicyEstimator->estimateFee(nBlocks, feeClass);
 }
 
-CFeeRate CTxMemPool::estimateSmartFee(int nBlocks, int *answerFoundAtBlocks) const {
+CFeeRate CTxMemPool::estimateSmartFee(int nBlocks, int *answerFoundAtBlocks, FeeEstimateClass feeClass) const {
     LOCK(cs);
-    return minerPolicyEstimator->estimateSmartFee(nBlocks, answerFoundAtBlocks, *this);
+    return minerPolicyEstimator->estimateSmartFee(nBlocks, answerFoundAtBlocks, *this, feeClass);
 }
 
 double CTxMemPool::estimatePriority(int nBlocks) const {
@@ -1191,6 +1214,24 @@ bool CTxMemPool::addUnchecked(const uint256 &hash, const CTxMemPoolEntry &entry,
     return addUnchecked(hash, entry, setAncestors, fCurrentEstimate);
 }
 
+bool CTxMemPool::addFromPool(const CTxMemPool &source, const uint256 &hash, bool fCurrentEstimate) {
+    LOCK2(source.cs, cs);
+    indexed_transaction_set::const_iterator it = source.mapTx.find(hash);
+    if (it == source.mapTx.end() || mapTx.count(hash) != 0)
+        return false;
+
+    const CTransaction &tx = it->GetTx();
+    if (!tx.IsZerocoinSpend() && !tx.IsSigmaSpend() && !tx.IsZerocoinRemint()) {
+        BOOST_FOREACH(const CTxIn &txin, tx.vin) {
+            if (mapNextTx.count(txin.prevout))
+                return false;
+        }
+    }
+
+    CTxMemPoolEntry entry(*it, HasNoInputsOf(tx));
+    return addUnchecked(hash, entry, fCurrentEstimate);
+}
+
 void CTxMemPool::UpdateChild(txiter entry, txiter child, bool add) {
     setEntries s;
     if (add && mapLinks[entry].children.insert(child).second) {
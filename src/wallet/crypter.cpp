@@ -224,13 +224,13 @@ bool CCryptoKeyStore::Unlock(const CKeyingMaterial& vMasterKeyIn, const bool& fF
             return false;
         vMasterKey = vMasterKeyIn;
         fDecryptionThoroughlyChecked = true;
-        if(!fFirstUnlock && zwalletMain){
-            auto &hdChain = pwalletMain->GetHDChain();
-            uint160 hashSeedMaster = hdChain.masterKeyID;
+    }
+    if(!fFirstUnlock && zwalletMain){
+        CHDChain hdChain = pwalletMain->GetHDChain();
+        if (hdChain.nVersion == CHDChain::VERSION_BASIC)
             pwalletMain->SetHDChain(hdChain, false); // Used to upgrade normal keys to BIP44
-            zwalletMain->SetupWallet(hashSeedMaster, false);
-            zwalletMain->SyncWithChain();
-        }
+        // Only catches up on what changed while locked, in the background
+        zwalletMain->SyncAfterUnlock(hdChain.masterKeyID);
     }
     NotifyStatusChanged(this);
     return true;
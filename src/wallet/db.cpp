@@ -240,7 +240,11 @@ void CDBEnv::CheckpointLSN(const std::string& strFile)
 }
 
 
-CDB::CDB(const std::string& strFilename, const char* pszMode, bool fFlushOnCloseIn) : pdb(NULL), activeTxn(NULL)
+//! Batch of each thread, not owned
+static void NoCleanup(CDB*) {}
+static boost::thread_specific_ptr<CDB> pbatchThread(NoCleanup);
+
+CDB::CDB(const std::string& strFilename, const char* pszMode, bool fFlushOnCloseIn) : pdb(NULL), activeTxn(NULL), pbatch(NULL), nBatchWrites(0)
 {
     int ret;
     fReadOnly = (!strchr(pszMode, '+') && !strchr(pszMode, 'w'));
@@ -297,11 +301,15 @@ CDB::CDB(const std::string& strFilename, const char* pszMode, bool fFlushOnClose
             bitdb.mapDb[strFile] = pdb;
         }
     }
+
+    CDB* pbatchActive = pbatchThread.get();
+    if (pbatchActive && pbatchActive->strFile == strFile)
+        pbatch = pbatchActive;
 }
 
 void CDB::Flush()
 {
-    if (activeTxn)
+    if (Txn())
         return;
 
     // Flush database activity from memory pool to disk log
@@ -321,8 +329,10 @@ void CDB::Close()
     activeTxn = NULL;
     pdb = NULL;
 
-    if (fFlushOnClose)
+    // The batch flushes once it is done
+    if (fFlushOnClose && !pbatch)
         Flush();
+    pbatch = NULL;
 
     {
         LOCK(bitdb.cs_db);
@@ -476,3 +486,43 @@ void CDBEnv::Flush(bool fShutdown)
         }
     }
 }
+
+CDBWriteBatch::CDBWriteBatch(const std::string& strFilename) : CDB(strFilename), fActive(false)
+{
+    // Nested batches join the outer one
+    if (pbatch || !TxnBegin())
+        return;
+    pbatchThread.reset(this);
+    fActive = true;
+}
+
+CDBWriteBatch::~CDBWriteBatch()
+{
+    if (!fActive)
+        return;
+    pbatchThread.reset();
+    if (!TxnCommit())
+        LogPrintf("%s: Failed to commit batched writes to %s\n", __func__, strFile);
+}
+
+bool CDBWriteBatch::Commit()
+{
+    if (!fActive)
+        return true;
+    bool fSuccess = TxnCommit();
+    nBatchWrites = 0;
+    if (!TxnBegin()) {
+        // Carry on writing outside a transaction
+        pbatchThread.reset();
+        fActive = false;
+        return false;
+    }
+    return fSuccess;
+}
+
+bool CDBWriteBatch::CommitIfFull()
+{
+    if (nBatchWrites < MAX_BATCH_WRITES)
+        return true;
+    return Commit();
+}
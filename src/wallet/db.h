@@ -98,6 +98,13 @@ protected:
     DbTxn* activeTxn;
     bool fReadOnly;
     bool fFlushOnClose;
+    //! Batch of the opening thread this handle joined, see CDBWriteBatch
+    CDB* pbatch;
+    //! Writes since the last commit, counted on the batch
+    unsigned int nBatchWrites;
+
+    //! Transaction used for database access
+    DbTxn* Txn() const { return pbatch ? pbatch->activeTxn : activeTxn; }
 
     explicit CDB(const std::string& strFilename, const char* pszMode = "r+", bool fFlushOnCloseIn=true);
     ~CDB() { Close(); }
@@ -126,7 +133,7 @@ protected:
         // Read
         Dbt datValue;
         datValue.set_flags(DB_DBT_MALLOC);
-        int ret = pdb->get(activeTxn, &datKey, &datValue, 0);
+        int ret = pdb->get(Txn(), &datKey, &datValue, 0);
         memset(datKey.get_data(), 0, datKey.get_size());
         if (datValue.get_data() == NULL)
             return false;
@@ -166,7 +173,9 @@ protected:
         Dbt datValue(&ssValue[0], ssValue.size());
 
         // Write
-        int ret = pdb->put(activeTxn, &datKey, &datValue, (fOverwrite ? 0 : DB_NOOVERWRITE));
+        int ret = pdb->put(Txn(), &datKey, &datValue, (fOverwrite ? 0 : DB_NOOVERWRITE));
+        if (pbatch)
+            pbatch->nBatchWrites++;
 
         // Clear memory in case it was a private key
         memset(datKey.get_data(), 0, datKey.get_size());
@@ -189,7 +198,9 @@ protected:
         Dbt datKey(&ssKey[0], ssKey.size());
 
         // Erase
-        int ret = pdb->del(activeTxn, &datKey, 0);
+        int ret = pdb->del(Txn(), &datKey, 0);
+        if (pbatch)
+            pbatch->nBatchWrites++;
 
         // Clear memory
         memset(datKey.get_data(), 0, datKey.get_size());
@@ -209,7 +220,7 @@ protected:
         Dbt datKey(&ssKey[0], ssKey.size());
 
         // Exists
-        int ret = pdb->exists(activeTxn, &datKey, 0);
+        int ret = pdb->exists(Txn(), &datKey, 0);
 
         // Clear memory
         memset(datKey.get_data(), 0, datKey.get_size());
@@ -221,7 +232,7 @@ protected:
         if (!pdb)
             return NULL;
         Dbc* pcursor = NULL;
-        int ret = pdb->cursor(NULL, &pcursor, 0);
+        int ret = pdb->cursor(Txn(), &pcursor, 0);
         if (ret != 0)
             return NULL;
         return pcursor;
@@ -265,8 +276,11 @@ protected:
     }
 
 public:
+    //! Transactions of a handle which joined a batch are part of the batch's transaction
     bool TxnBegin()
     {
+        if (pbatch)
+            return true;
         if (!pdb || activeTxn)
             return false;
         DbTxn* ptxn = bitdb.TxnBegin();
@@ -278,6 +292,8 @@ public:
 
     bool TxnCommit()
     {
+        if (pbatch)
+            return true;
         if (!pdb || !activeTxn)
             return false;
         int ret = activeTxn->commit(0);
@@ -287,6 +303,9 @@ public:
 
     bool TxnAbort()
     {
+        // Writes of a batch cannot be rolled back in part
+        if (pbatch)
+            return false;
         if (!pdb || !activeTxn)
             return false;
         int ret = activeTxn->abort();
@@ -308,4 +327,37 @@ public:
     bool static Rewrite(const std::string& strFile, const char* pszSkip = NULL);
 };
 
+/**
+ * Groups the database writes of the calling thread into one transaction.
+ *
+ * While a batch is alive, every CDB the same thread opens on the same file
+ * joins the batch's transaction and does not flush when it is closed, so a
+ * high volume operation pays for one commit and one checkpoint instead of one
+ * per record. Writes are committed by Commit() or when the batch goes out of
+ * scope, also if that happens through an exception. A batch created while
+ * another one is active on the file simply joins it.
+ *
+ * Other threads writing to the file block until the batch commits. Hold
+ * cs_wallet while a batch is alive, so they wait on the lock rather than the
+ * database, and keep each batch to a bounded amount of work: commit before
+ * releasing cs_wallet, and take cs_main before the batch if at all.
+ */
+class CDBWriteBatch : public CDB
+{
+public:
+    //! Pending writes after which CommitIfFull() commits, bounding the locks held by the transaction
+    static const unsigned int MAX_BATCH_WRITES = 1000;
+
+    explicit CDBWriteBatch(const std::string& strFilename);
+    ~CDBWriteBatch();
+
+    //! Commit the writes so far and continue batching in a new transaction
+    bool Commit();
+    //! Commit if MAX_BATCH_WRITES writes are pending. No cursor of the thread may be open.
+    bool CommitIfFull();
+
+private:
+    bool fActive;
+};
+
 #endif // BITCOIN_WALLET_DB_H
@@ -21,26 +21,38 @@
 class SigmaSpendSigner : public InputSigner
 {
 public:
-    const sigma::PrivateCoin coin;
+    const sigma::Params* params;
+    // null when only building a dummy transaction, which does not need the private coin
+    std::unique_ptr<sigma::PrivateCoin> coin;
     std::vector<sigma::PublicCoin> group;
     uint256 lastBlockOfGroup;
     bool fPadding;
 
 public:
-    SigmaSpendSigner(const sigma::PrivateCoin& coin) : coin(coin)
+    SigmaSpendSigner(const sigma::Params* params, std::unique_ptr<sigma::PrivateCoin> coin) : params(params), coin(std::move(coin))
     {
         fPadding = true;
     }
 
     CScript Sign(const CMutableTransaction& tx, const uint256& sig, bool fDummy) override
     {
+        CScript script;
+
+        script << OP_SIGMASPEND;
+
+        if (fDummy) {
+            // Only the size matters, so skip the proof
+            script.insert(script.end(), sigma::CoinSpend::SerializedSize(params), 0);
+            return script;
+        }
+
         // construct spend
         sigma::SpendMetaData meta(output.n, lastBlockOfGroup, sig);
-        sigma::CoinSpend spend(coin.getParams(), coin, group, meta, fPadding);
+        sigma::CoinSpend spend(params, *coin, group, meta, fPadding);
 
-        spend.setVersion(coin.getVersion());
+        spend.setVersion(coin->getVersion());
 
-        if (!fDummy && !spend.Verify(group, meta, fPadding)) {
+        if (!spend.Verify(group, meta, fPadding)) {
             throw std::runtime_error(_("The spend coin transaction failed to verify"));
         }
 
@@ -48,16 +60,13 @@ public:
         CDataStream serialized(SER_NETWORK, PROTOCOL_VERSION);
         serialized << spend;
 
-        CScript script;
-
-        script << OP_SIGMASPEND;
         script.insert(script.end(), serialized.begin(), serialized.end());
 
         return script;
     }
 };
 
-static std::unique_ptr<SigmaSpendSigner> CreateSigner(const CSigmaEntry& coin)
+static std::unique_ptr<SigmaSpendSigner> CreateSigner(const CSigmaEntry& coin, bool fDummy)
 {
     sigma::CSigmaState* state = sigma::CSigmaState::GetState();
     auto params = sigma::Params::get_default();
@@ -76,15 +85,19 @@ static std::unique_ptr<SigmaSpendSigner> CreateSigner(const CSigmaEntry& coin)
         version = chainActive.Height() >= ::Params().GetConsensus().nSigmaPaddingBlock ? ZEROCOIN_TX_VERSION_3_1
                                                                                        : ZEROCOIN_TX_VERSION_3;
     }
-    // construct private part of the mint
-    sigma::PrivateCoin priv(params, denom, version);
 
-    priv.setSerialNumber(coin.serialNumber);
-    priv.setRandomness(coin.randomness);
-    priv.setEcdsaSeckey(coin.ecdsaSecretKey);
-    priv.setPublicCoin(pub);
+    std::unique_ptr<sigma::PrivateCoin> priv;
+    if (!fDummy) {
+        // construct private part of the mint
+        priv.reset(new sigma::PrivateCoin(params, denom, version));
 
-    std::unique_ptr<SigmaSpendSigner> signer(new SigmaSpendSigner(priv));
+        priv->setSerialNumber(coin.serialNumber);
+        priv->setRandomness(coin.randomness);
+        priv->setEcdsaSeckey(coin.ecdsaSecretKey);
+        priv->setPublicCoin(pub);
+    }
+
+    std::unique_ptr<SigmaSpendSigner> signer(new SigmaSpendSigner(params, std::move(priv)));
 
     // get coin group
     int groupId;
@@ -98,13 +111,22 @@ static std::unique_ptr<SigmaSpendSigner> CreateSigner(const CSigmaEntry& coin)
     signer->output.n = static_cast<uint32_t>(groupId);
     signer->sequence = CTxIn::SEQUENCE_FINAL;
 
-    if (state->GetCoinSetForSpend(
-        &chainActive,
-        chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
-        denom,
-        groupId,
-        signer->lastBlockOfGroup,
-        signer->group) < 2) {
+    int maxHeight = chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1); // required 6 confirmation for mint to spend
+    int groupSize;
+    if (fDummy) {
+        // A dummy spend does not need the anonymity set itself
+        groupSize = state->GetCoinGroupSize(denom, groupId, maxHeight);
+    } else {
+        groupSize = state->GetCoinSetForSpend(
+            &chainActive,
+            maxHeight,
+            denom,
+            groupId,
+            signer->lastBlockOfGroup,
+            signer->group);
+    }
+
+    if (groupSize < 2) {
         throw std::runtime_error(_("Has to have at least two mint coins with at least 6 confirmation in order to spend a coin"));
     }
 
@@ -154,7 +176,7 @@ CAmount SigmaSpendBuilder::GetInputs(std::vector<std::unique_ptr<InputSigner>>&
     CAmount total = 0;
     for (auto& coin : selected) {
         total += coin.get_denomination_value();
-        signers.push_back(CreateSigner(coin));
+        signers.push_back(CreateSigner(coin, fDummy));
     }
 
     return total;
@@ -172,23 +194,27 @@ CAmount SigmaSpendBuilder::GetChanges(std::vector<CTxOut>& outputs, CAmount amou
         CAmount denominationValue;
         sigma::DenominationToInteger(denomination, denominationValue);
 
-        sigma::PrivateCoin newCoin(params, denomination, ZEROCOIN_TX_VERSION_3);
-        if(!fDummy){
+        // Create script for coin
+        CScript scriptSerializedCoin;
+        scriptSerializedCoin << OP_SIGMAMINT;
+
+        if (fDummy) {
+            // A dummy change only needs the right size, so skip generating the coin
+            scriptSerializedCoin.insert(scriptSerializedCoin.end(), GroupElement().memoryRequired(), 0);
+        } else {
+            sigma::PrivateCoin newCoin(params, denomination, ZEROCOIN_TX_VERSION_3);
             hdMint.SetNull();
             mintWallet.GenerateMint(denomination, newCoin, hdMint);
-        }
 
-        auto& pubCoin = newCoin.getPublicCoin();
+            auto& pubCoin = newCoin.getPublicCoin();
 
-        if (!pubCoin.validate()) {
-            throw std::runtime_error("Unable to mint a sigma coin.");
-        }
+            if (!pubCoin.validate()) {
+                throw std::runtime_error("Unable to mint a sigma coin.");
+            }
 
-        // Create script for coin
-        CScript scriptSerializedCoin;
-        scriptSerializedCoin << OP_SIGMAMINT;
-        std::vector<unsigned char> vch = pubCoin.getValue().getvch();
-        scriptSerializedCoin.insert(scriptSerializedCoin.end(), vch.begin(), vch.end());
+            std::vector<unsigned char> vch = pubCoin.getValue().getvch();
+            scriptSerializedCoin.insert(scriptSerializedCoin.end(), vch.begin(), vch.end());
+        }
 
         outputs.push_back(CTxOut(denominationValue, scriptSerializedCoin));
 
@@ -240,6 +240,44 @@ static bool ContainTxOut(const std::vector<CTxOut>& outs, const std::pair<const
     return (expectedOccurrence < 0 && occurrence > 0) || (occurrence == expectedOccurrence);
 }
 
+// The knapsack GetCoinsToSpend used to run over every single coin. Returns the fewest coins spent and
+// re-minted for a spend of roundedRequired (in units of 0.05) and sets the value to spend, or returns -1.
+static int ReferenceSpendCoinCount(
+    const std::vector<CAmount>& coins,
+    int roundedRequired,
+    size_t coinsToSpendLimit,
+    CAmount amountToSpendLimit,
+    int& bestSpendVal)
+{
+    constexpr CAmount zeros(5000000);
+    const uint64_t unreachable = (INT_MAX - 1) / 2;
+
+    std::vector<sigma::CoinDenomination> denominations;
+    sigma::GetAllDenoms(denominations);
+
+    int val = std::min<CAmount>(roundedRequired + 100 * COIN / zeros, amountToSpendLimit / zeros);
+
+    std::vector<uint64_t> row(val + 1, unreachable);
+    row[0] = 0;
+    for (CAmount coin : coins) {
+        int denom = coin / zeros;
+        for (int j = val; j >= denom; j--)
+            row[j] = std::min(row[j], row[j - denom] + 1);
+    }
+
+    int minimum = INT_MAX - 1;
+    bestSpendVal = -1;
+    for (int index = val; index >= roundedRequired; index--) {
+        int count = row[index] + CWallet::GetRequiredCoinCountForAmount((index - roundedRequired) * zeros, denominations);
+        if (minimum > count && row[index] != unreachable && row[index] <= coinsToSpendLimit) {
+            bestSpendVal = index;
+            minimum = count;
+        }
+    }
+
+    return minimum == INT_MAX - 1 ? -1 : minimum;
+}
+
 BOOST_FIXTURE_TEST_SUITE(wallet_sigma_tests, WalletSigmaTestingSetup)
 
 BOOST_AUTO_TEST_CASE(get_coin_no_coin)
@@ -421,6 +459,77 @@ BOOST_AUTO_TEST_CASE(get_coin_by_limit_max_to_1)
     sigmaState->Reset();
 }
 
+BOOST_AUTO_TEST_CASE(select_spend_coins_matches_knapsack)
+{
+    constexpr CAmount zeros(5000000);
+
+    seed_insecure_rand(true);
+
+    std::vector<sigma::CoinDenomination> denominations;
+    sigma::GetAllDenoms(denominations);
+
+    for (int i = 0; i < 500; i++) {
+        // Random wallet, sorted the way GetCoinsToSpend sorts it
+        std::list<CSigmaEntry> coins;
+        std::vector<CAmount> values;
+        CAmount balance = 0;
+        for (auto denomination : denominations) {
+            int count = insecure_rand() % 3 == 0 ? 0 : insecure_rand() % 6;
+            for (int j = 0; j < count; j++) {
+                CSigmaEntry coin;
+                coin.set_denomination(denomination);
+                coin.nHeight = j;
+                coins.push_back(coin);
+                values.push_back(coin.get_denomination_value());
+                balance += coin.get_denomination_value();
+            }
+        }
+        if (balance == 0)
+            continue;
+
+        int roundedRequired = insecure_rand() % (balance / zeros) + 1;
+        size_t coinsToSpendLimit = insecure_rand() % 2 ? SIZE_MAX : insecure_rand() % 8 + 1;
+        CAmount amountToSpendLimit = insecure_rand() % 3 != 0 ? MAX_MONEY : (roundedRequired + insecure_rand() % 3000) * zeros;
+
+        int expectedSpendVal;
+        int expected = ReferenceSpendCoinCount(values, roundedRequired, coinsToSpendLimit, amountToSpendLimit, expectedSpendVal);
+
+        std::vector<CSigmaEntry> coinsToSpend;
+        std::vector<sigma::CoinDenomination> coinsToMint;
+        if (expected < 0) {
+            BOOST_CHECK_THROW(CWallet::SelectSpendCoinsAndChange(roundedRequired * zeros, coins, coinsToSpendLimit, amountToSpendLimit, coinsToSpend, coinsToMint),
+                std::runtime_error);
+            continue;
+        }
+
+        CWallet::SelectSpendCoinsAndChange(roundedRequired * zeros, coins, coinsToSpendLimit, amountToSpendLimit, coinsToSpend, coinsToMint);
+
+        CAmount spent = 0;
+        for (auto& coin : coinsToSpend)
+            spent += coin.get_denomination_value();
+        CAmount minted = 0;
+        for (auto denomination : coinsToMint) {
+            CAmount value;
+            sigma::DenominationToInteger(denomination, value);
+            minted += value;
+        }
+
+        BOOST_CHECK_EQUAL(int(coinsToSpend.size() + coinsToMint.size()), expected);
+        BOOST_CHECK_EQUAL(spent, expectedSpendVal * zeros);
+        BOOST_CHECK_EQUAL(spent - minted, roundedRequired * zeros);
+        BOOST_CHECK(coinsToSpend.size() <= coinsToSpendLimit);
+
+        // Oldest coins of each denomination go first
+        for (auto denomination : denominations) {
+            int height = 0;
+            for (auto& coin : coinsToSpend) {
+                if (coin.get_denomination() == denomination)
+                    BOOST_CHECK_EQUAL(coin.nHeight, height++);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(create_spend_with_insufficient_coins)
 {
     CAmount fee;
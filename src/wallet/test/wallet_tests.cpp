@@ -351,4 +351,51 @@ BOOST_AUTO_TEST_CASE(ApproximateBestSubset)
     BOOST_CHECK_EQUAL(setCoinsRet.size(), 2U);
 }*/
 
+BOOST_AUTO_TEST_CASE(write_batch)
+{
+    const std::string& strFile = pwalletMain->strWalletFile;
+    CKeyPool keypool;
+
+    {
+        CDBWriteBatch batch(strFile);
+        {
+            CWalletDB walletdb(strFile);
+            BOOST_CHECK(walletdb.WritePool(1000001, keypool));
+
+            // handles joining the batch are part of its transaction
+            BOOST_CHECK(walletdb.TxnBegin());
+            BOOST_CHECK(walletdb.TxnCommit());
+            BOOST_CHECK(!walletdb.TxnAbort());
+        }
+        {
+            CWalletDB walletdb(strFile);
+            BOOST_CHECK(walletdb.ReadPool(1000001, keypool));
+        }
+        {
+            // nested batches join the outer one
+            CDBWriteBatch nested(strFile);
+            CWalletDB walletdb(strFile);
+            BOOST_CHECK(walletdb.WritePool(1000002, keypool));
+            BOOST_CHECK(nested.Commit());
+        }
+        BOOST_CHECK(batch.Commit());
+        BOOST_CHECK(batch.CommitIfFull());
+        {
+            CWalletDB walletdb(strFile);
+            BOOST_CHECK(walletdb.WritePool(1000003, keypool));
+        }
+    }
+
+    CWalletDB walletdb(strFile);
+    for (int64_t nPool = 1000001; nPool <= 1000003; nPool++) {
+        BOOST_CHECK(walletdb.ReadPool(nPool, keypool));
+        BOOST_CHECK(walletdb.ErasePool(nPool));
+    }
+
+    // without a batch, transactions work as before
+    BOOST_CHECK(walletdb.TxnBegin());
+    BOOST_CHECK(!walletdb.TxnBegin());
+    BOOST_CHECK(walletdb.TxnAbort());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
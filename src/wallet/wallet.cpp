@@ -50,6 +50,7 @@
 #include "hdmint/tracker.h"
 
 #include <assert.h>
+#include <deque>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/thread.hpp>
@@ -302,6 +303,8 @@ bool CWallet::AddKeyPubKey(const CKey &secret, const CPubKey &pubkey) {
     if (HaveWatchOnly(script))
         RemoveWatchOnly(script);
 
+    NotifyKeyAdded(this, pubkey.GetID());
+
     if (!fFileBacked)
         return true;
     if (!IsCrypted()) {
@@ -316,6 +319,7 @@ bool CWallet::AddCryptedKey(const CPubKey &vchPubKey,
                             const vector<unsigned char> &vchCryptedSecret) {
     if (!CCryptoKeyStore::AddCryptedKey(vchPubKey, vchCryptedSecret))
         return false;
+    NotifyKeyAdded(this, vchPubKey.GetID());
     if (!fFileBacked)
         return true;
     {
@@ -348,6 +352,7 @@ bool CWallet::LoadCryptedKey(const CPubKey &vchPubKey, const std::vector<unsigne
 bool CWallet::AddCScript(const CScript &redeemScript) {
     if (!CCryptoKeyStore::AddCScript(redeemScript))
         return false;
+    NotifyKeyAdded(this, CScriptID(redeemScript));
     if (!fFileBacked)
         return true;
     return CWalletDB(strWalletFile).WriteCScript(Hash160(redeemScript), redeemScript);
@@ -373,6 +378,9 @@ bool CWallet::AddWatchOnly(const CScript &dest) {
         return false;
     nTimeFirstKey = 1; // No birthday information for watch-only keys.
     NotifyWatchonlyChanged(true);
+    CTxDestination address;
+    if (ExtractDestination(dest, address))
+        NotifyKeyAdded(this, address);
     if (!fFileBacked)
         return true;
     return CWalletDB(strWalletFile).WriteWatchOnly(dest);
@@ -2079,6 +2087,8 @@ int CWallet::ScanForWalletTransactions(CBlockIndex *pindexStart, bool fUpdate) {
     CBlockIndex *pindex = pindexStart;
     {
         LOCK2(cs_main, cs_wallet);
+        // Write the found transactions in few database transactions
+        CDBWriteBatch batch(strWalletFile);
 
         // no need to read and scan block, if block was created before
         // our wallet birthday (as adjusted for block time variability)
@@ -2100,11 +2110,13 @@ int CWallet::ScanForWalletTransactions(CBlockIndex *pindexStart, bool fUpdate) {
 
             CBlock block;
             ReadBlockFromDisk(block, pindex, Params().GetConsensus());
-            BOOST_FOREACH(CTransaction & tx, block.vtx)
+            for (const CTransactionRef& ptx : block.vtx)
             {
+                const CTransaction& tx = *ptx;
                 if (AddToWalletIfInvolvingMe(tx, &block, fUpdate))
                     ret++;
             }
+            batch.CommitIfFull();
             pindex = chainActive.Next(pindex);
             if (GetTime() >= nNow + 60) {
                 nNow = GetTime();
@@ -2761,91 +2773,85 @@ std::list<CSigmaEntry> CWallet::GetAvailableCoins(const CCoinControl *coinContro
     CWalletDB walletdb(strWalletFile);
     std::list<CSigmaEntry> coins;
     std::vector<CMintMeta> vecMints = zwalletMain->GetTracker().ListMints(true, true, false);
-    list<CMintMeta> listMints(vecMints.begin(), vecMints.end());
-    for (const CMintMeta& mint : listMints) {
-        CSigmaEntry entry;
-        const auto& sigmaParams = sigma::Params::get_default();
-        if(fDummy){
-            /* If we just want to create the spend tx without signing (eg. to get fee before entering password),
-             * we fill in the available unencrypted details from the metadata, and create dummy values for the
-             * encrypted ones.
-             */
-            sigma::PrivateCoin dummyCoin(sigmaParams, mint.denom);
-
-            entry.value = mint.GetPubCoinValue();
-            entry.set_denomination(mint.denom);
-            entry.randomness = dummyCoin.getRandomness();
-            entry.serialNumber = dummyCoin.getSerialNumber();
-            entry.IsUsed = mint.isUsed;
-            entry.nHeight = mint.nHeight;
-            entry.id = mint.nId;
-            entry.ecdsaSecretKey = std::vector<unsigned char>(&dummyCoin.getEcdsaSeckey()[0],&dummyCoin.getEcdsaSeckey()[32]);
-        }else{
-            GetMint(mint.hashSerial, entry);   
-        }
-        coins.push_back(entry);
-    }
+    sigma::CSigmaState* sigmaState = sigma::CSigmaState::GetState();
 
-    std::set<COutPoint> lockedCoins = setLockedCoins;
+    // Sizes of the coin groups our mints are in, each one is only looked up once
+    std::map<std::pair<sigma::CoinDenomination, int>, int> groupSizes;
 
     // Filter out coins which are not confirmed, I.E. do not have at least 6 blocks
     // above them, after they were minted.
     // Also filter out used coins.
     // Finally filter out coins that have not been selected from CoinControl should that be used
-    coins.remove_if([lockedCoins, coinControl, includeUnsafe](const CSigmaEntry& coin) {
-        sigma::CSigmaState* sigmaState = sigma::CSigmaState::GetState();
-        if (coin.IsUsed)
-            return true;
+    // All of this only needs the metadata, so the coins are only read for the mints that pass
+    for (const CMintMeta& mint : vecMints) {
+        if (mint.isUsed)
+            continue;
 
         int coinHeight, coinId;
         std::tie(coinHeight, coinId) =  sigmaState->GetMintedCoinHeightAndId(
-            sigma::PublicCoin(coin.value, coin.get_denomination()));
+            sigma::PublicCoin(mint.GetPubCoinValue(), mint.denom));
 
-        // Check group size
-        uint256 hashOut;
-        std::vector<sigma::PublicCoin> coinOuts;
-        sigmaState->GetCoinSetForSpend(
-            &chainActive,
-            chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
-            coin.get_denomination(),
-            coinId,
-            hashOut,
-            coinOuts
-        );
+        if (coinHeight == -1) {
+            // Coin still in the mempool.
+            continue;
+        }
 
-        if (!includeUnsafe && coinOuts.size() < 2) {
-            return true;
+        // Check group size
+        auto group = std::make_pair(mint.denom, coinId);
+        auto groupSize = groupSizes.find(group);
+        if (groupSize == groupSizes.end()) {
+            groupSize = groupSizes.emplace(group, sigmaState->GetCoinGroupSize(
+                mint.denom,
+                coinId,
+                chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1) // required 6 confirmation for mint to spend
+            )).first;
         }
 
-        if (coinHeight == -1) {
-            // Coin still in the mempool.
-            return true;
+        if (!includeUnsafe && groupSize->second < 2) {
+            continue;
         }
 
         if (coinHeight + (ZC_MINT_CONFIRMATIONS - 1) > chainActive.Height()) {
             // Remove the coin from the candidates list, since it does not have the
             // required number of confirmations.
-            return true;
+            continue;
         }
 
-        COutPoint outPoint;
-        sigma::PublicCoin pubCoin(coin.value, coin.get_denomination());
-        sigma::GetOutPoint(outPoint, pubCoin);
+        COutPoint outPoint = mint.outPoint;
+        if (outPoint.IsNull()) {
+            sigma::PublicCoin pubCoin(mint.GetPubCoinValue(), mint.denom);
+            if (sigma::GetOutPoint(outPoint, pubCoin))
+                zwalletMain->GetTracker().SetMintOutPoint(mint.hashSerial, outPoint);
+        }
 
-        if(lockedCoins.count(outPoint) > 0){
-            return true;
+        if(setLockedCoins.count(outPoint) > 0){
+            continue;
         }
 
         if(coinControl != NULL){
             if(coinControl->HasSelected()){
                 if(!coinControl->IsSelected(outPoint)){
-                    return true;
+                    continue;
                 }
             }
         }
 
-        return false;
-    });
+        CSigmaEntry entry;
+        if(fDummy){
+            /* If we just want to create the spend tx without signing (eg. to get fee before entering password),
+             * we fill in the available unencrypted details from the metadata. Dummy spends are never proven,
+             * so the encrypted ones are left empty.
+             */
+            entry.value = mint.GetPubCoinValue();
+            entry.set_denomination(mint.denom);
+            entry.IsUsed = mint.isUsed;
+            entry.nHeight = mint.nHeight;
+            entry.id = mint.nId;
+        }else{
+            GetMint(mint.hashSerial, entry);
+        }
+        coins.push_back(entry);
+    }
 
     return coins;
 }
@@ -2909,6 +2915,51 @@ bool CWallet::GetCoinsToSpend(
     };
     coins.sort(comparer);
 
+    // If coinControl, want to use all inputs
+    if (coinControl != NULL && coinControl->HasSelected()) {
+        std::vector<sigma::CoinDenomination> denominations;
+        sigma::GetAllDenoms(denominations);
+
+        CAmount best_spend_val = availableBalance;
+
+        if (SelectMintCoinsForAmount(best_spend_val - roundedRequired * zeros, denominations, coinsToMint_out) != best_spend_val - roundedRequired * zeros) {
+            throw std::runtime_error(
+                _("Problem with coin selection for re-mint while spending."));
+        }
+        if (SelectSpendCoinsForAmount(best_spend_val, coins, coinsToSpend_out) != best_spend_val) {
+            throw std::runtime_error(
+                _("Problem with coin selection for spend."));
+        }
+
+        return true;
+    }
+
+    SelectSpendCoinsAndChange(roundedRequired * zeros, coins, coinsToSpendLimit, amountToSpendLimit, coinsToSpend_out, coinsToMint_out);
+
+    return true;
+}
+
+/** \brief coinsIn has to be sorted in descending order of denomination, and by height within a denomination.
+ *
+ *  Picks the coins to spend and the denominations to re-mint as change for a spend of required, which has
+ *  to be a multiple of 0.05, so that as few coins as possible are spent and re-minted.
+ *
+ *  There are only a handful of denominations, so this is a bounded knapsack over the number of coins of
+ *  each denomination, which takes O(denominations * amount) instead of O(coins * amount) time. The
+ *  concrete coins are then taken oldest first within each denomination.
+ */
+void CWallet::SelectSpendCoinsAndChange(
+        const CAmount& required,
+        const std::list<CSigmaEntry>& coinsIn,
+        const size_t coinsToSpendLimit,
+        const CAmount amountToSpendLimit,
+        std::vector<CSigmaEntry>& coinsToSpend_out,
+        std::vector<sigma::CoinDenomination>& coinsToMint_out)
+{
+    // Amounts below are counted in units of the smallest denomination, 0.05
+    constexpr CAmount zeros(5000000);
+    const uint32_t unreachable = (INT_MAX - 1) / 2;
+
     std::vector<sigma::CoinDenomination> denominations;
     sigma::GetAllDenoms(denominations);
 
@@ -2918,77 +2969,99 @@ bool CWallet::GetCoinsToSpend(
         throw runtime_error("Unknown sigma denomination.\n");
     }
 
-    int val = roundedRequired + max_coin_value / zeros;
+    int roundedRequired = required / zeros;
 
     // val represent max value in range that we will search which may be over limit.
     // then we trim it out because we never use it.
-    val = std::min(val, limitVal);
-
-    // We need only last 2 rows of matrix of knapsack algorithm.
-    std::vector<uint64_t> prev_row;
-    prev_row.resize(val + 1);
-
-    std::vector<uint64_t> next_row(val + 1, (INT_MAX - 1) / 2);
-
-    auto coinIt = coins.rbegin();
-    next_row[0] = 0;
-    next_row[coinIt->get_denomination_value() / zeros] = 1;
-    ++coinIt;
-
-    for (; coinIt != coins.rend(); coinIt++) {
-        std::swap(prev_row, next_row);
-        CAmount denom_i = coinIt->get_denomination_value() / zeros;
-        for (int j = 1; j <= val; j++) {
-            next_row[j] = prev_row[j];
-            if (j >= denom_i &&  next_row[j] > prev_row[j - denom_i] + 1) {
-                    next_row[j] = prev_row[j - denom_i] + 1;
+    int val = std::min<CAmount>(roundedRequired + max_coin_value / zeros, amountToSpendLimit / zeros);
+
+    // Coins of each denomination, oldest first
+    std::vector<std::vector<const CSigmaEntry*>> groups(denominations.size());
+    std::vector<int> units(denominations.size());
+    for (std::size_t k = 0; k < denominations.size(); k++) {
+        CAmount denom;
+        DenominationToInteger(denominations[k], denom);
+        units[k] = denom / zeros;
+    }
+    for (const CSigmaEntry& coin : coinsIn) {
+        if (coin.IsUsed)
+            continue;
+        auto it = std::find(denominations.begin(), denominations.end(), coin.get_denomination());
+        if (it == denominations.end())
+            throw runtime_error("Unknown sigma denomination.\n");
+        groups[it - denominations.begin()].push_back(&coin);
+    }
+
+    // best[k][j] is the fewest coins of the first k denominations which are worth exactly j
+    std::vector<std::vector<uint32_t>> best(denominations.size() + 1, std::vector<uint32_t>(val + 1, unreachable));
+    best[0][0] = 0;
+
+    for (std::size_t k = 0; k < denominations.size(); k++) {
+        const std::vector<uint32_t>& prev = best[k];
+        std::vector<uint32_t>& next = best[k + 1];
+        const int d = units[k];
+        const int count = groups[k].size();
+
+        // best[k + 1][j] = min over t <= count of best[k][j - t * d] + t. Along each residue class
+        // modulo d that is a sliding window minimum of best[k][r + i * d] - i, kept in a monotonic deque.
+        std::deque<std::pair<int, int64_t>> window;
+        for (int r = 0; r < d && r <= val; r++) {
+            window.clear();
+            for (int i = 0, j = r; j <= val; i++, j += d) {
+                if (prev[j] != unreachable) {
+                    int64_t key = int64_t(prev[j]) - i;
+                    while (!window.empty() && window.back().second >= key)
+                        window.pop_back();
+                    window.emplace_back(i, key);
+                }
+                while (!window.empty() && window.front().first < i - count)
+                    window.pop_front();
+                if (!window.empty())
+                    next[j] = window.front().second + i;
             }
         }
     }
 
-    int index = val;
-    uint64_t best_spend_val = 0;
+    const std::vector<uint32_t>& spendCount = best.back();
 
-    // If coinControl, want to use all inputs
-    bool coinControlUsed = false;
-    if(coinControl != NULL){
-        if(coinControl->HasSelected()){
-            auto coinIt = coins.rbegin();
-            for (; coinIt != coins.rend(); coinIt++) {
-                best_spend_val += coinIt->get_denomination_value();
-            }
-            coinControlUsed = true;
-        }
-    }
-    if(!coinControlUsed) {
-        best_spend_val = val;
-        int minimum = INT_MAX - 1;
-        while(index >= roundedRequired) {
-            int temp_min = next_row[index] + GetRequiredCoinCountForAmount(
-                (index - roundedRequired) * zeros, denominations);
-            if (minimum > temp_min && next_row[index] != (INT_MAX - 1) / 2 && next_row[index] <= coinsToSpendLimit) {
-                best_spend_val = index;
-                minimum = temp_min;
-            }
-            --index;
+    int index = val;
+    int best_spend_val = 0;
+    int minimum = INT_MAX - 1;
+    while (index >= roundedRequired) {
+        int temp_min = spendCount[index] + GetRequiredCoinCountForAmount(
+            (index - roundedRequired) * zeros, denominations);
+        if (minimum > temp_min && spendCount[index] != unreachable && spendCount[index] <= coinsToSpendLimit) {
+            best_spend_val = index;
+            minimum = temp_min;
         }
-        best_spend_val *= zeros;
-
-        if (minimum == INT_MAX - 1)
-            throw std::runtime_error(
-                _("Can not choose coins within limit."));
+        --index;
     }
 
-    if (SelectMintCoinsForAmount(best_spend_val - roundedRequired * zeros, denominations, coinsToMint_out) != best_spend_val - roundedRequired * zeros) {
+    if (minimum == INT_MAX - 1)
         throw std::runtime_error(
-            _("Problem with coin selection for re-mint while spending."));
+            _("Can not choose coins within limit."));
+
+    // Walk back through the table to find how many coins of each denomination make up the spend
+    std::vector<int> taken(denominations.size(), 0);
+    for (int k = denominations.size() - 1, j = best_spend_val; k >= 0; k--) {
+        const int d = units[k];
+        int t = 0;
+        while (best[k][j - t * d] == unreachable || best[k][j - t * d] + t != best[k + 1][j])
+            t++;
+        taken[k] = t;
+        j -= t * d;
     }
-    if (SelectSpendCoinsForAmount(best_spend_val, coins, coinsToSpend_out) != best_spend_val) {
-        throw std::runtime_error(
-            _("Problem with coin selection for spend."));
+
+    for (std::size_t k = 0; k < denominations.size(); k++) {
+        for (int t = 0; t < taken[k]; t++)
+            coinsToSpend_out.push_back(*groups[k][t]);
     }
 
-    return true;
+    CAmount change = best_spend_val * zeros - required;
+    if (SelectMintCoinsForAmount(change, denominations, coinsToMint_out) != change) {
+        throw std::runtime_error(
+            _("Problem with coin selection for re-mint while spending."));
+    }
 }
 
 CAmount CWallet::GetUnconfirmedBalance() const {
@@ -8979,7 +9052,7 @@ int CMerkleTx::SetMerkleBranch(const CBlock &block) {
 
     // Locate the transaction
     for (nIndex = 0; nIndex < (int) block.vtx.size(); nIndex++)
-        if (block.vtx[nIndex] == *(CTransaction * )this)
+        if (*block.vtx[nIndex] == *(CTransaction * )this)
     break;
     if (nIndex == (int) block.vtx.size()) {
         nIndex = -1;
@@ -9085,21 +9158,7 @@ bool CMerkleTx::AcceptToMemoryPool(
         }
         return res;
     } else {
-        // Changes to mempool should also be made to Dandelion stempool
-        CValidationState dummyState;
-        ::AcceptToMemoryPool(
-            stempool,
-            dummyState,
-            *this,
-            fCheckInputs,
-            fLimitFree,
-            NULL, /* pfMissingInputs */
-            false, /* fOverrideMempoolLimit */
-            nAbsurdFee,
-            isCheckWalletTransaction,
-            false /* markZcoinSpendTransactionSerial */
-        );
-        return ::AcceptToMemoryPool(
+        bool res = ::AcceptToMemoryPool(
             mempool,
             state,
             *this,
@@ -9110,6 +9169,10 @@ bool CMerkleTx::AcceptToMemoryPool(
             nAbsurdFee,
             isCheckWalletTransaction,
             markZcoinSpendTransactionSerial);
+        // Changes to mempool should also be made to Dandelion stempool
+        if (res)
+            AddToStemPoolFromMempool(GetHash());
+        return res;
     }
 }
 
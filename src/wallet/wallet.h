@@ -909,6 +909,14 @@ public:
         const std::list<CSigmaEntry>& coinsIn,
         std::vector<CSigmaEntry>& coinsOut);
 
+    static void SelectSpendCoinsAndChange(
+        const CAmount& required,
+        const std::list<CSigmaEntry>& coinsIn,
+        const size_t coinsToSpendLimit,
+        const CAmount amountToSpendLimit,
+        std::vector<CSigmaEntry>& coinsToSpend_out,
+        std::vector<sigma::CoinDenomination>& coinsToMint_out);
+
     // Returns a list of unspent and verified coins, I.E. coins which are ready
     // to be spent.
     std::list<CSigmaEntry> GetAvailableCoins(const CCoinControl *coinControl = NULL, bool includeUnsafe = false, bool fDummy = false) const;
@@ -1212,6 +1220,12 @@ public:
     /** Watch-only address added */
     boost::signals2::signal<void (bool fHaveWatchOnly)> NotifyWatchonlyChanged;
 
+    /**
+     * Key, redeem script or watch-only script added, making address (partially) ours.
+     * @note called with lock cs_wallet held.
+     */
+    boost::signals2::signal<void (CWallet *wallet, const CTxDestination &address)> NotifyKeyAdded;
+
     /** Inquire whether this wallet broadcasts transactions. */
     bool GetBroadcastTransactions() const { return fBroadcastTransactions; }
     /** Set whether this wallet broadcasts transactions. */
@@ -11,7 +11,9 @@
 #include "indexnode-payments.h"
 #include "indexnode-sync.h"
 #include "sigma/remint.h"
+#include "hash.h"
 
+#include <algorithm>
 #include <atomic>
 #include <sstream>
 #include <chrono>
@@ -180,7 +182,7 @@ bool CheckRemintZcoinTransaction(const CTransaction &tx,
 
     libzerocoin::SpendMetaData metadata(remint.getCoinGroupId(), tempTx.GetHash());
 
-    if (!remint.Verify(metadata)) {
+    if (!(zerocoinTxInfo && zerocoinTxInfo->fSkipProofVerification) && !remint.Verify(metadata)) {
         LogPrintf("CheckRemintZcoinTransaction: remint input verification failure\n");
         return false;
     }
@@ -367,6 +369,10 @@ bool CheckSpendZcoinTransaction(const CTransaction &tx,
         if (!zerocoinState.GetCoinGroupInfo(targetDenominations[vinIndex], pubcoinId, coinGroup))
             return state.DoS(100, false, NO_MINT_ZEROCOIN, "CheckSpendZcoinTransaction: Error: no coins were minted with such parameters");
 
+        // The block is assumed valid, the serial has been checked and recorded above
+        if (zerocoinTxInfo && zerocoinTxInfo->fSkipProofVerification)
+            continue;
+
         bool passVerify = false;
         CBlockIndex *index = coinGroup.lastBlock;
 
@@ -1916,28 +1922,30 @@ bool CZerocoinState::CanAddSpendToMempool(const CBigNum &coinSerial) {
     return !IsUsedCoinSerial(coinSerial) && mempoolCoinSerials.count(coinSerial) == 0;
 }
 
-extern const char *sigmaRemintBlacklist[];
-std::unordered_set<CBigNum,CZerocoinState::CBigNumHash> CZerocoinState::sigmaRemintBlacklistSet;
+extern const unsigned char sigmaRemintBlacklist[][32];
+extern const size_t sigmaRemintBlacklistSize;
+std::set<uint256> CZerocoinState::sigmaRemintBlacklistExtra;
+
+uint256 CZerocoinState::GetPublicCoinValueDigest(const CBigNum &value) {
+    std::vector<unsigned char> bytes = value.ToBytes();
+    return Hash(bytes.begin(), bytes.end());
+}
 
 bool CZerocoinState::IsPublicCoinValueBlacklisted(const CBigNum &value) {
-    static bool blackListLoaded = false;
-
-    // Check against black list
-    if (!blackListLoaded) {
-        AssertLockHeld(cs_main);
-        // Initial build of the black list. Thread-safe as we are protected by cs_main
-        for (const char **blEntry = sigmaRemintBlacklist; *blEntry; blEntry++) {
-            CBigNum bn;
-            bn.SetHex(*blEntry);
-            sigmaRemintBlacklistSet.insert(bn);
-        }
-    }
+    uint256 digest = GetPublicCoinValueDigest(value);
+
+    const unsigned char (*first)[32] = sigmaRemintBlacklist;
+    const unsigned char (*last)[32] = sigmaRemintBlacklist + sigmaRemintBlacklistSize;
+    const unsigned char (*entry)[32] = std::lower_bound(first, last, digest,
+            [](const unsigned char (&a)[32], const uint256 &b) { return memcmp(a, b.begin(), 32) < 0; });
+    if (entry != last && memcmp(*entry, digest.begin(), 32) == 0)
+        return true;
 
-    return sigmaRemintBlacklistSet.count(value) > 0;
+    return sigmaRemintBlacklistExtra.count(digest) > 0;
 }
 
 void CZerocoinState::BlacklistPublicCoinValue(const CBigNum &value) {
-    sigmaRemintBlacklistSet.insert(value);
+    sigmaRemintBlacklistExtra.insert(GetPublicCoinValueDigest(value));
 }
 
 void CZerocoinState::Reset() {
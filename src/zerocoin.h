@@ -7,6 +7,7 @@
 #include "consensus/validation.h"
 #include "libzerocoin/Zerocoin.h"
 #include "zerocoin_params.h"
+#include <set>
 #include <unordered_set>
 #include <unordered_map>
 #include <functional>
@@ -40,7 +41,10 @@ public:
     // information about transactions in the block is complete
     bool fInfoIsComplete;
 
-    CZerocoinTxInfo(): fHasSpendV1(false), fInfoIsComplete(false) {}
+    // the block is assumed valid: spend proofs are not verified, serials are still checked and recorded
+    bool fSkipProofVerification;
+
+    CZerocoinTxInfo(): fHasSpendV1(false), fInfoIsComplete(false), fSkipProofVerification(false) {}
     // finalize everything
     void Complete();
 };
@@ -104,8 +108,8 @@ private:
     // Latest IDs of coins by denomination
     map<int, int> latestCoinIds;
 
-    // set of blacklisted public coin values
-    static std::unordered_set<CBigNum,CZerocoinState::CBigNumHash> sigmaRemintBlacklistSet;
+    // digests of public coin values added to the blacklist at runtime (see BlacklistPublicCoinValue)
+    static std::set<uint256> sigmaRemintBlacklistExtra;
 
 public:
     CZerocoinState();
@@ -173,9 +177,13 @@ public:
     // Remove spend from the mempool (usually as the result of adding tx to the block)
     void RemoveSpendFromMempool(const CBigNum &coinSerial);
 
-    // Is public coin value blacklisted?
+    // Is public coin value blacklisted? Looks up GetPublicCoinValueDigest(value) in the
+    // sorted table generated by contrib/devtools/gen-remint-blacklist.py
     static bool IsPublicCoinValueBlacklisted(const CBigNum &value);
 
+    // Digest of a public coin value as stored in the remint blacklist
+    static uint256 GetPublicCoinValueDigest(const CBigNum &value);
+
     // Manually add public coin value to the blacklist. Meant for testing purposes only
     static void BlacklistPublicCoinValue(const CBigNum &value);
 
@@ -17,7 +17,7 @@ CZMQAbstract::~CZMQAbstract()
     assert(!psocket);
 }
 
-bool CZMQAbstract::NotifyBlock(const CBlockIndex * /*CBlockIndex*/)
+bool CZMQAbstract::NotifyBlock(const CBlockIndex * /*CBlockIndex*/, const std::vector<CTransactionRef> * /*pvtx*/)
 {
     return true;
 }
@@ -53,7 +53,7 @@ public:
     virtual void Shutdown() = 0;
 
     /* virtual functions to be implemented by publisher (defined here to allow access by notifiers) */ 
-    virtual bool NotifyBlock(const CBlockIndex *pindex);
+    virtual bool NotifyBlock(const CBlockIndex *pindex, const std::vector<CTransactionRef> *pvtx);
     virtual bool NotifyTransaction(const CTransaction &transaction);
     virtual bool NotifyConnections();
     virtual bool NotifyStatus();
@@ -8,6 +8,7 @@
 
 #include "version.h"
 #include "chainparamsbase.h"
+#include "consensus/validation.h"
 #include "main.h"
 #include "streams.h"
 #include "util.h"
@@ -109,7 +110,7 @@ CZMQReplierInterface* CZMQReplierInterface::Create()
 }
 
 
-CZMQPublisherInterface::CZMQPublisherInterface()
+CZMQPublisherInterface::CZMQPublisherInterface() : fStopPublisher(false), publisher(NULL), pindexQueued(NULL)
 {
 }
 
@@ -122,6 +123,8 @@ bool CZMQPublisherInterface::StartWorker()
 
 CZMQPublisherInterface::~CZMQPublisherInterface()
 {
+    StopPublisher();
+
     Shutdown();
 
     for (std::list<CZMQAbstract*>::iterator i=notifiers.begin(); i!=notifiers.end(); ++i)
@@ -185,177 +188,168 @@ CZMQPublisherInterface* CZMQPublisherInterface::Create()
         delete notificationInterface;
         notificationInterface = NULL;
     }
+    else
+    {
+        notificationInterface->publisher = new boost::thread(boost::bind(&CZMQPublisherInterface::ThreadPublish, notificationInterface));
+    }
 
     LogPrintf("returning notificationInterface\n");
     return notificationInterface;
 }
 
-void CZMQPublisherInterface::UpdateSyncStatus()
+void CZMQPublisherInterface::StopPublisher()
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
+    if (!publisher)
+        return;
+
     {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyStatus())
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
+        boost::unique_lock<boost::mutex> lock(cs_queue);
+        fStopPublisher = true;
     }
+    condQueue.notify_all();
+    publisher->join();
+    delete publisher;
+    publisher = NULL;
 }
 
-void CZMQPublisherInterface::NotifyAPIStatus()
+void CZMQPublisherInterface::Enqueue(const std::string& key, std::function<bool (CZMQAbstract*)> notify)
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
     {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyAPIStatus())
-        {
-            i++;
-        }
-        else
+        boost::unique_lock<boost::mutex> lock(cs_queue);
+        if (!key.empty() && !setQueued.insert(key).second)
+            return;
+
+        if (queue.size() >= MAX_QUEUE_SIZE)
         {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
+            LogPrint("zmq", "zmq: Publisher queue full, dropping event\n");
+            if (!queue.front().first.empty())
+                setQueued.erase(queue.front().first);
+            queue.pop_front();
         }
+        queue.emplace_back(key, std::move(notify));
     }
+    condQueue.notify_one();
 }
 
-void CZMQPublisherInterface::NotifyIndexnodeList()
+void CZMQPublisherInterface::ThreadPublish()
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
+    RenameThread("bitcoin-zmqpub");
+
+    while (true)
     {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyIndexnodeList())
+        std::function<bool (CZMQAbstract*)> notify;
         {
-            i++;
+            boost::unique_lock<boost::mutex> lock(cs_queue);
+            while (!fStopPublisher && queue.empty())
+                condQueue.wait(lock);
+            if (fStopPublisher)
+                return;
+
+            // a repeated event arriving from now on has to publish again
+            setQueued.erase(queue.front().first);
+            notify = std::move(queue.front().second);
+            queue.pop_front();
         }
-        else
+
+        for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
         {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
+            CZMQAbstract *notifier = *i;
+            bool fSuccess = false;
+            try {
+                fSuccess = notify(notifier);
+            } catch (const UniValue& objError) {
+                LogPrint("zmq", "zmq: %s failed to publish: %s\n", notifier->GetType(), objError.write());
+                fSuccess = true;
+            } catch (const std::exception& e) {
+                LogPrint("zmq", "zmq: %s failed to publish: %s\n", notifier->GetType(), e.what());
+                fSuccess = true;
+            }
+
+            if (fSuccess)
+            {
+                i++;
+            }
+            else
+            {
+                notifier->Shutdown();
+                i = notifiers.erase(i);
+            }
         }
     }
 }
 
+void CZMQPublisherInterface::UpdateSyncStatus()
+{
+    Enqueue("status", [](CZMQAbstract* notifier) { return notifier->NotifyStatus(); });
+}
+
+void CZMQPublisherInterface::NotifyAPIStatus()
+{
+    Enqueue("apistatus", [](CZMQAbstract* notifier) { return notifier->NotifyAPIStatus(); });
+}
+
+void CZMQPublisherInterface::NotifyIndexnodeList()
+{
+    Enqueue("indexnodelist", [](CZMQAbstract* notifier) { return notifier->NotifyIndexnodeList(); });
+}
+
 void CZMQPublisherInterface::NumConnectionsChanged()
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
-    {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyConnections())
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
-    }
+    Enqueue("connections", [](CZMQAbstract* notifier) { return notifier->NotifyConnections(); });
+}
+
+void CZMQPublisherInterface::BlockChecked(const CBlock& block, const CValidationState& state)
+{
+    if (!state.IsValid())
+        return;
+
+    // called right before the block is connected, keep its transactions for UpdatedBlockTip
+    boost::unique_lock<boost::mutex> lock(cs_queue);
+    hashCheckedBlock = block.GetHash();
+    vtxCheckedBlock = std::make_shared<const std::vector<CTransactionRef>>(block.vtx);
 }
 
 void CZMQPublisherInterface::UpdatedBlockTip(const CBlockIndex *pindex)
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
+    std::shared_ptr<const std::vector<CTransactionRef>> vtx;
     {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyBlock(pindex))
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
+        boost::unique_lock<boost::mutex> lock(cs_queue);
+        // the tip is announced again once the chain is activated
+        if (pindex == pindexQueued)
+            return;
+        pindexQueued = pindex;
+
+        if (vtxCheckedBlock && hashCheckedBlock == pindex->GetBlockHash())
+            vtx = vtxCheckedBlock;
+        vtxCheckedBlock.reset();
     }
+
+    Enqueue("", [pindex, vtx](CZMQAbstract* notifier) { return notifier->NotifyBlock(pindex, vtx.get()); });
+    UpdatedBalance();
 }
 
 void CZMQPublisherInterface::WalletTransaction(const CTransaction& tx)
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
-    {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyTransaction(tx))
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
-    }
+    Enqueue("", [tx](CZMQAbstract* notifier) { return notifier->NotifyTransaction(tx); });
+    UpdatedBalance();
 }
 
 void CZMQPublisherInterface::UpdatedIndexnode(CIndexnode &indexnode)
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
-    {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyIndexnodeUpdate(indexnode))
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
-    }
+    Enqueue("", [indexnode](CZMQAbstract* notifier) mutable { return notifier->NotifyIndexnodeUpdate(indexnode); });
 }
 
 void CZMQPublisherInterface::UpdatedMintStatus(std::string update)
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
-    {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyMintStatusUpdate(update))
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
-    }
+    Enqueue("", [update](CZMQAbstract* notifier) { return notifier->NotifyMintStatusUpdate(update); });
 }
 
 void CZMQPublisherInterface::UpdatedSettings(std::string update)
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
-    {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifySettingsUpdate(update))
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
-    }
+    Enqueue("", [update](CZMQAbstract* notifier) { return notifier->NotifySettingsUpdate(update); });
 }
 
 void CZMQPublisherInterface::UpdatedBalance()
 {
-    for (std::list<CZMQAbstract*>::iterator i = notifiers.begin(); i!=notifiers.end(); )
-    {
-        CZMQAbstract *notifier = *i;
-        if (notifier->NotifyBalance())
-        {
-            i++;
-        }
-        else
-        {
-            notifier->Shutdown();
-            i = notifiers.erase(i);
-        }
-    }
+    Enqueue("balance", [](CZMQAbstract* notifier) { return notifier->NotifyBalance(); });
 }
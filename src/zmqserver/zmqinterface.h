@@ -6,8 +6,18 @@
 #define ZCOIN_ZMQ_ZMQNOTIFICATIONINTERFACE_H
 
 #include "validationinterface.h"
+#include "primitives/transaction.h"
+#include "uint256.h"
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <set>
 #include <string>
 #include <map>
+#include <vector>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
 
 class CBlockIndex;
@@ -25,9 +35,16 @@ protected:
 };
 
 
+/* Validation callbacks only queue events; publishing (running the API
+   method and sending the reply) happens on a dedicated thread, so that
+   subscribers never hold up block connection. Events which publish current
+   state (balance, status, ...) are queued at most once. */
 class CZMQPublisherInterface : public CValidationInterface, CZMQInterface
 {
 public:
+    //! Events beyond this are dropped, oldest first
+    static const size_t MAX_QUEUE_SIZE = 1000;
+
     CZMQPublisherInterface();
     bool StartWorker();
     virtual ~CZMQPublisherInterface();
@@ -37,6 +54,7 @@ protected:
     // CValidationInterface
     void WalletTransaction(const CTransaction& tx);
     void UpdatedBlockTip(const CBlockIndex *pindex);
+    void BlockChecked(const CBlock& block, const CValidationState& state);
     void NumConnectionsChanged();
     void UpdateSyncStatus();
     void NotifyIndexnodeList();
@@ -45,7 +63,26 @@ protected:
     void UpdatedMintStatus(std::string update);
     void UpdatedSettings(std::string update);
     void UpdatedBalance();
-    
+
+private:
+    /* Queue a call to every notifier. A non-empty key is not queued again
+       while an event with the same key is waiting. */
+    void Enqueue(const std::string& key, std::function<bool (CZMQAbstract*)> notify);
+    void ThreadPublish();
+    void StopPublisher();
+
+    boost::mutex cs_queue;
+    boost::condition_variable condQueue;
+    std::deque<std::pair<std::string, std::function<bool (CZMQAbstract*)>>> queue;
+    std::set<std::string> setQueued;
+    bool fStopPublisher;
+    boost::thread* publisher;
+
+    //! Transactions of the block last connected, passed on to the block notifiers
+    uint256 hashCheckedBlock;
+    std::shared_ptr<const std::vector<CTransactionRef>> vtxCheckedBlock;
+    //! Tip of the last queued block event
+    const CBlockIndex *pindexQueued;
 };
 
 class CZMQReplierInterface : public CZMQInterface
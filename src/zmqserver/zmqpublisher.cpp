@@ -236,15 +236,19 @@ bool CZMQTransactionEvent::NotifyTransaction(const CTransaction &transaction)
     return true;
 }
 
-bool CZMQBlockEvent::NotifyBlock(const CBlockIndex *pindex){
+bool CZMQBlockEvent::NotifyBlock(const CBlockIndex *pindex, const std::vector<CTransactionRef> *pvtx){
     // We always publish on an update to wallet tx's
     if(topic=="address"){
+        // only read the block if it was not passed through from validation
         CBlock block;
-        if(!ReadBlockFromDisk(block, pindex, Params().GetConsensus())){
-            throw JSONAPIError(API_INVALID_PARAMETER, "Invalid, missing or duplicate parameter");
+        if(!pvtx){
+            if(!ReadBlockFromDisk(block, pindex, Params().GetConsensus())){
+                throw JSONAPIError(API_INVALID_PARAMETER, "Invalid, missing or duplicate parameter");
+            }
+            pvtx = &block.vtx;
         }
-        BOOST_FOREACH(const CTransaction&tx, block.vtx)
-        {
+        for (const CTransactionRef& ptx : *pvtx) {
+            const CTransaction& tx = *ptx;
             const CWalletTx *wtx = pwalletMain->GetWalletTx(tx.GetHash());
             if(wtx){
                 request.replace("data", pindex->ToJSON());
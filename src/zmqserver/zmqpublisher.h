@@ -53,10 +53,11 @@ public:
    virtual to allow multiple inheritence by topic classes */
 class CZMQBlockEvent : virtual public CZMQAbstractPublisher
 {
-    /* Data related to a new block (updatedblocktip)
+    /* Data related to a new block (updatedblocktip). pvtx holds the transactions
+       of the block if they were passed through, and is NULL otherwise.
     */
 public:
-    bool NotifyBlock(const CBlockIndex *pindex);
+    bool NotifyBlock(const CBlockIndex *pindex, const std::vector<CTransactionRef> *pvtx);
 };
 
 
@@ -151,10 +152,9 @@ public:
     void SetMethod(){ method= "blockchain";}
 };
 
-class CZMQBalanceTopic : public CZMQBlockEvent, 
-                         public CZMQTransactionEvent,
-                         public CZMQBalanceEvent
-                         
+/* Blocks and wallet transactions are turned into balance events by the
+   publisher interface, so that a burst of them is published only once. */
+class CZMQBalanceTopic : public CZMQBalanceEvent
 {
 public:
     void SetTopic(){ topic = "balance";}